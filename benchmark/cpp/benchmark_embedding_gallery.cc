@@ -0,0 +1,105 @@
+// Copyright (c) 2023 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fastdeploy/utils/perf.h"
+#include "fastdeploy/vision.h"
+#include "gflags/gflags.h"
+
+namespace vision = fastdeploy::vision;
+
+DEFINE_int32(dim, 512,
+             "Optional, dimension of the embeddings, 512 is the embedding "
+             "size of the faceid models.");
+DEFINE_int32(num_queries, 16, "Optional, number of queries in a batch.");
+
+static std::vector<float> RandomEmbeddings(int num, int dim, int seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> value(0.0f, 1.0f);
+  std::vector<float> embeddings(static_cast<size_t>(num) * dim);
+  for (auto& v : embeddings) {
+    v = value(rng);
+  }
+  return embeddings;
+}
+
+int main(int argc, char* argv[]) {
+#if defined(ENABLE_VISION)
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  const int dim = FLAGS_dim;
+  const int num_queries = FLAGS_num_queries;
+  const int batch = 10000;
+  std::vector<float> queries = RandomEmbeddings(num_queries, dim, 1);
+  // The FP32 gallery of 1M identities takes 2GB with dim 512, so only INT8
+  // is benchmarked at 1M
+  std::vector<std::pair<int, vision::utils::GalleryPrecision>> settings = {
+      {100000, vision::utils::GalleryPrecision::FP32},
+      {100000, vision::utils::GalleryPrecision::FP16},
+      {100000, vision::utils::GalleryPrecision::INT8},
+      {1000000, vision::utils::GalleryPrecision::INT8}};
+  for (const auto& setting : settings) {
+    int num = setting.first;
+    vision::utils::EmbeddingGallery gallery(dim, setting.second);
+    std::vector<float> embeddings;
+    for (int begin = 0; begin < num; begin += batch) {
+      embeddings = RandomEmbeddings(batch, dim, begin);
+      std::vector<int64_t> ids(batch);
+      for (int i = 0; i < batch; ++i) {
+        ids[i] = begin + i;
+      }
+      if (!gallery.Add(ids, embeddings)) {
+        return -1;
+      }
+    }
+    // The queries are close to the last added embeddings
+    std::vector<float> targets(queries);
+    for (int i = 0; i < num_queries * dim; ++i) {
+      targets[i] = embeddings[i] + 0.5f * queries[i];
+    }
+
+    std::vector<int64_t> ids;
+    std::vector<float> scores;
+    std::string name = std::to_string(num) + " identities precision " +
+                       std::to_string(static_cast<int>(setting.second));
+    fastdeploy::TimeCounter tc;
+    tc.Start();
+    if (!gallery.Search(
+            std::vector<float>(targets.begin(), targets.begin() + dim), 10,
+            &ids, &scores)) {
+      return -1;
+    }
+    tc.End();
+    tc.PrintInfo("Search 1 query in " + name);
+
+    tc.Start();
+    if (!gallery.Search(targets, 10, &ids, &scores)) {
+      return -1;
+    }
+    tc.End();
+    tc.PrintInfo("Search " + std::to_string(num_queries) + " queries in " +
+                 name);
+    int hits = 0;
+    for (int q = 0; q < num_queries; ++q) {
+      hits += ids[q * 10] == num - batch + q;
+    }
+    std::cout << "Top 1 hits of " << name << ": " << hits << "/"
+              << num_queries << std::endl;
+  }
+#endif
+  return 0;
+}
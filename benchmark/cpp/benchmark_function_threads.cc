@@ -0,0 +1,90 @@
+// Copyright (c) 2023 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fastdeploy/core/fd_tensor.h"
+#include "fastdeploy/function/elementwise.h"
+#include "fastdeploy/function/reduce.h"
+#include "fastdeploy/function/softmax.h"
+#include "fastdeploy/function/threads.h"
+#include "fastdeploy/function/transpose.h"
+#include "fastdeploy/utils/perf.h"
+#include "gflags/gflags.h"
+
+namespace function = fastdeploy::function;
+
+DEFINE_int32(cpu_thread_nums, 4,
+             "Optional, number of threads to compare with 1 thread.");
+DEFINE_int32(repeat, 10, "Optional, number of repeats of each kernel.");
+
+// Print the average time of func with 1 thread and FLAGS_cpu_thread_nums
+static void BenchmarkKernel(const std::string& name,
+                            const std::function<void(fastdeploy::FDTensor*)>&
+                                func) {
+  for (int num_threads : {1, FLAGS_cpu_thread_nums}) {
+    function::SetNumThreads(num_threads);
+    fastdeploy::FDTensor output;
+    // Warmup
+    func(&output);
+    fastdeploy::TimeCounter tc;
+    tc.Start();
+    for (int i = 0; i < FLAGS_repeat; ++i) {
+      func(&output);
+    }
+    tc.End();
+    std::cout << name << " with " << num_threads
+              << " threads: " << tc.Duration() * 1000 / FLAGS_repeat << "ms"
+              << std::endl;
+  }
+  function::SetNumThreads(1);
+}
+
+int main(int argc, char* argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  // The segmentation logits of 19 classes
+  std::vector<int64_t> shape = {1, 19, 1024, 2048};
+  fastdeploy::FDTensor x;
+  x.Allocate(shape, fastdeploy::FDDataType::FP32);
+  float* data = reinterpret_cast<float*>(x.MutableData());
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(-5.0f, 5.0f);
+  for (int64_t i = 0; i < x.Numel(); ++i) {
+    data[i] = dist(rng);
+  }
+
+  BenchmarkKernel("Transpose 1x19x1024x2048",
+                  [&x](fastdeploy::FDTensor* out) {
+                    function::Transpose(x, out, {0, 2, 3, 1});
+                  });
+  BenchmarkKernel("ArgMax 1x19x1024x2048", [&x](fastdeploy::FDTensor* out) {
+    function::ArgMax(x, out, 1);
+  });
+  BenchmarkKernel("Max 1x19x1024x2048", [&x](fastdeploy::FDTensor* out) {
+    function::Max(x, out, {1});
+  });
+  BenchmarkKernel("Softmax 1x19x1024x2048", [&x](fastdeploy::FDTensor* out) {
+    function::Softmax(x, out, 1);
+  });
+  BenchmarkKernel("Add 1x19x1024x2048", [&x](fastdeploy::FDTensor* out) {
+    function::Add(x, x, out);
+  });
+  BenchmarkKernel("Sum 1x19x1024x2048", [&x](fastdeploy::FDTensor* out) {
+    function::Sum(x, out, {2, 3});
+  });
+  return 0;
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2023 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include "fastdeploy/utils/perf.h"
+#include "fastdeploy/vision.h"
+#include "gflags/gflags.h"
+
+namespace vision = fastdeploy::vision;
+
+DEFINE_int32(repeat, 20, "Optional, number of repeats of each path.");
+
+#if defined(ENABLE_VISION)
+// The multi-pass implementation before the fused kernel: split, convertTo
+// of each channel and extractChannel into the CHW result
+static void MultiPassNormalizeAndPermute(const cv::Mat& im,
+                                         const std::vector<float>& alpha,
+                                         const std::vector<float>& beta,
+                                         bool swap_rb, cv::Mat* res) {
+  std::vector<cv::Mat> split_im;
+  cv::split(im, split_im);
+  if (swap_rb) std::swap(split_im[0], split_im[2]);
+  for (int c = 0; c < im.channels(); c++) {
+    split_im[c].convertTo(split_im[c], CV_32FC1, alpha[c], beta[c]);
+  }
+  *res = cv::Mat(im.rows, im.cols, CV_32FC(im.channels()));
+  for (int i = 0; i < im.channels(); ++i) {
+    cv::extractChannel(split_im[i],
+                       cv::Mat(im.rows, im.cols, CV_32FC1,
+                               res->ptr() + i * im.rows * im.cols * 4),
+                       0);
+  }
+}
+
+static void PrintTime(const std::string& name, fastdeploy::TimeCounter* tc) {
+  std::cout << name << ": " << tc->Duration() * 1000 / FLAGS_repeat << "ms"
+            << std::endl;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+#if defined(ENABLE_VISION)
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+  std::vector<float> std = {0.229f, 0.224f, 0.225f};
+  std::vector<float> alpha, beta;
+  for (size_t i = 0; i < mean.size(); ++i) {
+    alpha.push_back(1.0f / 255.0f / std[i]);
+    beta.push_back(-mean[i] / std[i]);
+  }
+  vision::ConvertAndPermute convert_and_permute(alpha, beta, true);
+  for (int size : {224, 640, 1280}) {
+    cv::Mat im(size, size, CV_8UC3);
+    cv::randu(im, cv::Scalar::all(0), cv::Scalar::all(255));
+    std::string tag = std::to_string(size) + "x" + std::to_string(size);
+
+    fastdeploy::TimeCounter tc;
+    cv::Mat res;
+    tc.Start();
+    for (int i = 0; i < FLAGS_repeat; ++i) {
+      MultiPassNormalizeAndPermute(im, alpha, beta, true, &res);
+    }
+    tc.End();
+    PrintTime("Multi-pass OpenCV NormalizeAndPermute " + tag, &tc);
+
+    // Wrap the images before timing, so only the processor is timed
+    std::vector<vision::FDMat> mats(FLAGS_repeat, vision::WrapMat(im));
+    tc.Start();
+    for (int i = 0; i < FLAGS_repeat; ++i) {
+      convert_and_permute(&mats[i], vision::ProcLib::OPENCV);
+    }
+    tc.End();
+    PrintTime("Fused NormalizeAndPermute " + tag, &tc);
+
+#ifdef ENABLE_FLYCV
+    std::vector<vision::FDMat> flycv_mats(FLAGS_repeat, vision::WrapMat(im));
+    for (auto& flycv_mat : flycv_mats) {
+      // Convert to fcv::Mat before timing
+      flycv_mat.GetFlyCVMat();
+    }
+    tc.Start();
+    for (int i = 0; i < FLAGS_repeat; ++i) {
+      convert_and_permute(&flycv_mats[i], vision::ProcLib::FLYCV);
+    }
+    tc.End();
+    PrintTime("FlyCV NormalizeAndPermute " + tag, &tc);
+#endif
+  }
+#endif
+  return 0;
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2023 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fastdeploy/utils/perf.h"
+#include "fastdeploy/vision.h"
+#include "gflags/gflags.h"
+
+namespace vision = fastdeploy::vision;
+
+DEFINE_int32(num_classes, 80, "Optional, number of classes of the boxes.");
+DEFINE_int32(repeat, 10, "Optional, number of repeats of each NMS.");
+
+#if defined(ENABLE_VISION)
+static vision::DetectionResult RandomDetectionResult(int num,
+                                                     int num_classes) {
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> coord(0.0f, 1000.0f);
+  std::uniform_real_distribution<float> size(10.0f, 200.0f);
+  std::uniform_real_distribution<float> score(0.0f, 1.0f);
+  std::uniform_int_distribution<int> label(0, num_classes - 1);
+  vision::DetectionResult result;
+  result.Reserve(num);
+  for (int i = 0; i < num; ++i) {
+    float x = coord(rng);
+    float y = coord(rng);
+    result.boxes.emplace_back(
+        std::array<float, 4>{x, y, x + size(rng), y + size(rng)});
+    result.scores.push_back(score(rng));
+    result.label_ids.push_back(label(rng));
+  }
+  return result;
+}
+
+// Time func on a copy of result in each repeat, the copies are made before
+// timing
+static void BenchmarkNMS(
+    const std::string& name, const vision::DetectionResult& result,
+    const std::function<void(vision::DetectionResult*)>& func) {
+  std::vector<vision::DetectionResult> copies(FLAGS_repeat, result);
+  fastdeploy::TimeCounter tc;
+  tc.Start();
+  for (auto& copy : copies) {
+    func(&copy);
+  }
+  tc.End();
+  std::cout << name << ": " << tc.Duration() * 1000 / FLAGS_repeat << "ms"
+            << std::endl;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+#if defined(ENABLE_VISION)
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  for (int num : {1000, 10000, 50000}) {
+    vision::DetectionResult result =
+        RandomDetectionResult(num, FLAGS_num_classes);
+    std::string tag = std::to_string(num) + " boxes";
+    BenchmarkNMS("NMS " + tag, result, [](vision::DetectionResult* res) {
+      vision::utils::NMS(res, 0.45);
+    });
+    BenchmarkNMS("Class aware NMS " + tag, result,
+                 [](vision::DetectionResult* res) {
+                   vision::utils::NMS(res, 0.45, -1, true);
+                 });
+    // The way of the YOLO postprocessors before the class aware mode, the
+    // boxes are offset by label_id * max_wh around the NMS
+    BenchmarkNMS("Offset class aware NMS " + tag, result,
+                 [](vision::DetectionResult* res) {
+                   const float max_wh = 7680.0f;
+                   for (size_t i = 0; i < res->boxes.size(); ++i) {
+                     float offset = res->label_ids[i] * max_wh;
+                     for (int j = 0; j < 4; ++j) {
+                       res->boxes[i][j] += offset;
+                     }
+                   }
+                   vision::utils::NMS(res, 0.45);
+                   for (size_t i = 0; i < res->boxes.size(); ++i) {
+                     float offset = res->label_ids[i] * max_wh;
+                     for (int j = 0; j < 4; ++j) {
+                       res->boxes[i][j] -= offset;
+                     }
+                   }
+                 });
+  }
+#endif
+  return 0;
+}
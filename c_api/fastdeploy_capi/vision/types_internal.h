@@ -23,9 +23,9 @@
 #include "fastdeploy/vision/detection/contrib/yolov5/yolov5.h"
 #include "fastdeploy/vision/detection/contrib/yolov7/yolov7.h"
 #include "fastdeploy/vision/detection/contrib/yolov8/yolov8.h"
-#include "fastdeploy/vision/detection/contrib/yolor.h"
-#include "fastdeploy/vision/detection/contrib/yolox.h"
-#include "fastdeploy/vision/detection/contrib/yolov6.h"
+#include "fastdeploy/vision/detection/contrib/yolor/yolor.h"
+#include "fastdeploy/vision/detection/contrib/yolox/yolox.h"
+#include "fastdeploy/vision/detection/contrib/yolov6/yolov6.h"
 #include "fastdeploy/vision/ocr/ppocr/classifier.h"
 #include "fastdeploy/vision/ocr/ppocr/dbdetector.h"
 #include "fastdeploy/vision/ocr/ppocr/recognizer.h"
@@ -92,7 +92,7 @@ int main(int argc, char* argv[]) {
     std::cerr << "Failed to initialize." << std::endl;
     return -1;
   }
-  model.SetNumLandmarks(FLAGS_num_landmarks);
+  model.GetPostprocessor().SetNumLandmarks(FLAGS_num_landmarks);
   auto im = cv::imread(FLAGS_image);
   auto im_bak = im.clone();
 
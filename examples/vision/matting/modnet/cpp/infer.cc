@@ -21,7 +21,7 @@ void CpuInfer(const std::string& model_file, const std::string& image_file,
     std::cerr << "Failed to initialize." << std::endl;
     return;
   }
-  model.size = {256, 256};
+  model.GetPreprocessor().SetSize({256, 256});
   auto im = cv::imread(image_file);
   cv::Mat bg = cv::imread(background_file);
 
@@ -50,7 +50,7 @@ void GpuInfer(const std::string& model_file, const std::string& image_file,
     std::cerr << "Failed to initialize." << std::endl;
     return;
   }
-  model.size = {256, 256};
+  model.GetPreprocessor().SetSize({256, 256});
 
   auto im = cv::imread(image_file);
   cv::Mat bg = cv::imread(background_file);
@@ -82,7 +82,7 @@ void TrtInfer(const std::string& model_file, const std::string& image_file,
     std::cerr << "Failed to initialize." << std::endl;
     return;
   }
-  model.size = {256, 256};
+  model.GetPreprocessor().SetSize({256, 256});
   auto im = cv::imread(image_file);
   cv::Mat bg = cv::imread(background_file);
 
@@ -14,6 +14,15 @@
 #ifdef WITH_GPU
 #include <cuda_runtime_api.h>
 #endif
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 
 #include "fastdeploy/core/allocate.h"
 
@@ -26,6 +35,364 @@ bool FDHostAllocator::operator()(void** ptr, size_t size) const {
 
 void FDHostFree::operator()(void* ptr) const { free(ptr); }
 
+void* SystemHostAllocator::Allocate(size_t size) { return malloc(size); }
+
+void SystemHostAllocator::Free(void* ptr, size_t /* size */) { free(ptr); }
+
+namespace {
+
+constexpr size_t kMinClassBytes = 64;
+constexpr int kMinClassShift = 6;
+constexpr int kClassesPerPower = 4;
+constexpr size_t kHugePageBytes = 2 * 1024 * 1024;
+
+int FloorLog2(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63 - __builtin_clzll(x);
+#else
+  int n = 0;
+  while (x >>= 1) ++n;
+  return n;
+#endif
+}
+
+// Sizes are rounded up to 64 bytes, then to 4 classes between each power
+// of 2, e.g. 80, 96, 112, 128, 160, 192..., so at most 25% memory is wasted
+int SizeClassIndex(size_t size) {
+  if (size <= kMinClassBytes) return 0;
+  int p = FloorLog2(size - 1);
+  size_t step = static_cast<size_t>(1) << (p - 2);
+  size_t k = (size - 1 - (static_cast<size_t>(1) << p)) / step + 1;
+  return (p - kMinClassShift) * kClassesPerPower + static_cast<int>(k);
+}
+
+size_t SizeClassBytes(int index) {
+  if (index == 0) return kMinClassBytes;
+  int p = kMinClassShift + (index - 1) / kClassesPerPower;
+  size_t k = (index - 1) % kClassesPerPower + 1;
+  return (static_cast<size_t>(1) << p) + k * (static_cast<size_t>(1) << (p - 2));
+}
+
+void* AlignedAlloc(size_t size, size_t alignment, bool use_huge_page) {
+  void* ptr = nullptr;
+#ifdef _WIN32
+  ptr = _aligned_malloc(size, alignment);
+#else
+  if (use_huge_page && size >= kHugePageBytes) {
+    alignment = std::max(alignment, kHugePageBytes);
+  }
+  if (posix_memalign(&ptr, alignment, size) != 0) {
+    return nullptr;
+  }
+#ifdef MADV_HUGEPAGE
+  if (use_huge_page && size >= kHugePageBytes) {
+    madvise(ptr, size / kHugePageBytes * kHugePageBytes, MADV_HUGEPAGE);
+  }
+#endif
+#endif
+  return ptr;
+}
+
+void AlignedFree(void* ptr) {
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+// The free blocks cached by one thread for one pool, the lists are only
+// visited by the owner thread, while the counters may be read by
+// GetStatistics() from the other threads
+struct ThreadCache {
+  explicit ThreadCache(int num_classes) : lists(num_classes) {}
+  std::vector<std::vector<void*>> lists;
+  size_t cached_bytes = 0;
+  std::atomic<int64_t> hits{0};
+  std::atomic<int64_t> misses{0};
+  std::atomic<int64_t> bytes_held{0};
+  std::atomic<int64_t> bytes_in_use{0};
+};
+
+void AddRelaxed(std::atomic<int64_t>* counter, int64_t value) {
+  counter->store(counter->load(std::memory_order_relaxed) + value,
+                 std::memory_order_relaxed);
+}
+
+}  // namespace
+
+struct HostMemoryPoolState {
+  HostMemoryPoolOption option;
+  int num_classes = 0;
+  uint64_t id = 0;
+
+  std::mutex mutex;
+  std::vector<std::vector<void*>> lists;
+  size_t cached_bytes = 0;
+  std::vector<ThreadCache*> thread_caches;
+  // Counters of the exited threads and the allocations out of thread cache
+  HostMemoryPoolStatistics retired;
+
+  ~HostMemoryPoolState() {
+    for (auto& list : lists) {
+      for (void* ptr : list) {
+        AlignedFree(ptr);
+      }
+    }
+  }
+
+  void* SystemAllocate(size_t size) {
+    return AlignedAlloc(size, option.alignment, option.use_huge_page);
+  }
+
+  // Move the cached blocks of thread to the shared lists, the blocks exceed
+  // max_cached_bytes are released to system. Requires the lock
+  void FlushLocked(ThreadCache* cache, int index) {
+    size_t class_bytes = SizeClassBytes(index);
+    auto& list = cache->lists[index];
+    for (void* ptr : list) {
+      if (cached_bytes + class_bytes <= option.max_cached_bytes) {
+        lists[index].push_back(ptr);
+        cached_bytes += class_bytes;
+      } else {
+        AlignedFree(ptr);
+      }
+    }
+    cache->cached_bytes -= class_bytes * list.size();
+    AddRelaxed(&cache->bytes_held,
+               -static_cast<int64_t>(class_bytes * list.size()));
+    list.clear();
+  }
+
+  void Retire(ThreadCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < num_classes; ++i) {
+      FlushLocked(cache, i);
+    }
+    retired.hits += cache->hits.load(std::memory_order_relaxed);
+    retired.misses += cache->misses.load(std::memory_order_relaxed);
+    retired.bytes_in_use += cache->bytes_in_use.load(std::memory_order_relaxed);
+    thread_caches.erase(
+        std::remove(thread_caches.begin(), thread_caches.end(), cache),
+        thread_caches.end());
+  }
+};
+
+namespace {
+
+struct ThreadCacheEntry {
+  uint64_t id;
+  std::weak_ptr<HostMemoryPoolState> state;
+  std::unique_ptr<ThreadCache> cache;
+};
+
+void ReleaseThreadCacheEntry(ThreadCacheEntry* entry) {
+  if (auto state = entry->state.lock()) {
+    state->Retire(entry->cache.get());
+  } else {
+    // The pool is destroyed, nobody else could reuse the blocks
+    for (auto& list : entry->cache->lists) {
+      for (void* ptr : list) {
+        AlignedFree(ptr);
+      }
+    }
+  }
+}
+
+struct ThreadCacheRegistry {
+  std::vector<ThreadCacheEntry> entries;
+  ~ThreadCacheRegistry() {
+    for (auto& entry : entries) {
+      ReleaseThreadCacheEntry(&entry);
+    }
+  }
+};
+
+ThreadCache* GetThreadCache(const std::shared_ptr<HostMemoryPoolState>& state) {
+  thread_local ThreadCacheRegistry registry;
+  for (auto& entry : registry.entries) {
+    if (entry.id == state->id) {
+      return entry.cache.get();
+    }
+  }
+  // Drop the caches of the destroyed pools before adding a new one
+  for (auto iter = registry.entries.begin(); iter != registry.entries.end();) {
+    if (iter->state.expired()) {
+      ReleaseThreadCacheEntry(&(*iter));
+      iter = registry.entries.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  ThreadCacheEntry entry;
+  entry.id = state->id;
+  entry.state = state;
+  entry.cache.reset(new ThreadCache(state->num_classes));
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->thread_caches.push_back(entry.cache.get());
+  }
+  registry.entries.push_back(std::move(entry));
+  return registry.entries.back().cache.get();
+}
+
+}  // namespace
+
+HostMemoryPool::HostMemoryPool(const HostMemoryPoolOption& option) {
+  FDASSERT(option.alignment >= sizeof(void*) &&
+               (option.alignment & (option.alignment - 1)) == 0,
+           "HostMemoryPool: The alignment must be a power of 2 and not less "
+           "than %d, but now it's %d.",
+           static_cast<int>(sizeof(void*)), static_cast<int>(option.alignment));
+  static std::atomic<uint64_t> next_id(0);
+  state_ = std::make_shared<HostMemoryPoolState>();
+  state_->option = option;
+  state_->option.max_block_bytes =
+      std::max(option.max_block_bytes, kMinClassBytes);
+  state_->num_classes = SizeClassIndex(state_->option.max_block_bytes) + 1;
+  state_->id = next_id++;
+  state_->lists.resize(state_->num_classes);
+}
+
+HostMemoryPool::~HostMemoryPool() {}
+
+void* HostMemoryPool::Allocate(size_t size) {
+  HostMemoryPoolState* state = state_.get();
+  if (size > state->option.max_block_bytes) {
+    void* ptr = state->SystemAllocate(size);
+    if (ptr != nullptr) {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->retired.misses += 1;
+      state->retired.bytes_in_use += size;
+    }
+    return ptr;
+  }
+  int index = SizeClassIndex(size);
+  size_t class_bytes = SizeClassBytes(index);
+  ThreadCache* cache = GetThreadCache(state_);
+  void* ptr = nullptr;
+  auto& list = cache->lists[index];
+  if (!list.empty()) {
+    ptr = list.back();
+    list.pop_back();
+    cache->cached_bytes -= class_bytes;
+    AddRelaxed(&cache->bytes_held, -static_cast<int64_t>(class_bytes));
+  } else {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    auto& shared_list = state->lists[index];
+    if (!shared_list.empty()) {
+      ptr = shared_list.back();
+      shared_list.pop_back();
+      state->cached_bytes -= class_bytes;
+    }
+  }
+  if (ptr != nullptr) {
+    AddRelaxed(&cache->hits, 1);
+  } else {
+    ptr = state->SystemAllocate(class_bytes);
+    if (ptr == nullptr) {
+      return nullptr;
+    }
+    AddRelaxed(&cache->misses, 1);
+  }
+  AddRelaxed(&cache->bytes_in_use, class_bytes);
+  return ptr;
+}
+
+void HostMemoryPool::Free(void* ptr, size_t size) {
+  if (ptr == nullptr) {
+    return;
+  }
+  HostMemoryPoolState* state = state_.get();
+  if (size > state->option.max_block_bytes) {
+    AlignedFree(ptr);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->retired.bytes_in_use -= size;
+    return;
+  }
+  int index = SizeClassIndex(size);
+  size_t class_bytes = SizeClassBytes(index);
+  ThreadCache* cache = GetThreadCache(state_);
+  AddRelaxed(&cache->bytes_in_use, -static_cast<int64_t>(class_bytes));
+  cache->lists[index].push_back(ptr);
+  cache->cached_bytes += class_bytes;
+  AddRelaxed(&cache->bytes_held, class_bytes);
+  if (cache->cached_bytes > state->option.thread_cached_bytes) {
+    // Return this class firstly, which is the only class for the blocks
+    // larger than thread_cached_bytes, then the others from large to small
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->FlushLocked(cache, index);
+    for (int i = state->num_classes - 1;
+         i >= 0 && cache->cached_bytes > state->option.thread_cached_bytes / 2;
+         --i) {
+      state->FlushLocked(cache, i);
+    }
+  }
+}
+
+HostMemoryPoolStatistics HostMemoryPool::GetStatistics() const {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  HostMemoryPoolStatistics stat = state_->retired;
+  stat.bytes_held += state_->cached_bytes;
+  for (auto cache : state_->thread_caches) {
+    stat.hits += cache->hits.load(std::memory_order_relaxed);
+    stat.misses += cache->misses.load(std::memory_order_relaxed);
+    stat.bytes_held += cache->bytes_held.load(std::memory_order_relaxed);
+    stat.bytes_in_use += cache->bytes_in_use.load(std::memory_order_relaxed);
+  }
+  return stat;
+}
+
+void HostMemoryPool::Trim() {
+  ThreadCache* cache = GetThreadCache(state_);
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  for (int i = 0; i < state_->num_classes; ++i) {
+    state_->FlushLocked(cache, i);
+    for (void* ptr : state_->lists[i]) {
+      AlignedFree(ptr);
+    }
+    state_->lists[i].clear();
+  }
+  state_->cached_bytes = 0;
+}
+
+namespace {
+
+std::mutex& HostAllocatorMutex() {
+  static std::mutex* mutex = new std::mutex();
+  return *mutex;
+}
+
+// The allocators are never destroyed, since the tensors allocated by them
+// may be still alive after the allocator is replaced, or in the static
+// objects released at exit
+std::atomic<HostAllocator*>& CurrentHostAllocator() {
+  static std::atomic<HostAllocator*> allocator(GetDefaultHostMemoryPool());
+  return allocator;
+}
+
+}  // namespace
+
+HostMemoryPool* GetDefaultHostMemoryPool() {
+  static HostMemoryPool* pool = new HostMemoryPool();
+  return pool;
+}
+
+void SetHostAllocator(const std::shared_ptr<HostAllocator>& allocator) {
+  if (allocator == nullptr) {
+    CurrentHostAllocator().store(GetDefaultHostMemoryPool());
+    return;
+  }
+  static auto* keep_alive = new std::vector<std::shared_ptr<HostAllocator>>();
+  std::lock_guard<std::mutex> lock(HostAllocatorMutex());
+  keep_alive->push_back(allocator);
+  CurrentHostAllocator().store(allocator.get());
+}
+
+HostAllocator* GetHostAllocator() {
+  return CurrentHostAllocator().load(std::memory_order_acquire);
+}
+
 #ifdef WITH_GPU
 
 bool FDDeviceAllocator::operator()(void** ptr, size_t size) const {
@@ -33,6 +33,111 @@ class FASTDEPLOY_DECL FDHostFree {
   void operator()(void* ptr) const;
 };
 
+/*! @brief Interface of the allocator for the host memory of FDTensor
+ */
+class FASTDEPLOY_DECL HostAllocator {
+ public:
+  virtual ~HostAllocator() = default;
+  /** \brief Allocate a block of host memory
+   *
+   * \param[in] size The number of bytes to allocate
+   * \return The pointer of the memory block, nullptr if failed
+   */
+  virtual void* Allocate(size_t size) = 0;
+  /** \brief Release a block of host memory returned by Allocate()
+   *
+   * \param[in] ptr The pointer of the memory block
+   * \param[in] size The size passed to Allocate() for this block
+   */
+  virtual void Free(void* ptr, size_t size) = 0;
+};
+
+/*! @brief Host allocator which calls malloc/free directly
+ */
+class FASTDEPLOY_DECL SystemHostAllocator : public HostAllocator {
+ public:
+  void* Allocate(size_t size) override;
+  void Free(void* ptr, size_t size) override;
+};
+
+/*! @brief Option of HostMemoryPool
+ */
+struct FASTDEPLOY_DECL HostMemoryPoolOption {
+  /// Alignment in bytes of the memory blocks, must be a power of 2
+  size_t alignment = 64;
+  /// Whether to back the blocks not less than 2MB with transparent huge pages, only works on Linux
+  bool use_huge_page = false;
+  /// Max bytes of the free blocks cached in the pool, the others will be released to system
+  size_t max_cached_bytes = 256 * 1024 * 1024;
+  /// Max bytes of the free blocks cached in each thread, which are reused without lock
+  size_t thread_cached_bytes = 4 * 1024 * 1024;
+  /// The blocks larger than this size are allocated from system directly
+  size_t max_block_bytes = 256 * 1024 * 1024;
+};
+
+/*! @brief Statistics of HostMemoryPool
+ */
+struct FASTDEPLOY_DECL HostMemoryPoolStatistics {
+  /// Number of allocations served by the cached blocks
+  int64_t hits = 0;
+  /// Number of allocations served by system
+  int64_t misses = 0;
+  /// Bytes of the free blocks held by the pool
+  int64_t bytes_held = 0;
+  /// Bytes of the blocks allocated and not released yet
+  int64_t bytes_in_use = 0;
+};
+
+struct HostMemoryPoolState;
+
+/*! @brief Size-class memory pool for host memory. The requested sizes are
+ *  rounded up to 4 classes per power of 2, and the released blocks are cached
+ *  per class, firstly in the cache of current thread, then in the pool shared
+ *  by all the threads, so the tensors with the same shapes in a loop could
+ *  reuse their memory without calling system allocator. It's the default
+ *  allocator of FDTensor.
+ *
+ *  The released blocks are not returned to system immediately. With the
+ *  default option, the pool holds at most 256MB of free blocks, plus 4MB in
+ *  each thread which has released a tensor. Call Trim() to release them, set
+ *  a smaller HostMemoryPoolOption::max_cached_bytes, or call
+ *  SetHostAllocator(std::make_shared<SystemHostAllocator>()) to allocate
+ *  from system directly like before.
+ */
+class FASTDEPLOY_DECL HostMemoryPool : public HostAllocator {
+ public:
+  explicit HostMemoryPool(
+      const HostMemoryPoolOption& option = HostMemoryPoolOption());
+  ~HostMemoryPool();
+  void* Allocate(size_t size) override;
+  void Free(void* ptr, size_t size) override;
+
+  /// Get the statistics of this pool, including all the threads
+  HostMemoryPoolStatistics GetStatistics() const;
+  /// Release the free blocks cached in the pool and the cache of current thread to system
+  void Trim();
+
+ private:
+  std::shared_ptr<HostMemoryPoolState> state_;
+};
+
+/** \brief Set the allocator for the host memory of FDTensor, the allocator
+ *  will be kept alive until the program exits since the tensors allocated by
+ *  it may be released later. It should be called before the tensors are
+ *  created, the tensors allocated before will be released by their original
+ *  allocator.
+ *
+ * \param[in] allocator The allocator, nullptr means to use the default HostMemoryPool
+ */
+FASTDEPLOY_DECL void SetHostAllocator(
+    const std::shared_ptr<HostAllocator>& allocator);
+
+/// Get the allocator for the host memory of FDTensor
+FASTDEPLOY_DECL HostAllocator* GetHostAllocator();
+
+/// Get the default HostMemoryPool of FDTensor
+FASTDEPLOY_DECL HostMemoryPool* GetDefaultHostMemoryPool();
+
 #ifdef WITH_GPU
 
 class FASTDEPLOY_DECL FDDeviceAllocator {
@@ -280,16 +280,33 @@ bool FDTensor::ReallocFn(size_t nbytes) {
                "so this is an unexpected problem happend.");
 #endif
     }
-    buffer_ = realloc(buffer_, nbytes);
+    if (buffer_ != nullptr && host_allocator != nullptr &&
+        nbytes <= nbytes_allocated && nbytes * 2 >= nbytes_allocated) {
+      return true;
+    }
+    HostAllocator* allocator = GetHostAllocator();
+    void* new_buffer = allocator->Allocate(nbytes);
+    if (new_buffer == nullptr) {
+      return false;
+    }
+    if (buffer_ != nullptr) {
+      memcpy(new_buffer, buffer_, std::min(nbytes, nbytes_allocated));
+      FreeFn();
+    }
+    buffer_ = new_buffer;
+    host_allocator = allocator;
     nbytes_allocated = nbytes;
-    return buffer_ != nullptr;
+    return true;
   }
 }
 
 void FDTensor::FreeFn() {
   if (external_data_ptr != nullptr) external_data_ptr = nullptr;
   if (buffer_ != nullptr) {
-    if (device == Device::GPU) {
+    if (host_allocator != nullptr) {
+      host_allocator->Free(buffer_, nbytes_allocated);
+      host_allocator = nullptr;
+    } else if (device == Device::GPU) {
 #ifdef WITH_GPU
       FDDeviceFree()(buffer_);
 #endif
@@ -402,10 +419,14 @@ FDTensor::FDTensor(FDTensor&& other)
       external_data_ptr(other.external_data_ptr),
       device(other.device),
       device_id(other.device_id),
+      is_pinned_memory(other.is_pinned_memory),
+      host_allocator(other.host_allocator),
       nbytes_allocated(other.nbytes_allocated) {
   other.name = "";
   // Note(zhoushunjie): Avoid double free.
   other.buffer_ = nullptr;
+  other.host_allocator = nullptr;
+  other.nbytes_allocated = 0;
   other.external_data_ptr = nullptr;
 }
 
@@ -441,11 +462,15 @@ FDTensor& FDTensor::operator=(FDTensor&& other) {
     dtype = other.dtype;
     device = other.device;
     device_id = other.device_id;
+    is_pinned_memory = other.is_pinned_memory;
+    host_allocator = other.host_allocator;
     nbytes_allocated = other.nbytes_allocated;
 
     other.name = "";
     // Note(zhoushunjie): Avoid double free.
     other.buffer_ = nullptr;
+    other.host_allocator = nullptr;
+    other.nbytes_allocated = 0;
     other.external_data_ptr = nullptr;
   }
   return *this;
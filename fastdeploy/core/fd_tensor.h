@@ -127,6 +127,10 @@ struct FASTDEPLOY_DECL FDTensor {
   // with cudaMallocHost()
   bool is_pinned_memory = false;
 
+  // The allocator of the host memory in `buffer_`, which is used to release
+  // the buffer, nullptr if the buffer is not allocated by HostAllocator
+  HostAllocator* host_allocator = nullptr;
+
   // if the external data is not on CPU, we use this temporary buffer
   // to transfer data to CPU at some cases we need to visit the
   // other devices' data
@@ -134,7 +138,8 @@ struct FASTDEPLOY_DECL FDTensor {
 
   // The number of bytes allocated so far.
   // When resizing GPU memory, we will free and realloc the memory only if the
-  // required size is larger than this value.
+  // required size is larger than this value. The host memory is also reused
+  // while the required size is not less than half of this value.
   size_t nbytes_allocated = 0;
 
   // Get data buffer pointer
@@ -14,20 +14,79 @@
 
 #include "fastdeploy/function/eigen.h"
 
+#include <thread>  // NOLINT
+
+#include "fastdeploy/function/threads.h"
+
 namespace fastdeploy {
 namespace function {
-std::shared_ptr<EigenDeviceWrapper> EigenDeviceWrapper::instance_ = nullptr;
+
+namespace {
+
+// Run the scheduled tasks in the calling thread, so the device of 1 thread
+// doesn't start any worker thread
+class InlineThreadPool : public Eigen::ThreadPoolInterface {
+ public:
+  void Schedule(std::function<void()> fn) override { fn(); }
+  int NumThreads() const override { return 1; }
+  int CurrentThreadId() const override { return -1; }
+};
+
+}  // namespace
 
 std::shared_ptr<EigenDeviceWrapper> EigenDeviceWrapper::GetInstance() {
-  if (instance_ == nullptr) {
-    instance_ = std::make_shared<EigenDeviceWrapper>();
+  static std::shared_ptr<EigenDeviceWrapper> instance = []() {
+    auto wrapper = std::make_shared<EigenDeviceWrapper>();
+    wrapper->SetNumThreads(1);
+    return wrapper;
+  }();
+  return instance;
+}
+
+std::shared_ptr<const Eigen::ThreadPoolDevice> EigenDeviceWrapper::GetDevice()
+    const {
+  return std::atomic_load(&device_);
+}
+
+void EigenDeviceWrapper::SetNumThreads(int num_threads) {
+  if (num_threads <= 0) {
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  num_threads = std::max(num_threads, 1);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto current = std::atomic_load(&device_);
+  if (current != nullptr && current->numThreads() == num_threads) {
+    return;
+  }
+  // The device is destroyed before its pool
+  struct Device {
+    std::unique_ptr<Eigen::ThreadPoolInterface> pool;
+    std::unique_ptr<Eigen::ThreadPoolDevice> device;
+  };
+  auto holder = std::make_shared<Device>();
+  if (num_threads == 1) {
+    holder->pool.reset(new InlineThreadPool());
+  } else {
+    holder->pool.reset(new Eigen::ThreadPool(num_threads));
   }
-  return instance_;
+  holder->device.reset(
+      new Eigen::ThreadPoolDevice(holder->pool.get(), num_threads));
+  std::shared_ptr<const Eigen::ThreadPoolDevice> device(
+      holder, holder->device.get());
+  std::atomic_store(&device_, device);
 }
 
-const Eigen::DefaultDevice* EigenDeviceWrapper::GetDevice() const {
-  return &device_;
+int EigenDeviceWrapper::GetNumThreads() const {
+  return GetDevice()->numThreads();
 }
 
+void SetNumThreads(int num_threads) {
+  EigenDeviceWrapper::GetInstance()->SetNumThreads(num_threads);
 }
+
+int GetNumThreads() {
+  return EigenDeviceWrapper::GetInstance()->GetNumThreads();
+}
+
+}  // namespace function
 }  // namespace fastdeploy
@@ -16,9 +16,13 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "fastdeploy/core/fd_tensor.h"
 #include "fastdeploy/utils/axis_utils.h"
+#ifndef EIGEN_USE_THREADS
+#define EIGEN_USE_THREADS
+#endif
 #include "unsupported/Eigen/CXX11/Tensor"
 
 namespace fastdeploy {
@@ -126,14 +130,22 @@ struct EigenMatrix : public EigenTensor<T, 2, MajorType, IndexType> {
   }
 };
 
+// All the kernels run on an Eigen::ThreadPoolDevice, the device of 1 thread
+// runs the kernels in the calling thread like Eigen::DefaultDevice.
 class EigenDeviceWrapper {
  public:
   static std::shared_ptr<EigenDeviceWrapper> GetInstance();
-  const Eigen::DefaultDevice* GetDevice() const;
+  // The kernel should hold the returned device until it finishes, so the
+  // device is not released by SetNumThreads in the meantime
+  std::shared_ptr<const Eigen::ThreadPoolDevice> GetDevice() const;
+  void SetNumThreads(int num_threads);
+  int GetNumThreads() const;
 
  private:
-  Eigen::DefaultDevice device_;
-  static std::shared_ptr<EigenDeviceWrapper> instance_;
+  // Only the current device is kept by the wrapper, a replaced device and
+  // its threads are released once the last kernel running on it finishes
+  std::shared_ptr<const Eigen::ThreadPoolDevice> device_;
+  std::mutex mutex_;
 };
 
 }  // namespace function
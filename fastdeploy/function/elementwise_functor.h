@@ -31,7 +31,8 @@ template <typename Functor> struct SameDimsElementwiseCompute {
 
 template <typename T> struct SameDimsAddFunctor {
   void operator()(const FDTensor& x, const FDTensor& y, FDTensor* z) {
-    const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+    auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+    const auto& dev = *device;
     auto eigen_x = EigenVector<T>::Flatten(x);
     auto eigen_y = EigenVector<T>::Flatten(y);
     auto eigen_z = EigenVector<T>::Flatten(*z);
@@ -41,7 +42,8 @@ template <typename T> struct SameDimsAddFunctor {
 
 template <typename T> struct SameDimsSubtractFunctor {
   void operator()(const FDTensor& x, const FDTensor& y, FDTensor* z) {
-    const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+    auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+    const auto& dev = *device;
     auto eigen_x = EigenVector<T>::Flatten(x);
     auto eigen_y = EigenVector<T>::Flatten(y);
     auto eigen_z = EigenVector<T>::Flatten(*z);
@@ -51,7 +53,8 @@ template <typename T> struct SameDimsSubtractFunctor {
 
 template <typename T> struct SameDimsMultiplyFunctor {
   void operator()(const FDTensor& x, const FDTensor& y, FDTensor* z) {
-    const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+    auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+    const auto& dev = *device;
     auto eigen_x = EigenVector<T>::Flatten(x);
     auto eigen_y = EigenVector<T>::Flatten(y);
     auto eigen_z = EigenVector<T>::Flatten(*z);
@@ -61,7 +64,8 @@ template <typename T> struct SameDimsMultiplyFunctor {
 
 template <typename T> struct SameDimsDivideFunctor {
   void operator()(const FDTensor& x, const FDTensor& y, FDTensor* z) {
-    const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+    auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+    const auto& dev = *device;
     auto eigen_x = EigenVector<T>::Flatten(x);
     auto eigen_y = EigenVector<T>::Flatten(y);
     auto eigen_z = EigenVector<T>::Flatten(*z);
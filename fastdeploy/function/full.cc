@@ -21,7 +21,8 @@ namespace function {
 
 template <typename T> void FullValue(FDTensor* tensor, const Scalar& val) {
   auto t = EigenVector<T>::Flatten(*tensor);
-  auto& place = *EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto& place = *device;
   t.device(place) = t.constant(val.to<T>());
 }
 
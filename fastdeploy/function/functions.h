@@ -32,5 +32,7 @@
 #include "fastdeploy/function/softmax.h"
 #include "fastdeploy/function/sort.h"
 #include "fastdeploy/function/split.h"
+#include "fastdeploy/function/threads.h"
 #include "fastdeploy/function/tile.h"
+#include "fastdeploy/function/topk.h"
 #include "fastdeploy/function/transpose.h"
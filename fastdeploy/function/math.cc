@@ -32,7 +32,8 @@ void ActivationImpl(const FDTensor& X, FDTensor* Out, const Functor& functor) {
   auto x = EigenVector<T>::Flatten(X);
   out_tmp.Allocate(X.Shape(), X.Dtype());
   auto out = EigenVector<T>::Flatten(out_tmp);
-  const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+  const auto& dev = *device;
   functor(dev, x, out);
   *Out = std::move(out_tmp);
 }
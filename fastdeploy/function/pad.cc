@@ -36,7 +36,7 @@ struct PadEigen {
       Eigen::TensorMap<Eigen::Tensor<T, Rank, Eigen::RowMajor, int>,
                        Eigen::Aligned>;
 
-  static void Eval(const Eigen::DefaultDevice& dev,
+  static void Eval(const Eigen::ThreadPoolDevice& dev,
                    OutType out,
                    const InType& in,
                    const Array& padding,
@@ -44,7 +44,7 @@ struct PadEigen {
     out.device(dev) = in.pad(padding, value);
   }
 
-  static void Eval32(const Eigen::DefaultDevice& dev,
+  static void Eval32(const Eigen::ThreadPoolDevice& dev,
                      OutType32BitIndex out,
                      const InType32BitIndex& in,
                      const Array32Bit& padding,
@@ -68,7 +68,8 @@ void PadFunction(const std::vector<int>& pads,
   auto src_tensor = EigenTensor<T, D>::From(src);
   auto out_tensor = EigenTensor<T, D>::From(*out);
 
-  const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+  const auto& dev = *device;
   PadEigen<T, D>::Eval(
       dev, out_tensor, src_tensor, paddings, pad_value);
 }
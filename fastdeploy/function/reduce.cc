@@ -50,7 +50,8 @@ void ReduceFunctor(const FDTensor& input, FDTensor* output,
                    out_dims.end());
   }
 
-  auto& place = *EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto& place = *device;
   Functor functor;
   if (D == 1) {
     auto out = EigenScalar<T>::From(*output);
@@ -153,7 +154,8 @@ void ReduceKernelImpl(const FDTensor& input, FDTensor* output,
                       const std::vector<int64_t>& dims, bool keep_dim,
                       bool reduce_all) {
   output->Allocate({1}, TypeToDataType<OutT>::dtype);
-  const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+  const auto& dev = *device;
   if (reduce_all) {
     // Flatten and reduce 1-D tensor
     auto x = EigenVector<OutT>::Flatten(input);
@@ -231,7 +233,8 @@ struct ArgMinMaxFunctor {};
     void operator()(const FDTensor& in, FDTensor* out,                   \
                     const std::vector<int64_t>& x_dims, int64_t axis,    \
                     bool keepdims, bool flatten) {                       \
-      const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice(); \
+      auto device = EigenDeviceWrapper::GetInstance()->GetDevice();      \
+      const auto& dev = *device;                                         \
       auto in_eigen = EigenTensor<T, Rank>::From(in, x_dims);            \
       if (keepdims) {                                                    \
         if (!flatten) {                                                  \
@@ -20,7 +20,8 @@ namespace function {
 //////// Max Functor ///////
 struct MaxFunctor {
   template <typename X, typename Y, typename Dim>
-  void operator()(const Eigen::DefaultDevice& dev, X* x, Y* y, const Dim& dim) {
+  void operator()(const Eigen::ThreadPoolDevice& dev, X* x, Y* y,
+                  const Dim& dim) {
     y->device(dev) = x->maximum(dim);
   }
 };
@@ -28,7 +29,8 @@ struct MaxFunctor {
 //////// Min Functor ///////
 struct MinFunctor {
   template <typename X, typename Y, typename Dim>
-  void operator()(const Eigen::DefaultDevice& dev, X* x, Y* y, const Dim& dim) {
+  void operator()(const Eigen::ThreadPoolDevice& dev, X* x, Y* y,
+                  const Dim& dim) {
     y->device(dev) = x->minimum(dim);
   }
 };
@@ -36,7 +38,8 @@ struct MinFunctor {
 //////// Sum Functor ///////
 struct SumFunctor {
   template <typename X, typename Y, typename Dim>
-  void operator()(const Eigen::DefaultDevice& dev, X* x, Y* y, const Dim& dim) {
+  void operator()(const Eigen::ThreadPoolDevice& dev, X* x, Y* y,
+                  const Dim& dim) {
     y->device(dev) = x->sum(dim);
   }
 };
@@ -44,7 +47,8 @@ struct SumFunctor {
 //////// All Functor ///////
 struct AllFunctor {
   template <typename X, typename Y, typename Dim>
-  void operator()(const Eigen::DefaultDevice& dev, X* x, Y* y, const Dim& dim) {
+  void operator()(const Eigen::ThreadPoolDevice& dev, X* x, Y* y,
+                  const Dim& dim) {
     y->device(dev) = x->all(dim);
   }
 };
@@ -52,7 +56,8 @@ struct AllFunctor {
 //////// Any Functor ///////
 struct AnyFunctor {
   template <typename X, typename Y, typename Dim>
-  void operator()(const Eigen::DefaultDevice& dev, X* x, Y* y, const Dim& dim) {
+  void operator()(const Eigen::ThreadPoolDevice& dev, X* x, Y* y,
+                  const Dim& dim) {
     y->device(dev) = x->any(dim);
   }
 };
@@ -60,7 +65,8 @@ struct AnyFunctor {
 //////// Mean Functor ///////
 struct MeanFunctor {
   template <typename X, typename Y, typename Dim>
-  void operator()(const Eigen::DefaultDevice& dev, X* x, Y* y, const Dim& dim) {
+  void operator()(const Eigen::ThreadPoolDevice& dev, X* x, Y* y,
+                  const Dim& dim) {
     y->device(dev) = x->mean(dim);
   }
 };
@@ -68,7 +74,8 @@ struct MeanFunctor {
 //////// Prod Functor ///////
 struct ProdFunctor {
   template <typename X, typename Y, typename Dim>
-  void operator()(const Eigen::DefaultDevice& dev, X* x, Y* y, const Dim& dim) {
+  void operator()(const Eigen::ThreadPoolDevice& dev, X* x, Y* y,
+                  const Dim& dim) {
     y->device(dev) = x->prod(dim);
   }
 };
@@ -126,7 +126,8 @@ void SliceKernel(const FDTensor& x, const std::vector<int64_t>& axes,
   out->Allocate(slice_dims, x.Dtype());
   auto in_t = EigenTensor<T, D>::From(x, in_dims);
   auto out_t = EigenTensor<T, D>::From(*out, slice_dims);
-  const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+  const auto& dev = *device;
   out_t.device(dev) = in_t.slice(offsets, extents);
 }
 
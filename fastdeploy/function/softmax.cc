@@ -52,7 +52,8 @@ struct SoftmaxEigen {
     Eigen::DSizes<int, 2> one_axis(1, axis_dim);
     Eigen::DSizes<int, 3> batch_axis_remain(batch_size, axis_dim, num_remain);
 
-    const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+    auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+    const auto& dev = *device;
     // For numerical stability, logits should be shifted by maximum number along
     // axis, calculate shifted_logits into softmax tensor for memory reuse.
     if (num_remain == 1) {
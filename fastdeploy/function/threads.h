@@ -0,0 +1,32 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "fastdeploy/utils/utils.h"
+
+namespace fastdeploy {
+namespace function {
+/** Set the number of threads used by the CPU kernels of function, such as
+    Transpose, Reduce, Softmax and the elementwise operations. It's 1 by
+    default, and the kernels already running keep their threads.
+    @param num_threads The number of threads, -1 means the number of CPU cores.
+*/
+FASTDEPLOY_DECL void SetNumThreads(int num_threads);
+
+/// Get the number of threads used by the CPU kernels of function
+FASTDEPLOY_DECL int GetNumThreads();
+
+}  // namespace function
+}  // namespace fastdeploy
@@ -64,7 +64,8 @@ void TileFunctor(const FDTensor& x,
   auto eigen_x = EigenTensor<T, Rank>::From(x, x_shape);
   auto eigen_out = EigenTensor<T, Rank>::From(out_tmp, out_shape);
 
-  const auto& dev = *EigenDeviceWrapper::GetInstance()->GetDevice();
+  auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+  const auto& dev = *device;
   eigen_out.device(dev) = eigen_x.broadcast(bcast_dims);
 
   *out = std::move(out_tmp);
@@ -0,0 +1,161 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/function/topk.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "fastdeploy/core/float16.h"
+#include "fastdeploy/utils/parallel.h"
+
+namespace fastdeploy {
+namespace function {
+
+// NaN is larger than any other number, the same as Sort
+template <typename T>
+static inline bool IsNan(T value) {
+  return std::isnan(static_cast<double>(value));
+}
+
+// Whether a should be in front of b in the result
+template <typename T>
+static inline bool Before(const std::pair<T, int64_t>& a,
+                          const std::pair<T, int64_t>& b, bool largest) {
+  bool a_nan = IsNan(a.first);
+  bool b_nan = IsNan(b.first);
+  if (a_nan || b_nan) {
+    if (a_nan != b_nan) {
+      return a_nan == largest;
+    }
+  } else if (a.first != b.first) {
+    return largest ? a.first > b.first : a.first < b.first;
+  }
+  return a.second < b.second;
+}
+
+// T is the type of the data and CompT is the type to compare, float16 is
+// compared as float
+template <typename T, typename CompT, typename IndexT>
+static void TopKKernel(const FDTensor& x, FDTensor* out, FDTensor* indices,
+                       int k, int axis, bool largest, bool sorted) {
+  auto shape = x.Shape();
+  int rank = shape.size();
+  axis = axis < 0 ? axis + rank : axis;
+  FDASSERT(axis >= 0 && axis < rank,
+           "The axis of TopK should be in range [-%d, %d), but now it's %d.",
+           rank, rank, axis);
+  int64_t axis_size = shape[axis];
+  // k <= 0 gets an empty result along axis
+  int64_t topk = std::max<int64_t>(std::min<int64_t>(k, axis_size), 0);
+  int64_t outer = 1;
+  for (int i = 0; i < axis; ++i) {
+    outer *= shape[i];
+  }
+  int64_t inner = 1;
+  for (int i = axis + 1; i < rank; ++i) {
+    inner *= shape[i];
+  }
+
+  std::vector<int64_t> out_shape = shape;
+  out_shape[axis] = topk;
+  // out or indices may share the memory with x, so write to the temporary
+  // tensors first
+  FDTensor out_tmp, indices_tmp;
+  out_tmp.Allocate(out_shape, x.Dtype());
+  indices_tmp.Allocate(out_shape, TypeToDataType<IndexT>::dtype);
+  const T* x_data = reinterpret_cast<const T*>(x.CpuData());
+  T* out_data = reinterpret_cast<T*>(out_tmp.MutableData());
+  IndexT* indices_data = reinterpret_cast<IndexT*>(indices_tmp.MutableData());
+
+  if (topk == 0) {
+    *out = std::move(out_tmp);
+    *indices = std::move(indices_tmp);
+    return;
+  }
+  utils::ParallelFor(outer * inner, [&](int64_t begin, int64_t end) {
+    using Item = std::pair<CompT, int64_t>;
+    // The heap top is the last one of the current k elements
+    auto cmp = [largest](const Item& a, const Item& b) {
+      return Before(a, b, largest);
+    };
+    std::vector<Item> heap;
+    heap.reserve(topk);
+    for (int64_t line = begin; line < end; ++line) {
+      int64_t o = line / inner;
+      int64_t i = line % inner;
+      const T* src = x_data + o * axis_size * inner + i;
+      heap.clear();
+      for (int64_t j = 0; j < topk; ++j) {
+        heap.emplace_back(static_cast<CompT>(src[j * inner]), j);
+      }
+      std::make_heap(heap.begin(), heap.end(), cmp);
+      for (int64_t j = topk; j < axis_size; ++j) {
+        Item item(static_cast<CompT>(src[j * inner]), j);
+        if (cmp(item, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), cmp);
+          heap.back() = item;
+          std::push_heap(heap.begin(), heap.end(), cmp);
+        }
+      }
+      if (sorted) {
+        std::sort_heap(heap.begin(), heap.end(), cmp);
+      }
+      T* dst = out_data + o * topk * inner + i;
+      IndexT* dst_indices = indices_data + o * topk * inner + i;
+      for (int64_t j = 0; j < topk; ++j) {
+        dst[j * inner] = src[heap[j].second * inner];
+        dst_indices[j * inner] = static_cast<IndexT>(heap[j].second);
+      }
+    }
+  });
+  *out = std::move(out_tmp);
+  *indices = std::move(indices_tmp);
+}
+
+template <typename T, typename CompT>
+static void TopKWithIndicesType(const FDTensor& x, FDTensor* out,
+                                FDTensor* indices, int k, int axis,
+                                bool largest, bool sorted,
+                                FDDataType indices_type) {
+  if (indices_type == FDDataType::INT32) {
+    TopKKernel<T, CompT, int32_t>(x, out, indices, k, axis, largest, sorted);
+  } else if (indices_type == FDDataType::INT64) {
+    TopKKernel<T, CompT, int64_t>(x, out, indices, k, axis, largest, sorted);
+  } else {
+    FDASSERT(false,
+             "The data type of indices of TopK should be int32 or int64, but "
+             "now it's %s.",
+             Str(indices_type).c_str());
+  }
+}
+
+void TopK(const FDTensor& x, FDTensor* out, FDTensor* indices, int k,
+          int axis, bool largest, bool sorted, FDDataType indices_type) {
+  if (x.dtype == FDDataType::FP16) {
+    TopKWithIndicesType<float16, float>(x, out, indices, k, axis, largest,
+                                        sorted, indices_type);
+    return;
+  }
+  FD_VISIT_INT_FLOAT_TYPES(x.dtype, "TopKKernel", ([&] {
+                             TopKWithIndicesType<data_t, data_t>(
+                                 x, out, indices, k, axis, largest, sorted,
+                                 indices_type);
+                           }));
+}
+
+}  // namespace function
+}  // namespace fastdeploy
@@ -0,0 +1,51 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "fastdeploy/core/fd_tensor.h"
+
+namespace fastdeploy {
+namespace function {
+
+/**
+ * @brief Get the k largest or smallest elements of the input tensor along the
+ *        given axis, and their indices. The elements are selected with a heap
+ *        of size k, and the slices along axis are processed in parallel.
+ * @param  x            The input of topk, the data type can be int32, int64,
+ *                      uint8, fp16, fp32 or fp64
+ * @param  out          The k elements, with the same shape as x except
+ *                      that the size of axis is k
+ * @param  indices      The indices of the k elements in x along axis, with
+ *                      the same shape as out
+ * @param  k            The number of elements to get, it's clipped to the
+ *                      size of axis. When k <= 0, out and indices are empty
+ *                      along axis
+ * @param  axis         The axis to get the elements along. When axis < 0,
+ *                      the actual axis will be the |axis|'th counting
+ *                      backwards
+ * @param  largest      Get the largest elements if true, otherwise the
+ *                      smallest ones. NaN is larger than any other number
+ * @param  sorted       Whether to sort the k elements, the largest (or the
+ *                      smallest) one first. The equal elements are sorted by
+ *                      their indices
+ * @param  indices_type The data type of indices, default to int64
+ */
+FASTDEPLOY_DECL void TopK(const FDTensor& x, FDTensor* out, FDTensor* indices,
+                          int k, int axis = -1, bool largest = true,
+                          bool sorted = true,
+                          FDDataType indices_type = FDDataType::INT64);
+
+}  // namespace function
+}  // namespace fastdeploy
@@ -54,7 +54,8 @@ struct TransposeKernelImpl {
       permute[i] = axis[i];
     }
 
-    auto& place = *EigenDeviceWrapper::GetInstance()->GetDevice();
+    auto device = EigenDeviceWrapper::GetInstance()->GetDevice();
+    auto& place = *device;
     auto eigen_in = EigenTensor<T, Rank>::From(in);
     auto eigen_out = EigenTensor<T, Rank>::From(*out);
     eigen_out.device(place) = eigen_in.shuffle(permute);
@@ -42,6 +42,19 @@ bool PPTinyPose::KeypointDetect(
   return true;
 }
 
+fastdeploy::vision::DetectionResult PPTinyPose::FilterDetectionResult(
+    const fastdeploy::vision::DetectionResult& detection_result) const {
+  fastdeploy::vision::DetectionResult filter_detection_res;
+  for (size_t i = 0; i < detection_result.boxes.size(); ++i) {
+    if (detection_result.scores[i] > detection_model_score_threshold) {
+      filter_detection_res.boxes.push_back(detection_result.boxes[i]);
+      filter_detection_res.scores.push_back(detection_result.scores[i]);
+      filter_detection_res.label_ids.push_back(detection_result.label_ids[i]);
+    }
+  }
+  return filter_detection_res;
+}
+
 bool PPTinyPose::Predict(
     cv::Mat* img, fastdeploy::vision::KeyPointDetectionResult* result) {
   result->Clear();
@@ -50,14 +63,8 @@ bool PPTinyPose::Predict(
     FDERROR << "Failed to detect image." << std::endl;
     return false;
   }
-  fastdeploy::vision::DetectionResult filter_detection_res;
-  for (size_t i = 0; i < detection_res.boxes.size(); ++i) {
-    if (detection_res.scores[i] > detection_model_score_threshold) {
-      filter_detection_res.boxes.push_back(detection_res.boxes[i]);
-      filter_detection_res.scores.push_back(detection_res.scores[i]);
-      filter_detection_res.label_ids.push_back(detection_res.label_ids[i]);
-    }
-  }
+  fastdeploy::vision::DetectionResult filter_detection_res =
+      FilterDetectionResult(detection_res);
   if (nullptr != pptinypose_model_ &&
       !KeypointDetect(img, result, filter_detection_res)) {
     FDERROR << "Failed to detect keypoint in image " << std::endl;
@@ -66,5 +73,31 @@ bool PPTinyPose::Predict(
   return true;
 };
 
+bool PPTinyPose::BatchPredict(
+    const std::vector<cv::Mat>& images,
+    std::vector<fastdeploy::vision::KeyPointDetectionResult>* results) {
+  results->resize(images.size());
+  for (auto& result : *results) {
+    result.Clear();
+  }
+  std::vector<fastdeploy::vision::DetectionResult> detection_results(
+      images.size());
+  if (nullptr != detector_ &&
+      !detector_->BatchPredict(images, &detection_results)) {
+    FDERROR << "There's a error while detectiong human box in images."
+            << std::endl;
+    return false;
+  }
+  for (size_t i = 0; i < detection_results.size(); ++i) {
+    detection_results[i] = FilterDetectionResult(detection_results[i]);
+  }
+  if (nullptr != pptinypose_model_ &&
+      !pptinypose_model_->BatchPredict(images, results, detection_results)) {
+    FDERROR << "Failed to detect keypoint in images " << std::endl;
+    return false;
+  }
+  return true;
+}
+
 }  // namespace pipeline
 }  // namespace fastdeploy
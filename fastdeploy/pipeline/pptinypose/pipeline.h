@@ -47,6 +47,16 @@ class FASTDEPLOY_DECL PPTinyPose {
   virtual bool Predict(cv::Mat* img,
                        fastdeploy::vision::KeyPointDetectionResult* result);
 
+  /** \brief Predict the keypoint detection results for a batch of input images, the persons of all the images are inferred by pptinypose model in batches
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output keypoint detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(
+      const std::vector<cv::Mat>& images,
+      std::vector<fastdeploy::vision::KeyPointDetectionResult>* results);
+
   /* \brief The score threshold for detectin model to filter bbox before inputting pptinypose model
    */
   float detection_model_score_threshold = 0;
@@ -61,6 +71,10 @@ class FASTDEPLOY_DECL PPTinyPose {
   virtual bool KeypointDetect(
       cv::Mat* img, fastdeploy::vision::KeyPointDetectionResult* result,
       fastdeploy::vision::DetectionResult& detection_result);
+  // Keep the boxes whose scores are larger than
+  // detection_model_score_threshold
+  fastdeploy::vision::DetectionResult FilterDetectionResult(
+      const fastdeploy::vision::DetectionResult& detection_result) const;
 };
 
 }  // namespace pipeline
@@ -24,9 +24,25 @@ void BindPPTinyPosePipeline(pybind11::module& m) {
                          pybind11::array& data) {
         auto mat = PyArrayToCvMat(data);
         vision::KeyPointDetectionResult res;
-        self.Predict(&mat, &res);
+        {
+          pybind11::gil_scoped_release release;
+          self.Predict(&mat, &res);
+        }
         return res;
       })
+      .def("batch_predict", [](pipeline::PPTinyPose& self,
+                               std::vector<pybind11::array>& data) {
+        std::vector<cv::Mat> images;
+        for (size_t i = 0; i < data.size(); ++i) {
+          images.push_back(PyArrayToCvMat(data[i]));
+        }
+        std::vector<vision::KeyPointDetectionResult> results;
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
+        return results;
+      })
 
       .def_readwrite("detection_model_score_threshold", 
                      &pipeline::PPTinyPose::detection_model_score_threshold);
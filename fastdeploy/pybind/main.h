@@ -56,6 +56,10 @@ void PyArrayToTensorList(std::vector<pybind11::array>& pyarray,
                          std::vector<FDTensor>* tensor,
                          bool share_buffer = false);
 pybind11::array TensorToPyArray(const FDTensor& tensor);
+// Convert FDTensor to numpy array without copy, the tensor will be moved
+// into the numpy array. Fallback to TensorToPyArray if the tensor doesn't
+// own its memory or the memory is not on CPU
+pybind11::array TensorToPyArrayNoCopy(FDTensor* tensor);
 
 #ifdef ENABLE_VISION
 cv::Mat PyArrayToCvMat(pybind11::array& pyarray);
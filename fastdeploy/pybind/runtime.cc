@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <sstream>
+
 #include "fastdeploy/pybind/main.h"
+#include "fastdeploy/runtime/batching_runtime.h"
 
 namespace fastdeploy {
 
@@ -55,33 +58,45 @@ void BindRuntime(pybind11::module& m) {
            })
       .def("infer",
            [](Runtime& self, std::map<std::string, pybind11::array>& data) {
+             // Share the memory of numpy arrays with input tensors, the
+             // arrays not in C-contiguous will be copied to contiguous ones
+             std::vector<pybind11::array> arrays;
+             arrays.reserve(data.size());
              std::vector<FDTensor> inputs(data.size());
              int index = 0;
              for (auto iter = data.begin(); iter != data.end(); ++iter) {
+               arrays.push_back(pybind11::array::ensure(
+                   iter->second, pybind11::array::c_style));
+               auto& array = arrays.back();
+               if (!array) {
+                 throw std::runtime_error("Failed to convert input " +
+                                          iter->first +
+                                          " to C-contiguous numpy array.");
+               }
                std::vector<int64_t> data_shape;
-               data_shape.insert(data_shape.begin(), iter->second.shape(),
-                                 iter->second.shape() + iter->second.ndim());
-               auto dtype = NumpyDataTypeToFDDataType(iter->second.dtype());
-               // TODO(jiangjiajun) Maybe skip memory copy is a better choice
-               // use SetExternalData
-               inputs[index].Resize(data_shape, dtype);
-               memcpy(inputs[index].MutableData(), iter->second.mutable_data(),
-                      iter->second.nbytes());
+               data_shape.insert(data_shape.begin(), array.shape(),
+                                 array.shape() + array.ndim());
+               auto dtype = NumpyDataTypeToFDDataType(array.dtype());
+               inputs[index].SetExternalData(data_shape, dtype,
+                                             const_cast<void*>(array.data()));
                inputs[index].name = iter->first;
                index += 1;
              }
 
              std::vector<FDTensor> outputs(self.NumOutputs());
-             self.Infer(inputs, &outputs);
+             bool success = false;
+             {
+               pybind11::gil_scoped_release release;
+               success = self.Infer(inputs, &outputs);
+             }
+             if (!success) {
+               throw std::runtime_error("Failed to inference with Runtime.");
+             }
 
              std::vector<pybind11::array> results;
              results.reserve(outputs.size());
              for (size_t i = 0; i < outputs.size(); ++i) {
-               auto numpy_dtype = FDDataTypeToNumpyDataType(outputs[i].dtype);
-               results.emplace_back(
-                   pybind11::array(numpy_dtype, outputs[i].shape));
-               memcpy(results[i].mutable_data(), outputs[i].Data(),
-                      outputs[i].Numel() * FDDataTypeSize(outputs[i].dtype));
+               results.push_back(TensorToPyArrayNoCopy(&outputs[i]));
              }
              return results;
            })
@@ -98,7 +113,12 @@ void BindRuntime(pybind11::module& m) {
                inputs.push_back(tensor);
              }
              std::vector<FDTensor> outputs;
-             if (!self.Infer(inputs, &outputs)) {
+             bool success = false;
+             {
+               pybind11::gil_scoped_release release;
+               success = self.Infer(inputs, &outputs);
+             }
+             if (!success) {
                throw std::runtime_error("Failed to inference with Runtime.");
              }
              return outputs;
@@ -106,12 +126,16 @@ void BindRuntime(pybind11::module& m) {
       .def("infer",
            [](Runtime& self, std::vector<FDTensor>& inputs) {
              std::vector<FDTensor> outputs;
-             self.Infer(inputs, &outputs);
+             {
+               pybind11::gil_scoped_release release;
+               self.Infer(inputs, &outputs);
+             }
              return outputs;
            })
       .def("bind_input_tensor", &Runtime::BindInputTensor)
       .def("bind_output_tensor", &Runtime::BindOutputTensor)
-      .def("infer", [](Runtime& self) { self.Infer(); })
+      .def("infer", [](Runtime& self) { self.Infer(); },
+           pybind11::call_guard<pybind11::gil_scoped_release>())
       .def("get_output_tensor",
            [](Runtime& self, const std::string& name) {
              FDTensor* output = self.GetOutputTensor(name);
@@ -127,6 +151,72 @@ void BindRuntime(pybind11::module& m) {
       .def("get_profile_time", &Runtime::GetProfileTime)
       .def_readonly("option", &Runtime::option);
 
+  pybind11::class_<BatchingStatistics>(m, "BatchingStatistics")
+      .def(pybind11::init())
+      .def_readwrite("num_requests", &BatchingStatistics::num_requests)
+      .def_readwrite("num_batches", &BatchingStatistics::num_batches)
+      .def_readwrite("batch_size_histogram",
+                     &BatchingStatistics::batch_size_histogram)
+      .def_readwrite("queue_depth_histogram",
+                     &BatchingStatistics::queue_depth_histogram)
+      .def("__repr__", [](const BatchingStatistics& self) {
+        std::ostringstream oss;
+        oss << self;
+        return oss.str();
+      });
+
+  pybind11::class_<BatchingRuntime>(m, "BatchingRuntime")
+      .def(pybind11::init())
+      .def("init", &BatchingRuntime::Init)
+      .def("infer",
+           [](BatchingRuntime& self,
+              std::map<std::string, pybind11::array>& data) {
+             // The numpy arrays are shared with the input tensors, they stay
+             // alive until the batch containing this request is done
+             std::vector<pybind11::array> arrays;
+             arrays.reserve(data.size());
+             std::vector<FDTensor> inputs(data.size());
+             int index = 0;
+             for (auto iter = data.begin(); iter != data.end(); ++iter) {
+               arrays.push_back(pybind11::array::ensure(
+                   iter->second, pybind11::array::c_style));
+               auto& array = arrays.back();
+               if (!array) {
+                 throw std::runtime_error("Failed to convert input " +
+                                          iter->first +
+                                          " to C-contiguous numpy array.");
+               }
+               std::vector<int64_t> data_shape;
+               data_shape.insert(data_shape.begin(), array.shape(),
+                                 array.shape() + array.ndim());
+               auto dtype = NumpyDataTypeToFDDataType(array.dtype());
+               inputs[index].SetExternalData(data_shape, dtype,
+                                             const_cast<void*>(array.data()));
+               inputs[index].name = iter->first;
+               index += 1;
+             }
+
+             std::vector<FDTensor> outputs;
+             bool success = false;
+             {
+               pybind11::gil_scoped_release release;
+               success = self.Infer(inputs, &outputs);
+             }
+             if (!success) {
+               throw std::runtime_error(
+                   "Failed to inference with BatchingRuntime.");
+             }
+
+             std::vector<pybind11::array> results;
+             results.reserve(outputs.size());
+             for (size_t i = 0; i < outputs.size(); ++i) {
+               results.push_back(TensorToPyArrayNoCopy(&outputs[i]));
+             }
+             return results;
+           })
+      .def("get_statistics", &BatchingRuntime::GetStatistics)
+      .def("reset_statistics", &BatchingRuntime::ResetStatistics);
+
   pybind11::enum_<Backend>(m, "Backend", pybind11::arithmetic(),
                                  "Backend for inference.")
       .value("UNKOWN", Backend::UNKNOWN)
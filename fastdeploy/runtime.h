@@ -20,4 +20,5 @@
 
 #pragma once
 #include "fastdeploy/core/config.h"
-#include "fastdeploy/runtime/runtime.h"
\ No newline at end of file
+#include "fastdeploy/runtime/runtime.h"
+#include "fastdeploy/runtime/batching_runtime.h"
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <future>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -83,6 +84,15 @@ class BaseBackend {
   virtual bool Infer(std::vector<FDTensor>& inputs,
                      std::vector<FDTensor>* outputs,
                      bool copy_to_fd = true) = 0;
+  // Optional: For those backends which can run multiple inference requests
+  // concurrently, the inputs and outputs should be kept alive until
+  // the returned future is ready. By default, it runs Infer synchronously
+  virtual std::future<bool> InferAsync(std::vector<FDTensor>& inputs,
+                                       std::vector<FDTensor>* outputs) {
+    std::promise<bool> promise;
+    promise.set_value(Infer(inputs, outputs));
+    return promise.get_future();
+  }
   // Optional: For those backends which can share memory
   // while creating multiple inference engines with same model file
   virtual std::unique_ptr<BaseBackend> Clone(RuntimeOption& runtime_option,
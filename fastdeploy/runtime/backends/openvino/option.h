@@ -38,6 +38,10 @@ struct OpenVINOBackendOption {
   /// Performance hint mode
   std::string hint = "UNDEFINED";
 
+  /// Number of inference requests used by InferAsync,
+  ///         -1 means use the optimal number of the compiled model
+  int num_infer_requests = -1;
+
   /**
    * @brief Set device name for OpenVINO, default 'CPU', can also be 'AUTO', 'GPU', 'GPU.1'....
    */
@@ -93,6 +97,15 @@ struct OpenVINOBackendOption {
     FDASSERT(_num_streams > 0, "The stream_num must be greater than 0.");
     num_streams = _num_streams;
   }
+
+  /**
+   * @brief Set the number of inference requests used by InferAsync
+   */
+  void SetInferRequestNum (int _num_infer_requests) {
+    FDASSERT(_num_infer_requests > 0,
+             "The infer_request_num must be greater than 0.");
+    num_infer_requests = _num_infer_requests;
+  }
   
 
   std::map<std::string, std::vector<int64_t>> shape_infos;
@@ -24,12 +24,16 @@ void BindOpenVINOOption(pybind11::module& m) {
       .def_readwrite("num_streams", &OpenVINOBackendOption::num_streams)
       .def_readwrite("affinity", &OpenVINOBackendOption::affinity)
       .def_readwrite("hint", &OpenVINOBackendOption::hint)
+      .def_readwrite("num_infer_requests",
+                     &OpenVINOBackendOption::num_infer_requests)
       .def("set_device", &OpenVINOBackendOption::SetDevice)
       .def("set_shape_info", &OpenVINOBackendOption::SetShapeInfo)
       .def("set_cpu_operators", &OpenVINOBackendOption::SetCpuOperators)
       .def("set_affinity", &OpenVINOBackendOption::SetAffinity)
       .def("set_performance_hint", &OpenVINOBackendOption::SetPerformanceHint)
-      .def("set_stream_num", &OpenVINOBackendOption::SetStreamNum);
+      .def("set_stream_num", &OpenVINOBackendOption::SetStreamNum)
+      .def("set_infer_request_num",
+           &OpenVINOBackendOption::SetInferRequestNum);
 }
 
 }  // namespace fastdeploy
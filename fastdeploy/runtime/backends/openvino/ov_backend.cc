@@ -14,6 +14,7 @@
 
 #include "fastdeploy/runtime/backends/openvino/ov_backend.h"
 
+#include <algorithm>
 
 namespace fastdeploy {
 
@@ -395,31 +396,22 @@ int OpenVINOBackend::NumInputs() const { return input_infos_.size(); }
 
 int OpenVINOBackend::NumOutputs() const { return output_infos_.size(); }
 
-bool OpenVINOBackend::Infer(std::vector<FDTensor>& inputs,
-                            std::vector<FDTensor>* outputs, bool copy_to_fd) {
-  if (inputs.size() != input_infos_.size()) {
-    FDERROR << "[OpenVINOBackend] Size of the inputs(" << inputs.size()
-            << ") should keep same with the inputs of this model("
-            << input_infos_.size() << ")." << std::endl;
-    return false;
-  }
-
-  RUNTIME_PROFILE_LOOP_H2D_D2H_BEGIN
+void OpenVINOBackend::SetInputTensors(std::vector<FDTensor>& inputs,
+                                      ov::InferRequest* request) {
   for (size_t i = 0; i < inputs.size(); ++i) {
     ov::Shape shape(inputs[i].shape.begin(), inputs[i].shape.end());
     ov::Tensor ov_tensor(FDDataTypeToOV(inputs[i].dtype), shape,
                          inputs[i].Data());
-    request_.set_tensor(inputs[i].name, ov_tensor);
+    request->set_tensor(inputs[i].name, ov_tensor);
   }
+}
 
-  RUNTIME_PROFILE_LOOP_BEGIN(1)
-  request_.start_async();
-  request_.wait();
-  RUNTIME_PROFILE_LOOP_END
-
+void OpenVINOBackend::GetOutputTensors(ov::InferRequest& request,
+                                       std::vector<FDTensor>* outputs,
+                                       bool copy_to_fd) {
   outputs->resize(output_infos_.size());
   for (size_t i = 0; i < output_infos_.size(); ++i) {
-    auto out_tensor = request_.get_output_tensor(i);
+    auto out_tensor = request.get_output_tensor(i);
     auto out_tensor_shape = out_tensor.get_shape();
     std::vector<int64_t> shape(out_tensor_shape.begin(),
                                out_tensor_shape.end());
@@ -436,16 +428,130 @@ bool OpenVINOBackend::Infer(std::vector<FDTensor>& inputs,
           out_tensor.data(), Device::CPU);
     }
   }
+}
+
+bool OpenVINOBackend::Infer(std::vector<FDTensor>& inputs,
+                            std::vector<FDTensor>* outputs, bool copy_to_fd) {
+  if (inputs.size() != input_infos_.size()) {
+    FDERROR << "[OpenVINOBackend] Size of the inputs(" << inputs.size()
+            << ") should keep same with the inputs of this model("
+            << input_infos_.size() << ")." << std::endl;
+    return false;
+  }
+
+  RUNTIME_PROFILE_LOOP_H2D_D2H_BEGIN
+  SetInputTensors(inputs, &request_);
+
+  RUNTIME_PROFILE_LOOP_BEGIN(1)
+  request_.start_async();
+  request_.wait();
+  RUNTIME_PROFILE_LOOP_END
+
+  GetOutputTensors(request_, outputs, copy_to_fd);
   RUNTIME_PROFILE_LOOP_H2D_D2H_END
   return true;
 }
 
+void OpenVINOBackend::InitRequestPool() {
+  int num_requests = option_.num_infer_requests;
+  if (num_requests <= 0) {
+    num_requests = static_cast<int>(
+        compiled_model_.get_property(ov::optimal_number_of_infer_requests));
+  }
+  num_requests = std::max(num_requests, 1);
+  for (int i = 0; i < num_requests; ++i) {
+    async_requests_.emplace_back(compiled_model_.create_infer_request());
+    idle_requests_.push_back(i);
+  }
+  FDINFO << "Created " << num_requests
+         << " inference requests for OpenVINOBackend::InferAsync."
+         << std::endl;
+}
+
+void OpenVINOBackend::ReleaseRequest(size_t index) {
+  // Notify with the lock held, otherwise the destructor may destroy pool_cv_
+  // between the unlock and the notification
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  idle_requests_.push_back(index);
+  --running_requests_;
+  pool_cv_.notify_all();
+}
+
+std::future<bool> OpenVINOBackend::InferAsync(std::vector<FDTensor>& inputs,
+                                              std::vector<FDTensor>* outputs) {
+  auto promise = std::make_shared<std::promise<bool>>();
+  auto result = promise->get_future();
+  if (inputs.size() != input_infos_.size()) {
+    FDERROR << "[OpenVINOBackend] Size of the inputs(" << inputs.size()
+            << ") should keep same with the inputs of this model("
+            << input_infos_.size() << ")." << std::endl;
+    promise->set_value(false);
+    return result;
+  }
+
+  size_t index = 0;
+  {
+    std::unique_lock<std::mutex> lock(pool_mutex_);
+    if (async_requests_.empty()) {
+      InitRequestPool();
+    }
+    pool_cv_.wait(lock, [this] { return !idle_requests_.empty(); });
+    index = idle_requests_.back();
+    idle_requests_.pop_back();
+    ++running_requests_;
+  }
+
+  ov::InferRequest& request = async_requests_[index];
+  try {
+    SetInputTensors(inputs, &request);
+    request.set_callback(
+        [this, index, outputs, promise](std::exception_ptr exception) {
+          bool success = false;
+          try {
+            if (exception) {
+              std::rethrow_exception(exception);
+            }
+            // The request will be reused by others, so the outputs
+            // should always be copied
+            GetOutputTensors(async_requests_[index], outputs, true);
+            success = true;
+          } catch (const std::exception& e) {
+            FDERROR << "Failed to Infer: " << e.what() << std::endl;
+          } catch (...) {
+            FDERROR << "Failed to Infer: unknown exception." << std::endl;
+          }
+          promise->set_value(success);
+          // Must be the last step, once the request is returned to the pool,
+          // this callback may be replaced by the next user of the request,
+          // and the backend may be destroyed
+          ReleaseRequest(index);
+        });
+    request.start_async();
+  } catch (const std::exception& e) {
+    FDERROR << "Failed to Infer: " << e.what() << std::endl;
+    promise->set_value(false);
+    ReleaseRequest(index);
+  } catch (...) {
+    FDERROR << "Failed to Infer: unknown exception." << std::endl;
+    promise->set_value(false);
+    ReleaseRequest(index);
+  }
+  return result;
+}
+
+OpenVINOBackend::~OpenVINOBackend() {
+  // Wait for the running requests, their callbacks refer to this backend
+  std::unique_lock<std::mutex> lock(pool_mutex_);
+  pool_cv_.wait(lock, [this] { return running_requests_ == 0; });
+}
+
 std::unique_ptr<BaseBackend> OpenVINOBackend::Clone(
     RuntimeOption& runtime_option, void* stream, int device_id) {
   std::unique_ptr<BaseBackend> new_backend =
       utils::make_unique<OpenVINOBackend>();
   auto casted_backend = dynamic_cast<OpenVINOBackend*>(new_backend.get());
   casted_backend->option_ = option_;
+  casted_backend->compiled_model_ = compiled_model_;
   casted_backend->request_ = compiled_model_.create_infer_request();
   casted_backend->input_infos_.assign(input_infos_.begin(), input_infos_.end());
   casted_backend->output_infos_.assign(output_infos_.begin(),
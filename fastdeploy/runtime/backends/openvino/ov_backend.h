@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -30,13 +32,18 @@ class OpenVINOBackend : public BaseBackend {
  public:
   static ov::Core core_;
   OpenVINOBackend() {}
-  virtual ~OpenVINOBackend() = default;
+  virtual ~OpenVINOBackend();
 
   bool Init(const RuntimeOption& option);
 
   bool Infer(std::vector<FDTensor>& inputs, std::vector<FDTensor>* outputs,
              bool copy_to_fd = true) override;
 
+  // Run the inference with one of the idle requests in the request pool,
+  // will block while all the requests are busy
+  std::future<bool> InferAsync(std::vector<FDTensor>& inputs,
+                               std::vector<FDTensor>* outputs) override;
+
   int NumInputs() const override;
 
   int NumOutputs() const override;
@@ -63,8 +70,26 @@ class OpenVINOBackend : public BaseBackend {
   void InitTensorInfo(const std::vector<ov::Output<ov::Node>>& ov_outputs,
                       std::map<std::string, TensorInfo>* tensor_infos);
 
+  void SetInputTensors(std::vector<FDTensor>& inputs,
+                       ov::InferRequest* request);
+  void GetOutputTensors(ov::InferRequest& request,
+                        std::vector<FDTensor>* outputs, bool copy_to_fd);
+
+  // Create the requests pool for InferAsync, need to hold pool_mutex_
+  void InitRequestPool();
+  void ReleaseRequest(size_t index);
+
   ov::CompiledModel compiled_model_;
   ov::InferRequest request_;
+  // All the requests are created from compiled_model_, and share
+  // the streams of it
+  std::vector<ov::InferRequest> async_requests_;
+  std::vector<size_t> idle_requests_;
+  // The number of the requests whose callbacks have not returned them to
+  // the pool yet, the destructor waits until it is 0
+  int running_requests_ = 0;
+  std::mutex pool_mutex_;
+  std::condition_variable pool_cv_;
   OpenVINOBackendOption option_;
   std::vector<TensorInfo> input_infos_;
   std::vector<TensorInfo> output_infos_;
@@ -19,6 +19,7 @@
 #include <algorithm>
 
 #include "fastdeploy/core/fd_tensor.h"
+#include "fastdeploy/utils/parallel.h"
 #include "fastdeploy/utils/utils.h"
 
 namespace fastdeploy {
@@ -29,20 +30,31 @@ bool SortScorePairDescend(const std::pair<float, T>& pair1,
   return pair1.first > pair2.first;
 }
 
+// Descending order of score, and ascending order of index for the
+// equal scores, which keeps the same order as the stable sort
+bool SortScoreIndexDescend(const std::pair<float, int>& pair1,
+                           const std::pair<float, int>& pair2) {
+  return pair1.first > pair2.first ||
+         (pair1.first == pair2.first && pair1.second < pair2.second);
+}
+
 void GetMaxScoreIndex(const float* scores, const int& score_size,
                       const float& threshold, const int& top_k,
                       std::vector<std::pair<float, int>>* sorted_indices) {
-  for (size_t i = 0; i < score_size; ++i) {
+  sorted_indices->clear();
+  for (int i = 0; i < score_size; ++i) {
     if (scores[i] > threshold) {
       sorted_indices->push_back(std::make_pair(scores[i], i));
     }
   }
-  // Sort the score pair according to the scores in descending order
-  std::stable_sort(sorted_indices->begin(), sorted_indices->end(),
-                   SortScorePairDescend<int>);
-  // Keep top_k scores if needed.
+  // Only the top_k scores need to be sorted
   if (top_k > -1 && top_k < static_cast<int>(sorted_indices->size())) {
+    std::partial_sort(sorted_indices->begin(), sorted_indices->begin() + top_k,
+                      sorted_indices->end(), SortScoreIndexDescend);
     sorted_indices->resize(top_k);
+  } else {
+    std::sort(sorted_indices->begin(), sorted_indices->end(),
+              SortScoreIndexDescend);
   }
 }
 
@@ -63,51 +75,84 @@ float BBoxArea(const float* box, const bool& normalized) {
   }
 }
 
-float JaccardOverlap(const float* box1, const float* box2,
-                     const bool& normalized) {
-  if (box2[0] > box1[2] || box2[2] < box1[0] || box2[1] > box1[3] ||
-      box2[3] < box1[1]) {
-    return 0.f;
-  } else {
-    const float inter_xmin = std::max(box1[0], box2[0]);
-    const float inter_ymin = std::max(box1[1], box2[1]);
-    const float inter_xmax = std::min(box1[2], box2[2]);
-    const float inter_ymax = std::min(box1[3], box2[3]);
-    float norm = normalized ? 0.0f : 1.0f;
-    float inter_w = inter_xmax - inter_xmin + norm;
-    float inter_h = inter_ymax - inter_ymin + norm;
-    const float inter_area = inter_w * inter_h;
-    const float bbox1_area = BBoxArea(box1, normalized);
-    const float bbox2_area = BBoxArea(box2, normalized);
-    return inter_area / (bbox1_area + bbox2_area - inter_area);
+// Boxes of the kept candidates in SoA layout
+struct KeptBoxes {
+  std::vector<float> xmin;
+  std::vector<float> ymin;
+  std::vector<float> xmax;
+  std::vector<float> ymax;
+  std::vector<float> area;
+  size_t size = 0;
+
+  void Reset(size_t capacity) {
+    xmin.resize(capacity);
+    ymin.resize(capacity);
+    xmax.resize(capacity);
+    ymax.resize(capacity);
+    area.resize(capacity);
+    size = 0;
   }
-}
+
+  void Push(const float* box, float box_area) {
+    xmin[size] = box[0];
+    ymin[size] = box[1];
+    xmax[size] = box[2];
+    ymax[size] = box[3];
+    area[size] = box_area;
+    size += 1;
+  }
+
+  // Whether the overlap between box and any kept box is above threshold,
+  // computes a block of kept boxes each time so the loop can be vectorized
+  bool Suppress(const float* box, float box_area, float threshold,
+                bool normalized) const {
+    constexpr size_t kBlock = 16;
+    const float norm = normalized ? 0.0f : 1.0f;
+    for (size_t start = 0; start < size; start += kBlock) {
+      size_t end = std::min(start + kBlock, size);
+      int suppressed = 0;
+      for (size_t k = start; k < end; ++k) {
+        const float inter_xmin = std::max(xmin[k], box[0]);
+        const float inter_ymin = std::max(ymin[k], box[1]);
+        const float inter_xmax = std::min(xmax[k], box[2]);
+        const float inter_ymax = std::min(ymax[k], box[3]);
+        const float inter_area = (inter_xmax - inter_xmin + norm) *
+                                 (inter_ymax - inter_ymin + norm);
+        const bool disjoint = box[0] > xmax[k] || box[2] < xmin[k] ||
+                              box[1] > ymax[k] || box[3] < ymin[k];
+        const float overlap =
+            disjoint ? 0.f : inter_area / (area[k] + box_area - inter_area);
+        suppressed |= overlap > threshold;
+      }
+      if (suppressed) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
 
 void MultiClassNmsKernel::FastNMS(const float* boxes, const float* scores,
                                   const int& num_boxes,
                                   std::vector<int>* keep_indices) {
-  std::vector<std::pair<float, int>> sorted_indices;
+  // Reuse the buffers, FastNMS may be called by multiple threads
+  thread_local std::vector<std::pair<float, int>> sorted_indices;
+  thread_local KeptBoxes kept;
   GetMaxScoreIndex(scores, num_boxes, score_threshold, nms_top_k,
                    &sorted_indices);
+  kept.Reset(sorted_indices.size());
 
   float adaptive_threshold = nms_threshold;
-  while (sorted_indices.size() != 0) {
-    const int idx = sorted_indices.front().second;
-    bool keep = true;
-    for (size_t k = 0; k < keep_indices->size(); ++k) {
-      if (!keep) {
-        break;
-      }
-      const int kept_idx = (*keep_indices)[k];
-      float overlap =
-          JaccardOverlap(boxes + idx * 4, boxes + kept_idx * 4, normalized);
-      keep = overlap <= adaptive_threshold;
-    }
-    if (keep) {
-      keep_indices->push_back(idx);
+  for (size_t i = 0; i < sorted_indices.size(); ++i) {
+    const int idx = sorted_indices[i].second;
+    const float* box = boxes + idx * 4;
+    const float box_area = BBoxArea(box, normalized);
+    if (kept.Suppress(box, box_area, adaptive_threshold, normalized)) {
+      continue;
     }
-    sorted_indices.erase(sorted_indices.begin());
-    if (keep && nms_eta<1.0 & adaptive_threshold> 0.5) {
+    keep_indices->push_back(idx);
+    kept.Push(box, box_area);
+    if (nms_eta < 1.0 && adaptive_threshold > 0.5) {
       adaptive_threshold *= nms_eta;
     }
   }
@@ -116,12 +161,22 @@ void MultiClassNmsKernel::FastNMS(const float* boxes, const float* scores,
 int MultiClassNmsKernel::NMSForEachSample(
     const float* boxes, const float* scores, int num_boxes, int num_classes,
     std::map<int, std::vector<int>>* keep_indices) {
+  // The classes are independent, so run them in parallel
+  std::vector<std::vector<int>> class_indices(num_classes);
+  utils::ParallelFor(num_classes, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      if (i == background_label) {
+        continue;
+      }
+      const float* score_for_class_i = scores + i * num_boxes;
+      FastNMS(boxes, score_for_class_i, num_boxes, &class_indices[i]);
+    }
+  });
   for (int i = 0; i < num_classes; ++i) {
     if (i == background_label) {
       continue;
     }
-    const float* score_for_class_i = scores + i * num_boxes;
-    FastNMS(boxes, score_for_class_i, num_boxes, &((*keep_indices)[i]));
+    (*keep_indices)[i].swap(class_indices[i]);
   }
   int num_det = 0;
   for (auto iter = keep_indices->begin(); iter != keep_indices->end(); ++iter) {
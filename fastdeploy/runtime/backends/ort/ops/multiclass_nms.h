@@ -15,14 +15,19 @@
 #pragma once
 
 #include <map>
+#include <vector>
 
 #ifndef NON_64_PLATFORM
+#include "fastdeploy/utils/utils.h"
 #include "onnxruntime_cxx_api.h"  // NOLINT
 
 namespace fastdeploy {
 
-struct MultiClassNmsKernel {
+struct FASTDEPLOY_DECL MultiClassNmsKernel {
  protected:
+  // Only used to run the kernel without onnxruntime, e.g unittest
+  MultiClassNmsKernel() = default;
+
   int64_t background_label = -1;
   int64_t keep_top_k = -1;
   float nms_eta;
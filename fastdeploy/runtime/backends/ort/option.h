@@ -50,6 +50,12 @@ struct OrtBackendOption {
   bool enable_fp16 = false;
   /// file path for optimized model
   std::string optimized_model_filepath;
+  /// Keep the input/output bindings between inferences, only works on CPU.
+  ///         Inputs are rebound only while their data pointer or shape
+  ///         changes, and the outputs with static shape will be written
+  ///         into the output FDTensors directly, without allocating and
+  ///         copying memory for every inference.
+  bool enable_persistent_binding = false;
 
   std::vector<std::string> ort_disabled_ops_{};
   void DisableOrtFP16OpTypes(const std::vector<std::string>& ops) {
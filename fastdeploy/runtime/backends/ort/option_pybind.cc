@@ -30,6 +30,8 @@ void BindOrtOption(pybind11::module& m) {
       .def_readwrite("device", &OrtBackendOption::device)
       .def_readwrite("device_id", &OrtBackendOption::device_id)
       .def_readwrite("enable_fp16", &OrtBackendOption::enable_fp16)
+      .def_readwrite("enable_persistent_binding",
+                     &OrtBackendOption::enable_persistent_binding)
       .def("disable_ort_fp16_op_types",
            &OrtBackendOption::DisableOrtFP16OpTypes);
 }
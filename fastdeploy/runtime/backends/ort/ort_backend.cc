@@ -19,9 +19,11 @@
 #include "fastdeploy/runtime/backends/ort/ops/adaptive_pool2d.h"
 #include "fastdeploy/runtime/backends/ort/ops/multiclass_nms.h"
 #include "fastdeploy/runtime/backends/ort/utils.h"
+#include "fastdeploy/utils/unique_ptr.h"
 #include "fastdeploy/utils/utils.h"
 
 
+#include <algorithm>
 #include <memory>
 
 namespace fastdeploy {
@@ -180,27 +182,36 @@ bool OrtBackend::InitFromOnnx(const std::string& model_file,
   }
 
   InitCustomOperators();
+  if (env_ == nullptr) {
+    env_ = std::make_shared<Ort::Env>();
+  }
+  if (prepacked_weights_ == nullptr) {
+    prepacked_weights_ = std::make_shared<Ort::PrepackedWeightsContainer>();
+  }
   if (model_file_name.size()) {
 #ifdef WIN32
     std::wstring widestr =
         std::wstring(model_file_name.begin(), model_file_name.end());
-    session_ = {env_, widestr.c_str(), session_options_};
+    session_ = std::make_shared<Ort::Session>(
+        *env_, widestr.c_str(), session_options_, *prepacked_weights_);
 #else
-    session_ = {env_, model_file_name.c_str(), session_options_};
+    session_ = std::make_shared<Ort::Session>(
+        *env_, model_file_name.c_str(), session_options_, *prepacked_weights_);
 #endif
   } else {
-    session_ = {env_, onnx_model_buffer.data(), onnx_model_buffer.size(),
-                session_options_};
+    session_ = std::make_shared<Ort::Session>(
+        *env_, onnx_model_buffer.data(), onnx_model_buffer.size(),
+        session_options_, *prepacked_weights_);
   }
 
-  binding_ = std::make_shared<Ort::IoBinding>(session_);
+  binding_ = std::make_shared<Ort::IoBinding>(*session_);
 
   Ort::MemoryInfo memory_info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
-  Ort::Allocator allocator(session_, memory_info);
-  size_t n_inputs = session_.GetInputCount();
+  Ort::Allocator allocator(*session_, memory_info);
+  size_t n_inputs = session_->GetInputCount();
   for (size_t i = 0; i < n_inputs; ++i) {
-    auto input_name_ptr = session_.GetInputNameAllocated(i, allocator);
-    auto type_info = session_.GetInputTypeInfo(i);
+    auto input_name_ptr = session_->GetInputNameAllocated(i, allocator);
+    auto type_info = session_->GetInputTypeInfo(i);
     std::vector<int64_t> shape =
         type_info.GetTensorTypeAndShapeInfo().GetShape();
     ONNXTensorElementDataType data_type =
@@ -209,10 +220,10 @@ bool OrtBackend::InitFromOnnx(const std::string& model_file,
         OrtValueInfo{input_name_ptr.get(), shape, data_type});
   }
 
-  size_t n_outputs = session_.GetOutputCount();
+  size_t n_outputs = session_->GetOutputCount();
   for (size_t i = 0; i < n_outputs; ++i) {
-    auto output_name_ptr = session_.GetOutputNameAllocated(i, allocator);
-    auto type_info = session_.GetOutputTypeInfo(i);
+    auto output_name_ptr = session_->GetOutputNameAllocated(i, allocator);
+    auto type_info = session_->GetOutputTypeInfo(i);
     std::vector<int64_t> shape =
         type_info.GetTensorTypeAndShapeInfo().GetShape();
     ONNXTensorElementDataType data_type =
@@ -283,6 +294,10 @@ bool OrtBackend::Infer(std::vector<FDTensor>& inputs,
     return false;
   }
 
+  if (option_.enable_persistent_binding && option_.device == Device::CPU) {
+    return InferWithPersistentBinding(inputs, outputs, copy_to_fd);
+  }
+
   // from FDTensor to Ort Inputs
   RUNTIME_PROFILE_LOOP_H2D_D2H_BEGIN
   for (size_t i = 0; i < inputs.size(); ++i) {
@@ -299,7 +314,7 @@ bool OrtBackend::Infer(std::vector<FDTensor>& inputs,
   // Inference with inputs
   RUNTIME_PROFILE_LOOP_BEGIN(1)
   try {
-    session_.Run({}, *(binding_.get()));
+    session_->Run({}, *(binding_.get()));
   } catch (const std::exception& e) {
     FDERROR << "Failed to Infer: " << e.what() << std::endl;
     return false;
@@ -317,6 +332,84 @@ bool OrtBackend::Infer(std::vector<FDTensor>& inputs,
   return true;
 }
 
+bool OrtBackend::InferWithPersistentBinding(std::vector<FDTensor>& inputs,
+                                            std::vector<FDTensor>* outputs,
+                                            bool copy_to_fd) {
+  RUNTIME_PROFILE_LOOP_H2D_D2H_BEGIN
+  // Only rebind the inputs whose memory or shape changed since last inference
+  if (bound_inputs_.size() != inputs.size()) {
+    bound_inputs_.assign(inputs.size(), OrtValueInfo());
+    bound_inputs_ptr_.assign(inputs.size(), nullptr);
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    auto dtype = GetOrtDtype(inputs[i].dtype);
+    if (bound_inputs_ptr_[i] == inputs[i].Data() &&
+        bound_inputs_[i].name == inputs[i].name &&
+        bound_inputs_[i].shape == inputs[i].shape &&
+        bound_inputs_[i].dtype == dtype) {
+      continue;
+    }
+    auto ort_value = CreateOrtValue(inputs[i], false);
+    binding_->BindInput(inputs[i].name.c_str(), ort_value);
+    bound_inputs_[i] = OrtValueInfo{inputs[i].name, inputs[i].shape, dtype};
+    bound_inputs_ptr_[i] = inputs[i].Data();
+  }
+
+  // The outputs with static shape are bound to the memory of the output
+  // FDTensors, while the dynamic ones are still allocated by onnxruntime
+  outputs->resize(outputs_desc_.size());
+  if (bound_outputs_ptr_.size() != outputs_desc_.size()) {
+    bound_outputs_ptr_.assign(outputs_desc_.size(), nullptr);
+  }
+  bool has_dynamic_output = false;
+  for (size_t i = 0; i < outputs_desc_.size(); ++i) {
+    const auto& shape = outputs_desc_[i].shape;
+    bool is_static = std::all_of(shape.begin(), shape.end(),
+                                 [](int64_t dim) { return dim > 0; });
+    if (!is_static) {
+      has_dynamic_output = true;
+      continue;
+    }
+    FDTensor& tensor = (*outputs)[i];
+    auto dtype = GetFdDtype(outputs_desc_[i].dtype);
+    bool matched = tensor.shape == shape && tensor.dtype == dtype &&
+                   tensor.device == Device::CPU;
+    // Keep the memory bound by Runtime::BindOutputTensor if it matches
+    if (!matched || (tensor.IsShared() && copy_to_fd)) {
+      tensor.Resize(shape, dtype, outputs_desc_[i].name);
+    }
+    tensor.name = outputs_desc_[i].name;
+    if (bound_outputs_ptr_[i] == tensor.MutableData()) {
+      continue;
+    }
+    auto ort_value = CreateOrtValue(tensor, false);
+    binding_->BindOutput(outputs_desc_[i].name.c_str(), ort_value);
+    bound_outputs_ptr_[i] = tensor.MutableData();
+  }
+
+  RUNTIME_PROFILE_LOOP_BEGIN(1)
+  try {
+    session_->Run({}, *(binding_.get()));
+  } catch (const std::exception& e) {
+    FDERROR << "Failed to Infer: " << e.what() << std::endl;
+    return false;
+  }
+  RUNTIME_PROFILE_LOOP_END
+
+  if (has_dynamic_output) {
+    std::vector<Ort::Value> ort_outputs = binding_->GetOutputValues();
+    for (size_t i = 0; i < ort_outputs.size(); ++i) {
+      if (bound_outputs_ptr_[i] != nullptr) {
+        continue;
+      }
+      OrtValueToFDTensor(ort_outputs[i], &((*outputs)[i]),
+                         outputs_desc_[i].name, copy_to_fd);
+    }
+  }
+  RUNTIME_PROFILE_LOOP_H2D_D2H_END
+  return true;
+}
+
 TensorInfo OrtBackend::GetInputInfo(int index) {
   FDASSERT(index < NumInputs(),
            "The index: %d should less than the number of inputs: %d.", index,
@@ -381,4 +474,57 @@ void OrtBackend::InitCustomOperators() {
 #endif
 }
 
+std::unique_ptr<BaseBackend> OrtBackend::Clone(RuntimeOption& runtime_option,
+                                               void* stream, int device_id) {
+  std::unique_ptr<BaseBackend> new_backend = utils::make_unique<OrtBackend>();
+  auto casted_backend = dynamic_cast<OrtBackend*>(new_backend.get());
+  // The env and prepacked weights are always shared, so even an engine
+  // rebuilt for another device/stream will not repack the weights again
+  casted_backend->env_ = env_;
+  casted_backend->prepacked_weights_ = prepacked_weights_;
+  bool other_device = device_id >= 0 && device_id != option_.device_id;
+  if (option_.device == Device::GPU && (other_device || stream != nullptr)) {
+    auto clone_option = option_;
+    if (other_device) {
+      clone_option.device_id = device_id;
+    }
+    clone_option.external_stream_ = stream;
+    std::string model_buffer = "";
+    if (runtime_option.model_from_memory_) {
+      model_buffer = runtime_option.model_file;
+    } else {
+      FDASSERT(ReadBinaryFromFile(runtime_option.model_file, &model_buffer),
+               "Fail to read binary from model file while cloning OrtBackend.");
+    }
+    casted_backend->model_file_name = model_file_name;
+    FDASSERT(casted_backend->InitFromOnnx(model_buffer, clone_option),
+             "Clone model from ONNX failed while initialize OrtBackend.");
+    FDWARNING << "The target device id/stream is different from current "
+                 "engine, OrtBackend will create a new session which only "
+                 "shares the prepacked weights with current engine."
+              << std::endl;
+    return new_backend;
+  }
+
+  casted_backend->option_ = option_;
+  casted_backend->session_ = session_;
+  casted_backend->model_file_name = model_file_name;
+  casted_backend->converted_to_fp16 = converted_to_fp16;
+  casted_backend->inputs_desc_.assign(inputs_desc_.begin(), inputs_desc_.end());
+  casted_backend->outputs_desc_.assign(outputs_desc_.begin(),
+                                       outputs_desc_.end());
+  // Each clone owns its IoBinding, so the output buffers allocated by
+  // onnxruntime will not be overwritten by the other clones
+  casted_backend->binding_ = std::make_shared<Ort::IoBinding>(*session_);
+  for (size_t i = 0; i < outputs_desc_.size(); ++i) {
+    Ort::MemoryInfo out_memory_info("Cpu", OrtDeviceAllocator, 0,
+                                    OrtMemTypeDefault);
+    casted_backend->binding_->BindOutput(outputs_desc_[i].name.c_str(),
+                                         out_memory_info);
+  }
+  casted_backend->initialized_ = true;
+  FDINFO << "OrtBackend clone finish." << std::endl;
+  return new_backend;
+}
+
 }  // namespace fastdeploy
@@ -55,6 +55,10 @@ class OrtBackend : public BaseBackend {
   static std::vector<OrtCustomOp*> custom_operators_;
   void InitCustomOperators();
 
+  std::unique_ptr<BaseBackend> Clone(RuntimeOption& runtime_option,
+                                     void* stream = nullptr,
+                                     int device_id = -1) override;
+
  private:
   bool InitFromPaddle(const std::string& model_buffer,
                       const std::string& params_buffer,
@@ -64,8 +68,11 @@ class OrtBackend : public BaseBackend {
   bool InitFromOnnx(const std::string& model_buffer,
                     const OrtBackendOption& option = OrtBackendOption());
 
-  Ort::Env env_;
-  Ort::Session session_{nullptr};
+  // The env, session and prepacked weights are shared by all the backends
+  // cloned from the same model, while IoBinding is owned by each clone
+  std::shared_ptr<Ort::Env> env_;
+  std::shared_ptr<Ort::Session> session_;
+  std::shared_ptr<Ort::PrepackedWeightsContainer> prepacked_weights_;
   Ort::SessionOptions session_options_;
   std::shared_ptr<Ort::IoBinding> binding_;
   std::vector<OrtValueInfo> inputs_desc_;
@@ -83,5 +90,14 @@ class OrtBackend : public BaseBackend {
   OrtBackendOption option_;
   void OrtValueToFDTensor(const Ort::Value& value, FDTensor* tensor,
                           const std::string& name, bool copy_to_fd);
+
+  // Infer while OrtBackendOption::enable_persistent_binding is true
+  bool InferWithPersistentBinding(std::vector<FDTensor>& inputs,
+                                  std::vector<FDTensor>* outputs,
+                                  bool copy_to_fd);
+  // The inputs/outputs memory bound to binding_ by last inference
+  std::vector<OrtValueInfo> bound_inputs_;
+  std::vector<const void*> bound_inputs_ptr_;
+  std::vector<void*> bound_outputs_ptr_;
 };
 }  // namespace fastdeploy
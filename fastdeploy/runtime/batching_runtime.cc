@@ -0,0 +1,262 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/runtime/batching_runtime.h"
+
+#include <algorithm>
+
+#include "fastdeploy/function/concat.h"
+#include "fastdeploy/function/split.h"
+#include "fastdeploy/utils/unique_ptr.h"
+#include "fastdeploy/utils/utils.h"
+
+namespace fastdeploy {
+
+BatchingRuntime::~BatchingRuntime() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+bool BatchingRuntime::Init(const RuntimeOption& option, int max_batch_size,
+                           int max_delay_us) {
+  if (worker_.joinable()) {
+    FDERROR << "BatchingRuntime is already initlized, cannot initialize again."
+            << std::endl;
+    return false;
+  }
+  if (max_batch_size <= 0 || max_delay_us < 0) {
+    FDERROR << "The max_batch_size should be greater than 0 and the "
+               "max_delay_us should not be less than 0, but now they are "
+            << max_batch_size << " and " << max_delay_us << "." << std::endl;
+    return false;
+  }
+  max_batch_size_ = max_batch_size;
+  max_delay_us_ = max_delay_us;
+  runtime_ = utils::make_unique<Runtime>();
+  if (!runtime_->Init(option)) {
+    FDERROR << "Failed to initialize the Runtime of BatchingRuntime."
+            << std::endl;
+    return false;
+  }
+  worker_ = std::thread(&BatchingRuntime::Run, this);
+  return true;
+}
+
+bool BatchingRuntime::Infer(std::vector<FDTensor>& input_tensors,
+                            std::vector<FDTensor>* output_tensors) {
+  if (!worker_.joinable()) {
+    FDERROR << "BatchingRuntime is not initialized." << std::endl;
+    return false;
+  }
+  if (input_tensors.size() != runtime_->NumInputs()) {
+    FDERROR << "[BatchingRuntime] Size of the inputs(" << input_tensors.size()
+            << ") should keep same with the inputs of this model("
+            << runtime_->NumInputs() << ")." << std::endl;
+    return false;
+  }
+  for (const auto& tensor : input_tensors) {
+    if (tensor.device != Device::CPU || tensor.shape.empty()) {
+      FDERROR << "BatchingRuntime only supports the input tensors on CPU "
+                 "with batch dimension, but the tensor "
+              << tensor.name << " is not." << std::endl;
+      return false;
+    }
+  }
+
+  auto request = std::make_shared<Request>();
+  request->inputs = &input_tensors;
+  request->outputs = output_tensors;
+  request->batch_size = static_cast<int>(input_tensors[0].shape[0]);
+  request->arrival = std::chrono::steady_clock::now();
+  auto result = request->result.get_future();
+  int queue_depth = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_depth = static_cast<int>(queue_.size());
+    queue_.push_back(request);
+  }
+  cv_.notify_all();
+  {
+    std::lock_guard<std::mutex> lock(stat_mutex_);
+    statistics_.num_requests += 1;
+    statistics_.queue_depth_histogram[queue_depth] += 1;
+  }
+  return result.get();
+}
+
+BatchingStatistics BatchingRuntime::GetStatistics() {
+  std::lock_guard<std::mutex> lock(stat_mutex_);
+  return statistics_;
+}
+
+void BatchingRuntime::ResetStatistics() {
+  std::lock_guard<std::mutex> lock(stat_mutex_);
+  statistics_ = BatchingStatistics();
+}
+
+void BatchingRuntime::Run() {
+  std::vector<std::shared_ptr<Request>> batch;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      // Wait for more requests until the batch is full or the first
+      // request has waited for max_delay_us, the requests which cannot be
+      // merged with the first one don't fill its batch
+      auto deadline = queue_.front()->arrival +
+                      std::chrono::microseconds(max_delay_us_);
+      cv_.wait_until(lock, deadline, [this] {
+        return stop_ || MergeableSamples() >= max_batch_size_;
+      });
+      PopBatch(&batch);
+    }
+    InferBatch(batch);
+    batch.clear();
+  }
+}
+
+bool BatchingRuntime::CanMerge(const Request& a, const Request& b) const {
+  if (a.inputs->size() != b.inputs->size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.inputs->size(); ++i) {
+    const FDTensor& x = (*a.inputs)[i];
+    const FDTensor& y = (*b.inputs)[i];
+    if (x.name != y.name || x.dtype != y.dtype ||
+        x.shape.size() != y.shape.size() || x.shape[0] != a.batch_size ||
+        y.shape[0] != b.batch_size) {
+      return false;
+    }
+    if (!std::equal(x.shape.begin() + 1, x.shape.end(), y.shape.begin() + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int BatchingRuntime::MergeableSamples() const {
+  const Request& head = *queue_.front();
+  int total = head.batch_size;
+  for (size_t i = 1; i < queue_.size() && total < max_batch_size_; ++i) {
+    if (CanMerge(head, *queue_[i])) {
+      total += queue_[i]->batch_size;
+    }
+  }
+  return total;
+}
+
+void BatchingRuntime::PopBatch(std::vector<std::shared_ptr<Request>>* batch) {
+  std::deque<std::shared_ptr<Request>> remained;
+  batch->push_back(queue_.front());
+  queue_.pop_front();
+  int total = batch->front()->batch_size;
+  for (auto& request : queue_) {
+    if (total + request->batch_size <= max_batch_size_ &&
+        CanMerge(*batch->front(), *request)) {
+      total += request->batch_size;
+      batch->push_back(request);
+    } else {
+      remained.push_back(request);
+    }
+  }
+  queue_.swap(remained);
+}
+
+void BatchingRuntime::InferBatch(
+    std::vector<std::shared_ptr<Request>>& batch) {
+  {
+    std::lock_guard<std::mutex> lock(stat_mutex_);
+    statistics_.num_batches += 1;
+    statistics_.batch_size_histogram[static_cast<int>(batch.size())] += 1;
+  }
+  if (batch.size() == 1) {
+    batch[0]->result.set_value(
+        runtime_->Infer(*batch[0]->inputs, batch[0]->outputs));
+    return;
+  }
+
+  // Concatenate the inputs, the tensors share memory with the requests
+  std::vector<int> sections;
+  int total = 0;
+  for (const auto& request : batch) {
+    sections.push_back(request->batch_size);
+    total += request->batch_size;
+  }
+  size_t num_inputs = batch[0]->inputs->size();
+  std::vector<FDTensor> inputs(num_inputs);
+  for (size_t i = 0; i < num_inputs; ++i) {
+    std::vector<FDTensor> parts(batch.size());
+    for (size_t j = 0; j < batch.size(); ++j) {
+      FDTensor& tensor = (*batch[j]->inputs)[i];
+      parts[j].SetExternalData(tensor.shape, tensor.dtype, tensor.Data());
+    }
+    function::Concat(parts, &inputs[i], 0);
+    inputs[i].name = (*batch[0]->inputs)[i].name;
+  }
+
+  std::vector<FDTensor> outputs;
+  bool success = runtime_->Infer(inputs, &outputs);
+  bool batchable = true;
+  for (size_t i = 0; success && i < outputs.size(); ++i) {
+    if (outputs[i].shape.empty() || outputs[i].shape[0] != total) {
+      batchable = false;
+    }
+  }
+  if (!batchable) {
+    if (!warned_unbatchable_) {
+      FDWARNING << "The outputs of model don't keep the batch dimension of "
+                   "inputs, BatchingRuntime will run the requests one by one."
+                << std::endl;
+      warned_unbatchable_ = true;
+    }
+    for (auto& request : batch) {
+      request->result.set_value(
+          runtime_->Infer(*request->inputs, request->outputs));
+    }
+    return;
+  }
+  if (!success) {
+    for (auto& request : batch) {
+      request->result.set_value(false);
+    }
+    return;
+  }
+
+  // Split the outputs back to each request
+  for (auto& request : batch) {
+    request->outputs->resize(outputs.size());
+  }
+  std::vector<FDTensor> splitted;
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    function::Split(outputs[i], sections, &splitted, 0);
+    for (size_t j = 0; j < batch.size(); ++j) {
+      splitted[j].name = outputs[i].name;
+      (*batch[j]->outputs)[i] = std::move(splitted[j]);
+    }
+  }
+  for (auto& request : batch) {
+    request->result.set_value(true);
+  }
+}
+
+}  // namespace fastdeploy
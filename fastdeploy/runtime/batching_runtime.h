@@ -0,0 +1,131 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file batching_runtime.h
+    \brief Runtime which merges the concurrent requests into batches.
+ */
+
+#pragma once
+
+#include <chrono>  // NOLINT
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "fastdeploy/runtime/runtime.h"
+
+namespace fastdeploy {
+
+/*! @brief Statistics of BatchingRuntime
+ */
+struct FASTDEPLOY_DECL BatchingStatistics {
+  /// Number of requests received by BatchingRuntime::Infer
+  int64_t num_requests = 0;
+  /// Number of inferences run by the backend
+  int64_t num_batches = 0;
+  /// Histogram of batch size(number of merged requests) -> count
+  std::map<int, int64_t> batch_size_histogram;
+  /// Histogram of queue depth while a request arrived -> count
+  std::map<int, int64_t> queue_depth_histogram;
+
+  friend std::ostream& operator<<(std::ostream& output,
+                                  const BatchingStatistics& stat) {
+    output << "BatchingStatistics(num_requests: " << stat.num_requests
+           << ", num_batches: " << stat.num_batches << ", batch_size: {";
+    for (const auto& item : stat.batch_size_histogram) {
+      output << item.first << ": " << item.second << ", ";
+    }
+    output << "}, queue_depth: {";
+    for (const auto& item : stat.queue_depth_histogram) {
+      output << item.first << ": " << item.second << ", ";
+    }
+    output << "})";
+    return output;
+  }
+};
+
+/*! @brief BatchingRuntime merges the single requests from multiple threads into one batch along axis 0, runs the backend once and splits the results back to each request
+ */
+class FASTDEPLOY_DECL BatchingRuntime {
+ public:
+  BatchingRuntime() {}
+  ~BatchingRuntime();
+
+  /** \brief Intialize the inner Runtime and start the batching thread
+   *
+   * \param[in] option RuntimeOption of the inner Runtime, the model should support dynamic batch size
+   * \param[in] max_batch_size Max number of samples(the total size of axis 0 of the inputs) in one batch
+   * \param[in] max_delay_us Max time in microseconds the first request of a batch waits for the following requests
+   * \return true if the initialization successed, otherwise false
+   */
+  bool Init(const RuntimeOption& option, int max_batch_size = 8,
+            int max_delay_us = 1000);
+
+  /** \brief Inference the model, can be called by multiple threads at the same time, and will block until the batch containing this request is done
+   *
+   * \param[in] input_tensors Notice the FDTensor::name should keep same with the model's input
+   * \param[in] output_tensors Inference results
+   * \return true if the inference successed, otherwise false
+   */
+  bool Infer(std::vector<FDTensor>& input_tensors,
+             std::vector<FDTensor>* output_tensors);
+
+  /// Get the statistics of requests and batches
+  BatchingStatistics GetStatistics();
+
+  /// Reset the statistics of requests and batches
+  void ResetStatistics();
+
+  /// Get the inner Runtime
+  Runtime* GetRuntime() { return runtime_.get(); }
+
+ private:
+  struct Request {
+    std::vector<FDTensor>* inputs;
+    std::vector<FDTensor>* outputs;
+    int batch_size;
+    std::chrono::steady_clock::time_point arrival;
+    std::promise<bool> result;
+  };
+
+  void Run();
+  // Total size of axis 0 of the requests in queue_ which can be merged
+  // with the first one
+  int MergeableSamples() const;
+  // Pop the requests which can be merged with the first one in queue_
+  void PopBatch(std::vector<std::shared_ptr<Request>>* batch);
+  void InferBatch(std::vector<std::shared_ptr<Request>>& batch);
+  bool CanMerge(const Request& a, const Request& b) const;
+
+  std::unique_ptr<Runtime> runtime_;
+  int max_batch_size_ = 8;
+  int max_delay_us_ = 1000;
+
+  std::deque<std::shared_ptr<Request>> queue_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_ = false;
+  std::thread worker_;
+  bool warned_unbatchable_ = false;
+
+  std::mutex stat_mutex_;
+  BatchingStatistics statistics_;
+};
+
+}  // namespace fastdeploy
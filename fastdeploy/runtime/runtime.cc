@@ -179,6 +179,16 @@ bool Runtime::Infer(std::vector<FDTensor>& input_tensors,
   return backend_->Infer(input_tensors, output_tensors);
 }
 
+std::future<bool> Runtime::InferAsync(std::vector<FDTensor>& input_tensors,
+                                      std::vector<FDTensor>* output_tensors) {
+  for (auto& tensor : input_tensors) {
+    FDASSERT(tensor.device_id < 0 || tensor.device_id == option.device_id,
+             "Device id of input tensor(%d) and runtime(%d) are not same.",
+             tensor.device_id, option.device_id);
+  }
+  return backend_->InferAsync(input_tensors, output_tensors);
+}
+
 bool Runtime::Infer() {
   bool result = false;
   // All devices now use the same inference path
@@ -325,9 +335,9 @@ void Runtime::CreateSophgoNPUBackend() {
 
 Runtime* Runtime::Clone(void* stream, int device_id) {
   Runtime* runtime = new Runtime();
-  if (option.backend != Backend::OPENVINO) {
+  if (option.backend != Backend::OPENVINO && option.backend != Backend::ORT) {
     runtime->Init(option);
-    FDWARNING << "Only OpenVINO support \
+    FDWARNING << "Only OpenVINO/ORT support \
                   clone engine to  reduce CPU/GPU memory usage now. For "
               << option.backend
               << ", FastDeploy will create a new engine which \
@@ -48,6 +48,15 @@ struct FASTDEPLOY_DECL Runtime {
   bool Infer(std::vector<FDTensor>& input_tensors,
              std::vector<FDTensor>* output_tensors);
 
+  /** \brief Asynchronously inference the model by the input data, the backends which support multiple inference requests(e.g OpenVINO) can run the calls concurrently
+   *
+   * \param[in] input_tensors Notice the FDTensor::name should keep same with the model's input, should be kept alive until the returned future is ready
+   * \param[in] output_tensors Inference results, will be written when the returned future is ready
+   * \return future of the inference, its value is true if the inference successed, otherwise false
+   */
+  std::future<bool> InferAsync(std::vector<FDTensor>& input_tensors,
+                               std::vector<FDTensor>* output_tensors);
+
   /** \brief No params inference the model.
    *
    *  the input and output data need to pass through the BindInputTensor and GetOutputTensor interfaces.
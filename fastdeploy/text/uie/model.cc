@@ -17,13 +17,11 @@
 #include <algorithm>
 #include <codecvt>
 #include <locale>
-#include <queue>
+#include <numeric>
 #include <sstream>
 
 #include "fast_tokenizer/pretokenizers/pretokenizer.h"
 #include "fast_tokenizer/utils/utf8.h"
-#include "fastdeploy/function/concat.h"
-#include "fastdeploy/function/split.h"
 
 namespace fastdeploy {
 namespace text {
@@ -561,19 +559,29 @@ void UIEModel::Preprocess(
   }
   tokenizer_.EncodeBatchStrings(text_pair_input, encodings);
   // 2. Construct the input vector tensor
-  // 2.1 Allocate input tensor
-  int64_t batch_size = input_texts.size();
   int64_t seq_len = 0;
-  if (batch_size > 0) {
+  if (encodings->size() > 0) {
     seq_len = (*encodings)[0].GetIds().size();
   }
+  std::vector<size_t> indices(encodings->size());
+  std::iota(indices.begin(), indices.end(), 0);
+  ConstructBatchInputs(*encodings, indices.data(), indices.size(), seq_len,
+                       inputs);
+}
+
+void UIEModel::ConstructBatchInputs(
+    const std::vector<fast_tokenizer::core::Encoding>& encodings,
+    const size_t* indices, size_t batch_size, int64_t seq_len,
+    std::vector<fastdeploy::FDTensor>* inputs) {
+  // 1. Allocate input tensor
   inputs->resize(NumInputsOfRuntime());
   for (int i = 0; i < NumInputsOfRuntime(); ++i) {
-    (*inputs)[i].Allocate({batch_size, seq_len}, fastdeploy::FDDataType::INT64,
+    (*inputs)[i].Allocate({static_cast<int64_t>(batch_size), seq_len},
+                          fastdeploy::FDDataType::INT64,
                           InputInfoOfRuntime(i).name);
   }
 
-  // 2.2 Set the value of data
+  // 2. Set the value of data
   size_t start = 0;
   int64_t* input_ids_ptr =
       reinterpret_cast<int64_t*>((*inputs)[0].MutableData());
@@ -583,21 +591,89 @@ void UIEModel::Preprocess(
   int64_t* attn_mask_ptr =
       reinterpret_cast<int64_t*>((*inputs)[3].MutableData());
 
-  for (int i = 0; i < encodings->size(); ++i) {
-    auto&& curr_input_ids = (*encodings)[i].GetIds();
-    auto&& curr_type_ids = (*encodings)[i].GetTypeIds();
-    auto&& curr_attn_mask = (*encodings)[i].GetAttentionMask();
+  for (size_t i = 0; i < batch_size; ++i) {
+    auto&& curr_input_ids = encodings[indices[i]].GetIds();
+    auto&& curr_type_ids = encodings[indices[i]].GetTypeIds();
+    auto&& curr_attn_mask = encodings[indices[i]].GetAttentionMask();
+    // The encodings longer than seq_len only have padding tokens after
+    // seq_len, and the shorter ones are padded with 0
+    int64_t len = (std::min)(seq_len,
+                             static_cast<int64_t>(curr_input_ids.size()));
 
-    std::copy(curr_input_ids.begin(), curr_input_ids.end(),
+    std::copy(curr_input_ids.begin(), curr_input_ids.begin() + len,
               input_ids_ptr + start);
-    std::copy(curr_type_ids.begin(), curr_type_ids.end(), type_ids_ptr + start);
+    std::copy(curr_type_ids.begin(), curr_type_ids.begin() + len,
+              type_ids_ptr + start);
     std::iota(pos_ids_ptr + start, pos_ids_ptr + start + seq_len, 0);
-    std::copy(curr_attn_mask.begin(), curr_attn_mask.end(),
+    std::copy(curr_attn_mask.begin(), curr_attn_mask.begin() + len,
               attn_mask_ptr + start);
+    std::fill(input_ids_ptr + start + len, input_ids_ptr + start + seq_len, 0);
+    std::fill(type_ids_ptr + start + len, type_ids_ptr + start + seq_len, 0);
+    std::fill(attn_mask_ptr + start + len, attn_mask_ptr + start + seq_len, 0);
     start += seq_len;
   }
 }
 
+bool UIEModel::BucketedInfer(
+    const std::vector<fast_tokenizer::core::Encoding>& encodings,
+    std::vector<std::vector<IDX_PROB>>* start_candidate_idx_prob,
+    std::vector<std::vector<IDX_PROB>>* end_candidate_idx_prob) {
+  // 1. Sort the encodings by the number of valid tokens, so the encodings in
+  // one bucket are padded to the similar length
+  size_t encoding_size = encodings.size();
+  std::vector<int64_t> valid_lens(encoding_size);
+  for (size_t i = 0; i < encoding_size; ++i) {
+    auto&& attn_mask = encodings[i].GetAttentionMask();
+    valid_lens[i] = std::count_if(attn_mask.begin(), attn_mask.end(),
+                                  [](uint32_t mask) { return mask != 0; });
+  }
+  std::vector<size_t> indices(encoding_size);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::stable_sort(indices.begin(), indices.end(),
+                   [&valid_lens](size_t lhs, size_t rhs) {
+                     return valid_lens[lhs] < valid_lens[rhs];
+                   });
+
+  // 2. Infer the buckets, the outputs are consumed by GetCandidateIdx
+  // directly without concatenating them
+  start_candidate_idx_prob->clear();
+  end_candidate_idx_prob->clear();
+  start_candidate_idx_prob->resize(encoding_size);
+  end_candidate_idx_prob->resize(encoding_size);
+  size_t bucket_size = batch_size_ > 0 ? batch_size_ : encoding_size;
+  std::vector<fastdeploy::FDTensor> inputs;
+  std::vector<fastdeploy::FDTensor> outputs(NumOutputsOfRuntime());
+  std::vector<std::vector<IDX_PROB>> start_candidates, end_candidates;
+  for (size_t i = 0; i < encoding_size; i += bucket_size) {
+    size_t actual_batch_size = (std::min)(bucket_size, encoding_size - i);
+    int64_t seq_len = 0;
+    for (size_t j = i; j < i + actual_batch_size; ++j) {
+      seq_len = (std::max)(seq_len, valid_lens[indices[j]]);
+    }
+    ConstructBatchInputs(encodings, indices.data() + i, actual_batch_size,
+                         seq_len, &inputs);
+    if (!Infer(inputs, &outputs)) {
+      FDERROR << "Failed to inference while using model:" << ModelName()
+              << "." << std::endl;
+      return false;
+    }
+    start_candidates.clear();
+    end_candidates.clear();
+    GetCandidateIdx(reinterpret_cast<const float*>(outputs[0].Data()),
+                    outputs[0].shape[0], outputs[0].shape[1],
+                    &start_candidates, position_prob_);
+    GetCandidateIdx(reinterpret_cast<const float*>(outputs[1].Data()),
+                    outputs[1].shape[0], outputs[1].shape[1], &end_candidates,
+                    position_prob_);
+    for (size_t j = 0; j < actual_batch_size; ++j) {
+      (*start_candidate_idx_prob)[indices[i + j]] =
+          std::move(start_candidates[j]);
+      (*end_candidate_idx_prob)[indices[i + j]] = std::move(end_candidates[j]);
+    }
+  }
+  return true;
+}
+
 void UIEModel::Postprocess(
     const std::vector<fastdeploy::FDTensor>& outputs,
     const std::vector<fast_tokenizer::core::Encoding>& encodings,
@@ -614,20 +690,28 @@ void UIEModel::Postprocess(
                   &start_candidate_idx_prob, position_prob_);
   GetCandidateIdx(end_prob, outputs[1].shape[0], outputs[1].shape[1],
                   &end_candidate_idx_prob, position_prob_);
+  PostprocessCandidates(start_candidate_idx_prob, end_candidate_idx_prob,
+                        encodings, 0, short_input_texts, short_prompts,
+                        input_mapping_with_short_text, results);
+}
 
-  std::vector<std::vector<fast_tokenizer::core::Offset>> offset_mapping;
-  for (int i = 0; i < encodings.size(); ++i) {
-    auto&& curr_offsets = encodings[i].GetOffsets();
-    offset_mapping.push_back(curr_offsets);
-  }
-
+void UIEModel::PostprocessCandidates(
+    const std::vector<std::vector<IDX_PROB>>& start_candidate_idx_prob,
+    const std::vector<std::vector<IDX_PROB>>& end_candidate_idx_prob,
+    const std::vector<fast_tokenizer::core::Encoding>& encodings,
+    size_t offset, const std::vector<std::string>& short_input_texts,
+    const std::vector<std::string>& short_prompts,
+    const std::vector<std::vector<size_t>>& input_mapping_with_short_text,
+    std::vector<std::vector<UIEResult>>* results) {
   SPAN_SET span_set;
-  auto batch_size = outputs[0].shape[0];
+  auto batch_size = short_input_texts.size();
   std::vector<std::vector<float>> probs(batch_size);
   std::vector<std::vector<SpanIdx>> span_idxs(batch_size);
   for (int i = 0; i < batch_size; ++i) {
-    GetSpan(start_candidate_idx_prob[i], end_candidate_idx_prob[i], &span_set);
-    GetSpanIdxAndProbs(span_set, offset_mapping[i], &span_idxs[i], &probs[i]);
+    GetSpan(start_candidate_idx_prob[offset + i],
+            end_candidate_idx_prob[offset + i], &span_set);
+    GetSpanIdxAndProbs(span_set, encodings[offset + i].GetOffsets(),
+                       &span_idxs[i], &probs[i]);
     span_set.clear();
   }
   ConvertSpanToUIEResult(short_input_texts, short_prompts, span_idxs, probs,
@@ -723,78 +807,76 @@ void UIEModel::Predict(
     const std::vector<std::string>& texts,
     std::vector<std::unordered_map<std::string, std::vector<UIEResult>>>*
         results) {
-  std::queue<SchemaNode> nodes;
-  for (auto& node : schema_->root_->children_) {
-    nodes.push(node);
-  }
+  // The nodes of the same depth are independent of each other, so their
+  // prompts are tokenized and inferred together
+  std::vector<SchemaNode> nodes = schema_->root_->children_;
   results->resize(texts.size());
   while (!nodes.empty()) {
-    auto node = nodes.front();
-    nodes.pop();
-    std::vector<std::vector<size_t>> input_mapping_with_raw_texts;
-    std::vector<std::vector<size_t>> input_mapping_with_short_text;
-    std::vector<std::string> short_input_texts;
-    std::vector<std::string> short_prompts;
-    // 1. Construct texts and prompts from raw text
-    bool has_prompt = ConstructTextsAndPrompts(
-        texts, node.name_, node.prefix_, &short_input_texts, &short_prompts,
-        &input_mapping_with_raw_texts, &input_mapping_with_short_text);
-    std::vector<std::vector<UIEResult>> results_list;
-    if (has_prompt) {
-      // 2. Convert texts and prompts to FDTensor
-      std::vector<FDTensor> inputs;
-      std::vector<fast_tokenizer::core::Encoding> encodings;
-      Preprocess(short_input_texts, short_prompts, &encodings, &inputs);
-
-      std::vector<std::vector<FDTensor>> inputs_vec(NumInputsOfRuntime());
-      int encoding_size = encodings.size();
-      std::vector<int> num_or_sections;
-      for (int i = 0; i < encoding_size; i += batch_size_) {
-        int actual_batch_size = (std::min)(batch_size_, encoding_size - i);
-        num_or_sections.push_back(actual_batch_size);
+    size_t num_nodes = nodes.size();
+    std::vector<std::vector<std::vector<size_t>>> input_mapping_with_raw_texts(
+        num_nodes);
+    std::vector<std::vector<std::vector<size_t>>> input_mapping_with_short_text(
+        num_nodes);
+    std::vector<std::vector<std::string>> short_input_texts(num_nodes);
+    std::vector<std::vector<std::string>> short_prompts(num_nodes);
+    std::vector<bool> has_prompt(num_nodes);
+    std::vector<size_t> encoding_offsets(num_nodes, 0);
+    std::vector<fast_tokenizer::core::EncodeInput> text_pair_input;
+    for (size_t i = 0; i < num_nodes; ++i) {
+      // 1. Construct texts and prompts from raw text
+      has_prompt[i] = ConstructTextsAndPrompts(
+          texts, nodes[i].name_, nodes[i].prefix_, &short_input_texts[i],
+          &short_prompts[i], &input_mapping_with_raw_texts[i],
+          &input_mapping_with_short_text[i]);
+      if (!has_prompt[i]) {
+        continue;
       }
-      for (int i = 0; i < NumInputsOfRuntime(); ++i) {
-        function::Split(inputs[i], num_or_sections, &inputs_vec[i]);
+      encoding_offsets[i] = text_pair_input.size();
+      for (size_t j = 0; j < short_input_texts[i].size(); ++j) {
+        text_pair_input.emplace_back(std::pair<std::string, std::string>(
+            short_prompts[i][j], short_input_texts[i][j]));
       }
+    }
 
-      // 3. Infer
-      std::vector<fastdeploy::FDTensor> outputs(NumOutputsOfRuntime());
-      std::vector<fastdeploy::FDTensor> outputs0, outputs1;
-
-      for (int i = 0; i < inputs_vec[0].size(); ++i) {
-        std::vector<fastdeploy::FDTensor> curr_inputs(NumInputsOfRuntime());
-        std::vector<fastdeploy::FDTensor> curr_outputs(NumOutputsOfRuntime());
-        for (int j = 0; j < NumInputsOfRuntime(); ++j) {
-          curr_inputs[j] = std::move(inputs_vec[j][i]);
-          curr_inputs[j].name = inputs[j].name;
-        }
-        if (!Infer(curr_inputs, &curr_outputs)) {
-          FDERROR << "Failed to inference while using model:" << ModelName()
-                  << "." << std::endl;
-        }
-        outputs0.push_back(curr_outputs[0]);
-        outputs1.push_back(curr_outputs[1]);
+    // 2. Tokenize and infer the prompts of all the nodes
+    std::vector<fast_tokenizer::core::Encoding> encodings;
+    std::vector<std::vector<IDX_PROB>> start_candidate_idx_prob,
+        end_candidate_idx_prob;
+    if (!text_pair_input.empty()) {
+      tokenizer_.EncodeBatchStrings(text_pair_input, &encodings);
+      if (!BucketedInfer(encodings, &start_candidate_idx_prob,
+                         &end_candidate_idx_prob)) {
+        return;
       }
-      function::Concat(outputs0, &outputs[0]);
-      function::Concat(outputs1, &outputs[1]);
-      // 4. Convert FDTensor to UIEResult
-      Postprocess(outputs, encodings, short_input_texts, short_prompts,
-                  input_mapping_with_short_text, &results_list);
     }
-    // 5. Construct the new relation of the UIEResult
-    std::vector<std::vector<UIEResult*>> relations;
-    ConstructChildRelations(node.relations_, input_mapping_with_raw_texts,
-                            results_list, node.name_, results, &relations);
-
-    // 6. Construct the next prompt prefix
-    std::vector<std::vector<std::string>> prefix(texts.size());
-    ConstructChildPromptPrefix(input_mapping_with_raw_texts, results_list,
-                               &prefix);
-    for (auto& node_child : node.children_) {
-      node_child.relations_ = relations;
-      node_child.prefix_ = prefix;
-      nodes.push(node_child);
+
+    std::vector<SchemaNode> next_nodes;
+    for (size_t i = 0; i < num_nodes; ++i) {
+      auto& node = nodes[i];
+      // 3. Convert the candidate idx to UIEResult
+      std::vector<std::vector<UIEResult>> results_list;
+      if (has_prompt[i]) {
+        PostprocessCandidates(start_candidate_idx_prob, end_candidate_idx_prob,
+                              encodings, encoding_offsets[i],
+                              short_input_texts[i], short_prompts[i],
+                              input_mapping_with_short_text[i], &results_list);
+      }
+      // 4. Construct the new relation of the UIEResult
+      std::vector<std::vector<UIEResult*>> relations;
+      ConstructChildRelations(node.relations_, input_mapping_with_raw_texts[i],
+                              results_list, node.name_, results, &relations);
+
+      // 5. Construct the next prompt prefix
+      std::vector<std::vector<std::string>> prefix(texts.size());
+      ConstructChildPromptPrefix(input_mapping_with_raw_texts[i], results_list,
+                                 &prefix);
+      for (auto& node_child : node.children_) {
+        node_child.relations_ = relations;
+        node_child.prefix_ = prefix;
+        next_nodes.push_back(node_child);
+      }
     }
+    nodes = std::move(next_nodes);
   }
 }
 
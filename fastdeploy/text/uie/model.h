@@ -192,6 +192,28 @@ struct FASTDEPLOY_DECL UIEModel : public FastDeployModel {
       const SPAN_SET& span_set,
       const std::vector<fast_tokenizer::core::Offset>& offset_mapping,
       std::vector<SpanIdx>* span_idxs, std::vector<float>* probs) const;
+  // Fill the inputs of runtime with the encodings of indices, which are
+  // padded or truncated to seq_len
+  void ConstructBatchInputs(
+      const std::vector<fast_tokenizer::core::Encoding>& encodings,
+      const size_t* indices, size_t batch_size, int64_t seq_len,
+      std::vector<fastdeploy::FDTensor>* inputs);
+  // Sort the encodings by length and infer them in buckets of batch_size_,
+  // then get the candidate start/end idx of every encoding
+  bool BucketedInfer(
+      const std::vector<fast_tokenizer::core::Encoding>& encodings,
+      std::vector<std::vector<IDX_PROB>>* start_candidate_idx_prob,
+      std::vector<std::vector<IDX_PROB>>* end_candidate_idx_prob);
+  // Convert the candidate idx of encodings[offset, offset + the size of
+  // short_input_texts) to UIEResult
+  void PostprocessCandidates(
+      const std::vector<std::vector<IDX_PROB>>& start_candidate_idx_prob,
+      const std::vector<std::vector<IDX_PROB>>& end_candidate_idx_prob,
+      const std::vector<fast_tokenizer::core::Encoding>& encodings,
+      size_t offset, const std::vector<std::string>& short_input_texts,
+      const std::vector<std::string>& short_prompts,
+      const std::vector<std::vector<size_t>>& input_mapping_with_short_text,
+      std::vector<std::vector<UIEResult>>* results);
   void
   ConvertSpanToUIEResult(const std::vector<std::string>& texts,
                          const std::vector<std::string>& prompts,
@@ -80,7 +80,10 @@ void BindUIE(pybind11::module& m) {
             std::vector<
                 std::unordered_map<std::string, std::vector<text::UIEResult>>>
                 results;
-            self.Predict(texts, &results);
+            {
+              pybind11::gil_scoped_release release;
+              self.Predict(texts, &results);
+            }
             return results;
           },
           py::arg("text"));
@@ -0,0 +1,170 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/utils/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>  // NOLINT
+#include <vector>
+
+namespace fastdeploy {
+namespace utils {
+
+namespace {
+
+struct ParallelJob {
+  const std::function<void(int64_t, int64_t)>* func;
+  int64_t n;
+  int64_t chunk_size;
+  int64_t num_chunks;
+  std::atomic<int64_t> next_chunk{0};
+  std::atomic<int64_t> remaining_chunks{0};
+  std::mutex mutex;
+  std::condition_variable done;
+
+  void Run() {
+    int64_t chunk = 0;
+    while ((chunk = next_chunk.fetch_add(1)) < num_chunks) {
+      int64_t begin = chunk * chunk_size;
+      int64_t end = std::min(begin + chunk_size, n);
+      (*func)(begin, end);
+      if (remaining_chunks.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        done.notify_all();
+      }
+    }
+  }
+};
+
+thread_local bool in_parallel_region = false;
+
+class ThreadPool {
+ public:
+  static ThreadPool& Instance() {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Make sure there are at least num_workers threads in the pool
+  void Reserve(int num_workers) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (static_cast<int>(workers_.size()) < num_workers) {
+      workers_.emplace_back([this] { Loop(); });
+    }
+  }
+
+  void Submit(const std::shared_ptr<ParallelJob>& job, int times) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (int i = 0; i < times; ++i) {
+        jobs_.push_back(job);
+      }
+    }
+    cv_.notify_all();
+  }
+
+ private:
+  void Loop() {
+    in_parallel_region = true;
+    while (true) {
+      std::shared_ptr<ParallelJob> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+        if (stop_ && jobs_.empty()) {
+          return;
+        }
+        job = jobs_.front();
+        jobs_.pop_front();
+      }
+      job->Run();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::deque<std::shared_ptr<ParallelJob>> jobs_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_ = false;
+};
+
+std::atomic<int> default_num_threads{-1};
+
+}  // namespace
+
+void SetParallelThreadNum(int num_threads) {
+  default_num_threads = num_threads;
+}
+
+int GetParallelThreadNum() {
+  int num_threads = default_num_threads;
+  if (num_threads <= 0) {
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  return std::max(num_threads, 1);
+}
+
+void ParallelFor(int64_t n, const std::function<void(int64_t, int64_t)>& func,
+                 int64_t grain_size, int num_threads) {
+  if (n <= 0) {
+    return;
+  }
+  if (num_threads <= 0) {
+    num_threads = GetParallelThreadNum();
+  }
+  grain_size = std::max<int64_t>(grain_size, 1);
+  int64_t max_chunks = (n + grain_size - 1) / grain_size;
+  num_threads = static_cast<int>(std::min<int64_t>(num_threads, max_chunks));
+  if (num_threads <= 1 || in_parallel_region) {
+    func(0, n);
+    return;
+  }
+
+  auto job = std::make_shared<ParallelJob>();
+  job->func = &func;
+  job->n = n;
+  job->chunk_size = (n + num_threads - 1) / num_threads;
+  job->num_chunks = (n + job->chunk_size - 1) / job->chunk_size;
+  job->remaining_chunks = job->num_chunks;
+
+  auto& pool = ThreadPool::Instance();
+  pool.Reserve(num_threads - 1);
+  pool.Submit(job, static_cast<int>(job->num_chunks) - 1);
+
+  in_parallel_region = true;
+  job->Run();
+  in_parallel_region = false;
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->done.wait(lock, [&job] { return job->remaining_chunks == 0; });
+}
+
+}  // namespace utils
+}  // namespace fastdeploy
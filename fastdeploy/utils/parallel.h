@@ -0,0 +1,47 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "fastdeploy/utils/utils.h"
+
+namespace fastdeploy {
+namespace utils {
+
+/** \brief Run func(begin, end) over the chunks of [0, n) with the threads of a
+ *  global thread pool, the calling thread will also run part of the chunks.
+ *  It's safe to call ParallelFor from multiple threads, the nested calls from
+ *  inside func will run serially in the current thread.
+ *
+ * \param[in] n The number of iterations
+ * \param[in] func The function to process the iterations in [begin, end)
+ * \param[in] grain_size The minimal number of iterations in one chunk
+ * \param[in] num_threads The max number of threads to use, -1 means use the value set by SetParallelThreadNum
+ */
+FASTDEPLOY_DECL void ParallelFor(
+    int64_t n, const std::function<void(int64_t, int64_t)>& func,
+    int64_t grain_size = 1, int num_threads = -1);
+
+/** \brief Set the default max number of threads used by ParallelFor, -1 means the number of CPU cores
+ */
+FASTDEPLOY_DECL void SetParallelThreadNum(int num_threads);
+
+/// Get the default max number of threads used by ParallelFor
+FASTDEPLOY_DECL int GetParallelThreadNum();
+
+}  // namespace utils
+}  // namespace fastdeploy
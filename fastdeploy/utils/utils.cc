@@ -21,6 +21,10 @@
 #include <Windows.h>
 #endif
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
 namespace fastdeploy {
 
 bool FDLogger::enable_info = true;
@@ -112,4 +116,37 @@ std::vector<int64_t> GetStride(const std::vector<int64_t>& dims) {
   return result;
 }
 
+namespace {
+
+bool DetectAVX2() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info, 1);
+  // The OS should save the YMM registers while switching the context
+  bool os_avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) &&
+                (_xgetbv(0) & 0x6) == 0x6;
+  if (!os_avx) {
+    return false;
+  }
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#elif (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+  return __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
+bool CpuSupportsAVX2() {
+  static const bool supported = DetectAVX2();
+  return supported;
+}
+
 }  // namespace fastdeploy
@@ -207,6 +207,12 @@ FASTDEPLOY_DECL bool ReadBinaryFromFile(const std::string& file,
 FASTDEPLOY_DECL std::vector<int64_t>
 GetStride(const std::vector<int64_t>& dims);
 
+/** \brief Whether the CPU and OS support AVX2, the SIMD kernels compiled with
+ *  the target attribute are selected by it at runtime, so they work without
+ *  the ISA flags of compiler. Always false on the CPUs other than x86.
+ */
+FASTDEPLOY_DECL bool CpuSupportsAVX2();
+
 template <typename T>
 std::string Str(const std::vector<T>& shape) {
   std::ostringstream oss;
@@ -15,24 +15,24 @@
 
 #include "fastdeploy/core/config.h"
 #ifdef ENABLE_VISION
-#include "fastdeploy/vision/classification/contrib/resnet.h"
+#include "fastdeploy/vision/classification/contrib/resnet/resnet.h"
 #include "fastdeploy/vision/classification/contrib/yolov5cls/yolov5cls.h"
 #include "fastdeploy/vision/classification/ppcls/model.h"
 #include "fastdeploy/vision/classification/ppshitu/ppshituv2_rec.h"
 #include "fastdeploy/vision/classification/ppshitu/ppshituv2_det.h"
-#include "fastdeploy/vision/detection/contrib/nanodet_plus.h"
-#include "fastdeploy/vision/detection/contrib/scaledyolov4.h"
-#include "fastdeploy/vision/detection/contrib/yolor.h"
+#include "fastdeploy/vision/detection/contrib/nanodet_plus/nanodet_plus.h"
+#include "fastdeploy/vision/detection/contrib/scaledyolov4/scaledyolov4.h"
+#include "fastdeploy/vision/detection/contrib/yolor/yolor.h"
 #include "fastdeploy/vision/detection/contrib/yolov5/yolov5.h"
 #include "fastdeploy/vision/detection/contrib/yolov5seg/yolov5seg.h"
 #include "fastdeploy/vision/detection/contrib/fastestdet/fastestdet.h"
-#include "fastdeploy/vision/detection/contrib/yolov5lite.h"
-#include "fastdeploy/vision/detection/contrib/yolov6.h"
+#include "fastdeploy/vision/detection/contrib/yolov5lite/yolov5lite.h"
+#include "fastdeploy/vision/detection/contrib/yolov6/yolov6.h"
 #include "fastdeploy/vision/detection/contrib/yolov7/yolov7.h"
 #include "fastdeploy/vision/detection/contrib/yolov7end2end_ort.h"
 #include "fastdeploy/vision/detection/contrib/yolov7end2end_trt.h"
 #include "fastdeploy/vision/detection/contrib/yolov8/yolov8.h"
-#include "fastdeploy/vision/detection/contrib/yolox.h"
+#include "fastdeploy/vision/detection/contrib/yolox/yolox.h"
 #include "fastdeploy/vision/detection/contrib/rknpu2/model.h"
 #include "fastdeploy/vision/perception/paddle3d/smoke/smoke.h"
 #include "fastdeploy/vision/perception/paddle3d/petr/petr.h"
@@ -40,20 +40,20 @@
 #include "fastdeploy/vision/perception/paddle3d/caddn/caddn.h"
 #include "fastdeploy/vision/detection/ppdet/model.h"
 #include "fastdeploy/vision/facealign/contrib/face_landmark_1000.h"
-#include "fastdeploy/vision/facealign/contrib/pfld.h"
-#include "fastdeploy/vision/facealign/contrib/pipnet.h"
-#include "fastdeploy/vision/facedet/contrib/retinaface.h"
-#include "fastdeploy/vision/facedet/contrib/scrfd.h"
-#include "fastdeploy/vision/facedet/contrib/ultraface.h"
-#include "fastdeploy/vision/facedet/contrib/yolov5face.h"
+#include "fastdeploy/vision/facealign/contrib/pfld/pfld.h"
+#include "fastdeploy/vision/facealign/contrib/pipnet/pipnet.h"
+#include "fastdeploy/vision/facedet/contrib/retinaface/retinaface.h"
+#include "fastdeploy/vision/facedet/contrib/scrfd/scrfd.h"
+#include "fastdeploy/vision/facedet/contrib/ultraface/ultraface.h"
+#include "fastdeploy/vision/facedet/contrib/yolov5face/yolov5face.h"
 #include "fastdeploy/vision/facedet/contrib/yolov7face/yolov7face.h"
 #include "fastdeploy/vision/facedet/contrib/centerface/centerface.h"
 #include "fastdeploy/vision/facedet/ppdet/blazeface/blazeface.h"
 #include "fastdeploy/vision/faceid/contrib/insightface/model.h"
 #include "fastdeploy/vision/faceid/contrib/adaface/adaface.h"
-#include "fastdeploy/vision/headpose/contrib/fsanet.h"
+#include "fastdeploy/vision/headpose/contrib/fsanet/fsanet.h"
 #include "fastdeploy/vision/keypointdet/pptinypose/pptinypose.h"
-#include "fastdeploy/vision/matting/contrib/modnet.h"
+#include "fastdeploy/vision/matting/contrib/modnet/modnet.h"
 #include "fastdeploy/vision/matting/contrib/rvm.h"
 #include "fastdeploy/vision/matting/ppmatting/ppmatting.h"
 #include "fastdeploy/vision/ocr/ppocr/classifier.h"
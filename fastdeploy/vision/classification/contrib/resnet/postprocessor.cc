@@ -0,0 +1,62 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/classification/contrib/resnet/postprocessor.h"
+#include "fastdeploy/function/softmax.h"
+#include "fastdeploy/function/topk.h"
+
+namespace fastdeploy {
+namespace vision {
+namespace classification {
+
+ResNetPostprocessor::ResNetPostprocessor() { topk_ = 1; }
+
+bool ResNetPostprocessor::Run(
+    const std::vector<FDTensor>& tensors, std::vector<ClassifyResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  if (tensors[0].dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = tensors[0].shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of outputs and ims_info should be the same."
+            << std::endl;
+    return false;
+  }
+  // 1. Softmax 2. Choose topk labels of the whole batch at once
+  FDTensor infer_result_softmax;
+  function::Softmax(tensors[0], &infer_result_softmax, 1);
+  FDTensor topk_scores;
+  FDTensor topk_indices;
+  function::TopK(infer_result_softmax, &topk_scores, &topk_indices, topk_, 1,
+                 true, true, FDDataType::INT32);
+  int topk = topk_scores.shape[1];
+  const float* scores_data = reinterpret_cast<const float*>(topk_scores.Data());
+  const int32_t* indices_data =
+      reinterpret_cast<const int32_t*>(topk_indices.Data());
+  results->resize(batch);
+  for (int bs = 0; bs < batch; ++bs) {
+    (*results)[bs].Clear();
+    (*results)[bs].label_ids.assign(indices_data + bs * topk,
+                                    indices_data + (bs + 1) * topk);
+    (*results)[bs].scores.assign(scores_data + bs * topk,
+                                 scores_data + (bs + 1) * topk);
+  }
+  return true;
+}
+
+}  // namespace classification
+}  // namespace vision
+}  // namespace fastdeploy
@@ -16,6 +16,8 @@
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/classification/contrib/resnet/postprocessor.h"
+#include "fastdeploy/vision/classification/contrib/resnet/preprocessor.h"
 
 // The namespace shoulde be
 // fastdeploy::vision::classification (fastdeploy::vision::${task})
@@ -36,43 +38,53 @@ class FASTDEPLOY_DECL ResNet : public FastDeployModel {
    * \param[in] custom_option RuntimeOption for inference, the default will use cpu, and choose the backend defined in "valid_cpu_backends"
    * \param[in] model_format Model format of the loaded model, default is ONNX format
    */
-  ResNet(const std::string& model_file,
-               const std::string& params_file = "",
-               const RuntimeOption& custom_option = RuntimeOption(),
-               const ModelFormat& model_format = ModelFormat::ONNX);
+  ResNet(const std::string& model_file, const std::string& params_file = "",
+         const RuntimeOption& custom_option = RuntimeOption(),
+         const ModelFormat& model_format = ModelFormat::ONNX);
 
   virtual std::string ModelName() const { return "ResNet"; }
-   /** \brief Predict for the input "im", the result will be saved in "result".
+
+  /** \brief DEPRECATED Predict for the input "im", the result will be saved in "result", remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result Saving the inference result.
    * \param[in] topk The length of return values, e.g., if topk==2, the result will include the 2 most possible class label for input image.
    */
   virtual bool Predict(cv::Mat* im, ClassifyResult* result, int topk = 1);
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default size = {224, 224}
-  */
-  std::vector<int> size;
-  /*! @brief
-  Mean parameters for normalize, size should be the the same as channels, default mean_vals = {0.485f, 0.456f, 0.406f}
-  */
-  std::vector<float> mean_vals;
-  /*! @brief
-  Std parameters for normalize, size should be the the same as channels, default std_vals = {0.229f, 0.224f, 0.225f}
-  */
-  std::vector<float> std_vals;
 
+  /** \brief Predict the classification result for an input image
+   *
+   * \param[in] img The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output classification result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& img, ClassifyResult* result);
+
+  /** \brief Predict the classification results for a batch of input images
+   *
+   * \param[in] imgs, The input image list, each element comes from cv::imread()
+   * \param[in] results The output classification result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& imgs,
+                            std::vector<ClassifyResult>* results);
+
+  /// Get preprocessor reference of ResNet
+  virtual ResNetPreprocessor& GetPreprocessor() {
+    return preprocessor_;
+  }
+
+  /// Get postprocessor reference of ResNet
+  virtual ResNetPostprocessor& GetPostprocessor() {
+    return postprocessor_;
+  }
 
- private:
-  /*! @brief Initialize for ResNet model, assign values to the global variables and call InitRuntime()
+ protected:
+  /*! @brief Initialize for ResNet model, call InitRuntime()
   */
   bool Initialize();
-  /// PreProcessing for the input "mat", the result will be saved in "outputs".
-  bool Preprocess(Mat* mat, FDTensor* outputs);
-  /*! @brief PostProcessing for the input "infer_result", the result will be saved in "result".
-  */
-  bool Postprocess(FDTensor& infer_result, ClassifyResult* result,
-                   int topk = 1);
+  ResNetPreprocessor preprocessor_;
+  ResNetPostprocessor postprocessor_;
 };
 }  // namespace classification
 }  // namespace vision
@@ -13,7 +13,8 @@
 // limitations under the License.
 
 #include "fastdeploy/vision/classification/contrib/yolov5cls/postprocessor.h"
-#include "fastdeploy/vision/utils/utils.h"
+#include "fastdeploy/function/softmax.h"
+#include "fastdeploy/function/topk.h"
 
 namespace fastdeploy {
 namespace vision {
@@ -30,25 +31,22 @@ bool YOLOv5ClsPostprocessor::Run(
   FDTensor infer_result = tensors[0];
   FDTensor infer_result_softmax;
   function::Softmax(infer_result, &infer_result_softmax, 1);
+  FDTensor topk_scores;
+  FDTensor topk_indices;
+  function::TopK(infer_result_softmax, &topk_scores, &topk_indices, topk_, 1,
+                 true, true, FDDataType::INT32);
+  int topk = topk_scores.shape[1];
+  const float* scores_data = reinterpret_cast<const float*>(topk_scores.Data());
+  const int32_t* indices_data =
+      reinterpret_cast<const int32_t*>(topk_indices.Data());
   results->resize(batch);
 
   for (size_t bs = 0; bs < batch; ++bs) {
     (*results)[bs].Clear();
-    // output (1,1000) score classnum 1000
-    int num_classes = infer_result_softmax.shape[1];
-    const float* infer_result_buffer =
-        reinterpret_cast<const float*>(infer_result_softmax.Data()) + bs * infer_result_softmax.shape[1];
-    topk_ = std::min(num_classes, topk_);
-    (*results)[bs].label_ids =
-        utils::TopKIndices(infer_result_buffer, num_classes, topk_);
-    (*results)[bs].scores.resize(topk_);
-    for (int i = 0; i < topk_; ++i) {
-      (*results)[bs].scores[i] = *(infer_result_buffer + (*results)[bs].label_ids[i]);
-    }
-
-    if ((*results)[bs].label_ids.size() == 0) {
-      return true;
-    }
+    (*results)[bs].label_ids.assign(indices_data + bs * topk,
+                                    indices_data + (bs + 1) * topk);
+    (*results)[bs].scores.assign(scores_data + bs * topk,
+                                 scores_data + (bs + 1) * topk);
   }
   return true;
 }
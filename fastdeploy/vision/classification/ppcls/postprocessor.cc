@@ -13,7 +13,7 @@
 // limitations under the License.
 
 #include "fastdeploy/vision/classification/ppcls/postprocessor.h"
-#include "fastdeploy/vision/utils/utils.h"
+#include "fastdeploy/function/topk.h"
 
 namespace fastdeploy {
 namespace vision {
@@ -31,18 +31,21 @@ bool PaddleClasPostprocessor::Run(const std::vector<FDTensor>& infer_result, std
   }
 
   int batch = infer_result[0].shape[0];
-  int num_classes = infer_result[0].shape[1];
-  const float* infer_result_data = reinterpret_cast<const float*>(infer_result[0].Data());
- 
-  results->resize(batch);
+  FDTensor topk_scores;
+  FDTensor topk_indices;
+  function::TopK(infer_result[0], &topk_scores, &topk_indices, topk_, 1, true,
+                 true, FDDataType::INT32);
+  int topk = topk_scores.shape[1];
+  const float* scores_data = reinterpret_cast<const float*>(topk_scores.Data());
+  const int32_t* indices_data =
+      reinterpret_cast<const int32_t*>(topk_indices.Data());
 
-  int topk = std::min(num_classes, topk_);
+  results->resize(batch);
   for (int i = 0; i < batch; ++i) {
-    (*results)[i].label_ids = utils::TopKIndices(infer_result_data + i * num_classes, num_classes, topk);
-    (*results)[i].scores.resize(topk);
-    for (int j = 0; j < topk; ++j) {
-      (*results)[i].scores[j] = infer_result_data[i * num_classes + (*results)[i].label_ids[j]];
-    }
+    (*results)[i].label_ids.assign(indices_data + i * topk,
+                                   indices_data + (i + 1) * topk);
+    (*results)[i].scores.assign(scores_data + i * topk,
+                                scores_data + (i + 1) * topk);
   }
 
   return true;
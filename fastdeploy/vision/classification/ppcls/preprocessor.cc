@@ -124,17 +124,24 @@ bool PaddleClasPreprocessor::Apply(FDMatBatch* image_batch,
     FDERROR << "The preprocessor is not initialized." << std::endl;
     return false;
   }
-  for (size_t j = 0; j < processors_.size(); ++j) {
-    image_batch->proc_lib = proc_lib_;
-    if (initial_resize_on_cpu_ && j == 0 &&
-        processors_[j]->Name().find("Resize") == 0) {
-      image_batch->proc_lib = ProcLib::OPENCV;
-    }
-    if (!(*(processors_[j].get()))(image_batch)) {
-      FDERROR << "Failed to processs image in " << processors_[j]->Name() << "."
-              << std::endl;
+  if (!CudaUsed()) {
+    // Each image runs the whole chain and is written into the batched tensor
+    if (!ApplyToEachMat(image_batch, processors_)) {
       return false;
     }
+  } else {
+    for (size_t j = 0; j < processors_.size(); ++j) {
+      image_batch->proc_lib = proc_lib_;
+      if (initial_resize_on_cpu_ && j == 0 &&
+          processors_[j]->Name().find("Resize") == 0) {
+        image_batch->proc_lib = ProcLib::OPENCV;
+      }
+      if (!(*(processors_[j].get()))(image_batch)) {
+        FDERROR << "Failed to processs image in " << processors_[j]->Name()
+                << "." << std::endl;
+        return false;
+      }
+    }
   }
 
   outputs->resize(1);
@@ -77,7 +77,10 @@ void BindPPShiTuV2(pybind11::module& m) {
               pybind11::array& data) {
              cv::Mat im = PyArrayToCvMat(data);
              vision::ClassifyResult result;
-             self.Predict(im, &result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(im, &result);
+             }
              return result;
            })
       .def("batch_predict",
@@ -88,7 +91,10 @@ void BindPPShiTuV2(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::ClassifyResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly(
@@ -14,35 +14,61 @@
 
 #include "fastdeploy/vision/common/processors/base.h"
 
+#include <atomic>
+
+#include "fastdeploy/utils/parallel.h"
 #include "fastdeploy/utils/utils.h"
 #include "fastdeploy/vision/common/processors/proc_lib.h"
 
 namespace fastdeploy {
 namespace vision {
 
+namespace {
+
+// Run func on each mat of the batch, the mats are processed by
+// mat_batch->num_threads threads, since they are independent with each other
+bool ProcessEachMat(FDMatBatch* mat_batch,
+                    const std::function<bool(FDMat*)>& func) {
+  std::vector<FDMat>& mats = *(mat_batch->mats);
+  if (mat_batch->num_threads == 1) {
+    for (size_t i = 0; i < mats.size(); ++i) {
+      if (func(&mats[i]) != true) {
+        return false;
+      }
+    }
+    return true;
+  }
+  std::atomic<bool> success(true);
+  utils::ParallelFor(
+      mats.size(),
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end && success; ++i) {
+          if (func(&mats[i]) != true) {
+            success = false;
+          }
+        }
+      },
+      1, mat_batch->num_threads);
+  return success;
+}
+
+}  // namespace
+
 bool Processor::ImplByOpenCV(FDMat* mat) {
   FDERROR << Name() << " Not Implement Yet." << std::endl;
   return false;
 }
 
 bool Processor::ImplByOpenCV(FDMatBatch* mat_batch) {
-  for (size_t i = 0; i < mat_batch->mats->size(); ++i) {
-    if (ImplByOpenCV(&(*(mat_batch->mats))[i]) != true) {
-      return false;
-    }
-  }
-  return true;
+  return ProcessEachMat(mat_batch,
+                        [this](FDMat* mat) { return ImplByOpenCV(mat); });
 }
 
 bool Processor::ImplByFlyCV(FDMat* mat) { return ImplByOpenCV(mat); }
 
 bool Processor::ImplByFlyCV(FDMatBatch* mat_batch) {
-  for (size_t i = 0; i < mat_batch->mats->size(); ++i) {
-    if (ImplByFlyCV(&(*(mat_batch->mats))[i]) != true) {
-      return false;
-    }
-  }
-  return true;
+  return ProcessEachMat(mat_batch,
+                        [this](FDMat* mat) { return ImplByFlyCV(mat); });
 }
 
 bool Processor::ImplByCuda(FDMat* mat) {
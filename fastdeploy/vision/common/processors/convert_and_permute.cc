@@ -14,6 +14,9 @@
 
 #include "fastdeploy/vision/common/processors/convert_and_permute.h"
 
+#include "fastdeploy/vision/common/processors/normalize_and_permute.h"
+#include "fastdeploy/vision/common/processors/normalize_and_permute_kernel.h"
+
 namespace fastdeploy {
 namespace vision {
 
@@ -33,13 +36,37 @@ bool ConvertAndPermute::ImplByOpenCV(FDMat* mat) {
   cv::Mat* im = mat->GetOpenCVMat();
   int origin_w = im->cols;
   int origin_h = im->rows;
+  if (im->depth() == CV_8U && mat->layout == Layout::HWC &&
+      static_cast<size_t>(im->channels()) <= alpha_.size() &&
+      (!swap_rb_ || im->channels() >= 3)) {
+    // Fused single pass kernel for the common uint8 images
+    cv::Mat res;
+    if (output_buffer_ == nullptr) {
+      res.create(origin_h, origin_w, CV_32FC(im->channels()));
+    } else {
+      res = cv::Mat(origin_h, origin_w, CV_32FC(im->channels()),
+                    output_buffer_);
+    }
+    NormalizeAndPermuteUint8(im->ptr<uint8_t>(), origin_h, origin_w,
+                             im->channels(), im->step[0], alpha_.data(),
+                             beta_.data(), swap_rb_,
+                             reinterpret_cast<float*>(res.ptr()));
+    mat->SetMat(res);
+    mat->layout = Layout::CHW;
+    return true;
+  }
   std::vector<cv::Mat> split_im;
   cv::split(*im, split_im);
   if (swap_rb_) std::swap(split_im[0], split_im[2]);
   for (int c = 0; c < im->channels(); c++) {
     split_im[c].convertTo(split_im[c], CV_32FC1, alpha_[c], beta_[c]);
   }
-  cv::Mat res(origin_h, origin_w, CV_32FC(im->channels()));
+  cv::Mat res;
+  if (output_buffer_ == nullptr) {
+    res.create(origin_h, origin_w, CV_32FC(im->channels()));
+  } else {
+    res = cv::Mat(origin_h, origin_w, CV_32FC(im->channels()), output_buffer_);
+  }
   for (int i = 0; i < im->channels(); ++i) {
     cv::extractChannel(split_im[i],
                        cv::Mat(origin_h, origin_w, CV_32FC1,
@@ -83,10 +110,43 @@ bool ConvertAndPermute::ImplByFlyCV(FDMat* mat) {
 }
 #endif
 
+#if defined(WITH_GPU) || defined(ENABLE_CVCUDA)
+namespace {
+
+// The GPU implementations of NormalizeAndPermute compute
+// `result = mat * alpha + beta` too, so they're reused with the alpha and
+// beta of ConvertAndPermute
+NormalizeAndPermute CreateNormalizeAndPermute(const std::vector<float>& alpha,
+                                              const std::vector<float>& beta,
+                                              bool swap_rb) {
+  NormalizeAndPermute op(std::vector<float>(alpha.size(), 0.0f),
+                         std::vector<float>(alpha.size(), 1.0f), false,
+                         std::vector<float>(), std::vector<float>(), swap_rb);
+  op.SetAlpha(alpha);
+  op.SetBeta(beta);
+  return op;
+}
+
+}  // namespace
+#endif
+
+#ifdef WITH_GPU
+bool ConvertAndPermute::ImplByCuda(FDMat* mat) {
+  return CreateNormalizeAndPermute(alpha_, beta_, swap_rb_).ImplByCuda(mat);
+}
+#endif
+
+#ifdef ENABLE_CVCUDA
+bool ConvertAndPermute::ImplByCvCuda(FDMat* mat) {
+  return CreateNormalizeAndPermute(alpha_, beta_, swap_rb_).ImplByCvCuda(mat);
+}
+#endif
+
 bool ConvertAndPermute::Run(FDMat* mat, const std::vector<float>& alpha,
                             const std::vector<float>& beta, bool swap_rb,
-                            ProcLib lib) {
+                            ProcLib lib, float* output_buffer) {
   auto n = ConvertAndPermute(alpha, beta, swap_rb);
+  n.SetOutputBuffer(output_buffer);
   return n(mat, lib);
 }
 
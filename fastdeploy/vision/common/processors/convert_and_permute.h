@@ -28,20 +28,37 @@ class FASTDEPLOY_DECL ConvertAndPermute : public Processor {
   bool ImplByOpenCV(FDMat* mat);
 #ifdef ENABLE_FLYCV
   bool ImplByFlyCV(FDMat* mat);
+#endif
+#ifdef WITH_GPU
+  bool ImplByCuda(FDMat* mat);
+#endif
+#ifdef ENABLE_CVCUDA
+  bool ImplByCvCuda(FDMat* mat);
 #endif
   std::string Name() { return "ConvertAndPermute"; }
 
+  /** \brief Set the buffer to write the processed image, e.g the memory of
+   *  this image in the input tensor of runtime, so no more copy is needed.
+   *  The processed mat will share memory with this buffer. It's only used
+   *  by the OpenCV implementation.
+   *
+   * \param[in] buffer The buffer with channels * height * width floats, nullptr means to allocate new memory
+   */
+  void SetOutputBuffer(float* buffer) { output_buffer_ = buffer; }
+
   /** \brief Process the input images
    *
    * \param[in] mat The input image data，`result = mat * alpha + beta`
    * \param[in] alpha The alpha channel data
    * \param[in] beta The beta channel data
    * \param[in] lib to define OpenCV or FlyCV or CVCUDA will be used.
+   * \param[in] output_buffer The buffer to write the processed image, nullptr means to allocate new memory
    * \return true if the process successed, otherwise false
    */
   static bool Run(FDMat* mat, const std::vector<float>& alpha,
                   const std::vector<float>& beta, bool swap_rb = false,
-                  ProcLib lib = ProcLib::DEFAULT);
+                  ProcLib lib = ProcLib::DEFAULT,
+                  float* output_buffer = nullptr);
 
   std::vector<float> GetAlpha() const { return alpha_; }
 
@@ -83,6 +100,7 @@ class FASTDEPLOY_DECL ConvertAndPermute : public Processor {
   std::vector<float> alpha_;
   std::vector<float> beta_;
   bool swap_rb_;
+  float* output_buffer_ = nullptr;
 };
 }  // namespace vision
 }  // namespace fastdeploy
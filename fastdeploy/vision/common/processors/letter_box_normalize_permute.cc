@@ -0,0 +1,208 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/common/processors/letter_box_normalize_permute.h"
+
+#include <cmath>
+
+#include "fastdeploy/vision/common/processors/normalize_and_permute_kernel.h"
+
+namespace fastdeploy {
+namespace vision {
+
+LetterBoxNormalizePermute::LetterBoxNormalizePermute(
+    int resize_w, int resize_h, int top, int bottom, int left, int right,
+    const std::vector<float>& padding_value, const std::vector<float>& alpha,
+    const std::vector<float>& beta, bool swap_rb) {
+  FDASSERT(alpha.size() == beta.size(),
+           "LetterBoxNormalizePermute: requires the size of alpha equal to the "
+           "size of beta.");
+  FDASSERT(resize_w > 0 && resize_h > 0,
+           "LetterBoxNormalizePermute: requires resize_w and resize_h > 0.");
+  FDASSERT(top >= 0 && bottom >= 0 && left >= 0 && right >= 0,
+           "LetterBoxNormalizePermute: requires the padding sizes >= 0.");
+  resize_w_ = resize_w;
+  resize_h_ = resize_h;
+  top_ = top;
+  bottom_ = bottom;
+  left_ = left;
+  right_ = right;
+  padding_value_ = padding_value;
+  alpha_ = alpha;
+  beta_ = beta;
+  swap_rb_ = swap_rb;
+}
+
+bool LetterBoxNormalizePermute::ImplByOpenCV(FDMat* mat) {
+  if (mat->layout != Layout::HWC) {
+    FDERROR << "LetterBoxNormalizePermute: The input data must be Layout::HWC "
+               "format!"
+            << std::endl;
+    return false;
+  }
+  cv::Mat* im = mat->GetOpenCVMat();
+  if (im->depth() != CV_8U) {
+    FDERROR << "LetterBoxNormalizePermute: Only supports uint8 image, but now "
+               "it's "
+            << mat->Type() << "." << std::endl;
+    return false;
+  }
+  int channels = im->channels();
+  if (channels > 4 || channels > static_cast<int>(alpha_.size()) ||
+      channels > static_cast<int>(padding_value_.size())) {
+    FDERROR << "LetterBoxNormalizePermute: Require the size of alpha, beta "
+               "and padding value not less than channels, but now channels = "
+            << channels << ", the size of alpha = " << alpha_.size()
+            << ", the size of padding value = " << padding_value_.size()
+            << "." << std::endl;
+    return false;
+  }
+  if (swap_rb_ && channels < 3) {
+    FDERROR << "LetterBoxNormalizePermute: Require channels >= 3 while "
+               "swap_rb is true, but now channels = "
+            << channels << "." << std::endl;
+    return false;
+  }
+
+  int out_h = resize_h_ + top_ + bottom_;
+  int out_w = resize_w_ + left_ + right_;
+  cv::Mat res;
+  if (output_buffer_ == nullptr) {
+    res.create(out_h, out_w, CV_32FC(channels));
+  } else {
+    res = cv::Mat(out_h, out_w, CV_32FC(channels), output_buffer_);
+  }
+  LetterBoxNormalizePermuteUint8(
+      im->ptr<uint8_t>(), im->rows, im->cols, channels, im->step[0],
+      resize_h_, resize_w_, top_, bottom_, left_, right_,
+      padding_value_.data(), alpha_.data(), beta_.data(), swap_rb_,
+      reinterpret_cast<float*>(res.ptr()));
+  mat->SetMat(res);
+  mat->SetHeight(out_h);
+  mat->SetWidth(out_w);
+  mat->layout = Layout::CHW;
+  return true;
+}
+
+bool LetterBoxNormalizePermute::Run(FDMat* mat, int resize_w, int resize_h,
+                                    int top, int bottom, int left, int right,
+                                    const std::vector<float>& padding_value,
+                                    const std::vector<float>& alpha,
+                                    const std::vector<float>& beta,
+                                    bool swap_rb, float* output_buffer) {
+  auto l = LetterBoxNormalizePermute(resize_w, resize_h, top, bottom, left,
+                                     right, padding_value, alpha, beta,
+                                     swap_rb);
+  l.SetOutputBuffer(output_buffer);
+  return l(mat);
+}
+
+void ComputeLetterBox(const FDMat& mat, const std::vector<int>& size,
+                      bool is_scale_up, bool is_mini_pad, bool is_no_pad,
+                      int stride, int* resize_w, int* resize_h, int* top,
+                      int* bottom, int* left, int* right) {
+  float scale =
+      std::min(size[1] * 1.0 / mat.Height(), size[0] * 1.0 / mat.Width());
+  if (!is_scale_up) {
+    scale = std::min(scale, 1.0f);
+  }
+
+  *resize_h = int(round(mat.Height() * scale));
+  *resize_w = int(round(mat.Width() * scale));
+
+  int pad_w = size[0] - *resize_w;
+  int pad_h = size[1] - *resize_h;
+  if (is_mini_pad) {
+    pad_h = pad_h % stride;
+    pad_w = pad_w % stride;
+  } else if (is_no_pad) {
+    pad_h = 0;
+    pad_w = 0;
+    *resize_h = size[1];
+    *resize_w = size[0];
+  }
+  if (std::fabs(scale - 1.0f) <= 1e-06) {
+    *resize_h = mat.Height();
+    *resize_w = mat.Width();
+  }
+  *top = 0;
+  *bottom = 0;
+  *left = 0;
+  *right = 0;
+  if (pad_h > 0 || pad_w > 0) {
+    float half_h = pad_h * 1.0 / 2;
+    *top = int(round(half_h - 0.1));
+    *bottom = int(round(half_h + 0.1));
+    float half_w = pad_w * 1.0 / 2;
+    *left = int(round(half_w - 0.1));
+    *right = int(round(half_w + 0.1));
+  }
+}
+
+bool LetterBoxNormalizePermuteBatch(
+    std::vector<FDMat>* images, const std::vector<int>& size,
+    const std::vector<float>& padding_value, bool is_scale_up,
+    bool is_mini_pad, bool is_no_pad, int stride, FDTensor* output,
+    std::vector<std::map<std::string, std::array<float, 2>>>* ims_info) {
+  // Compute the letterbox of all the images first to allocate the batched
+  // tensor, params are (resize_w, resize_h, top, bottom, left, right)
+  std::vector<std::array<int, 6>> params(images->size());
+  int channels = (*images)[0].Channels();
+  int out_h = 0;
+  int out_w = 0;
+  for (size_t i = 0; i < images->size(); ++i) {
+    auto& p = params[i];
+    ComputeLetterBox((*images)[i], size, is_scale_up, is_mini_pad, is_no_pad,
+                     stride, &p[0], &p[1], &p[2], &p[3], &p[4], &p[5]);
+    int h = p[1] + p[2] + p[3];
+    int w = p[0] + p[4] + p[5];
+    if (i == 0) {
+      out_h = h;
+      out_w = w;
+    } else if (h != out_h || w != out_w ||
+               (*images)[i].Channels() != channels) {
+      FDERROR << "The shapes of preprocessed images should be same in a "
+                 "batch, but now they are ("
+              << channels << ", " << out_h << ", " << out_w << ") and ("
+              << (*images)[i].Channels() << ", " << h << ", " << w << ")."
+              << std::endl;
+      return false;
+    }
+  }
+
+  output->Resize({static_cast<int64_t>(images->size()), channels, out_h,
+                  out_w},
+                 FDDataType::FP32);
+  float* data = reinterpret_cast<float*>(output->MutableData());
+  std::vector<float> alpha(channels, 1.0f / 255.0f);
+  std::vector<float> beta(channels, 0.0f);
+  for (size_t i = 0; i < images->size(); ++i) {
+    FDMat* mat = &(*images)[i];
+    (*ims_info)[i]["input_shape"] = {static_cast<float>(mat->Height()),
+                                     static_cast<float>(mat->Width())};
+    const auto& p = params[i];
+    if (!LetterBoxNormalizePermute::Run(
+            mat, p[0], p[1], p[2], p[3], p[4], p[5], padding_value, alpha,
+            beta, true, data + i * channels * out_h * out_w)) {
+      FDERROR << "Failed to preprocess input image." << std::endl;
+      return false;
+    }
+    (*ims_info)[i]["output_shape"] = {static_cast<float>(out_h),
+                                      static_cast<float>(out_w)};
+  }
+  return true;
+}
+
+}  // namespace vision
+}  // namespace fastdeploy
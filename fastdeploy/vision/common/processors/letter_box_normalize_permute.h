@@ -0,0 +1,128 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <string>
+
+#include "fastdeploy/vision/common/processors/base.h"
+
+namespace fastdeploy {
+namespace vision {
+
+/*! @brief Processor for letterbox, which resizes images by bilinear
+ *  interpolation, pads them, and converts them to float with CHW layout in a
+ *  single pass. It's the fused version of Resize + Pad + ConvertAndPermute,
+ *  and only supports uint8 images with HWC layout.
+ */
+class FASTDEPLOY_DECL LetterBoxNormalizePermute : public Processor {
+ public:
+  LetterBoxNormalizePermute(int resize_w, int resize_h, int top, int bottom,
+                            int left, int right,
+                            const std::vector<float>& padding_value,
+                            const std::vector<float>& alpha,
+                            const std::vector<float>& beta,
+                            bool swap_rb = false);
+  bool ImplByOpenCV(FDMat* mat);
+  std::string Name() { return "LetterBoxNormalizePermute"; }
+
+  /** \brief Set the buffer to write the processed image, e.g the memory of
+   *  this image in the batched input tensor of runtime, so no more copy is
+   *  needed. The processed mat will share memory with this buffer.
+   *
+   * \param[in] buffer The buffer with channels * (resize_h + top + bottom) * (resize_w + left + right) floats, nullptr means to allocate new memory
+   */
+  void SetOutputBuffer(float* buffer) { output_buffer_ = buffer; }
+
+  /** \brief Process the input images
+   *
+   * \param[in] mat The input image data, `result = mat * alpha + beta`
+   * \param[in] resize_w width of the image after resize
+   * \param[in] resize_h height of the image after resize
+   * \param[in] top top pad size of the output image
+   * \param[in] bottom bottom pad size of the output image
+   * \param[in] left left pad size of the output image
+   * \param[in] right right pad size of the output image
+   * \param[in] padding_value value vector used by padding, in the channel order of input image
+   * \param[in] alpha The alpha of each channel
+   * \param[in] beta The beta of each channel
+   * \param[in] swap_rb to define whether to swap r and b channel order
+   * \param[in] output_buffer The buffer to write the processed image, nullptr means to allocate new memory
+   * \return true if the process successed, otherwise false
+   */
+  static bool Run(FDMat* mat, int resize_w, int resize_h, int top, int bottom,
+                  int left, int right, const std::vector<float>& padding_value,
+                  const std::vector<float>& alpha,
+                  const std::vector<float>& beta, bool swap_rb = false,
+                  float* output_buffer = nullptr);
+
+ private:
+  int resize_w_;
+  int resize_h_;
+  int top_;
+  int bottom_;
+  int left_;
+  int right_;
+  std::vector<float> padding_value_;
+  std::vector<float> alpha_;
+  std::vector<float> beta_;
+  bool swap_rb_;
+  float* output_buffer_ = nullptr;
+};
+
+/** \brief Compute the size after resize and the paddings of the letterbox used by the YOLO preprocessors
+ *
+ * \param[in] mat The input image
+ * \param[in] size The target size, tuple of (width, height)
+ * \param[in] is_scale_up If false, the image can only be zoomed out
+ * \param[in] is_mini_pad Only pad to the minimum rectangle whose height and width are times of stride
+ * \param[in] is_no_pad Resize the image to size without padding, only works while is_mini_pad is false
+ * \param[in] stride The padding stride for is_mini_pad
+ * \param[out] resize_w width of the image after resize
+ * \param[out] resize_h height of the image after resize
+ * \param[out] top top pad size of the output image
+ * \param[out] bottom bottom pad size of the output image
+ * \param[out] left left pad size of the output image
+ * \param[out] right right pad size of the output image
+ */
+FASTDEPLOY_DECL void ComputeLetterBox(const FDMat& mat,
+                                      const std::vector<int>& size,
+                                      bool is_scale_up, bool is_mini_pad,
+                                      bool is_no_pad, int stride,
+                                      int* resize_w, int* resize_h, int* top,
+                                      int* bottom, int* left, int* right);
+
+/** \brief Letterbox the images as the YOLO preprocessors, `result = pixel / 255` in RGB order, and write them into the batched tensor by LetterBoxNormalizePermute without more copy
+ *
+ * \param[in] images The input images, all of them should have the same shape after letterbox
+ * \param[in] size The target size, tuple of (width, height)
+ * \param[in] padding_value value vector used by padding, in the channel order of input image
+ * \param[in] is_scale_up If false, the image can only be zoomed out
+ * \param[in] is_mini_pad Only pad to the minimum rectangle whose height and width are times of stride
+ * \param[in] is_no_pad Resize the image to size without padding, only works while is_mini_pad is false
+ * \param[in] stride The padding stride for is_mini_pad
+ * \param[out] output The batched tensor with layout NCHW
+ * \param[out] ims_info The input_shape and output_shape of each image
+ * \return true if the process successed, otherwise false
+ */
+FASTDEPLOY_DECL bool LetterBoxNormalizePermuteBatch(
+    std::vector<FDMat>* images, const std::vector<int>& size,
+    const std::vector<float>& padding_value, bool is_scale_up,
+    bool is_mini_pad, bool is_no_pad, int stride, FDTensor* output,
+    std::vector<std::map<std::string, std::array<float, 2>>>* ims_info);
+
+}  // namespace vision
+}  // namespace fastdeploy
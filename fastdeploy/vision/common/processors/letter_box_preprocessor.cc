@@ -0,0 +1,95 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fastdeploy/vision/common/processors/letter_box_preprocessor.h"
+
+#include "fastdeploy/vision/common/processors/convert_and_permute.h"
+#include "fastdeploy/vision/common/processors/letter_box_normalize_permute.h"
+#include "fastdeploy/vision/common/processors/pad.h"
+#include "fastdeploy/vision/common/processors/resize.h"
+
+namespace fastdeploy {
+namespace vision {
+
+LetterBoxPreprocessor::LetterBoxPreprocessor() {
+  size_ = {640, 640};
+  padding_value_ = {114.0, 114.0, 114.0};
+  is_mini_pad_ = false;
+  is_no_pad_ = false;
+  is_scale_up_ = false;
+  stride_ = 32;
+  fit_before_letter_box_ = true;
+  fit_by_area_ = true;
+  fit_by_round_ = true;
+  alpha_ = {1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f};
+  beta_ = {0.0f, 0.0f, 0.0f};
+  swap_rb_ = true;
+}
+
+bool LetterBoxPreprocessor::ResizeToFit(FDMat* mat) {
+  float ratio = std::min(size_[1] * 1.0f / static_cast<float>(mat->Height()),
+                         size_[0] * 1.0f / static_cast<float>(mat->Width()));
+  if (std::fabs(ratio - 1.0f) <= 1e-06) {
+    return true;
+  }
+  int interp = cv::INTER_LINEAR;
+  if (fit_by_area_ && ratio < 1.0) {
+    interp = cv::INTER_AREA;
+  }
+  int resize_h = int(mat->Height() * ratio);
+  int resize_w = int(mat->Width() * ratio);
+  if (fit_by_round_) {
+    resize_h = int(round(static_cast<float>(mat->Height()) * ratio));
+    resize_w = int(round(static_cast<float>(mat->Width()) * ratio));
+  }
+  return Resize::Run(mat, resize_w, resize_h, -1, -1, interp, false,
+                     mat->proc_lib);
+}
+
+bool LetterBoxPreprocessor::LetterBox(FDMat* mat) {
+  int resize_w, resize_h, top, bottom, left, right;
+  ComputeLetterBox(*mat, size_, is_scale_up_, is_mini_pad_, is_no_pad_,
+                   stride_, &resize_w, &resize_h, &top, &bottom, &left,
+                   &right);
+  if (resize_w != mat->Width() || resize_h != mat->Height()) {
+    if (!Resize::Run(mat, resize_w, resize_h, -1, -1, cv::INTER_LINEAR, false,
+                     mat->proc_lib)) {
+      return false;
+    }
+  }
+  if (top > 0 || bottom > 0 || left > 0 || right > 0) {
+    return Pad::Run(mat, top, bottom, left, right, padding_value_,
+                    mat->proc_lib);
+  }
+  return true;
+}
+
+bool LetterBoxPreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  // YOLO serials preprocess steps
+  // 1. resize to fit in size
+  // 2. letterbox
+  // 3. (BGR->RGB), convert and HWC->CHW in one pass
+  if (fit_before_letter_box_ && !ResizeToFit(mat)) {
+    return false;
+  }
+  if (!LetterBox(mat)) {
+    return false;
+  }
+  return ConvertAndPermute::Run(mat, alpha_, beta_, swap_rb_, mat->proc_lib);
+}
+
+}  // namespace vision
+}  // namespace fastdeploy
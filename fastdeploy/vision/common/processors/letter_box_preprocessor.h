@@ -0,0 +1,125 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "fastdeploy/vision/common/processors/per_image_preprocessor.h"
+
+namespace fastdeploy {
+namespace vision {
+
+/*! @brief Base class of the preprocessors for the YOLO serials models, which resize the image to fit in the target size, letterbox it, and convert it to float with CHW layout
+ */
+class FASTDEPLOY_DECL LetterBoxPreprocessor : public PerImagePreprocessor {
+ public:
+  /** \brief Create a preprocessor with the default arguments of YOLO serials model
+   */
+  LetterBoxPreprocessor();
+
+  /// Set target size, tuple of (width, height), default size = {640, 640}
+  void SetSize(const std::vector<int>& size) { size_ = size; }
+
+  /// Get target size, tuple of (width, height), default size = {640, 640}
+  std::vector<int> GetSize() const { return size_; }
+
+  /// Set padding value, size should be the same as channels
+  void SetPaddingValue(const std::vector<float>& padding_value) {
+    padding_value_ = padding_value;
+  }
+
+  /// Get padding value, size should be the same as channels
+  std::vector<float> GetPaddingValue() const { return padding_value_; }
+
+  /// Set is_scale_up, if is_scale_up is false, the input image only
+  /// can be zoom out, the maximum resize scale cannot exceed 1.0, default false
+  void SetScaleUp(bool is_scale_up) { is_scale_up_ = is_scale_up; }
+
+  /// Get is_scale_up, default false
+  bool GetScaleUp() const { return is_scale_up_; }
+
+  /// Set is_mini_pad, pad to the minimum rectange
+  /// which height and width is times of stride, default false
+  void SetMiniPad(bool is_mini_pad) { is_mini_pad_ = is_mini_pad; }
+
+  /// Get is_mini_pad, default false
+  bool GetMiniPad() const { return is_mini_pad_; }
+
+  /// Set is_no_pad, while is_mini_pad = false and is_no_pad = true,
+  /// will resize the image to the set size, default false
+  void SetNoPad(bool is_no_pad) { is_no_pad_ = is_no_pad; }
+
+  /// Get is_no_pad, default false
+  bool GetNoPad() const { return is_no_pad_; }
+
+  /// Set padding stride, only for mini_pad mode
+  void SetStride(int stride) { stride_ = stride; }
+
+  /// Get padding stride, default 32
+  int GetStride() const { return stride_; }
+
+ protected:
+  /// Resize the image to fit in size and keep its ratio, the original repos
+  /// do it right after loading the image
+  bool ResizeToFit(FDMat* mat);
+
+  /// Resize and pad the image by the letterbox from ComputeLetterBox()
+  bool LetterBox(FDMat* mat);
+
+  /// ResizeToFit() if fit_before_letter_box_, LetterBox(), then compute
+  /// `result = mat * alpha_ + beta_` with CHW layout
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info);
+
+  // target size, tuple of (width, height), default size = {640, 640}
+  std::vector<int> size_;
+
+  // padding value, size should be the same as channels
+  std::vector<float> padding_value_;
+
+  // only pad to the minimum rectange which height and width is times of stride
+  bool is_mini_pad_;
+
+  // while is_mini_pad = false and is_no_pad = true,
+  // will resize the image to the set size
+  bool is_no_pad_;
+
+  // if is_scale_up is false, the input image only can be zoom out,
+  // the maximum resize scale cannot exceed 1.0
+  bool is_scale_up_;
+
+  // padding stride, for is_mini_pad
+  int stride_;
+
+  // whether to call ResizeToFit() before letterbox, default true
+  bool fit_before_letter_box_;
+
+  // shrink the image by cv::INTER_AREA in ResizeToFit(), otherwise by
+  // cv::INTER_LINEAR, default true
+  bool fit_by_area_;
+
+  // round the size of image in ResizeToFit(), otherwise truncate it,
+  // default true
+  bool fit_by_round_;
+
+  // `result = mat * alpha + beta` after letterbox, default 1 / 255 and 0
+  std::vector<float> alpha_;
+  std::vector<float> beta_;
+
+  // whether to convert BGR to RGB, default true
+  bool swap_rb_;
+};
+
+}  // namespace vision
+}  // namespace fastdeploy
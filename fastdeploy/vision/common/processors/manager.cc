@@ -13,6 +13,11 @@
 // limitations under the License.
 #include "fastdeploy/vision/common/processors/manager.h"
 
+#include <atomic>
+#include <mutex>
+
+#include "fastdeploy/utils/parallel.h"
+
 namespace fastdeploy {
 namespace vision {
 
@@ -45,6 +50,17 @@ void ProcessorManager::UseCuda(bool enable_cv_cuda, int gpu_id) {
   }
 }
 
+bool ProcessorManager::SetPreprocessThreads(int num_threads) {
+  if (num_threads < -1 || num_threads == 0) {
+    FDERROR << "The number of preprocess threads should be > 0 or == -1, but "
+               "now it's "
+            << num_threads << "." << std::endl;
+    return false;
+  }
+  preprocess_threads_ = num_threads;
+  return true;
+}
+
 bool ProcessorManager::CudaUsed() {
   return (proc_lib_ == ProcLib::CUDA || proc_lib_ == ProcLib::CVCUDA);
 }
@@ -61,8 +77,10 @@ void ProcessorManager::PreApply(FDMatBatch* image_batch) {
   image_batch->input_cache = &batch_input_cache_;
   image_batch->output_cache = &batch_output_cache_;
   image_batch->proc_lib = proc_lib_;
+  image_batch->num_threads = preprocess_threads_;
   if (CudaUsed()) {
     SetStream(image_batch);
+    image_batch->num_threads = 1;
   }
 
   for (size_t i = 0; i < image_batch->mats->size(); ++i) {
@@ -88,6 +106,112 @@ void ProcessorManager::PostApply() {
   }
 }
 
+bool ProcessorManager::ApplyToEachMat(
+    FDMatBatch* image_batch,
+    const std::vector<std::shared_ptr<Processor>>& processors) {
+  if (CudaUsed()) {
+    for (size_t j = 0; j < processors.size(); ++j) {
+      if (!(*(processors[j].get()))(image_batch)) {
+        FDERROR << "Failed to processs image in " << processors[j]->Name()
+                << "." << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  return ApplyToEachMat(image_batch, [&processors](size_t i, FDMat* mat) {
+    for (size_t j = 0; j < processors.size(); ++j) {
+      if (!(*(processors[j].get()))(mat)) {
+        FDERROR << "Failed to processs image in " << processors[j]->Name()
+                << "." << std::endl;
+        return false;
+      }
+    }
+    return true;
+  });
+}
+
+bool ProcessorManager::ApplyToEachMat(
+    FDMatBatch* image_batch,
+    const std::function<bool(size_t, FDMat*)>& process_mat) {
+  std::vector<FDMat>& mats = *(image_batch->mats);
+  if (CudaUsed()) {
+    // The processors run on the stream one image after another, and the
+    // batched tensor is concated on GPU by image_batch->Tensor()
+    for (size_t i = 0; i < mats.size(); ++i) {
+      if (!process_mat(i, &mats[i])) {
+        FDERROR << "Failed to processs image:" << i << "." << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  FDTensor* batch_tensor = image_batch->input_cache;
+  // The batched tensor is allocated by the first processed image, the other
+  // images should have the same shape and data type
+  std::mutex mutex;
+  std::vector<int64_t> mat_shape;
+  FDDataType mat_dtype = FDDataType::FP32;
+  auto process = [&](size_t i) -> bool {
+    FDMat* mat = &mats[i];
+    if (!process_mat(i, mat)) {
+      FDERROR << "Failed to processs image:" << i << "." << std::endl;
+      return false;
+    }
+    FDTensor* tensor = mat->Tensor();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (mat_shape.empty()) {
+        mat_shape = tensor->Shape();
+        mat_dtype = tensor->Dtype();
+        std::vector<int64_t> batch_shape = mat_shape;
+        batch_shape.insert(batch_shape.begin(), mats.size());
+        batch_tensor->Resize(batch_shape, mat_dtype, "batch_input_cache",
+                             Device::CPU);
+      } else if (tensor->Shape() != mat_shape ||
+                 tensor->Dtype() != mat_dtype) {
+        FDERROR << "The processed images should have the same shape and "
+                   "data type, but image:"
+                << i << " is " << Str(tensor->Shape()) << " "
+                << tensor->Dtype() << ", while others are " << Str(mat_shape)
+                << " " << mat_dtype << "." << std::endl;
+        return false;
+      }
+    }
+    int64_t num_bytes = tensor->Nbytes();
+    uint8_t* dst = reinterpret_cast<uint8_t*>(batch_tensor->Data());
+    FDTensor::CopyBuffer(dst + i * num_bytes, tensor->Data(), num_bytes,
+                         Device::CPU, false);
+    return true;
+  };
+
+  bool success = true;
+  if (image_batch->num_threads == 1) {
+    for (size_t i = 0; i < mats.size() && success; ++i) {
+      success = process(i);
+    }
+  } else {
+    std::atomic<bool> all_success(true);
+    utils::ParallelFor(
+        mats.size(),
+        [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end && all_success; ++i) {
+            if (!process(i)) {
+              all_success = false;
+            }
+          }
+        },
+        1, image_batch->num_threads);
+    success = all_success;
+  }
+  if (success) {
+    image_batch->SetTensor(batch_tensor);
+  }
+  return success;
+}
+
 bool ProcessorManager::Run(std::vector<FDMat>* images,
                            std::vector<FDTensor>* outputs) {
   FDMatBatch image_batch(images);
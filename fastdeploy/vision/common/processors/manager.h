@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "fastdeploy/utils/utils.h"
 #include "fastdeploy/vision/common/processors/mat.h"
 #include "fastdeploy/vision/common/processors/mat_batch.h"
@@ -63,6 +65,16 @@ class FASTDEPLOY_DECL ProcessorManager {
 
   int DeviceId() { return device_id_; }
 
+  /** \brief Set the number of threads to process the images of a batch in parallel on CPU. The preprocessors built on ApplyToEachMat() run the whole chain of processors for each image in one thread and write it into its slice of the batched tensor, the others run each processor on the images in parallel before the next one. The processors which call utils::ParallelFor inside will run serially in these threads, it's suggested to reduce the threads of OpenCV by SetProcLibCpuNumThreads() while using multiple threads here
+   *
+   * \param[in] num_threads The number of threads, default 1 means to process the images serially, -1 means to use the value of utils::GetParallelThreadNum()
+   * \return true if the number of threads is valid, otherwise false
+   */
+  bool SetPreprocessThreads(int num_threads);
+
+  /// Get the number of threads to process the images of a batch
+  int GetPreprocessThreads() const { return preprocess_threads_; }
+
   /** \brief Process the input images and prepare input tensors for runtime
    *
    * \param[in] images The input image data list, all the elements are returned by cv::imread()
@@ -85,6 +97,25 @@ class FASTDEPLOY_DECL ProcessorManager {
   void PostApply();
 
  protected:
+  /** \brief Run the processors on the images of the batch, it could be called by Apply(). On CPU, each image runs the whole chain of processors and is copied into its slice of the batched tensor in one task of the threads set by SetPreprocessThreads(), so the images don't wait for each other between the processors, and image_batch->Tensor() returns the batched tensor without another copy. While using CUDA, the processors run on the whole batch one by one
+   *
+   * \param[in] image_batch The input image batch, all the images should have the same shape and data type after the processors
+   * \param[in] processors The processors to run in order
+   * \return true if the preprocess successed, otherwise false
+   */
+  bool ApplyToEachMat(
+      FDMatBatch* image_batch,
+      const std::vector<std::shared_ptr<Processor>>& processors);
+
+  /** \brief Run a function on each image of the batch, for the preprocessors whose steps depend on the image, e.g. letterbox. On CPU, the images are processed and copied into their slices of the batched tensor in parallel like the processors version. While using CUDA, the images are processed one by one, the function should run the processors with mat->proc_lib to use CUDA
+   *
+   * \param[in] image_batch The input image batch, all the images should have the same shape and data type after the function
+   * \param[in] process_mat The function to process an image with its index in the batch, return true if successed, it's called in multiple threads at the same time on CPU
+   * \return true if the preprocess successed, otherwise false
+   */
+  bool ApplyToEachMat(FDMatBatch* image_batch,
+                      const std::function<bool(size_t, FDMat*)>& process_mat);
+
   ProcLib proc_lib_ = ProcLib::DEFAULT;
 
  private:
@@ -92,6 +123,7 @@ class FASTDEPLOY_DECL ProcessorManager {
   cudaStream_t stream_ = nullptr;
 #endif
   int device_id_ = -1;
+  int preprocess_threads_ = 1;
 
   std::vector<FDTensor> input_caches_;
   std::vector<FDTensor> output_caches_;
@@ -50,6 +50,10 @@ void BindProcessorManager(pybind11::module& m) {
            })
       .def("pre_apply", &vision::ProcessorManager::PreApply)
       .def("post_apply", &vision::ProcessorManager::PostApply)
+      .def("set_preprocess_threads",
+           &vision::ProcessorManager::SetPreprocessThreads)
+      .def("get_preprocess_threads",
+           &vision::ProcessorManager::GetPreprocessThreads)
       .def("use_cuda",
            [](vision::ProcessorManager& self, bool enable_cv_cuda = false,
               int gpu_id = -1) { self.UseCuda(enable_cv_cuda, gpu_id); });
@@ -13,6 +13,8 @@
 // limitations under the License.
 #include "fastdeploy/vision/common/processors/mat_batch.h"
 
+#include "fastdeploy/utils/parallel.h"
+
 namespace fastdeploy {
 namespace vision {
 
@@ -41,11 +43,20 @@ FDTensor* FDMatBatch::Tensor() {
   for (size_t i = 0; i < mats->size(); ++i) {
     FDASSERT(device == (*mats)[i].Tensor()->device,
              "Mats and MatBatch are not on the same device");
-    uint8_t* p = reinterpret_cast<uint8_t*>(input_cache->Data());
-    int num_bytes = (*mats)[i].Tensor()->Nbytes();
-    FDTensor::CopyBuffer(p + i * num_bytes, (*mats)[i].Tensor()->Data(),
-                         num_bytes, device, false);
   }
+  uint8_t* p = reinterpret_cast<uint8_t*>(input_cache->Data());
+  int num_bytes = src->Nbytes();
+  // Each mat is copied to its own slice of the batched tensor, so the copies
+  // of different mats could run in parallel on CPU
+  utils::ParallelFor(
+      mats->size(),
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          FDTensor::CopyBuffer(p + i * num_bytes, (*mats)[i].Tensor()->Data(),
+                               num_bytes, device, false);
+        }
+      },
+      1, device == Device::CPU ? num_threads : 1);
   SetTensor(input_cache);
   return fd_tensor.get();
 }
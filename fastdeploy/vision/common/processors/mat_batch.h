@@ -67,6 +67,9 @@ struct FASTDEPLOY_DECL FDMatBatch {
   FDMatBatchLayout layout = FDMatBatchLayout::NHWC;
   Device device = Device::CPU;
   ProcLib proc_lib = ProcLib::DEFAULT;
+  // The number of threads to process the mats in parallel on CPU,
+  // refer to ProcessorManager::SetPreprocessThreads()
+  int num_threads = 1;
 
   // False: the data is stored in the mats separately
   // True: the data is stored in the fd_tensor continuously in 4 dimensions
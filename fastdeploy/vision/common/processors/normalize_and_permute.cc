@@ -14,6 +14,8 @@
 
 #include "fastdeploy/vision/common/processors/normalize_and_permute.h"
 
+#include "fastdeploy/vision/common/processors/normalize_and_permute_kernel.h"
+
 namespace fastdeploy {
 namespace vision {
 
@@ -60,13 +62,37 @@ bool NormalizeAndPermute::ImplByOpenCV(FDMat* mat) {
   cv::Mat* im = mat->GetOpenCVMat();
   int origin_w = im->cols;
   int origin_h = im->rows;
+  if (im->depth() == CV_8U && mat->layout == Layout::HWC &&
+      static_cast<size_t>(im->channels()) <= alpha_.size() &&
+      (!swap_rb_ || im->channels() >= 3)) {
+    // Fused single pass kernel for the common uint8 images
+    cv::Mat res;
+    if (output_buffer_ == nullptr) {
+      res.create(origin_h, origin_w, CV_32FC(im->channels()));
+    } else {
+      res = cv::Mat(origin_h, origin_w, CV_32FC(im->channels()),
+                    output_buffer_);
+    }
+    NormalizeAndPermuteUint8(im->ptr<uint8_t>(), origin_h, origin_w,
+                             im->channels(), im->step[0], alpha_.data(),
+                             beta_.data(), swap_rb_,
+                             reinterpret_cast<float*>(res.ptr()));
+    mat->SetMat(res);
+    mat->layout = Layout::CHW;
+    return true;
+  }
   std::vector<cv::Mat> split_im;
   cv::split(*im, split_im);
   if (swap_rb_) std::swap(split_im[0], split_im[2]);
   for (int c = 0; c < im->channels(); c++) {
     split_im[c].convertTo(split_im[c], CV_32FC1, alpha_[c], beta_[c]);
   }
-  cv::Mat res(origin_h, origin_w, CV_32FC(im->channels()));
+  cv::Mat res;
+  if (output_buffer_ == nullptr) {
+    res.create(origin_h, origin_w, CV_32FC(im->channels()));
+  } else {
+    res = cv::Mat(origin_h, origin_w, CV_32FC(im->channels()), output_buffer_);
+  }
   for (int i = 0; i < im->channels(); ++i) {
     cv::extractChannel(split_im[i],
                        cv::Mat(origin_h, origin_w, CV_32FC1,
@@ -113,8 +139,9 @@ bool NormalizeAndPermute::Run(FDMat* mat, const std::vector<float>& mean,
                               const std::vector<float>& std, bool is_scale,
                               const std::vector<float>& min,
                               const std::vector<float>& max, ProcLib lib,
-                              bool swap_rb) {
+                              bool swap_rb, float* output_buffer) {
   auto n = NormalizeAndPermute(mean, std, is_scale, min, max, swap_rb);
+  n.SetOutputBuffer(output_buffer);
   return n(mat, lib);
 }
 
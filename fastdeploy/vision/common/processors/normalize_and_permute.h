@@ -41,6 +41,15 @@ class FASTDEPLOY_DECL NormalizeAndPermute : public Processor {
 #endif
   std::string Name() { return "NormalizeAndPermute"; }
 
+  /** \brief Set the buffer to write the processed image, e.g the memory of
+   *  this image in the input tensor of runtime, so no more copy is needed.
+   *  The processed mat will share memory with this buffer. It's only used
+   *  by the OpenCV implementation.
+   *
+   * \param[in] buffer The buffer with channels * height * width floats, nullptr means to allocate new memory
+   */
+  void SetOutputBuffer(float* buffer) { output_buffer_ = buffer; }
+
   // While use normalize, it is more recommend not use this function
   // this function will need to compute result = ((mat / 255) - mean) / std
   // if we use the following method
@@ -60,13 +69,15 @@ class FASTDEPLOY_DECL NormalizeAndPermute : public Processor {
    * \param[in] min min value vector to be in target image
    * \param[in] lib to define OpenCV or FlyCV or CVCUDA will be used.
    * \param[in] swap_rb to define whether to swap r and b channel order
+   * \param[in] output_buffer The buffer to write the processed image, nullptr means to allocate new memory
    * \return true if the process successed, otherwise false
    */
   static bool Run(FDMat* mat, const std::vector<float>& mean,
                   const std::vector<float>& std, bool is_scale = true,
                   const std::vector<float>& min = std::vector<float>(),
                   const std::vector<float>& max = std::vector<float>(),
-                  ProcLib lib = ProcLib::DEFAULT, bool swap_rb = false);
+                  ProcLib lib = ProcLib::DEFAULT, bool swap_rb = false,
+                  float* output_buffer = nullptr);
 
   /** \brief Process the input images
    *
@@ -106,6 +117,7 @@ class FASTDEPLOY_DECL NormalizeAndPermute : public Processor {
   FDTensor gpu_alpha_;
   FDTensor gpu_beta_;
   bool swap_rb_;
+  float* output_buffer_ = nullptr;
 };
 }  // namespace vision
 }  // namespace fastdeploy
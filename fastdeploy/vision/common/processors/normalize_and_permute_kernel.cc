@@ -0,0 +1,514 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/common/processors/normalize_and_permute_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "fastdeploy/utils/parallel.h"
+#include "opencv2/core/core.hpp"
+
+// The SSE2 kernels are the baseline of x86 CPUs, and the AVX2 kernels are
+// compiled with the target attribute and selected by CpuSupportsAVX2()
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define FD_NP_KERNEL_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define FD_NP_TARGET_AVX2
+#else
+#define FD_NP_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace fastdeploy {
+namespace vision {
+
+namespace {
+
+// Process a row of 3-channel image in blocks of 16 pixels, and return the
+// number of pixels processed, the rest pixels are left to the scalar code
+typedef int (*Row3Kernel)(const uint8_t* src, int width,
+                          const int* src_channels, const float* alpha,
+                          const float* beta, float* dst, int64_t plane_size);
+
+#if defined(FD_NP_KERNEL_X86)
+inline void ConvertAndStore16Sse2(__m128i v, float alpha, float beta,
+                                  float* dst) {
+  __m128 a = _mm_set1_ps(alpha);
+  __m128 b = _mm_set1_ps(beta);
+  __m128i zero = _mm_setzero_si128();
+  __m128i lo = _mm_unpacklo_epi8(v, zero);
+  __m128i hi = _mm_unpackhi_epi8(v, zero);
+  __m128i x[4] = {_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+                  _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)};
+  for (int i = 0; i < 4; ++i) {
+    __m128 f = _mm_cvtepi32_ps(x[i]);
+    _mm_storeu_ps(dst + i * 4, _mm_add_ps(_mm_mul_ps(f, a), b));
+  }
+}
+
+// Deinterleave 16 3-channel pixels by unpacking only, the same sequence as
+// v_load_deinterleave of OpenCV for SSE2
+inline void Deinterleave3Sse2(const uint8_t* src, __m128i* v) {
+  const __m128i* p = reinterpret_cast<const __m128i*>(src);
+  __m128i t00 = _mm_loadu_si128(p);
+  __m128i t01 = _mm_loadu_si128(p + 1);
+  __m128i t02 = _mm_loadu_si128(p + 2);
+
+  __m128i t10 = _mm_unpacklo_epi8(t00, _mm_unpackhi_epi64(t01, t01));
+  __m128i t11 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t00, t00), t02);
+  __m128i t12 = _mm_unpacklo_epi8(t01, _mm_unpackhi_epi64(t02, t02));
+
+  __m128i t20 = _mm_unpacklo_epi8(t10, _mm_unpackhi_epi64(t11, t11));
+  __m128i t21 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t10, t10), t12);
+  __m128i t22 = _mm_unpacklo_epi8(t11, _mm_unpackhi_epi64(t12, t12));
+
+  __m128i t30 = _mm_unpacklo_epi8(t20, _mm_unpackhi_epi64(t21, t21));
+  __m128i t31 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t20, t20), t22);
+  __m128i t32 = _mm_unpacklo_epi8(t21, _mm_unpackhi_epi64(t22, t22));
+
+  v[0] = _mm_unpacklo_epi8(t30, _mm_unpackhi_epi64(t31, t31));
+  v[1] = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t30, t30), t32);
+  v[2] = _mm_unpacklo_epi8(t31, _mm_unpackhi_epi64(t32, t32));
+}
+
+int NormalizeAndPermuteRow3Sse2(const uint8_t* src, int width,
+                                const int* src_channels, const float* alpha,
+                                const float* beta, float* dst,
+                                int64_t plane_size) {
+  int x = 0;
+  for (; x + 16 <= width; x += 16) {
+    __m128i v[3];
+    Deinterleave3Sse2(src + x * 3, v);
+    for (int c = 0; c < 3; ++c) {
+      ConvertAndStore16Sse2(v[src_channels[c]], alpha[c], beta[c],
+                            dst + c * plane_size + x);
+    }
+  }
+  return x;
+}
+
+// Shuffle masks to gather the bytes of one channel from 16 interleaved
+// 3-channel pixels, which are loaded into 3 registers
+struct Deinterleave3Masks {
+  __m128i masks[3][3];  // [channel][register]
+
+  Deinterleave3Masks() {
+    for (int c = 0; c < 3; ++c) {
+      alignas(16) int8_t bytes[3][16];
+      // The bytes with highest bit set will be zeroed by _mm_shuffle_epi8
+      std::fill(&bytes[0][0], &bytes[0][0] + 48, static_cast<int8_t>(-1));
+      for (int j = 0; j < 16; ++j) {
+        int pos = j * 3 + c;
+        bytes[pos / 16][j] = static_cast<int8_t>(pos % 16);
+      }
+      for (int r = 0; r < 3; ++r) {
+        masks[c][r] =
+            _mm_load_si128(reinterpret_cast<const __m128i*>(bytes[r]));
+      }
+    }
+  }
+};
+
+const Deinterleave3Masks& GetDeinterleave3Masks() {
+  static const Deinterleave3Masks masks;
+  return masks;
+}
+
+FD_NP_TARGET_AVX2 inline void ConvertAndStore16Avx2(__m128i v, float alpha,
+                                                    float beta, float* dst) {
+  __m256 a = _mm256_set1_ps(alpha);
+  __m256 b = _mm256_set1_ps(beta);
+  __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v));
+  __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+  _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_mul_ps(lo, a), b));
+  _mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_mul_ps(hi, a), b));
+}
+
+FD_NP_TARGET_AVX2 int NormalizeAndPermuteRow3Avx2(
+    const uint8_t* src, int width, const int* src_channels,
+    const float* alpha, const float* beta, float* dst, int64_t plane_size) {
+  const Deinterleave3Masks& m = GetDeinterleave3Masks();
+  int x = 0;
+  for (; x + 16 <= width; x += 16) {
+    const __m128i* p = reinterpret_cast<const __m128i*>(src + x * 3);
+    __m128i r0 = _mm_loadu_si128(p);
+    __m128i r1 = _mm_loadu_si128(p + 1);
+    __m128i r2 = _mm_loadu_si128(p + 2);
+    for (int c = 0; c < 3; ++c) {
+      const __m128i* mask = m.masks[src_channels[c]];
+      __m128i v = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r0, mask[0]),
+                                            _mm_shuffle_epi8(r1, mask[1])),
+                               _mm_shuffle_epi8(r2, mask[2]));
+      ConvertAndStore16Avx2(v, alpha[c], beta[c], dst + c * plane_size + x);
+    }
+  }
+  return x;
+}
+#elif defined(__ARM_NEON)
+inline void ConvertAndStore16Neon(uint8x16_t v, float alpha, float beta,
+                                  float* dst) {
+  float32x4_t a = vdupq_n_f32(alpha);
+  float32x4_t b = vdupq_n_f32(beta);
+  uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+  uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+  float32x4_t x0 = vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo)));
+  float32x4_t x1 = vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo)));
+  float32x4_t x2 = vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi)));
+  float32x4_t x3 = vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi)));
+  vst1q_f32(dst, vaddq_f32(vmulq_f32(x0, a), b));
+  vst1q_f32(dst + 4, vaddq_f32(vmulq_f32(x1, a), b));
+  vst1q_f32(dst + 8, vaddq_f32(vmulq_f32(x2, a), b));
+  vst1q_f32(dst + 12, vaddq_f32(vmulq_f32(x3, a), b));
+}
+
+int NormalizeAndPermuteRow3Neon(const uint8_t* src, int width,
+                                const int* src_channels, const float* alpha,
+                                const float* beta, float* dst,
+                                int64_t plane_size) {
+  int x = 0;
+  for (; x + 16 <= width; x += 16) {
+    uint8x16x3_t v = vld3q_u8(src + x * 3);
+    for (int c = 0; c < 3; ++c) {
+      ConvertAndStore16Neon(v.val[src_channels[c]], alpha[c], beta[c],
+                            dst + c * plane_size + x);
+    }
+  }
+  return x;
+}
+#endif
+
+Row3Kernel SelectRow3Kernel() {
+#if defined(FD_NP_KERNEL_X86)
+  if (CpuSupportsAVX2()) {
+    return NormalizeAndPermuteRow3Avx2;
+  }
+  return NormalizeAndPermuteRow3Sse2;
+#elif defined(__ARM_NEON)
+  return NormalizeAndPermuteRow3Neon;
+#else
+  return nullptr;
+#endif
+}
+
+// Select the kernel once, nullptr means there's only the scalar code
+Row3Kernel GetRow3Kernel() {
+  static const Row3Kernel kernel = SelectRow3Kernel();
+  return kernel;
+}
+
+// Process one row of image, dst points to the row in the first channel plane
+void NormalizeAndPermuteRow(const uint8_t* src, int width, int channels,
+                            const int* src_channels, const float* alpha,
+                            const float* beta, float* dst,
+                            int64_t plane_size) {
+  int x = 0;
+  if (channels == 3) {
+    // The SIMD kernel processes blocks of 16 pixels, then the rest pixels
+    Row3Kernel kernel = GetRow3Kernel();
+    if (kernel != nullptr) {
+      x = kernel(src, width, src_channels, alpha, beta, dst, plane_size);
+    }
+    float* d0 = dst;
+    float* d1 = dst + plane_size;
+    float* d2 = dst + 2 * plane_size;
+    const int s0 = src_channels[0];
+    const int s1 = src_channels[1];
+    const int s2 = src_channels[2];
+    for (; x < width; ++x) {
+      const uint8_t* p = src + x * 3;
+      d0[x] = p[s0] * alpha[0] + beta[0];
+      d1[x] = p[s1] * alpha[1] + beta[1];
+      d2[x] = p[s2] * alpha[2] + beta[2];
+    }
+    return;
+  }
+  for (int c = 0; c < channels; ++c) {
+    const uint8_t* s = src + src_channels[c];
+    float* d = dst + c * plane_size;
+    float a = alpha[c];
+    float b = beta[c];
+    for (int i = x; i < width; ++i) {
+      d[i] = s[i * channels] * a + b;
+    }
+  }
+}
+
+// Compute the source positions and weights of bilinear interpolation in the
+// same way of cv::resize with INTER_LINEAR
+void ComputeInterpolation(int src_size, int dst_size, std::vector<int>* pos0,
+                          std::vector<int>* pos1,
+                          std::vector<float>* weights) {
+  pos0->resize(dst_size);
+  pos1->resize(dst_size);
+  weights->resize(dst_size);
+  double scale = static_cast<double>(src_size) / dst_size;
+  for (int i = 0; i < dst_size; ++i) {
+    float f = static_cast<float>((i + 0.5) * scale - 0.5);
+    int p = static_cast<int>(std::floor(f));
+    f -= p;
+    if (p < 0) {
+      p = 0;
+      f = 0.f;
+    }
+    if (p >= src_size - 1) {
+      p = src_size - 1;
+      f = 0.f;
+    }
+    (*pos0)[i] = p;
+    (*pos1)[i] = std::min(p + 1, src_size - 1);
+    (*weights)[i] = f;
+  }
+}
+
+// Interpolate one row of image horizontally to planar float buffer,
+// x0 and x1 are the offsets of source pixels in bytes
+void HorizontalInterpolate(const uint8_t* src, int channels,
+                           const int* src_channels, const int* x0,
+                           const int* x1, const float* weights, int dst_width,
+                           float* dst) {
+  for (int c = 0; c < channels; ++c) {
+    const uint8_t* s = src + src_channels[c];
+    float* d = dst + c * dst_width;
+    for (int i = 0; i < dst_width; ++i) {
+      float v0 = s[x0[i]];
+      float v1 = s[x1[i]];
+      d[i] = v0 + (v1 - v0) * weights[i];
+    }
+  }
+}
+
+// Blend two horizontally interpolated rows vertically, and convert them by
+// `dst = (row0 * w0 + row1 * w1) * alpha + beta`
+typedef void (*BlendRowKernel)(const float* row0, const float* row1, float w0,
+                               float w1, float alpha, float beta, int width,
+                               float* dst);
+
+void BlendRowScalar(const float* row0, const float* row1, float w0, float w1,
+                    float alpha, float beta, int width, float* dst) {
+  for (int i = 0; i < width; ++i) {
+    dst[i] = (row0[i] * w0 + row1[i] * w1) * alpha + beta;
+  }
+}
+
+#if defined(FD_NP_KERNEL_X86)
+void BlendRowSse2(const float* row0, const float* row1, float w0, float w1,
+                  float alpha, float beta, int width, float* dst) {
+  __m128 v_w0 = _mm_set1_ps(w0);
+  __m128 v_w1 = _mm_set1_ps(w1);
+  __m128 a = _mm_set1_ps(alpha);
+  __m128 b = _mm_set1_ps(beta);
+  int i = 0;
+  for (; i + 4 <= width; i += 4) {
+    __m128 x = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(row0 + i), v_w0),
+                          _mm_mul_ps(_mm_loadu_ps(row1 + i), v_w1));
+    _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(x, a), b));
+  }
+  BlendRowScalar(row0 + i, row1 + i, w0, w1, alpha, beta, width - i, dst + i);
+}
+
+FD_NP_TARGET_AVX2 void BlendRowAvx2(const float* row0, const float* row1,
+                                    float w0, float w1, float alpha,
+                                    float beta, int width, float* dst) {
+  __m256 v_w0 = _mm256_set1_ps(w0);
+  __m256 v_w1 = _mm256_set1_ps(w1);
+  __m256 a = _mm256_set1_ps(alpha);
+  __m256 b = _mm256_set1_ps(beta);
+  int i = 0;
+  for (; i + 8 <= width; i += 8) {
+    __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(row0 + i), v_w0),
+                             _mm256_mul_ps(_mm256_loadu_ps(row1 + i), v_w1));
+    _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(x, a), b));
+  }
+  BlendRowScalar(row0 + i, row1 + i, w0, w1, alpha, beta, width - i, dst + i);
+}
+#elif defined(__ARM_NEON)
+void BlendRowNeon(const float* row0, const float* row1, float w0, float w1,
+                  float alpha, float beta, int width, float* dst) {
+  float32x4_t v_w0 = vdupq_n_f32(w0);
+  float32x4_t v_w1 = vdupq_n_f32(w1);
+  float32x4_t a = vdupq_n_f32(alpha);
+  float32x4_t b = vdupq_n_f32(beta);
+  int i = 0;
+  for (; i + 4 <= width; i += 4) {
+    float32x4_t x = vaddq_f32(vmulq_f32(vld1q_f32(row0 + i), v_w0),
+                              vmulq_f32(vld1q_f32(row1 + i), v_w1));
+    vst1q_f32(dst + i, vaddq_f32(vmulq_f32(x, a), b));
+  }
+  BlendRowScalar(row0 + i, row1 + i, w0, w1, alpha, beta, width - i, dst + i);
+}
+#endif
+
+BlendRowKernel SelectBlendRowKernel() {
+#if defined(FD_NP_KERNEL_X86)
+  if (CpuSupportsAVX2()) {
+    return BlendRowAvx2;
+  }
+  return BlendRowSse2;
+#elif defined(__ARM_NEON)
+  return BlendRowNeon;
+#else
+  return BlendRowScalar;
+#endif
+}
+
+BlendRowKernel GetBlendRowKernel() {
+  static const BlendRowKernel kernel = SelectBlendRowKernel();
+  return kernel;
+}
+
+}  // namespace
+
+void NormalizeAndPermuteUint8(const uint8_t* src, int height, int width,
+                              int channels, size_t src_step,
+                              const float* alpha, const float* beta,
+                              bool swap_rb, float* dst, int num_threads) {
+  FDASSERT(channels > 0 && channels <= 4,
+           "NormalizeAndPermuteUint8: Only supports 1~4 channels, but now "
+           "it's %d.",
+           channels);
+  int src_channels[4] = {0, 1, 2, 3};
+  if (swap_rb && channels >= 3) {
+    std::swap(src_channels[0], src_channels[2]);
+  }
+  if (num_threads <= 0) {
+    num_threads = cv::getNumThreads();
+  }
+  int64_t plane_size = static_cast<int64_t>(height) * width;
+  // Make sure each thread processes enough pixels to pay for the scheduling
+  int64_t grain_size = std::max<int64_t>(1, (1 << 16) / std::max(width, 1));
+  utils::ParallelFor(
+      height,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t y = begin; y < end; ++y) {
+          NormalizeAndPermuteRow(src + y * src_step, width, channels,
+                                 src_channels, alpha, beta, dst + y * width,
+                                 plane_size);
+        }
+      },
+      grain_size, num_threads);
+}
+
+void LetterBoxNormalizePermuteUint8(const uint8_t* src, int height, int width,
+                                    int channels, size_t src_step,
+                                    int resize_h, int resize_w, int top,
+                                    int bottom, int left, int right,
+                                    const float* padding_value,
+                                    const float* alpha, const float* beta,
+                                    bool swap_rb, float* dst,
+                                    int num_threads) {
+  FDASSERT(channels > 0 && channels <= 4,
+           "LetterBoxNormalizePermuteUint8: Only supports 1~4 channels, but "
+           "now it's %d.",
+           channels);
+  int src_channels[4] = {0, 1, 2, 3};
+  if (swap_rb && channels >= 3) {
+    std::swap(src_channels[0], src_channels[2]);
+  }
+  if (num_threads <= 0) {
+    num_threads = cv::getNumThreads();
+  }
+  int out_h = resize_h + top + bottom;
+  int out_w = resize_w + left + right;
+  int64_t plane_size = static_cast<int64_t>(out_h) * out_w;
+
+  // Fill the paddings
+  for (int c = 0; c < channels; ++c) {
+    float value = padding_value[src_channels[c]] * alpha[c] + beta[c];
+    float* plane = dst + c * plane_size;
+    std::fill(plane, plane + static_cast<int64_t>(top) * out_w, value);
+    std::fill(plane + static_cast<int64_t>(top + resize_h) * out_w,
+              plane + plane_size, value);
+    if (left > 0 || right > 0) {
+      for (int y = top; y < top + resize_h; ++y) {
+        float* row = plane + static_cast<int64_t>(y) * out_w;
+        std::fill(row, row + left, value);
+        std::fill(row + left + resize_w, row + out_w, value);
+      }
+    }
+  }
+
+  float* dst_origin = dst + static_cast<int64_t>(top) * out_w + left;
+  int64_t grain_size = std::max<int64_t>(1, (1 << 16) / std::max(resize_w, 1));
+  if (resize_h == height && resize_w == width) {
+    utils::ParallelFor(
+        height,
+        [&](int64_t begin, int64_t end) {
+          for (int64_t y = begin; y < end; ++y) {
+            NormalizeAndPermuteRow(src + y * src_step, width, channels,
+                                   src_channels, alpha, beta,
+                                   dst_origin + y * out_w, plane_size);
+          }
+        },
+        grain_size, num_threads);
+    return;
+  }
+
+  std::vector<int> x0;
+  std::vector<int> x1;
+  std::vector<float> wx;
+  ComputeInterpolation(width, resize_w, &x0, &x1, &wx);
+  for (int i = 0; i < resize_w; ++i) {
+    x0[i] *= channels;
+    x1[i] *= channels;
+  }
+  std::vector<int> y0;
+  std::vector<int> y1;
+  std::vector<float> wy;
+  ComputeInterpolation(height, resize_h, &y0, &y1, &wy);
+  BlendRowKernel blend_row = GetBlendRowKernel();
+
+  utils::ParallelFor(
+      resize_h,
+      [&](int64_t begin, int64_t end) {
+        // Two horizontally interpolated source rows, reused by the
+        // adjacent output rows
+        std::vector<float> buffer(2 * channels * resize_w);
+        float* rows[2] = {buffer.data(), buffer.data() + channels * resize_w};
+        int cached[2] = {-1, -1};
+        auto fetch = [&](int sy, int keep) -> const float* {
+          for (int k = 0; k < 2; ++k) {
+            if (cached[k] == sy) {
+              return rows[k];
+            }
+          }
+          int k = cached[0] == keep ? 1 : 0;
+          HorizontalInterpolate(src + sy * src_step, channels, src_channels,
+                                x0.data(), x1.data(), wx.data(), resize_w,
+                                rows[k]);
+          cached[k] = sy;
+          return rows[k];
+        };
+        for (int64_t y = begin; y < end; ++y) {
+          const float* r0 = fetch(y0[y], y1[y]);
+          const float* r1 = fetch(y1[y], y0[y]);
+          float w1 = wy[y];
+          float w0 = 1.f - w1;
+          for (int c = 0; c < channels; ++c) {
+            blend_row(r0 + c * resize_w, r1 + c * resize_w, w0, w1, alpha[c],
+                      beta[c], resize_w,
+                      dst_origin + c * plane_size + y * out_w);
+          }
+        }
+      },
+      grain_size, num_threads);
+}
+
+}  // namespace vision
+}  // namespace fastdeploy
@@ -0,0 +1,81 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "fastdeploy/utils/utils.h"
+
+namespace fastdeploy {
+namespace vision {
+
+/** \brief Normalize an uint8 HWC image and permute it to float CHW in a single
+ *  pass over the image, the output channel c is computed by
+ *  `dst[c] = src[c'] * alpha[c] + beta[c]`, where c' is 2 - c for the first
+ *  3 channels while swap_rb is true, otherwise c' is c.
+ *  The kernel is vectorized with SSE2 or NEON, and AVX2 is selected at
+ *  runtime on the x86 CPUs supporting it without any compile flags. It runs
+ *  with the threads of utils::ParallelFor for large images.
+ *
+ * \param[in] src The data of input image
+ * \param[in] height The height of input image
+ * \param[in] width The width of input image
+ * \param[in] channels The channels of input image
+ * \param[in] src_step The bytes of each row in input image
+ * \param[in] alpha The scale of each channel, size should be channels
+ * \param[in] beta The bias of each channel, size should be channels
+ * \param[in] swap_rb Whether to swap the first and third channel
+ * \param[out] dst The output buffer, its size should be channels * height * width, e.g the input tensor of runtime
+ * \param[in] num_threads The max number of threads to use, -1 means the threads number of OpenCV
+ */
+FASTDEPLOY_DECL void NormalizeAndPermuteUint8(
+    const uint8_t* src, int height, int width, int channels, size_t src_step,
+    const float* alpha, const float* beta, bool swap_rb, float* dst,
+    int num_threads = -1);
+
+/** \brief Resize an uint8 HWC image by bilinear interpolation, normalize and
+ *  permute it to float CHW, and fill the paddings around it in a single pass,
+ *  which is the fused version of Resize + Pad + NormalizeAndPermute.
+ *  The paddings are filled with `padding_value[c'] * alpha[c] + beta[c]`.
+ *  The vertical interpolation is vectorized and selected at runtime in the
+ *  same way as NormalizeAndPermuteUint8.
+ *
+ * \param[in] src The data of input image
+ * \param[in] height The height of input image
+ * \param[in] width The width of input image
+ * \param[in] channels The channels of input image
+ * \param[in] src_step The bytes of each row in input image
+ * \param[in] resize_h The height of image after resize
+ * \param[in] resize_w The width of image after resize
+ * \param[in] top The padding rows on top of the resized image
+ * \param[in] bottom The padding rows on bottom of the resized image
+ * \param[in] left The padding columns on left of the resized image
+ * \param[in] right The padding columns on right of the resized image
+ * \param[in] padding_value The padding value of each channel in input image
+ * \param[in] alpha The scale of each channel, size should be channels
+ * \param[in] beta The bias of each channel, size should be channels
+ * \param[in] swap_rb Whether to swap the first and third channel
+ * \param[out] dst The output buffer, its size should be channels * (resize_h + top + bottom) * (resize_w + left + right)
+ * \param[in] num_threads The max number of threads to use, -1 means the threads number of OpenCV
+ */
+FASTDEPLOY_DECL void LetterBoxNormalizePermuteUint8(
+    const uint8_t* src, int height, int width, int channels, size_t src_step,
+    int resize_h, int resize_w, int top, int bottom, int left, int right,
+    const float* padding_value, const float* alpha, const float* beta,
+    bool swap_rb, float* dst, int num_threads = -1);
+
+}  // namespace vision
+}  // namespace fastdeploy
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fastdeploy/vision/common/processors/per_image_preprocessor.h"
+
+namespace fastdeploy {
+namespace vision {
+
+PerImagePreprocessor::PerImagePreprocessor() { SetPreprocessThreads(-1); }
+
+bool PerImagePreprocessor::Run(
+    std::vector<FDMat>* images, std::vector<FDTensor>* outputs,
+    std::vector<std::map<std::string, std::array<float, 2>>>* ims_info) {
+  if (images->size() == 0) {
+    FDERROR << "The size of input images should be greater than 0."
+            << std::endl;
+    return false;
+  }
+  ims_info->clear();
+  ims_info->resize(images->size());
+  ims_info_ = ims_info;
+  bool ret = ProcessorManager::Run(images, outputs);
+  ims_info_ = nullptr;
+  return ret;
+}
+
+bool PerImagePreprocessor::Apply(FDMatBatch* image_batch,
+                                 std::vector<FDTensor>* outputs) {
+  if (ims_info_ == nullptr) {
+    FDERROR << "The shape info of images is required, please call "
+               "Run(images, outputs, ims_info)."
+            << std::endl;
+    return false;
+  }
+  bool success =
+      ApplyToEachMat(image_batch, [this](size_t i, FDMat* mat) -> bool {
+        auto& im_info = (*ims_info_)[i];
+        // Record the shape of image and the shape of preprocessed image
+        im_info["input_shape"] = {static_cast<float>(mat->Height()),
+                                  static_cast<float>(mat->Width())};
+        if (!Preprocess(mat, &im_info)) {
+          return false;
+        }
+        im_info["output_shape"] = {static_cast<float>(mat->Height()),
+                                   static_cast<float>(mat->Width())};
+        return true;
+      });
+  if (!success) {
+    return false;
+  }
+
+  outputs->resize(1);
+  FDTensor* tensor = image_batch->Tensor();
+  (*outputs)[0].SetExternalData(tensor->Shape(), tensor->Dtype(),
+                                tensor->Data(), tensor->device,
+                                tensor->device_id);
+  return true;
+}
+
+}  // namespace vision
+}  // namespace fastdeploy
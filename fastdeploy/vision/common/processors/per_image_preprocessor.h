@@ -0,0 +1,73 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <string>
+
+#include "fastdeploy/vision/common/processors/manager.h"
+
+namespace fastdeploy {
+namespace vision {
+
+/*! @brief Base class of the preprocessors which process each image by Preprocess() and record the shape info of images, the images are processed in parallel on CPU and written into the batched tensor by ApplyToEachMat()
+ */
+class FASTDEPLOY_DECL PerImagePreprocessor : public ProcessorManager {
+ public:
+  /** \brief Create the preprocessor, the images of a batch are processed by the default threads number of utils::ParallelFor, which could be changed by SetPreprocessThreads()
+   */
+  PerImagePreprocessor();
+
+  using ProcessorManager::Run;
+
+  /** \brief Process the input image and prepare input tensors for runtime
+   *
+   * \param[in] images The input image data list, all the elements are returned by cv::imread()
+   * \param[in] outputs The output tensors which will feed in runtime
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the preprocess successed, otherwise false
+   */
+  bool Run(std::vector<FDMat>* images, std::vector<FDTensor>* outputs,
+           std::vector<std::map<std::string, std::array<float, 2>>>* ims_info);
+
+  /** \brief Implement the virtual function of ProcessorManager, Apply() is the
+   *  body of Run(). It's called by Run() with ims_info, otherwise returns false
+   *
+   * \param[in] image_batch The input image batch
+   * \param[in] outputs The output tensors which will feed in runtime
+   * \return true if the preprocess successed, otherwise false
+   */
+  virtual bool Apply(FDMatBatch* image_batch, std::vector<FDTensor>* outputs);
+
+ protected:
+  /** \brief Process an image to the input of runtime with CHW layout, it's called by multiple threads at the same time. The processors should be run with mat->proc_lib to use CUDA after UseCuda()
+   *
+   * \param[in] mat The input image
+   * \param[in] im_info The shape info of this image, the input_shape and output_shape are recorded by the caller, other info could be added here
+   * \return true if the preprocess successed, otherwise false
+   */
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info)
+      = 0;
+
+ private:
+  std::vector<std::map<std::string, std::array<float, 2>>>* ims_info_ =
+      nullptr;
+};
+
+}  // namespace vision
+}  // namespace fastdeploy
@@ -21,6 +21,7 @@
 #include "fastdeploy/vision/common/processors/convert_and_permute.h"
 #include "fastdeploy/vision/common/processors/crop.h"
 #include "fastdeploy/vision/common/processors/hwc2chw.h"
+#include "fastdeploy/vision/common/processors/letter_box_normalize_permute.h"
 #include "fastdeploy/vision/common/processors/limit_by_stride.h"
 #include "fastdeploy/vision/common/processors/limit_short.h"
 #include "fastdeploy/vision/common/processors/normalize.h"
@@ -67,7 +67,10 @@ void BindFastestDet(pybind11::module& m) {
            [](vision::detection::FastestDet& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict", [](vision::detection::FastestDet& self, std::vector<pybind11::array>& data) {
@@ -76,7 +79,10 @@ void BindFastestDet(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::DetectionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       })
       .def_property_readonly("preprocessor", &vision::detection::FastestDet::GetPreprocessor)
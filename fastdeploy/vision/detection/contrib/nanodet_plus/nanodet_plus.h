@@ -17,6 +17,8 @@
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/detection/contrib/nanodet_plus/postprocessor.h"
+#include "fastdeploy/vision/detection/contrib/nanodet_plus/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -41,7 +43,7 @@ class FASTDEPLOY_DECL NanoDetPlus : public FastDeployModel {
   /// Get model's name
   std::string ModelName() const { return "nanodet"; }
 
-  /** \brief Predict the detection result for an input image
+  /** \brief DEPRECATED Predict the detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output detection result will be writen to this structure
@@ -53,44 +55,35 @@ class FASTDEPLOY_DECL NanoDetPlus : public FastDeployModel {
                        float conf_threshold = 0.35f,
                        float nms_iou_threshold = 0.5f);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of input size (width, height), default (320, 320)
-  */
-  std::vector<int> size;
-  // padding value, size should be the same as channels
-  std::vector<float> padding_value;
-  // keep aspect ratio or not when perform resize operation.
-  // This option is set as `false` by default in NanoDet-Plus
-  bool keep_ratio;
-  // downsample strides for NanoDet-Plus to generate anchors,
-  // will take (8, 16, 32, 64) as default values
-  std::vector<int> downsample_strides;
-  // for offseting the boxes by classes when using NMS, default 4096
-  float max_wh;
-  /*! @brief
-  Argument for image postprocessing step, reg_max for GFL regression, default 7
-  */
-  int reg_max;
-
- private:
-  bool Initialize();
+  /** \brief Predict the detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, DetectionResult* result);
 
-  bool Preprocess(Mat* mat, FDTensor* output,
-                  std::map<std::string, std::array<float, 2>>* im_info);
+  /** \brief Predict the detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<DetectionResult>* results);
 
-  bool Postprocess(FDTensor& infer_result, DetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
+  /// Get preprocessor reference of NanoDetPlus
+  virtual NanoDetPlusPreprocessor& GetPreprocessor() { return preprocessor_; }
 
-  bool IsDynamicInput() const { return is_dynamic_input_; }
+  /// Get postprocessor reference of NanoDetPlus
+  virtual NanoDetPlusPostprocessor& GetPostprocessor() {
+    return postprocessor_;
+  }
 
-  // whether to inference with dynamic shape (e.g ONNX export with dynamic shape
-  // or not.)
-  // RangiLyu/nanodet official 'export_onnx.py' script will export static ONNX
-  // by default.
-  // This value will auto check by fastdeploy after the internal Runtime
-  // initialized.
-  bool is_dynamic_input_;
+ protected:
+  bool Initialize();
+  NanoDetPlusPreprocessor preprocessor_;
+  NanoDetPlusPostprocessor postprocessor_;
 };
 
 }  // namespace detection
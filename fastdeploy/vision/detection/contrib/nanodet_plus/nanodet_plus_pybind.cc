@@ -0,0 +1,129 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/pybind/main.h"
+
+namespace fastdeploy {
+void BindNanoDetPlus(pybind11::module& m) {
+  pybind11::class_<vision::detection::NanoDetPlusPreprocessor,
+                   vision::ProcessorManager>(m, "NanoDetPlusPreprocessor")
+      .def(pybind11::init<>())
+      .def("run", [](vision::detection::NanoDetPlusPreprocessor& self,
+                     std::vector<pybind11::array>& im_list) {
+        std::vector<vision::FDMat> images;
+        for (size_t i = 0; i < im_list.size(); ++i) {
+          images.push_back(vision::WrapMat(PyArrayToCvMat(im_list[i])));
+        }
+        std::vector<FDTensor> outputs;
+        std::vector<std::map<std::string, std::array<float, 2>>> ims_info;
+        if (!self.Run(&images, &outputs, &ims_info)) {
+          throw std::runtime_error(
+              "Failed to preprocess the input data in NanoDetPlusPreprocessor.");
+        }
+        for (size_t i = 0; i < outputs.size(); ++i) {
+          outputs[i].StopSharing();
+        }
+        return make_pair(outputs, ims_info);
+      })
+      .def_property("size",
+                    &vision::detection::NanoDetPlusPreprocessor::GetSize,
+                    &vision::detection::NanoDetPlusPreprocessor::SetSize)
+      .def_property("padding_value",
+                    &vision::detection::NanoDetPlusPreprocessor::GetPaddingValue,
+                    &vision::detection::NanoDetPlusPreprocessor::SetPaddingValue)
+      .def_property("keep_ratio",
+                    &vision::detection::NanoDetPlusPreprocessor::GetKeepRatio,
+                    &vision::detection::NanoDetPlusPreprocessor::SetKeepRatio);
+
+  pybind11::class_<vision::detection::NanoDetPlusPostprocessor>(
+      m, "NanoDetPlusPostprocessor")
+      .def(pybind11::init<>())
+      .def("run",
+           [](vision::detection::NanoDetPlusPostprocessor& self,
+              std::vector<FDTensor>& inputs,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::DetectionResult> results;
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "NanoDetPlusPostprocessor.");
+             }
+             return results;
+           })
+      .def("run",
+           [](vision::detection::NanoDetPlusPostprocessor& self,
+              std::vector<pybind11::array>& input_array,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::DetectionResult> results;
+             std::vector<FDTensor> inputs;
+             PyArrayToTensorList(input_array, &inputs, /*share_buffer=*/true);
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "NanoDetPlusPostprocessor.");
+             }
+             return results;
+           })
+      .def_property("conf_threshold",
+                    &vision::detection::NanoDetPlusPostprocessor::GetConfThreshold,
+                    &vision::detection::NanoDetPlusPostprocessor::SetConfThreshold)
+      .def_property("nms_threshold",
+                    &vision::detection::NanoDetPlusPostprocessor::GetNMSThreshold,
+                    &vision::detection::NanoDetPlusPostprocessor::SetNMSThreshold)
+      .def_property("downsample_strides",
+                    &vision::detection::NanoDetPlusPostprocessor::GetDownsampleStrides,
+                    &vision::detection::NanoDetPlusPostprocessor::SetDownsampleStrides)
+      .def_property("max_wh",
+                    &vision::detection::NanoDetPlusPostprocessor::GetMaxWH,
+                    &vision::detection::NanoDetPlusPostprocessor::SetMaxWH)
+      .def_property("reg_max",
+                    &vision::detection::NanoDetPlusPostprocessor::GetRegMax,
+                    &vision::detection::NanoDetPlusPostprocessor::SetRegMax);
+
+  pybind11::class_<vision::detection::NanoDetPlus, FastDeployModel>(m, "NanoDetPlus")
+      .def(pybind11::init<std::string, std::string, RuntimeOption,
+                          ModelFormat>())
+      .def("predict",
+           [](vision::detection::NanoDetPlus& self, pybind11::array& data) {
+             auto mat = PyArrayToCvMat(data);
+             vision::DetectionResult res;
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
+             return res;
+           })
+      .def("batch_predict",
+           [](vision::detection::NanoDetPlus& self,
+              std::vector<pybind11::array>& data) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::DetectionResult> results;
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
+             return results;
+           })
+      .def_property_readonly("preprocessor",
+                             &vision::detection::NanoDetPlus::GetPreprocessor)
+      .def_property_readonly("postprocessor",
+                             &vision::detection::NanoDetPlus::GetPostprocessor);
+}
+}  // namespace fastdeploy
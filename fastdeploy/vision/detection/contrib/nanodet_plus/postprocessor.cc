@@ -0,0 +1,196 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/detection/contrib/nanodet_plus/postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/utils/utils.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+namespace {
+
+struct NanoDetPlusCenterPoint {
+  int grid0;
+  int grid1;
+  int stride;
+};
+
+void GenerateNanoDetPlusCenterPoints(
+    const std::vector<int>& size, const std::vector<int>& downsample_strides,
+    std::vector<NanoDetPlusCenterPoint>* center_points) {
+  // size: tuple of input (width, height), e.g (320, 320)
+  // downsample_strides: downsample strides in NanoDet and
+  // NanoDet-Plus, e.g (8, 16, 32, 64)
+  const int width = size[0];
+  const int height = size[1];
+  for (const auto& ds : downsample_strides) {
+    int num_grid_w = width / ds;
+    int num_grid_h = height / ds;
+    for (int g1 = 0; g1 < num_grid_h; ++g1) {
+      for (int g0 = 0; g0 < num_grid_w; ++g0) {
+        (*center_points).emplace_back(NanoDetPlusCenterPoint{g0, g1, ds});
+      }
+    }
+  }
+}
+
+// The expectation of the softmax distribution over reg_num bins
+float GFLRegression(const float* logits, int reg_num) {
+  // Hint: reg_num = reg_max + 1
+  float total_exp = 0.f;
+  float offset = 0.f;
+  for (int i = 0; i < reg_num; ++i) {
+    float prob = std::exp(logits[i]);
+    total_exp += prob;
+    offset += static_cast<float>(i) * prob;
+  }
+  return offset / total_exp;
+}
+
+}  // namespace
+
+NanoDetPlusPostprocessor::NanoDetPlusPostprocessor() {
+  conf_threshold_ = 0.35;
+  nms_threshold_ = 0.5;
+  downsample_strides_ = {8, 16, 32, 64};
+  max_wh_ = 4096.0f;
+  reg_max_ = 7;
+}
+
+bool NanoDetPlusPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<DetectionResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  const FDTensor& tensor = infer_result[0];
+  if (tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = tensor.shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of infer_result and ims_info should be the "
+               "same."
+            << std::endl;
+    return false;
+  }
+  // infer_result shape might look like (N,2125,112)
+  const size_t num_points = tensor.shape[1];
+  const int num_cls_reg = tensor.shape[2];                   // e.g 112
+  const int num_classes = num_cls_reg - (reg_max_ + 1) * 4;  // e.g 80
+  if (num_classes <= 0) {
+    FDERROR << "The last dim of infer_result " << num_cls_reg
+            << " is too small for reg_max " << reg_max_ << "." << std::endl;
+    return false;
+  }
+
+  // The images of a batch are resized to the same size, so they share the
+  // center points generated with the downsample strides
+  auto iter_out = ims_info[0].find("output_shape");
+  FDASSERT(iter_out != ims_info[0].end(),
+           "Cannot find output_shape from im_info.");
+  std::vector<int> size = {static_cast<int>(iter_out->second[1]),
+                           static_cast<int>(iter_out->second[0])};
+  std::vector<NanoDetPlusCenterPoint> center_points;
+  GenerateNanoDetPlusCenterPoints(size, downsample_strides_, &center_points);
+  if (center_points.size() < num_points) {
+    FDERROR << "The number of center points " << center_points.size()
+            << " is less than the number of boxes " << num_points
+            << ", please check the downsample_strides." << std::endl;
+    return false;
+  }
+  results->resize(batch);
+
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      DetectionResult* result = &((*results)[bs]);
+      result->Clear();
+      const float* data = static_cast<const float*>(tensor.Data()) +
+                          bs * num_points * num_cls_reg;
+      for (size_t i = 0; i < num_points; ++i) {
+        const float* scores = data + i * num_cls_reg;
+        const float* max_class_score =
+            std::max_element(scores, scores + num_classes);
+        float confidence = (*max_class_score);
+        // filter boxes by conf_threshold
+        if (confidence <= conf_threshold_) {
+          continue;
+        }
+        int32_t label_id = std::distance(scores, max_class_score);
+        // fetch i-th center point
+        float grid0 = static_cast<float>(center_points[i].grid0);
+        float grid1 = static_cast<float>(center_points[i].grid1);
+        float downsample_stride = static_cast<float>(center_points[i].stride);
+        // apply gfl regression to get offsets (l,t,r,b)
+        const float* logits = scores + num_classes;  // 32|44...
+        float l = GFLRegression(logits, reg_max_ + 1);
+        float t = GFLRegression(logits + (reg_max_ + 1), reg_max_ + 1);
+        float r = GFLRegression(logits + 2 * (reg_max_ + 1), reg_max_ + 1);
+        float b = GFLRegression(logits + 3 * (reg_max_ + 1), reg_max_ + 1);
+
+        // convert from offsets to [x1, y1, x2, y2], and offset by
+        // label_id * max_wh for multi classes NMS
+        float offset = label_id * max_wh_;
+        result->boxes.emplace_back(std::array<float, 4>{
+            (grid0 - l) * downsample_stride + offset,
+            (grid1 - t) * downsample_stride + offset,
+            (grid0 + r) * downsample_stride + offset,
+            (grid1 + b) * downsample_stride + offset});
+        result->label_ids.push_back(label_id);
+        result->scores.push_back(confidence);
+      }
+
+      if (result->boxes.size() == 0) {
+        continue;
+      }
+
+      utils::NMS(result, nms_threshold_);
+
+      // scale the boxes to the origin image shape, with the scale_factor and
+      // pad recorded by the preprocessor
+      auto iter_ipt = ims_info[bs].find("input_shape");
+      auto iter_scale = ims_info[bs].find("scale_factor");
+      auto iter_pad = ims_info[bs].find("pad");
+      FDASSERT(iter_ipt != ims_info[bs].end() &&
+                   iter_scale != ims_info[bs].end() &&
+                   iter_pad != ims_info[bs].end(),
+               "Cannot find input_shape, scale_factor or pad from im_info.");
+      float ipt_h = iter_ipt->second[0];
+      float ipt_w = iter_ipt->second[1];
+      for (size_t i = 0; i < result->boxes.size(); ++i) {
+        float offset = max_wh_ * result->label_ids[i];
+        for (int j = 0; j < 4; ++j) {
+          // j % 2 == 0 for x, and j % 2 == 1 for y
+          int axis = 1 - j % 2;
+          float bound = (j % 2 == 0 ? ipt_w : ipt_h) - 1.0f;
+          float pad = iter_pad->second[axis];
+          float value =
+              (result->boxes[i][j] - offset - pad) / iter_scale->second[axis];
+          result->boxes[i][j] = std::min(std::max(value, 0.0f), bound);
+        }
+      }
+    }
+  });
+  return true;
+}
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,95 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+/*! @brief Postprocessor object for NanoDetPlus serials model.
+ */
+class FASTDEPLOY_DECL NanoDetPlusPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for NanoDetPlus serials model
+   */
+  NanoDetPlusPostprocessor();
+
+  /** \brief Process the result of runtime and fill to DetectionResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, in shape [N, num_points, num_classes + (reg_max + 1) * 4]
+   * \param[in] results The output result of detection
+   * \param[in] ims_info The shape info list recorded by NanoDetPlusPreprocessor
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<DetectionResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+
+  /// Set conf_threshold, default 0.35
+  void SetConfThreshold(const float& conf_threshold) {
+    conf_threshold_ = conf_threshold;
+  }
+
+  /// Get conf_threshold, default 0.35
+  float GetConfThreshold() const { return conf_threshold_; }
+
+  /// Set nms_threshold, default 0.5
+  void SetNMSThreshold(const float& nms_threshold) {
+    nms_threshold_ = nms_threshold;
+  }
+
+  /// Get nms_threshold, default 0.5
+  float GetNMSThreshold() const { return nms_threshold_; }
+
+  /// Set downsample strides to generate center points, default {8, 16, 32, 64}
+  void SetDownsampleStrides(const std::vector<int>& downsample_strides) {
+    downsample_strides_ = downsample_strides;
+  }
+
+  /// Get downsample strides to generate center points, default {8, 16, 32, 64}
+  std::vector<int> GetDownsampleStrides() const { return downsample_strides_; }
+
+  /// Set max_wh for offseting the boxes by classes when using NMS, default 4096
+  void SetMaxWH(const float& max_wh) { max_wh_ = max_wh; }
+
+  /// Get max_wh for offseting the boxes by classes when using NMS, default 4096
+  float GetMaxWH() const { return max_wh_; }
+
+  /// Set reg_max for GFL regression, default 7
+  void SetRegMax(int reg_max) { reg_max_ = reg_max; }
+
+  /// Get reg_max for GFL regression, default 7
+  int GetRegMax() const { return reg_max_; }
+
+ protected:
+  float conf_threshold_;
+  float nms_threshold_;
+  // downsample strides for NanoDet-Plus to generate anchors,
+  // will take (8, 16, 32, 64) as default values
+  std::vector<int> downsample_strides_;
+  float max_wh_;
+  int reg_max_;
+};
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,112 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/detection/contrib/nanodet_plus/preprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+NanoDetPlusPreprocessor::NanoDetPlusPreprocessor() {
+  size_ = {320, 320};
+  padding_value_ = {0.0f, 0.0f, 0.0f};
+  keep_ratio_ = false;
+}
+
+bool NanoDetPlusPreprocessor::WrapAndResize(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  // Reference: nanodet/data/transform/warp.py#L139
+  // The default value of `keep_ratio` is `fasle` in
+  // `config/nanodet-plus-m-1.5x_320.yml` for both
+  // train and val processes. So, we just let this
+  // option default `false` according to the official
+  // implementation in NanoDet and NanoDet-Plus.
+  // Note, this function will apply a normal resize
+  // operation to input Mat if the keep_ratio option
+  // is fasle and the behavior will be the same as
+  // yolov5's letterbox if keep_ratio is true.
+  float ipt_h = static_cast<float>(mat->Height());
+  float ipt_w = static_cast<float>(mat->Width());
+
+  // with keep_ratio = false (default)
+  if (!keep_ratio_) {
+    (*im_info)["scale_factor"] = {size_[1] / ipt_h, size_[0] / ipt_w};
+    (*im_info)["pad"] = {0.0f, 0.0f};
+    if (size_[1] != mat->Height() || size_[0] != mat->Width()) {
+      return Resize::Run(mat, size_[0], size_[1], -1, -1, cv::INTER_LINEAR,
+                         false, mat->proc_lib);
+    }
+    return true;
+  }
+  // with keep_ratio = true, same as yolov5's letterbox
+  float r = std::min(size_[1] / ipt_h, size_[0] / ipt_w);
+
+  int resize_h = int(round(ipt_h * r));
+  int resize_w = int(round(ipt_w * r));
+
+  if (resize_h != mat->Height() || resize_w != mat->Width()) {
+    if (!Resize::Run(mat, resize_w, resize_h, -1, -1, cv::INTER_LINEAR, false,
+                     mat->proc_lib)) {
+      return false;
+    }
+  }
+
+  int pad_w = size_[0] - resize_w;
+  int pad_h = size_[1] - resize_h;
+  int top = 0;
+  int left = 0;
+  if (pad_h > 0 || pad_w > 0) {
+    float half_h = pad_h * 1.0 / 2;
+    top = int(round(half_h - 0.1));
+    int bottom = int(round(half_h + 0.1));
+    float half_w = pad_w * 1.0 / 2;
+    left = int(round(half_w - 0.1));
+    int right = int(round(half_w + 0.1));
+    if (!Pad::Run(mat, top, bottom, left, right, padding_value_,
+                  mat->proc_lib)) {
+      return false;
+    }
+  }
+  (*im_info)["scale_factor"] = {r, r};
+  (*im_info)["pad"] = {static_cast<float>(top), static_cast<float>(left)};
+  return true;
+}
+
+bool NanoDetPlusPreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  // NanoDet-Plus preprocess steps
+  // 1. WrapAndResize
+  // 2. Normalize, HWC->CHW and cast to float in one pass (keep BGR order)
+  if (!WrapAndResize(mat, im_info)) {
+    return false;
+  }
+  // Compute `result = mat * alpha + beta` directly by channel
+  // Reference: /config/nanodet-plus-m-1.5x_320.yml#L89
+  // from mean: [103.53, 116.28, 123.675], std: [57.375, 57.12, 58.395]
+  // x' = (x - mean) / std to x'= x * alpha + beta.
+  // e.g alpha[0] = 0.017429f = 1.0f / 57.375f
+  // e.g beta[0] = -103.53f * 0.0174291f
+  std::vector<float> alpha = {0.017429f, 0.017507f, 0.017125f};
+  std::vector<float> beta = {-103.53f * 0.0174291f, -116.28f * 0.0175070f,
+                             -123.675f * 0.0171247f};  // BGR order
+  return ConvertAndPermute::Run(mat, alpha, beta, false, mat->proc_lib);
+}
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,77 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/vision/common/processors/per_image_preprocessor.h"
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+/*! @brief Preprocessor object for NanoDetPlus serials model, the scale_factor and pad of the resize are recorded in ims_info besides input_shape and output_shape, which are used to rescale the boxes.
+ */
+class FASTDEPLOY_DECL NanoDetPlusPreprocessor : public PerImagePreprocessor {
+ public:
+  /** \brief Create a preprocessor instance for NanoDetPlus serials model
+   */
+  NanoDetPlusPreprocessor();
+
+  /// Set target size, tuple of (width, height), default size = {320, 320}
+  void SetSize(const std::vector<int>& size) { size_ = size; }
+
+  /// Get target size, tuple of (width, height), default size = {320, 320}
+  std::vector<int> GetSize() const { return size_; }
+
+  /// Set padding value, size should be the same as channels
+  void SetPaddingValue(const std::vector<float>& padding_value) {
+    padding_value_ = padding_value;
+  }
+
+  /// Get padding value, size should be the same as channels
+  std::vector<float> GetPaddingValue() const { return padding_value_; }
+
+  /// Set whether to keep aspect ratio when resize, default false
+  void SetKeepRatio(bool keep_ratio) { keep_ratio_ = keep_ratio; }
+
+  /// Get whether to keep aspect ratio when resize, default false
+  bool GetKeepRatio() const { return keep_ratio_; }
+
+ protected:
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info);
+
+  // resize to the target size, letterbox like yolov5 if keep_ratio_ is true
+  bool WrapAndResize(FDMat* mat,
+                     std::map<std::string, std::array<float, 2>>* im_info);
+
+  // target size, tuple of (width, height), default size = {320, 320}
+  std::vector<int> size_;
+
+  // padding value, size should be the same as channels
+  std::vector<float> padding_value_;
+
+  // keep aspect ratio or not when perform resize operation.
+  // This option is set as `false` by default in NanoDet-Plus
+  bool keep_ratio_;
+};
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
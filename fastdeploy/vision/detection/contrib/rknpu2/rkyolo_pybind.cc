@@ -91,7 +91,10 @@ void BindRKYOLO(pybind11::module& m) {
            [](vision::detection::RKYOLOV5& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -102,7 +105,10 @@ void BindRKYOLO(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::DetectionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
@@ -116,7 +122,10 @@ void BindRKYOLO(pybind11::module& m) {
            [](vision::detection::RKYOLOX& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -127,7 +136,10 @@ void BindRKYOLO(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::DetectionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
@@ -141,7 +153,10 @@ void BindRKYOLO(pybind11::module& m) {
            [](vision::detection::RKYOLOV7& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -152,7 +167,10 @@ void BindRKYOLO(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::DetectionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
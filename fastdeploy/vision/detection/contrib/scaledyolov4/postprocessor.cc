@@ -12,20 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "fastdeploy/pybind/main.h"
+
+#include "fastdeploy/vision/detection/contrib/scaledyolov4/postprocessor.h"
 
 namespace fastdeploy {
-void BindPFLD(pybind11::module& m) {
-  pybind11::class_<vision::facealign::PFLD, FastDeployModel>(m, "PFLD")
-      .def(pybind11::init<std::string, std::string, RuntimeOption,
-                          ModelFormat>())
-      .def("predict",
-           [](vision::facealign::PFLD& self, pybind11::array& data) {
-             auto mat = PyArrayToCvMat(data);
-             vision::FaceAlignmentResult res;
-             self.Predict(&mat, &res);
-             return res;
-           })
-      .def_readwrite("size", &vision::facealign::PFLD::size);
+
+namespace vision {
+
+namespace detection {
+
+ScaledYOLOv4Postprocessor::ScaledYOLOv4Postprocessor() {
+  conf_threshold_ = 0.25;
+  nms_threshold_ = 0.5;
 }
+
+}  // namespace detection
+
+}  // namespace vision
+
 }  // namespace fastdeploy
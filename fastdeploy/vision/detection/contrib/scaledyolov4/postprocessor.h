@@ -0,0 +1,38 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "fastdeploy/vision/detection/contrib/yolo_postprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+/*! @brief Postprocessor object for ScaledYOLOv4 serials model.
+ */
+class FASTDEPLOY_DECL ScaledYOLOv4Postprocessor : public YOLOPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for ScaledYOLOv4 serials model, the default conf_threshold is 0.25 and nms_threshold is 0.5
+   */
+  ScaledYOLOv4Postprocessor();
+};
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -12,20 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "fastdeploy/pybind/main.h"
+
+#include "fastdeploy/vision/detection/contrib/scaledyolov4/preprocessor.h"
 
 namespace fastdeploy {
-void BindFSANet(pybind11::module& m) {
-  pybind11::class_<vision::headpose::FSANet, FastDeployModel>(m, "FSANet")
-      .def(pybind11::init<std::string, std::string, RuntimeOption,
-                          ModelFormat>())
-      .def("predict",
-           [](vision::headpose::FSANet& self, pybind11::array& data) {
-             auto mat = PyArrayToCvMat(data);
-             vision::HeadPoseResult res;
-             self.Predict(&mat, &res);
-             return res;
-           })
-      .def_readwrite("size", &vision::headpose::FSANet::size);
+
+namespace vision {
+
+namespace detection {
+
+ScaledYOLOv4Preprocessor::ScaledYOLOv4Preprocessor() {
+  // The original repo truncates the size while fitting the image
+  fit_by_round_ = false;
 }
+
+}  // namespace detection
+
+}  // namespace vision
+
 }  // namespace fastdeploy
@@ -0,0 +1,280 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/detection/contrib/yolo_decode.h"
+
+#include <algorithm>
+
+#include "fastdeploy/vision/utils/utils.h"
+
+// The AVX2 kernel is compiled with the target attribute and selected by
+// CpuSupportsAVX2(), SSE2 is the baseline of x86 CPUs
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define FD_YOLO_KERNEL_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define FD_YOLO_TARGET_AVX2
+#else
+#define FD_YOLO_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace fastdeploy {
+namespace vision {
+namespace detection {
+
+namespace {
+
+// Add the box of [cx, cy, w, h] in the letterboxed image to result
+void AddBox(float cx, float cy, float w, float h, float score, int32_t label,
+            const LetterBoxInfo& letter_box, DetectionResult* result) {
+  // convert from [x, y, w, h] to [x1, y1, x2, y2], and then remove the pad
+  // and scale of the letterbox
+  result->boxes.emplace_back(std::array<float, 4>{
+      (cx - w / 2.0f - letter_box.pad_w) / letter_box.scale,
+      (cy - h / 2.0f - letter_box.pad_h) / letter_box.scale,
+      (cx + w / 2.0f - letter_box.pad_w) / letter_box.scale,
+      (cy + h / 2.0f - letter_box.pad_h) / letter_box.scale});
+  result->scores.push_back(score);
+  result->label_ids.push_back(label);
+}
+
+// Append the indices of the set bits in mask to rows
+inline void AppendMaskedRows(int mask, int lanes, int start,
+                             std::vector<int32_t>* rows) {
+  for (int k = 0; mask != 0 && k < lanes; ++k, mask >>= 1) {
+    if (mask & 1) {
+      rows->push_back(start + k);
+    }
+  }
+}
+
+#if defined(FD_YOLO_KERNEL_X86)
+// The kernels below append the rows of [0, i) whose objectness is larger than
+// threshold, and return i, the rest rows are left to the scalar code
+FD_YOLO_TARGET_AVX2 int FilterByObjectnessAvx2(const float* objectness,
+                                               int num_rows, int row_size,
+                                               float threshold,
+                                               std::vector<int32_t>* rows) {
+  const __m256i offsets = _mm256_mullo_epi32(
+      _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(row_size));
+  const __m256 vthreshold = _mm256_set1_ps(threshold);
+  int i = 0;
+  for (; i + 8 <= num_rows; i += 8) {
+    __m256 v = _mm256_i32gather_ps(
+        objectness + static_cast<int64_t>(i) * row_size, offsets, 4);
+    int mask = _mm256_movemask_ps(_mm256_cmp_ps(v, vthreshold, _CMP_GT_OQ));
+    AppendMaskedRows(mask, 8, i, rows);
+  }
+  return i;
+}
+
+int FilterByObjectnessSse2(const float* objectness, int num_rows,
+                           int row_size, float threshold,
+                           std::vector<int32_t>* rows) {
+  const __m128 vthreshold = _mm_set1_ps(threshold);
+  int i = 0;
+  for (; i + 4 <= num_rows; i += 4) {
+    const float* p = objectness + static_cast<int64_t>(i) * row_size;
+    __m128 v = _mm_setr_ps(p[0], p[row_size], p[2 * row_size],
+                           p[3 * row_size]);
+    int mask = _mm_movemask_ps(_mm_cmpgt_ps(v, vthreshold));
+    AppendMaskedRows(mask, 4, i, rows);
+  }
+  return i;
+}
+#elif defined(__ARM_NEON)
+int FilterByObjectnessNeon(const float* objectness, int num_rows,
+                           int row_size, float threshold,
+                           std::vector<int32_t>* rows) {
+  const float32x4_t vthreshold = vdupq_n_f32(threshold);
+  // The bit of each lane in mask
+  const uint32_t bits_data[4] = {1, 2, 4, 8};
+  const uint32x4_t bits = vld1q_u32(bits_data);
+  int i = 0;
+  for (; i + 4 <= num_rows; i += 4) {
+    const float* p = objectness + static_cast<int64_t>(i) * row_size;
+    float32x4_t v = vdupq_n_f32(p[0]);
+    v = vsetq_lane_f32(p[row_size], v, 1);
+    v = vsetq_lane_f32(p[2 * row_size], v, 2);
+    v = vsetq_lane_f32(p[3 * row_size], v, 3);
+    uint32x4_t gt = vandq_u32(vcgtq_f32(v, vthreshold), bits);
+    uint32x2_t folded = vorr_u32(vget_low_u32(gt), vget_high_u32(gt));
+    int mask =
+        static_cast<int>(vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1));
+    AppendMaskedRows(mask, 4, i, rows);
+  }
+  return i;
+}
+#endif
+
+// Get the rows whose objectness is larger than threshold, the objectness of
+// the rows are compared by SIMD with 4 or 8 rows each time
+void FilterByObjectness(const float* objectness, int num_rows, int row_size,
+                        float threshold, std::vector<int32_t>* rows) {
+  rows->clear();
+  int i = 0;
+#if defined(FD_YOLO_KERNEL_X86)
+  if (CpuSupportsAVX2()) {
+    i = FilterByObjectnessAvx2(objectness, num_rows, row_size, threshold,
+                               rows);
+  } else {
+    i = FilterByObjectnessSse2(objectness, num_rows, row_size, threshold,
+                               rows);
+  }
+#elif defined(__ARM_NEON)
+  i = FilterByObjectnessNeon(objectness, num_rows, row_size, threshold, rows);
+#endif
+  for (; i < num_rows; ++i) {
+    if (objectness[static_cast<int64_t>(i) * row_size] > threshold) {
+      rows->push_back(i);
+    }
+  }
+}
+
+// Add the boxes of the anchors [start, start + lanes), whose max class
+// scores and labels are in max_scores and labels
+void AddYOLOv8Boxes(const float* data, int num_anchors, int num_classes,
+                    int start, int lanes, const float* max_scores,
+                    const int32_t* labels, float conf_threshold,
+                    bool multi_label, const LetterBoxInfo& letter_box,
+                    DetectionResult* result) {
+  for (int k = 0; k < lanes; ++k) {
+    if (max_scores[k] <= conf_threshold) {
+      continue;
+    }
+    int i = start + k;
+    float cx = data[i];
+    float cy = data[num_anchors + i];
+    float w = data[2 * num_anchors + i];
+    float h = data[3 * num_anchors + i];
+    if (!multi_label) {
+      AddBox(cx, cy, w, h, max_scores[k], labels[k], letter_box, result);
+      continue;
+    }
+    const float* class_scores = data + 4 * num_anchors + i;
+    for (int c = 0; c < num_classes; ++c) {
+      float confidence = class_scores[static_cast<int64_t>(c) * num_anchors];
+      if (confidence > conf_threshold) {
+        AddBox(cx, cy, w, h, confidence, c, letter_box, result);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+LetterBoxInfo GetLetterBoxInfo(
+    const std::map<std::string, std::array<float, 2>>& im_info) {
+  auto iter_out = im_info.find("output_shape");
+  auto iter_ipt = im_info.find("input_shape");
+  FDASSERT(iter_out != im_info.end() && iter_ipt != im_info.end(),
+           "Cannot find input_shape or output_shape from im_info.");
+  float out_h = iter_out->second[0];
+  float out_w = iter_out->second[1];
+  LetterBoxInfo letter_box;
+  letter_box.ipt_h = iter_ipt->second[0];
+  letter_box.ipt_w = iter_ipt->second[1];
+  letter_box.scale =
+      std::min(out_h / letter_box.ipt_h, out_w / letter_box.ipt_w);
+  letter_box.pad_h = (out_h - letter_box.ipt_h * letter_box.scale) / 2;
+  letter_box.pad_w = (out_w - letter_box.ipt_w * letter_box.scale) / 2;
+  return letter_box;
+}
+
+void DecodeYOLOv5Output(const float* data, int num_rows, int row_size,
+                        int num_classes, float conf_threshold,
+                        bool multi_label, const LetterBoxInfo& letter_box,
+                        DetectionResult* result, std::vector<int32_t>* rows) {
+  result->Clear();
+  std::vector<int32_t> candidates;
+  FilterByObjectness(data + 4, num_rows, row_size, conf_threshold,
+                     &candidates);
+  result->boxes.reserve(candidates.size());
+  result->scores.reserve(candidates.size());
+  result->label_ids.reserve(candidates.size());
+  if (rows != nullptr) {
+    rows->clear();
+    rows->reserve(candidates.size());
+  }
+  for (int32_t row : candidates) {
+    const float* s = data + static_cast<int64_t>(row) * row_size;
+    if (multi_label) {
+      for (int j = 0; j < num_classes; ++j) {
+        float confidence = s[4] * s[5 + j];
+        // filter boxes by conf_threshold
+        if (confidence <= conf_threshold) {
+          continue;
+        }
+        AddBox(s[0], s[1], s[2], s[3], confidence, j, letter_box, result);
+        if (rows != nullptr) {
+          rows->push_back(row);
+        }
+      }
+      continue;
+    }
+    float max_class_score = 0.0f;
+    int label_id =
+        utils::ArgMaxWithValue(s + 5, num_classes, &max_class_score);
+    float confidence = s[4] * max_class_score;
+    // filter boxes by conf_threshold
+    if (label_id < 0 || confidence <= conf_threshold) {
+      continue;
+    }
+    AddBox(s[0], s[1], s[2], s[3], confidence, label_id, letter_box, result);
+    if (rows != nullptr) {
+      rows->push_back(row);
+    }
+  }
+}
+
+void DecodeYOLOv8Output(const float* data, int num_anchors, int num_classes,
+                        float conf_threshold, bool multi_label,
+                        const LetterBoxInfo& letter_box,
+                        DetectionResult* result) {
+  result->Clear();
+  if (num_classes <= 0) {
+    return;
+  }
+  // The max class scores of the anchors are computed with SIMD by chunks,
+  // then the anchors whose max scores are not larger than conf_threshold
+  // are skipped
+  const float* class_scores = data + 4 * static_cast<int64_t>(num_anchors);
+  const int chunk_size = 256;
+  float max_scores[chunk_size];
+  int32_t labels[chunk_size];
+  for (int start = 0; start < num_anchors; start += chunk_size) {
+    int lanes = std::min(chunk_size, num_anchors - start);
+    utils::ArgMaxOverChannels(class_scores + start, num_classes, num_anchors,
+                              lanes, labels, max_scores);
+    AddYOLOv8Boxes(data, num_anchors, num_classes, start, lanes, max_scores,
+                   labels, conf_threshold, multi_label, letter_box, result);
+  }
+}
+
+void ClipBoxes(const LetterBoxInfo& letter_box, DetectionResult* result) {
+  for (auto& box : result->boxes) {
+    box[0] = std::min(std::max(box[0], 0.0f), letter_box.ipt_w);
+    box[1] = std::min(std::max(box[1], 0.0f), letter_box.ipt_h);
+    box[2] = std::min(std::max(box[2], 0.0f), letter_box.ipt_w);
+    box[3] = std::min(std::max(box[3], 0.0f), letter_box.ipt_h);
+  }
+}
+
+}  // namespace detection
+}  // namespace vision
+}  // namespace fastdeploy
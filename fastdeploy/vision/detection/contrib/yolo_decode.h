@@ -0,0 +1,86 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+namespace vision {
+namespace detection {
+
+/// The letterbox applied by the YOLO preprocessors, used to map the boxes back to the input image
+struct LetterBoxInfo {
+  float scale = 1.0f;
+  float pad_w = 0.0f;
+  float pad_h = 0.0f;
+  /// The width of the input image
+  float ipt_w = 0.0f;
+  /// The height of the input image
+  float ipt_h = 0.0f;
+};
+
+/// Get LetterBoxInfo from the input_shape and output_shape recorded in im_info
+FASTDEPLOY_DECL LetterBoxInfo GetLetterBoxInfo(
+    const std::map<std::string, std::array<float, 2>>& im_info);
+
+/** \brief Decode the output rows of YOLOv5/YOLOv7/YOLOv5Seg into result
+ *
+ * Each row is [cx, cy, w, h, objectness, num_classes scores, extra values]. The rows are filtered by objectness first, which is the upper bound of the confidence since the class scores are sigmoid outputs, then the class argmax is only computed for the remaining rows. The boxes are mapped back to the input image by letter_box but not clipped, since the clipped boxes would change the IoU in NMS
+ *
+ * \param[in] data The output of one image with num_rows * row_size values
+ * \param[in] num_rows The number of rows
+ * \param[in] row_size The number of values in each row
+ * \param[in] num_classes The number of classes
+ * \param[in] conf_threshold The boxes whose confidence is not larger than conf_threshold are dropped
+ * \param[in] multi_label Whether to add a box for each class larger than conf_threshold, otherwise only for the max class
+ * \param[in] letter_box The letterbox of the image
+ * \param[out] result The decoded boxes, scores and label_ids
+ * \param[out] rows The row of each decoded box if not nullptr
+ */
+FASTDEPLOY_DECL void DecodeYOLOv5Output(const float* data, int num_rows,
+                                        int row_size, int num_classes,
+                                        float conf_threshold, bool multi_label,
+                                        const LetterBoxInfo& letter_box,
+                                        DetectionResult* result,
+                                        std::vector<int32_t>* rows = nullptr);
+
+/** \brief Decode the output of YOLOv8 into result without transposing it
+ *
+ * \param[in] data The output of one image in the layout of [4 + num_classes, num_anchors], the first 4 channels are [cx, cy, w, h]
+ * \param[in] num_anchors The number of anchors
+ * \param[in] num_classes The number of classes
+ * \param[in] conf_threshold The boxes whose confidence is not larger than conf_threshold are dropped
+ * \param[in] multi_label Whether to add a box for each class larger than conf_threshold, otherwise only for the max class
+ * \param[in] letter_box The letterbox of the image
+ * \param[out] result The decoded boxes, scores and label_ids
+ */
+FASTDEPLOY_DECL void DecodeYOLOv8Output(const float* data, int num_anchors,
+                                        int num_classes, float conf_threshold,
+                                        bool multi_label,
+                                        const LetterBoxInfo& letter_box,
+                                        DetectionResult* result);
+
+/// Clip the boxes in result to the input image
+FASTDEPLOY_DECL void ClipBoxes(const LetterBoxInfo& letter_box,
+                               DetectionResult* result);
+
+}  // namespace detection
+}  // namespace vision
+}  // namespace fastdeploy
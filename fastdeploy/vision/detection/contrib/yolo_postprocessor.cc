@@ -0,0 +1,80 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fastdeploy/vision/detection/contrib/yolo_postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/utils/utils.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+void YOLOPostprocessor::DecodeImage(const float* data, int num_rows,
+                                    int row_size,
+                                    const LetterBoxInfo& letter_box,
+                                    DetectionResult* result) const {
+  // Only the box of the max class is kept for each row
+  DecodeYOLOv5Output(data, num_rows, row_size, row_size - 5, conf_threshold_,
+                     false, letter_box, result);
+}
+
+bool YOLOPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<DetectionResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  const FDTensor& tensor = infer_result[0];
+  if (tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = tensor.shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of infer_result and ims_info should be the "
+               "same."
+            << std::endl;
+    return false;
+  }
+  if (!PrepareBatch(tensor, ims_info)) {
+    return false;
+  }
+  int num_rows = tensor.shape[1];
+  int row_size = tensor.shape[2];
+  results->resize(batch);
+
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      DetectionResult* result = &((*results)[bs]);
+      LetterBoxInfo letter_box = GetLetterBoxInfo(ims_info[bs]);
+      const float* data = static_cast<const float*>(tensor.Data()) +
+                          bs * num_rows * row_size;
+      DecodeImage(data, num_rows, row_size, letter_box, result);
+      if (result->boxes.size() == 0) {
+        continue;
+      }
+      utils::NMS(result, nms_threshold_, -1, true);
+      ClipBoxes(letter_box, result);
+    }
+  });
+  return true;
+}
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,95 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/detection/contrib/yolo_decode.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+/*! @brief Base postprocessor of the YOLO serials models whose output rows are [x, y, w, h, objectness, class scores] of the letterboxed image, e.g. YOLOR, YOLOv6, ScaledYOLOv4 and YOLOv5Lite
+ */
+class FASTDEPLOY_DECL YOLOPostprocessor {
+ public:
+  virtual ~YOLOPostprocessor() = default;
+
+  /** \brief Process the result of runtime and fill to DetectionResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, in shape [N, num_boxes, 5 + num_classes]
+   * \param[in] results The output result of detection
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<DetectionResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+
+  /// Set conf_threshold, default 0.25
+  void SetConfThreshold(const float& conf_threshold) {
+    conf_threshold_ = conf_threshold;
+  }
+
+  /// Get conf_threshold, default 0.25
+  float GetConfThreshold() const { return conf_threshold_; }
+
+  /// Set nms_threshold, default 0.5
+  void SetNMSThreshold(const float& nms_threshold) {
+    nms_threshold_ = nms_threshold;
+  }
+
+  /// Get nms_threshold, default 0.5
+  float GetNMSThreshold() const { return nms_threshold_; }
+
+ protected:
+  /** \brief Prepare the states shared by the images of a batch before decoding, e.g. the anchors
+   *
+   * \param[in] tensor The output tensor of runtime
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the preparation successed, otherwise false
+   */
+  virtual bool PrepareBatch(
+      const FDTensor& tensor,
+      const std::vector<std::map<std::string, std::array<float, 2>>>&
+          ims_info) {
+    return true;
+  }
+
+  /** \brief Decode the output rows of one image, the boxes are mapped back to the input image but not clipped
+   *
+   * \param[in] data The output of one image with num_rows * row_size values
+   * \param[in] num_rows The number of rows
+   * \param[in] row_size The number of values in each row
+   * \param[in] letter_box The letterbox of the image
+   * \param[out] result The decoded boxes, scores and label_ids
+   */
+  virtual void DecodeImage(const float* data, int num_rows, int row_size,
+                           const LetterBoxInfo& letter_box,
+                           DetectionResult* result) const;
+
+  float conf_threshold_ = 0.25;
+  float nms_threshold_ = 0.5;
+};
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -1,5 +1,4 @@
-﻿
-  // Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -14,12 +13,17 @@
 // limitations under the License.
 
 #pragma once
+
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/detection/contrib/yolor/postprocessor.h"
+#include "fastdeploy/vision/detection/contrib/yolor/preprocessor.h"
 
 namespace fastdeploy {
+
 namespace vision {
+
 namespace detection {
 /*! @brief YOLOR model object used when to load a YOLOR model exported by YOLOR.
  */
@@ -37,7 +41,8 @@ class FASTDEPLOY_DECL YOLOR : public FastDeployModel {
         const ModelFormat& model_format = ModelFormat::ONNX);
 
   virtual std::string ModelName() const { return "YOLOR"; }
-  /** \brief Predict the detection result for an input image
+
+  /** \brief DEPRECATED Predict the detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread()
    * \param[in] result The output detection result will be writen to this structure
@@ -49,47 +54,33 @@ class FASTDEPLOY_DECL YOLOR : public FastDeployModel {
                        float conf_threshold = 0.25,
                        float nms_iou_threshold = 0.5);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default size = {640, 640}
-  */
-  std::vector<int> size;
-  // padding value, size should be the same as channels
-
-  std::vector<float> padding_value;
-  // only pad to the minimum rectange which height and width is times of stride
-  bool is_mini_pad;
-  // while is_mini_pad = false and is_no_pad = true,
-  // will resize the image to the set size
-  bool is_no_pad;
-  // if is_scale_up is false, the input image only can be zoom out,
-  // the maximum resize scale cannot exceed 1.0
-  bool is_scale_up;
-  // padding stride, for is_mini_pad
-  int stride;
-  // for offseting the boxes by classes when using NMS
-  float max_wh;
-
- private:
-  bool Initialize();
+  /** \brief Predict the detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, DetectionResult* result);
 
-  bool Preprocess(Mat* mat, FDTensor* output,
-                  std::map<std::string, std::array<float, 2>>* im_info);
+  /** \brief Predict the detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<DetectionResult>* results);
 
-  bool Postprocess(FDTensor& infer_result, DetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
+  /// Get preprocessor reference of YOLOR
+  virtual YOLORPreprocessor& GetPreprocessor() { return preprocessor_; }
 
-  void LetterBox(Mat* mat, const std::vector<int>& size,
-                 const std::vector<float>& color, bool _auto,
-                 bool scale_fill = false, bool scale_up = true,
-                 int stride = 32);
+  /// Get postprocessor reference of YOLOR
+  virtual YOLORPostprocessor& GetPostprocessor() { return postprocessor_; }
 
-  // whether to inference with dynamic shape (e.g ONNX export with dynamic shape
-  // or not.)
-  // while is_dynamic_shape if 'false', is_mini_pad will force 'false'. This
-  // value will
-  // auto check by fastdeploy after the internal Runtime already initialized.
-  bool is_dynamic_input_;
+ protected:
+  bool Initialize();
+  YOLORPreprocessor preprocessor_;
+  YOLORPostprocessor postprocessor_;
 };
 
 }  // namespace detection
@@ -27,39 +27,18 @@ YOLOv5Preprocessor::YOLOv5Preprocessor() {
   is_scale_up_ = true;
   stride_ = 32;
   max_wh_ = 7680.0;
+  fused_letter_box_ = false;
 }
 
 void YOLOv5Preprocessor::LetterBox(FDMat* mat) {
-  float scale =
-      std::min(size_[1] * 1.0 / mat->Height(), size_[0] * 1.0 / mat->Width());
-  if (!is_scale_up_) {
-    scale = std::min(scale, 1.0f);
-  }
-
-  int resize_h = int(round(mat->Height() * scale));
-  int resize_w = int(round(mat->Width() * scale));
-
-  int pad_w = size_[0] - resize_w;
-  int pad_h = size_[1] - resize_h;
-  if (is_mini_pad_) {
-    pad_h = pad_h % stride_;
-    pad_w = pad_w % stride_;
-  } else if (is_no_pad_) {
-    pad_h = 0;
-    pad_w = 0;
-    resize_h = size_[1];
-    resize_w = size_[0];
-  }
-  if (std::fabs(scale - 1.0f) > 1e-06) {
+  int resize_w, resize_h, top, bottom, left, right;
+  ComputeLetterBox(*mat, size_, is_scale_up_, is_mini_pad_, is_no_pad_,
+                   stride_, &resize_w, &resize_h, &top, &bottom, &left,
+                   &right);
+  if (resize_w != mat->Width() || resize_h != mat->Height()) {
     Resize::Run(mat, resize_w, resize_h);
   }
-  if (pad_h > 0 || pad_w > 0) {
-    float half_h = pad_h * 1.0 / 2;
-    int top = int(round(half_h - 0.1));
-    int bottom = int(round(half_h + 0.1));
-    float half_w = pad_w * 1.0 / 2;
-    int left = int(round(half_w - 0.1));
-    int right = int(round(half_w + 0.1));
+  if (top > 0 || bottom > 0 || left > 0 || right > 0) {
     Pad::Run(mat, top, bottom, left, right, padding_value_);
   }
 }
@@ -97,6 +76,11 @@ bool YOLOv5Preprocessor::Run(
   }
   ims_info->resize(images->size());
   outputs->resize(1);
+  if (fused_letter_box_) {
+    return LetterBoxNormalizePermuteBatch(
+        images, size_, padding_value_, is_scale_up_, is_mini_pad_, is_no_pad_,
+        stride_, &((*outputs)[0]), ims_info);
+  }
   // Concat all the preprocessed data to a batch tensor
   std::vector<FDTensor> tensors(images->size());
   for (size_t i = 0; i < images->size(); ++i) {
@@ -78,6 +78,17 @@ class FASTDEPLOY_DECL YOLOv5Preprocessor {
   /// Get padding stride, default 32
   bool GetStride() const { return stride_; }
 
+  /// Set whether to use the fused letterbox, which resizes, pads and
+  /// normalizes the images in a single pass and writes them into the batched
+  /// input tensor directly, default false. The results may slightly differ
+  /// from the default way, since the resized pixels are not rounded to uint8
+  void SetFusedLetterBox(bool fused_letter_box) {
+    fused_letter_box_ = fused_letter_box;
+  }
+
+  /// Get whether to use the fused letterbox, default false
+  bool GetFusedLetterBox() const { return fused_letter_box_; }
+
  protected:
   bool Preprocess(FDMat* mat, FDTensor* output,
                   std::map<std::string, std::array<float, 2>>* im_info);
@@ -106,6 +117,10 @@ class FASTDEPLOY_DECL YOLOv5Preprocessor {
 
   // for offseting the boxes by classes when using NMS
   float max_wh_;
+
+  // whether to use LetterBoxNormalizePermute instead of
+  // Resize + Pad + ConvertAndPermute
+  bool fused_letter_box_;
 };
 
 }  // namespace detection
@@ -50,7 +50,10 @@ void BindYOLOv5(pybind11::module& m) {
                     &vision::detection::YOLOv5Preprocessor::GetMiniPad,
                     &vision::detection::YOLOv5Preprocessor::SetMiniPad)
       .def_property("stride", &vision::detection::YOLOv5Preprocessor::GetStride,
-                    &vision::detection::YOLOv5Preprocessor::SetStride);
+                    &vision::detection::YOLOv5Preprocessor::SetStride)
+      .def_property("fused_letter_box",
+                    &vision::detection::YOLOv5Preprocessor::GetFusedLetterBox,
+                    &vision::detection::YOLOv5Preprocessor::SetFusedLetterBox);
 
   pybind11::class_<vision::detection::YOLOv5Postprocessor>(
       m, "YOLOv5Postprocessor")
@@ -100,7 +103,10 @@ void BindYOLOv5(pybind11::module& m) {
            [](vision::detection::YOLOv5& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -111,7 +117,10 @@ void BindYOLOv5(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::DetectionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
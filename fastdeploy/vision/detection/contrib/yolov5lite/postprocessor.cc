@@ -0,0 +1,120 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/detection/contrib/yolov5lite/postprocessor.h"
+
+#include <cmath>
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+YOLOv5LitePostprocessor::YOLOv5LitePostprocessor() {
+  conf_threshold_ = 0.45;
+  nms_threshold_ = 0.25;
+  is_decode_exported_ = false;
+  anchor_config_ = {{10.0, 13.0, 16.0, 30.0, 33.0, 23.0},
+                    {30.0, 61.0, 62.0, 45.0, 59.0, 119.0},
+                    {116.0, 90.0, 156.0, 198.0, 373.0, 326.0}};
+  downsample_strides_ = {8, 16, 32};
+}
+
+void YOLOv5LitePostprocessor::GenerateAnchors(
+    int width, int height, std::vector<Anchor>* anchors) const {
+  anchors->clear();
+  for (size_t i = 0; i < downsample_strides_.size(); ++i) {
+    const int ds = downsample_strides_[i];
+    int num_grid_w = width / ds;
+    int num_grid_h = height / ds;
+    int num_anchors = anchor_config_[i].size() / 2;
+    for (int an = 0; an < num_anchors; ++an) {
+      float anchor_w = anchor_config_[i][an * 2];
+      float anchor_h = anchor_config_[i][an * 2 + 1];
+      for (int g1 = 0; g1 < num_grid_h; ++g1) {
+        for (int g0 = 0; g0 < num_grid_w; ++g0) {
+          anchors->emplace_back(Anchor{g0, g1, ds, anchor_w, anchor_h});
+        }
+      }
+    }
+  }
+}
+
+bool YOLOv5LitePostprocessor::PrepareBatch(
+    const FDTensor& tensor,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  // The images of a batch have the same output_shape, so the anchors are
+  // shared by all of them
+  anchors_.clear();
+  if (is_decode_exported_ || ims_info.empty()) {
+    return true;
+  }
+  if (anchor_config_.size() < downsample_strides_.size()) {
+    FDERROR << "The anchor_config should have the anchors of each "
+               "downsample stride."
+            << std::endl;
+    return false;
+  }
+  auto iter_out = ims_info[0].find("output_shape");
+  FDASSERT(iter_out != ims_info[0].end(),
+           "Cannot find output_shape from im_info.");
+  GenerateAnchors(static_cast<int>(iter_out->second[1]),
+                  static_cast<int>(iter_out->second[0]), &anchors_);
+  if (static_cast<int64_t>(anchors_.size()) != tensor.shape[1]) {
+    FDERROR << "The number of anchors " << anchors_.size()
+            << " doesn't match the number of boxes " << tensor.shape[1]
+            << ", please check anchor_config and downsample_strides, or "
+               "set is_decode_exported if the model was exported with "
+               "the decode module."
+            << std::endl;
+    return false;
+  }
+  return true;
+}
+
+void YOLOv5LitePostprocessor::DecodeImage(const float* data, int num_rows,
+                                          int row_size,
+                                          const LetterBoxInfo& letter_box,
+                                          DetectionResult* result) const {
+  if (is_decode_exported_) {
+    YOLOPostprocessor::DecodeImage(data, num_rows, row_size, letter_box,
+                                   result);
+    return;
+  }
+  // Filter the rows and take the max class with the shared kernel, then
+  // decode the offsets of the kept rows with their anchors
+  std::vector<int32_t> rows;
+  DecodeYOLOv5Output(data, num_rows, row_size, row_size - 5, conf_threshold_,
+                     false, LetterBoxInfo(), result, &rows);
+  for (size_t i = 0; i < rows.size(); ++i) {
+    const float* row = data + static_cast<int64_t>(rows[i]) * row_size;
+    const Anchor& anchor = anchors_[rows[i]];
+    float x = (row[0] * 2.0f - 0.5f + anchor.grid0) * anchor.stride;
+    float y = (row[1] * 2.0f - 0.5f + anchor.grid1) * anchor.stride;
+    float w = std::pow(row[2] * 2.0f, 2.0f) * anchor.anchor_w;
+    float h = std::pow(row[3] * 2.0f, 2.0f) * anchor.anchor_h;
+    result->boxes[i] = {(x - w / 2.0f - letter_box.pad_w) / letter_box.scale,
+                        (y - h / 2.0f - letter_box.pad_h) / letter_box.scale,
+                        (x + w / 2.0f - letter_box.pad_w) / letter_box.scale,
+                        (y + h / 2.0f - letter_box.pad_h) / letter_box.scale};
+  }
+}
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,98 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/vision/detection/contrib/yolo_postprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+/*! @brief Postprocessor object for YOLOv5Lite serials model.
+ */
+class FASTDEPLOY_DECL YOLOv5LitePostprocessor : public YOLOPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for YOLOv5Lite serials model, the default conf_threshold is 0.45 and nms_threshold is 0.25
+   */
+  YOLOv5LitePostprocessor();
+
+  /// Set whether the model file was exported with the decode module, the
+  /// official YOLOv5Lite/export.py exports the model without it, default false
+  void SetDecodeExported(bool is_decode_exported) {
+    is_decode_exported_ = is_decode_exported;
+  }
+
+  /// Get whether the model file was exported with the decode module
+  bool GetDecodeExported() const { return is_decode_exported_; }
+
+  /// Set the anchors of each downsample stride, each stride has three
+  /// anchors with width and height, only used without the decode module
+  void SetAnchorConfig(const std::vector<std::vector<float>>& anchor_config) {
+    anchor_config_ = anchor_config;
+  }
+
+  /// Get the anchors of each downsample stride
+  std::vector<std::vector<float>> GetAnchorConfig() const {
+    return anchor_config_;
+  }
+
+  /// Set the downsample strides to generate anchors, default (8, 16, 32),
+  /// might have stride 64, only used without the decode module
+  void SetDownsampleStrides(const std::vector<int>& downsample_strides) {
+    downsample_strides_ = downsample_strides;
+  }
+
+  /// Get the downsample strides, default (8, 16, 32)
+  std::vector<int> GetDownsampleStrides() const { return downsample_strides_; }
+
+ protected:
+  // Generate the anchors shared by the images of the batch
+  bool PrepareBatch(
+      const FDTensor& tensor,
+      const std::vector<std::map<std::string, std::array<float, 2>>>&
+          ims_info) override;
+
+  // Decode the offsets with the anchors if the model was exported without
+  // the decode module
+  void DecodeImage(const float* data, int num_rows, int row_size,
+                   const LetterBoxInfo& letter_box,
+                   DetectionResult* result) const override;
+
+  bool is_decode_exported_;
+  std::vector<std::vector<float>> anchor_config_;
+  std::vector<int> downsample_strides_;
+
+ private:
+  struct Anchor {
+    int grid0;
+    int grid1;
+    int stride;
+    float anchor_w;
+    float anchor_h;
+  };
+
+  // generate the anchors of the input with the size of (width, height)
+  void GenerateAnchors(int width, int height,
+                       std::vector<Anchor>* anchors) const;
+
+  std::vector<Anchor> anchors_;
+};
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,39 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "fastdeploy/vision/common/processors/letter_box_preprocessor.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+/*! @brief Preprocessor object for YOLOv5Lite serials model, the arguments of letterbox are set by the functions of LetterBoxPreprocessor.
+ */
+class FASTDEPLOY_DECL YOLOv5LitePreprocessor : public LetterBoxPreprocessor {
+ public:
+  /** \brief Create a preprocessor instance for YOLOv5Lite serials model
+   */
+  YOLOv5LitePreprocessor();
+};
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,142 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/pybind/main.h"
+
+namespace fastdeploy {
+void BindYOLOv5Lite(pybind11::module& m) {
+  pybind11::class_<vision::detection::YOLOv5LitePreprocessor,
+                   vision::ProcessorManager>(m, "YOLOv5LitePreprocessor")
+      .def(pybind11::init<>())
+      .def("run", [](vision::detection::YOLOv5LitePreprocessor& self,
+                     std::vector<pybind11::array>& im_list) {
+        std::vector<vision::FDMat> images;
+        for (size_t i = 0; i < im_list.size(); ++i) {
+          images.push_back(vision::WrapMat(PyArrayToCvMat(im_list[i])));
+        }
+        std::vector<FDTensor> outputs;
+        std::vector<std::map<std::string, std::array<float, 2>>> ims_info;
+        if (!self.Run(&images, &outputs, &ims_info)) {
+          throw std::runtime_error(
+              "Failed to preprocess the input data in YOLOv5LitePreprocessor.");
+        }
+        for (size_t i = 0; i < outputs.size(); ++i) {
+          outputs[i].StopSharing();
+        }
+        return make_pair(outputs, ims_info);
+      })
+      .def_property("size",
+                    &vision::detection::YOLOv5LitePreprocessor::GetSize,
+                    &vision::detection::YOLOv5LitePreprocessor::SetSize)
+      .def_property("padding_value",
+                    &vision::detection::YOLOv5LitePreprocessor::GetPaddingValue,
+                    &vision::detection::YOLOv5LitePreprocessor::SetPaddingValue)
+      .def_property("is_scale_up",
+                    &vision::detection::YOLOv5LitePreprocessor::GetScaleUp,
+                    &vision::detection::YOLOv5LitePreprocessor::SetScaleUp)
+      .def_property("is_mini_pad",
+                    &vision::detection::YOLOv5LitePreprocessor::GetMiniPad,
+                    &vision::detection::YOLOv5LitePreprocessor::SetMiniPad)
+      .def_property("is_no_pad",
+                    &vision::detection::YOLOv5LitePreprocessor::GetNoPad,
+                    &vision::detection::YOLOv5LitePreprocessor::SetNoPad)
+      .def_property("stride",
+                    &vision::detection::YOLOv5LitePreprocessor::GetStride,
+                    &vision::detection::YOLOv5LitePreprocessor::SetStride);
+
+  pybind11::class_<vision::detection::YOLOv5LitePostprocessor>(
+      m, "YOLOv5LitePostprocessor")
+      .def(pybind11::init<>())
+      .def("run",
+           [](vision::detection::YOLOv5LitePostprocessor& self,
+              std::vector<FDTensor>& inputs,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::DetectionResult> results;
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "YOLOv5LitePostprocessor.");
+             }
+             return results;
+           })
+      .def("run",
+           [](vision::detection::YOLOv5LitePostprocessor& self,
+              std::vector<pybind11::array>& input_array,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::DetectionResult> results;
+             std::vector<FDTensor> inputs;
+             PyArrayToTensorList(input_array, &inputs, /*share_buffer=*/true);
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "YOLOv5LitePostprocessor.");
+             }
+             return results;
+           })
+      .def_property("conf_threshold",
+                    &vision::detection::YOLOv5LitePostprocessor::GetConfThreshold,
+                    &vision::detection::YOLOv5LitePostprocessor::SetConfThreshold)
+      .def_property("nms_threshold",
+                    &vision::detection::YOLOv5LitePostprocessor::GetNMSThreshold,
+                    &vision::detection::YOLOv5LitePostprocessor::SetNMSThreshold)
+      .def_property("is_decode_exported",
+                    &vision::detection::YOLOv5LitePostprocessor::GetDecodeExported,
+                    &vision::detection::YOLOv5LitePostprocessor::SetDecodeExported)
+      .def_property("anchor_config",
+                    &vision::detection::YOLOv5LitePostprocessor::GetAnchorConfig,
+                    &vision::detection::YOLOv5LitePostprocessor::SetAnchorConfig)
+      .def_property("downsample_strides",
+                    &vision::detection::YOLOv5LitePostprocessor::GetDownsampleStrides,
+                    &vision::detection::YOLOv5LitePostprocessor::SetDownsampleStrides);
+
+  pybind11::class_<vision::detection::YOLOv5Lite, FastDeployModel>(m, "YOLOv5Lite")
+      .def(pybind11::init<std::string, std::string, RuntimeOption,
+                          ModelFormat>())
+      .def("predict",
+           [](vision::detection::YOLOv5Lite& self, pybind11::array& data) {
+             auto mat = PyArrayToCvMat(data);
+             vision::DetectionResult res;
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
+             return res;
+           })
+      .def("batch_predict",
+           [](vision::detection::YOLOv5Lite& self,
+              std::vector<pybind11::array>& data) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::DetectionResult> results;
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
+             return results;
+           })
+      .def("use_cuda_preprocessing",
+           [](vision::detection::YOLOv5Lite& self, int max_image_size) {
+             self.UseCudaPreprocessing(max_image_size);
+           })
+      .def_property_readonly("preprocessor",
+                             &vision::detection::YOLOv5Lite::GetPreprocessor)
+      .def_property_readonly("postprocessor",
+                             &vision::detection::YOLOv5Lite::GetPostprocessor);
+}
+}  // namespace fastdeploy
@@ -15,6 +15,7 @@
 #pragma once
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/detection/contrib/yolo_decode.h"
 
 namespace fastdeploy {
 namespace vision {
@@ -64,10 +65,17 @@ class FASTDEPLOY_DECL YOLOv5SegPostprocessor {
   bool GetMultiLabel() const { return multi_label_; }
 
  protected:
+  // Compute the masks of the kept boxes from their mask embeddings in the
+  // rows of data
+  void ProcessMasks(const FDTensor& mask_tensor, int64_t bs, const float* data,
+                    int row_size, const std::vector<int32_t>& rows,
+                    const std::vector<int>& index,
+                    const std::array<float, 2>& output_shape,
+                    const LetterBoxInfo& letter_box, DetectionResult* result);
+
   float conf_threshold_;
   float nms_threshold_;
   bool multi_label_;
-  float max_wh_;
   // channel nums of masks
   int mask_nums_;
   // mask threshold
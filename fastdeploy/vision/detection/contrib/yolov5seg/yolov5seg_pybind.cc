@@ -38,7 +38,8 @@ void BindYOLOv5Seg(pybind11::module& m) {
       .def_property("padding_value", &vision::detection::YOLOv5SegPreprocessor::GetPaddingValue, &vision::detection::YOLOv5SegPreprocessor::SetPaddingValue)
       .def_property("is_scale_up", &vision::detection::YOLOv5SegPreprocessor::GetScaleUp, &vision::detection::YOLOv5SegPreprocessor::SetScaleUp)
       .def_property("is_mini_pad", &vision::detection::YOLOv5SegPreprocessor::GetMiniPad, &vision::detection::YOLOv5SegPreprocessor::SetMiniPad)
-      .def_property("stride", &vision::detection::YOLOv5SegPreprocessor::GetStride, &vision::detection::YOLOv5SegPreprocessor::SetStride);
+      .def_property("stride", &vision::detection::YOLOv5SegPreprocessor::GetStride, &vision::detection::YOLOv5SegPreprocessor::SetStride)
+      .def_property("fused_letter_box", &vision::detection::YOLOv5SegPreprocessor::GetFusedLetterBox, &vision::detection::YOLOv5SegPreprocessor::SetFusedLetterBox);
 
   pybind11::class_<vision::detection::YOLOv5SegPostprocessor>(
       m, "YOLOv5SegPostprocessor")
@@ -72,7 +73,10 @@ void BindYOLOv5Seg(pybind11::module& m) {
            [](vision::detection::YOLOv5Seg& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict", [](vision::detection::YOLOv5Seg& self, std::vector<pybind11::array>& data) {
@@ -81,7 +85,10 @@ void BindYOLOv5Seg(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::DetectionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       })
       .def_property_readonly("preprocessor", &vision::detection::YOLOv5Seg::GetPreprocessor)
@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.  //NOLINT
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
 // you may not use this file except in compliance with the License.
@@ -17,6 +17,8 @@
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/detection/contrib/yolov6/postprocessor.h"
+#include "fastdeploy/vision/detection/contrib/yolov6/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -38,10 +40,9 @@ class FASTDEPLOY_DECL YOLOv6 : public FastDeployModel {
          const RuntimeOption& custom_option = RuntimeOption(),
          const ModelFormat& model_format = ModelFormat::ONNX);
 
-  ~YOLOv6();
+  virtual std::string ModelName() const { return "YOLOv6"; }
 
-  std::string ModelName() const { return "YOLOv6"; }
-  /** \brief Predict the detection result for an input image
+  /** \brief DEPRECATED Predict the detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output detection result will be writen to this structure
@@ -53,67 +54,39 @@ class FASTDEPLOY_DECL YOLOv6 : public FastDeployModel {
                        float conf_threshold = 0.25,
                        float nms_iou_threshold = 0.5);
 
+  /** \brief Predict the detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, DetectionResult* result);
 
+  /** \brief Predict the detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<DetectionResult>* results);
+
+  /** \brief DEPRECATED Use CUDA to preprocess the images, the same as GetPreprocessor().UseCuda() on the device of runtime, remove at 1.0 version
+   *
+   * \param[in] max_img_size Not used any more, it was the max size of the input image to allocate the CUDA buffers
+   */
   void UseCudaPreprocessing(int max_img_size = 3840 * 2160);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default size = {640, 640};
-  */
-  std::vector<int> size;
-  // padding value, size should be the same as channels
+  /// Get preprocessor reference of YOLOv6
+  virtual YOLOv6Preprocessor& GetPreprocessor() { return preprocessor_; }
 
-  std::vector<float> padding_value;
-  // only pad to the minimum rectange which height and width is times of stride
-  bool is_mini_pad;
-  // while is_mini_pad = false and is_no_pad = true,
-  // will resize the image to the set size
-  bool is_no_pad;
-  // if is_scale_up is false, the input image only can be zoom out,
-  // the maximum resize scale cannot exceed 1.0
-  bool is_scale_up;
-  // padding stride, for is_mini_pad
-  int stride;
-  // for offseting the boxes by classes when using NMS,
-  // default 4096 in meituan/YOLOv6
-  float max_wh;
+  /// Get postprocessor reference of YOLOv6
+  virtual YOLOv6Postprocessor& GetPostprocessor() { return postprocessor_; }
 
- private:
+ protected:
   bool Initialize();
-
-  bool Preprocess(Mat* mat, FDTensor* outputs,
-                  std::map<std::string, std::array<float, 2>>* im_info);
-
-  bool CudaPreprocess(Mat* mat, FDTensor* output,
-                      std::map<std::string, std::array<float, 2>>* im_info);
-
-  bool Postprocess(FDTensor& infer_result, DetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
-
-  bool IsDynamicInput() const { return is_dynamic_input_; }
-
-  void LetterBox(Mat* mat, std::vector<int> size, std::vector<float> color,
-                 bool _auto, bool scale_fill = false, bool scale_up = true,
-                 int stride = 32);
-
-  // whether to inference with dynamic shape (e.g ONNX export with dynamic shape
-  // or not.)
-  // meituan/YOLOv6 official 'export_onnx.py' script will export static ONNX by
-  // default.
-  // while is_dynamic_input if 'false', is_mini_pad will force 'false'. This
-  // value will
-  // auto check by fastdeploy after the internal Runtime already initialized.
-  bool is_dynamic_input_;
-// CUDA host buffer for input image
-  uint8_t* input_img_cuda_buffer_host_ = nullptr;
-  // CUDA device buffer for input image
-  uint8_t* input_img_cuda_buffer_device_ = nullptr;
-  // CUDA device buffer for TRT input tensor
-  float* input_tensor_cuda_buffer_device_ = nullptr;
-  // Whether to use CUDA preprocessing
-  bool use_cuda_preprocessing_ = false;
-  // CUDA stream
-  void* cuda_stream_ = nullptr;
+  YOLOv6Preprocessor preprocessor_;
+  YOLOv6Postprocessor postprocessor_;
 };
 
 }  // namespace detection
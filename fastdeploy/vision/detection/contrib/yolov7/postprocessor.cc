@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include "fastdeploy/vision/detection/contrib/yolov7/postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/detection/contrib/yolo_decode.h"
 #include "fastdeploy/vision/utils/utils.h"
 
 namespace fastdeploy {
@@ -22,79 +24,34 @@ namespace detection {
 YOLOv7Postprocessor::YOLOv7Postprocessor() {
   conf_threshold_ = 0.25;
   nms_threshold_ = 0.5;
-  max_wh_ = 7680.0;
 }
 
 bool YOLOv7Postprocessor::Run(const std::vector<FDTensor>& tensors, std::vector<DetectionResult>* results,
                               const std::vector<std::map<std::string, std::array<float, 2>>>& ims_info) {
+  if (tensors[0].dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
   int batch = tensors[0].shape[0];
- 
+  int num_rows = tensors[0].shape[1];
+  int row_size = tensors[0].shape[2];
   results->resize(batch);
 
-  for (size_t bs = 0; bs < batch; ++bs) {
-    (*results)[bs].Clear();
-    (*results)[bs].Reserve(tensors[0].shape[1]);
-    if (tensors[0].dtype != FDDataType::FP32) {
-      FDERROR << "Only support post process with float32 data." << std::endl;
-      return false;
-    }
-    const float* data = reinterpret_cast<const float*>(tensors[0].Data()) + bs * tensors[0].shape[1] * tensors[0].shape[2];
-    for (size_t i = 0; i < tensors[0].shape[1]; ++i) {
-      int s = i * tensors[0].shape[2];
-      float confidence = data[s + 4];
-      const float* max_class_score =
-          std::max_element(data + s + 5, data + s + tensors[0].shape[2]);
-      confidence *= (*max_class_score);
-      // filter boxes by conf_threshold
-      if (confidence <= conf_threshold_) {
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      DetectionResult* result = &((*results)[bs]);
+      LetterBoxInfo letter_box = GetLetterBoxInfo(ims_info[bs]);
+      const float* data = reinterpret_cast<const float*>(tensors[0].Data()) +
+                          bs * num_rows * row_size;
+      DecodeYOLOv5Output(data, num_rows, row_size, row_size - 5,
+                         conf_threshold_, false, letter_box, result);
+      if (result->boxes.size() == 0) {
         continue;
       }
-      int32_t label_id = std::distance(data + s + 5, max_class_score);
-      // convert from [x, y, w, h] to [x1, y1, x2, y2]
-      (*results)[bs].boxes.emplace_back(std::array<float, 4>{
-          data[s] - data[s + 2] / 2.0f + label_id * max_wh_,
-          data[s + 1] - data[s + 3] / 2.0f + label_id * max_wh_,
-          data[s + 0] + data[s + 2] / 2.0f + label_id * max_wh_,
-          data[s + 1] + data[s + 3] / 2.0f + label_id * max_wh_});
-      (*results)[bs].label_ids.push_back(label_id);
-      (*results)[bs].scores.push_back(confidence);
-    }
-
-    if ((*results)[bs].boxes.size() == 0) {
-      continue;
+      utils::NMS(result, nms_threshold_, -1, true);
+      ClipBoxes(letter_box, result);
     }
-
-    utils::NMS(&((*results)[bs]), nms_threshold_);
-
-    // scale the boxes to the origin image shape
-    auto iter_out = ims_info[bs].find("output_shape");
-    auto iter_ipt = ims_info[bs].find("input_shape");
-    FDASSERT(iter_out != ims_info[bs].end() && iter_ipt != ims_info[bs].end(),
-            "Cannot find input_shape or output_shape from im_info.");
-    float out_h = iter_out->second[0];
-    float out_w = iter_out->second[1];
-    float ipt_h = iter_ipt->second[0];
-    float ipt_w = iter_ipt->second[1];
-    float scale = std::min(out_h / ipt_h, out_w / ipt_w);
-    float pad_h = (out_h - ipt_h * scale) / 2;
-    float pad_w = (out_w - ipt_w * scale) / 2;
-    for (size_t i = 0; i < (*results)[bs].boxes.size(); ++i) {
-      int32_t label_id = ((*results)[bs].label_ids)[i];
-      // clip box
-      (*results)[bs].boxes[i][0] = (*results)[bs].boxes[i][0] - max_wh_ * label_id;
-      (*results)[bs].boxes[i][1] = (*results)[bs].boxes[i][1] - max_wh_ * label_id;
-      (*results)[bs].boxes[i][2] = (*results)[bs].boxes[i][2] - max_wh_ * label_id;
-      (*results)[bs].boxes[i][3] = (*results)[bs].boxes[i][3] - max_wh_ * label_id;
-      (*results)[bs].boxes[i][0] = std::max(((*results)[bs].boxes[i][0] - pad_w) / scale, 0.0f);
-      (*results)[bs].boxes[i][1] = std::max(((*results)[bs].boxes[i][1] - pad_h) / scale, 0.0f);
-      (*results)[bs].boxes[i][2] = std::max(((*results)[bs].boxes[i][2] - pad_w) / scale, 0.0f);
-      (*results)[bs].boxes[i][3] = std::max(((*results)[bs].boxes[i][3] - pad_h) / scale, 0.0f);
-      (*results)[bs].boxes[i][0] = std::min((*results)[bs].boxes[i][0], ipt_w - 1.0f);
-      (*results)[bs].boxes[i][1] = std::min((*results)[bs].boxes[i][1], ipt_h - 1.0f);
-      (*results)[bs].boxes[i][2] = std::min((*results)[bs].boxes[i][2], ipt_w - 1.0f);
-      (*results)[bs].boxes[i][3] = std::min((*results)[bs].boxes[i][3], ipt_h - 1.0f);
-    }
-  }
+  });
   return true;
 }
 
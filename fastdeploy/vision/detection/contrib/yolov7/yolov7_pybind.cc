@@ -36,7 +36,8 @@ void BindYOLOv7(pybind11::module& m) {
       })
       .def_property("size", &vision::detection::YOLOv7Preprocessor::GetSize, &vision::detection::YOLOv7Preprocessor::SetSize)
       .def_property("padding_value", &vision::detection::YOLOv7Preprocessor::GetPaddingValue, &vision::detection::YOLOv7Preprocessor::SetPaddingValue)
-      .def_property("is_scale_up", &vision::detection::YOLOv7Preprocessor::GetScaleUp, &vision::detection::YOLOv7Preprocessor::SetScaleUp);
+      .def_property("is_scale_up", &vision::detection::YOLOv7Preprocessor::GetScaleUp, &vision::detection::YOLOv7Preprocessor::SetScaleUp)
+      .def_property("fused_letter_box", &vision::detection::YOLOv7Preprocessor::GetFusedLetterBox, &vision::detection::YOLOv7Preprocessor::SetFusedLetterBox);
 
   pybind11::class_<vision::detection::YOLOv7Postprocessor>(
       m, "YOLOv7Postprocessor")
@@ -69,7 +70,10 @@ void BindYOLOv7(pybind11::module& m) {
            [](vision::detection::YOLOv7& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict", [](vision::detection::YOLOv7& self, std::vector<pybind11::array>& data) {
@@ -78,7 +82,10 @@ void BindYOLOv7(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::DetectionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       })
       .def_property_readonly("preprocessor", &vision::detection::YOLOv7::GetPreprocessor)
@@ -25,7 +25,10 @@ void BindYOLOv7End2EndTRT(pybind11::module& m) {
               float conf_threshold) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(&mat, &res, conf_threshold);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res, conf_threshold);
+             }
              return res;
            })
       .def("use_cuda_preprocessing",
@@ -50,7 +50,10 @@ void BindYOLOv8(pybind11::module& m) {
                     &vision::detection::YOLOv8Preprocessor::GetMiniPad,
                     &vision::detection::YOLOv8Preprocessor::SetMiniPad)
       .def_property("stride", &vision::detection::YOLOv8Preprocessor::GetStride,
-                    &vision::detection::YOLOv8Preprocessor::SetStride);
+                    &vision::detection::YOLOv8Preprocessor::SetStride)
+      .def_property("fused_letter_box",
+                    &vision::detection::YOLOv8Preprocessor::GetFusedLetterBox,
+                    &vision::detection::YOLOv8Preprocessor::SetFusedLetterBox);
 
   pybind11::class_<vision::detection::YOLOv8Postprocessor>(
       m, "YOLOv8Postprocessor")
@@ -100,7 +103,10 @@ void BindYOLOv8(pybind11::module& m) {
            [](vision::detection::YOLOv8& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -111,7 +117,10 @@ void BindYOLOv8(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::DetectionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
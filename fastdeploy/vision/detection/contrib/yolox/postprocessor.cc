@@ -0,0 +1,173 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/detection/contrib/yolox/postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/utils/utils.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+namespace {
+
+struct YOLOXAnchor {
+  int grid0;
+  int grid1;
+  int stride;
+};
+
+void GenerateYOLOXAnchors(const std::vector<int>& size,
+                          const std::vector<int>& downsample_strides,
+                          std::vector<YOLOXAnchor>* anchors) {
+  // size: tuple of input (width, height)
+  // downsample_strides: downsample strides in YOLOX, e.g (8,16,32)
+  const int width = size[0];
+  const int height = size[1];
+  for (const auto& ds : downsample_strides) {
+    int num_grid_w = width / ds;
+    int num_grid_h = height / ds;
+    for (int g1 = 0; g1 < num_grid_h; ++g1) {
+      for (int g0 = 0; g0 < num_grid_w; ++g0) {
+        (*anchors).emplace_back(YOLOXAnchor{g0, g1, ds});
+      }
+    }
+  }
+}
+
+}  // namespace
+
+YOLOXPostprocessor::YOLOXPostprocessor() {
+  conf_threshold_ = 0.25;
+  nms_threshold_ = 0.5;
+  is_decode_exported_ = false;
+  downsample_strides_ = {8, 16, 32};
+  max_wh_ = 4096.0f;
+}
+
+bool YOLOXPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<DetectionResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  const FDTensor& tensor = infer_result[0];
+  if (tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = tensor.shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of infer_result and ims_info should be the "
+               "same."
+            << std::endl;
+    return false;
+  }
+  const size_t num_rows = tensor.shape[1];
+  const size_t row_size = tensor.shape[2];
+
+  // The images of a batch are letterboxed to the same size, so they share
+  // the anchors generated with the downsample strides
+  std::vector<YOLOXAnchor> anchors;
+  if (!is_decode_exported_) {
+    auto iter_out = ims_info[0].find("output_shape");
+    FDASSERT(iter_out != ims_info[0].end(),
+             "Cannot find output_shape from im_info.");
+    std::vector<int> size = {static_cast<int>(iter_out->second[1]),
+                             static_cast<int>(iter_out->second[0])};
+    GenerateYOLOXAnchors(size, downsample_strides_, &anchors);
+    if (anchors.size() < num_rows) {
+      FDERROR << "The number of anchors " << anchors.size()
+              << " is less than the number of boxes " << num_rows
+              << ", please check the downsample_strides." << std::endl;
+      return false;
+    }
+  }
+  results->resize(batch);
+
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      DetectionResult* result = &((*results)[bs]);
+      result->Clear();
+      const float* data =
+          static_cast<const float*>(tensor.Data()) + bs * num_rows * row_size;
+      for (size_t i = 0; i < num_rows; ++i) {
+        const float* row = data + i * row_size;
+        float confidence = row[4];
+        const float* max_class_score =
+            std::max_element(row + 5, row + row_size);
+        confidence *= (*max_class_score);
+        // filter boxes by conf_threshold
+        if (confidence <= conf_threshold_) {
+          continue;
+        }
+        int32_t label_id = std::distance(row + 5, max_class_score);
+        float x = row[0];
+        float y = row[1];
+        float w = row[2];
+        float h = row[3];
+        if (!is_decode_exported_) {
+          // convert from offsets of the i-th anchor to [x, y, w, h]
+          float downsample_stride = static_cast<float>(anchors[i].stride);
+          x = (x + anchors[i].grid0) * downsample_stride;
+          y = (y + anchors[i].grid1) * downsample_stride;
+          w = std::exp(w) * downsample_stride;
+          h = std::exp(h) * downsample_stride;
+        }
+        // convert from [x, y, w, h] to [x1, y1, x2, y2], and offset by
+        // label_id * max_wh for multi classes NMS
+        float offset = label_id * max_wh_;
+        result->boxes.emplace_back(std::array<float, 4>{
+            x - w / 2.0f + offset, y - h / 2.0f + offset,
+            x + w / 2.0f + offset, y + h / 2.0f + offset});
+        result->label_ids.push_back(label_id);
+        result->scores.push_back(confidence);
+      }
+
+      if (result->boxes.size() == 0) {
+        continue;
+      }
+
+      utils::NMS(result, nms_threshold_);
+
+      // scale the boxes to the origin image shape
+      auto iter_out = ims_info[bs].find("output_shape");
+      auto iter_ipt = ims_info[bs].find("input_shape");
+      FDASSERT(iter_out != ims_info[bs].end() &&
+                   iter_ipt != ims_info[bs].end(),
+               "Cannot find input_shape or output_shape from im_info.");
+      float out_h = iter_out->second[0];
+      float out_w = iter_out->second[1];
+      float ipt_h = iter_ipt->second[0];
+      float ipt_w = iter_ipt->second[1];
+      float r = std::min(out_h / ipt_h, out_w / ipt_w);
+      for (size_t i = 0; i < result->boxes.size(); ++i) {
+        float offset = max_wh_ * result->label_ids[i];
+        for (int j = 0; j < 4; ++j) {
+          float bound = (j % 2 == 0 ? ipt_w : ipt_h) - 1.0f;
+          result->boxes[i][j] = std::min(
+              std::max((result->boxes[i][j] - offset) / r, 0.0f), bound);
+        }
+      }
+    }
+  });
+  return true;
+}
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,102 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+/*! @brief Postprocessor object for YOLOX serials model.
+ */
+class FASTDEPLOY_DECL YOLOXPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for YOLOX serials model
+   */
+  YOLOXPostprocessor();
+
+  /** \brief Process the result of runtime and fill to DetectionResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, in shape [N, num_anchors, 5 + num_classes]
+   * \param[in] results The output result of detection
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<DetectionResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+
+  /// Set conf_threshold, default 0.25
+  void SetConfThreshold(const float& conf_threshold) {
+    conf_threshold_ = conf_threshold;
+  }
+
+  /// Get conf_threshold, default 0.25
+  float GetConfThreshold() const { return conf_threshold_; }
+
+  /// Set nms_threshold, default 0.5
+  void SetNMSThreshold(const float& nms_threshold) {
+    nms_threshold_ = nms_threshold;
+  }
+
+  /// Get nms_threshold, default 0.5
+  float GetNMSThreshold() const { return nms_threshold_; }
+
+  /*! @brief
+    Set whether the model_file was exported with decode module. The official
+    YOLOX/tools/export_onnx.py script will export ONNX file without
+    decode module. Please set it 'true' manually if the model file
+    was exported with decode module. default false.
+  */
+  void SetDecodeExported(bool is_decode_exported) {
+    is_decode_exported_ = is_decode_exported;
+  }
+
+  /// Get whether the model_file was exported with decode module, default false
+  bool GetDecodeExported() const { return is_decode_exported_; }
+
+  /// Set downsample strides to generate anchors, default {8, 16, 32}
+  void SetDownsampleStrides(const std::vector<int>& downsample_strides) {
+    downsample_strides_ = downsample_strides;
+  }
+
+  /// Get downsample strides to generate anchors, default {8, 16, 32}
+  std::vector<int> GetDownsampleStrides() const { return downsample_strides_; }
+
+  /// Set max_wh for offseting the boxes by classes when using NMS, default 4096
+  void SetMaxWH(const float& max_wh) { max_wh_ = max_wh; }
+
+  /// Get max_wh for offseting the boxes by classes when using NMS, default 4096
+  float GetMaxWH() const { return max_wh_; }
+
+ protected:
+  float conf_threshold_;
+  float nms_threshold_;
+  bool is_decode_exported_;
+  // downsample strides for YOLOX to generate anchors,
+  // will take (8,16,32) as default values, might have stride=64
+  std::vector<int> downsample_strides_;
+  float max_wh_;
+};
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
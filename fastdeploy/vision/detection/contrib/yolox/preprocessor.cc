@@ -0,0 +1,71 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/detection/contrib/yolox/preprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace detection {
+
+YOLOXPreprocessor::YOLOXPreprocessor() {
+  size_ = {640, 640};
+  padding_value_ = {114.0, 114.0, 114.0};
+}
+
+bool YOLOXPreprocessor::LetterBoxWithRightBottomPad(FDMat* mat) {
+  // specific pre process for YOLOX, not the same as YOLOv5
+  // reference: YOLOX/yolox/data/data_augment.py#L142
+  float r = std::min(size_[1] * 1.0f / static_cast<float>(mat->Height()),
+                     size_[0] * 1.0f / static_cast<float>(mat->Width()));
+
+  int resize_h = int(round(static_cast<float>(mat->Height()) * r));
+  int resize_w = int(round(static_cast<float>(mat->Width()) * r));
+
+  if (resize_h != mat->Height() || resize_w != mat->Width()) {
+    if (!Resize::Run(mat, resize_w, resize_h, -1, -1, cv::INTER_LINEAR, false,
+                     mat->proc_lib)) {
+      return false;
+    }
+  }
+
+  int pad_w = size_[0] - resize_w;
+  int pad_h = size_[1] - resize_h;
+  // right-bottom padding for YOLOX
+  if (pad_h > 0 || pad_w > 0) {
+    return Pad::Run(mat, 0, pad_h, 0, pad_w, padding_value_, mat->proc_lib);
+  }
+  return true;
+}
+
+bool YOLOXPreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  // YOLOX ( >= v0.1.1) preprocess steps
+  // 1. preproc
+  // 2. HWC->CHW and cast to float in one pass
+  // 3. NO!!! BRG2GRB and Normalize needed in YOLOX
+  if (!LetterBoxWithRightBottomPad(mat)) {
+    return false;
+  }
+  std::vector<float> alpha = {1.0f, 1.0f, 1.0f};
+  std::vector<float> beta = {0.0f, 0.0f, 0.0f};
+  return ConvertAndPermute::Run(mat, alpha, beta, false, mat->proc_lib);
+}
+
+}  // namespace detection
+
+}  // namespace vision
+
+}  // namespace fastdeploy
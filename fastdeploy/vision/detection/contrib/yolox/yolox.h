@@ -17,6 +17,8 @@
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/detection/contrib/yolox/postprocessor.h"
+#include "fastdeploy/vision/detection/contrib/yolox/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -39,7 +41,8 @@ class FASTDEPLOY_DECL YOLOX : public FastDeployModel {
         const ModelFormat& model_format = ModelFormat::ONNX);
 
   std::string ModelName() const { return "YOLOX"; }
-  /** \brief Predict the detection result for an input image
+
+  /** \brief DEPRECATED Predict the detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output detection result will be writen to this structure
@@ -51,50 +54,33 @@ class FASTDEPLOY_DECL YOLOX : public FastDeployModel {
                        float conf_threshold = 0.25,
                        float nms_iou_threshold = 0.5);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default size = {640, 640}
-  */
-  std::vector<int> size;
-  // padding value, size should be the same as channels
-  std::vector<float> padding_value;
-  /*! @brief
-    whether the model_file was exported with decode module. The official
-    YOLOX/tools/export_onnx.py script will export ONNX file without
-    decode module. Please set it 'true' manually if the model file
-    was exported with decode module. default false.
-  */
-  bool is_decode_exported;
-  // downsample strides for YOLOX to generate anchors,
-  // will take (8,16,32) as default values, might have stride=64
-  std::vector<int> downsample_strides;
-  // for offseting the boxes by classes when using NMS, default 4096
-  float max_wh;
-
- private:
-  bool Initialize();
-
-  bool Preprocess(Mat* mat, FDTensor* outputs,
-                  std::map<std::string, std::array<float, 2>>* im_info);
+  /** \brief Predict the detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, DetectionResult* result);
 
-  bool Postprocess(FDTensor& infer_result, DetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
+  /** \brief Predict the detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<DetectionResult>* results);
 
-  bool PostprocessWithDecode(
-      FDTensor& infer_result, DetectionResult* result,
-      const std::map<std::string, std::array<float, 2>>& im_info,
-      float conf_threshold, float nms_iou_threshold);
+  /// Get preprocessor reference of YOLOX
+  virtual YOLOXPreprocessor& GetPreprocessor() { return preprocessor_; }
 
-  bool IsDynamicInput() const { return is_dynamic_input_; }
+  /// Get postprocessor reference of YOLOX
+  virtual YOLOXPostprocessor& GetPostprocessor() { return postprocessor_; }
 
-  // whether to inference with dynamic shape (e.g ONNX export with dynamic shape
-  // or not.)
-  // megvii/YOLOX official 'export_onnx.py' script will export static ONNX by
-  // default.
-  // while is_dynamic_shape if 'false', is_mini_pad will force 'false'. This
-  // value will
-  // auto check by fastdeploy after the internal Runtime already initialized.
-  bool is_dynamic_input_;
+ protected:
+  bool Initialize();
+  YOLOXPreprocessor preprocessor_;
+  YOLOXPostprocessor postprocessor_;
 };
 
 }  // namespace detection
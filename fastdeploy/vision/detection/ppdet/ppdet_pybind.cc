@@ -114,7 +114,10 @@ void BindPPDet(pybind11::module& m) {
            [](vision::detection::PPDetBase& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -125,7 +128,10 @@ void BindPPDet(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::DetectionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def("clone",
@@ -25,7 +25,10 @@ void BindFaceLandmark1000(pybind11::module& m) {
           [](vision::facealign::FaceLandmark1000& self, pybind11::array& data) {
             auto mat = PyArrayToCvMat(data);
             vision::FaceAlignmentResult res;
-            self.Predict(&mat, &res);
+            {
+              pybind11::gil_scoped_release release;
+              self.Predict(&mat, &res);
+            }
             return res;
           })
       .def_property("size", &vision::facealign::FaceLandmark1000::GetSize,
@@ -11,11 +11,12 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #pragma once
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/facealign/contrib/pfld/postprocessor.h"
+#include "fastdeploy/vision/facealign/contrib/pfld/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -38,25 +39,46 @@ class FASTDEPLOY_DECL PFLD : public FastDeployModel {
              const ModelFormat& model_format = ModelFormat::ONNX);
 
   std::string ModelName() const { return "PFLD"; }
-  /** \brief Predict the face detection result for an input image
+
+  /** \brief DEPRECATED Predict the face alignment result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
-   * \param[in] result The output face detection result will be writen to this structure
+   * \param[in] result The output face alignment result will be writen to this structure
    * \return true if the prediction successed, otherwise false
    */
   virtual bool Predict(cv::Mat* im, FaceAlignmentResult* result);
 
-  /// tuple of (width, height), default (112, 112)
-  std::vector<int> size;
+  /** \brief Predict the face alignment result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output face alignment result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, FaceAlignmentResult* result);
+
+  /** \brief Predict the face alignment results for a batch of input images, e.g. the faces cropped from one image
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output face alignment result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<FaceAlignmentResult>* results);
 
- private:
-  bool Initialize();
+  /// Get preprocessor reference of PFLD
+  virtual PFLDPreprocessor& GetPreprocessor() {
+    return preprocessor_;
+  }
 
-  bool Preprocess(Mat* mat, FDTensor* outputs,
-                  std::map<std::string, std::array<int, 2>>* im_info);
+  /// Get postprocessor reference of PFLD
+  virtual PFLDPostprocessor& GetPostprocessor() {
+    return postprocessor_;
+  }
 
-  bool Postprocess(FDTensor& infer_result, FaceAlignmentResult* result,
-                   const std::map<std::string, std::array<int, 2>>& im_info);
+ protected:
+  bool Initialize();
+  PFLDPreprocessor preprocessor_;
+  PFLDPostprocessor postprocessor_;
 };
 
 }  // namespace facealign
@@ -0,0 +1,105 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/pybind/main.h"
+
+namespace fastdeploy {
+void BindPFLD(pybind11::module& m) {
+  pybind11::class_<vision::facealign::PFLDPreprocessor,
+                   vision::ProcessorManager>(m, "PFLDPreprocessor")
+      .def(pybind11::init<>())
+      .def("run", [](vision::facealign::PFLDPreprocessor& self,
+                     std::vector<pybind11::array>& im_list) {
+        std::vector<vision::FDMat> images;
+        for (size_t i = 0; i < im_list.size(); ++i) {
+          images.push_back(vision::WrapMat(PyArrayToCvMat(im_list[i])));
+        }
+        std::vector<FDTensor> outputs;
+        std::vector<std::map<std::string, std::array<float, 2>>> ims_info;
+        if (!self.Run(&images, &outputs, &ims_info)) {
+          throw std::runtime_error(
+              "Failed to preprocess the input data in PFLDPreprocessor.");
+        }
+        for (size_t i = 0; i < outputs.size(); ++i) {
+          outputs[i].StopSharing();
+        }
+        return make_pair(outputs, ims_info);
+      })
+      .def_property("size", &vision::facealign::PFLDPreprocessor::GetSize,
+                    &vision::facealign::PFLDPreprocessor::SetSize);
+
+  pybind11::class_<vision::facealign::PFLDPostprocessor>(m, "PFLDPostprocessor")
+      .def(pybind11::init<>())
+      .def("run",
+           [](vision::facealign::PFLDPostprocessor& self,
+              std::vector<FDTensor>& inputs,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::FaceAlignmentResult> results;
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "PFLDPostprocessor.");
+             }
+             return results;
+           })
+      .def("run",
+           [](vision::facealign::PFLDPostprocessor& self,
+              std::vector<pybind11::array>& input_array,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::FaceAlignmentResult> results;
+             std::vector<FDTensor> inputs;
+             PyArrayToTensorList(input_array, &inputs, /*share_buffer=*/true);
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "PFLDPostprocessor.");
+             }
+             return results;
+           });
+
+  pybind11::class_<vision::facealign::PFLD, FastDeployModel>(m, "PFLD")
+      .def(pybind11::init<std::string, std::string, RuntimeOption,
+                          ModelFormat>())
+      .def("predict",
+           [](vision::facealign::PFLD& self, pybind11::array& data) {
+             auto mat = PyArrayToCvMat(data);
+             vision::FaceAlignmentResult res;
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
+             return res;
+           })
+      .def("batch_predict",
+           [](vision::facealign::PFLD& self,
+              std::vector<pybind11::array>& data) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::FaceAlignmentResult> results;
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
+             return results;
+           })
+      .def_property_readonly("preprocessor",
+                             &vision::facealign::PFLD::GetPreprocessor)
+      .def_property_readonly("postprocessor",
+                             &vision::facealign::PFLD::GetPostprocessor);
+}
+}  // namespace fastdeploy
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/facealign/contrib/pfld/postprocessor.h"
+
+#include <algorithm>
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facealign {
+
+bool PFLDPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<FaceAlignmentResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  if (infer_result.size() < 2) {
+    FDERROR << "PFLD should have 2 output tensors, but now it has "
+            << infer_result.size() << "." << std::endl;
+    return false;
+  }
+  const FDTensor& landmarks_tensor = infer_result[1];
+  if (landmarks_tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = landmarks_tensor.shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of landmarks and ims_info should be the same."
+            << std::endl;
+    return false;
+  }
+  int num_values = landmarks_tensor.Numel() / batch;
+  results->resize(batch);
+  for (int bs = 0; bs < batch; ++bs) {
+    auto iter_in = ims_info[bs].find("input_shape");
+    FDASSERT(iter_in != ims_info[bs].end(),
+             "Cannot find input_shape from im_info.");
+    float in_h = iter_in->second[0];
+    float in_w = iter_in->second[1];
+
+    FaceAlignmentResult* result = &((*results)[bs]);
+    result->Clear();
+    result->Reserve(num_values / 2);
+    const float* data =
+        static_cast<const float*>(landmarks_tensor.Data()) + bs * num_values;
+    for (int i = 0; i + 1 < num_values; i += 2) {
+      float x = std::min(std::max(0.f, data[i]), 1.0f);
+      float y = std::min(std::max(0.f, data[i + 1]), 1.0f);
+      // decode landmarks (default 106 landmarks)
+      result->landmarks.emplace_back(std::array<float, 2>{x * in_w, y * in_h});
+    }
+  }
+  return true;
+}
+
+}  // namespace facealign
+
+}  // namespace vision
+
+}  // namespace fastdeploy
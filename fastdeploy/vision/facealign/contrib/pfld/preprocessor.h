@@ -0,0 +1,51 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/vision/common/processors/per_image_preprocessor.h"
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facealign {
+
+/*! @brief Preprocessor object for PFLD serials model.
+ */
+class FASTDEPLOY_DECL PFLDPreprocessor : public PerImagePreprocessor {
+ public:
+  /** \brief Create a preprocessor instance for PFLD serials model
+   */
+  PFLDPreprocessor();
+
+  /// Set target size, tuple of (width, height), default size = {112, 112}
+  void SetSize(const std::vector<int>& size) { size_ = size; }
+
+  /// Get target size, tuple of (width, height), default size = {112, 112}
+  std::vector<int> GetSize() const { return size_; }
+
+ protected:
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info);
+
+  // target size, tuple of (width, height), default size = {112, 112}
+  std::vector<int> size_;
+};
+
+}  // namespace facealign
+
+}  // namespace vision
+
+}  // namespace fastdeploy
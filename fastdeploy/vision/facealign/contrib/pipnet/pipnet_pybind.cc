@@ -0,0 +1,115 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/pybind/main.h"
+
+namespace fastdeploy {
+void BindPIPNet(pybind11::module& m) {
+  pybind11::class_<vision::facealign::PIPNetPreprocessor,
+                   vision::ProcessorManager>(m, "PIPNetPreprocessor")
+      .def(pybind11::init<>())
+      .def("run", [](vision::facealign::PIPNetPreprocessor& self,
+                     std::vector<pybind11::array>& im_list) {
+        std::vector<vision::FDMat> images;
+        for (size_t i = 0; i < im_list.size(); ++i) {
+          images.push_back(vision::WrapMat(PyArrayToCvMat(im_list[i])));
+        }
+        std::vector<FDTensor> outputs;
+        std::vector<std::map<std::string, std::array<float, 2>>> ims_info;
+        if (!self.Run(&images, &outputs, &ims_info)) {
+          throw std::runtime_error(
+              "Failed to preprocess the input data in PIPNetPreprocessor.");
+        }
+        for (size_t i = 0; i < outputs.size(); ++i) {
+          outputs[i].StopSharing();
+        }
+        return make_pair(outputs, ims_info);
+      })
+      .def_property("size", &vision::facealign::PIPNetPreprocessor::GetSize,
+                    &vision::facealign::PIPNetPreprocessor::SetSize)
+      .def_property("mean_vals",
+                    &vision::facealign::PIPNetPreprocessor::GetMeanVals,
+                    &vision::facealign::PIPNetPreprocessor::SetMeanVals)
+      .def_property("std_vals",
+                    &vision::facealign::PIPNetPreprocessor::GetStdVals,
+                    &vision::facealign::PIPNetPreprocessor::SetStdVals);
+
+  pybind11::class_<vision::facealign::PIPNetPostprocessor>(
+      m, "PIPNetPostprocessor")
+      .def(pybind11::init<>())
+      .def("run",
+           [](vision::facealign::PIPNetPostprocessor& self,
+              std::vector<FDTensor>& inputs,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::FaceAlignmentResult> results;
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "PIPNetPostprocessor.");
+             }
+             return results;
+           })
+      .def("run",
+           [](vision::facealign::PIPNetPostprocessor& self,
+              std::vector<pybind11::array>& input_array,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::FaceAlignmentResult> results;
+             std::vector<FDTensor> inputs;
+             PyArrayToTensorList(input_array, &inputs, /*share_buffer=*/true);
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "PIPNetPostprocessor.");
+             }
+             return results;
+           })
+      .def_property("num_landmarks",
+                    &vision::facealign::PIPNetPostprocessor::GetNumLandmarks,
+                    &vision::facealign::PIPNetPostprocessor::SetNumLandmarks);
+
+  pybind11::class_<vision::facealign::PIPNet, FastDeployModel>(m, "PIPNet")
+      .def(pybind11::init<std::string, std::string, RuntimeOption,
+                          ModelFormat>())
+      .def("predict",
+           [](vision::facealign::PIPNet& self, pybind11::array& data) {
+             auto mat = PyArrayToCvMat(data);
+             vision::FaceAlignmentResult res;
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
+             return res;
+           })
+      .def("batch_predict",
+           [](vision::facealign::PIPNet& self,
+              std::vector<pybind11::array>& data) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::FaceAlignmentResult> results;
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
+             return results;
+           })
+      .def_property_readonly("preprocessor",
+                             &vision::facealign::PIPNet::GetPreprocessor)
+      .def_property_readonly("postprocessor",
+                             &vision::facealign::PIPNet::GetPostprocessor);
+}
+}  // namespace fastdeploy
@@ -11,9 +11,11 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include "fastdeploy/vision/facealign/contrib/pipnet/postprocessor.h"
 
-#include "fastdeploy/vision/facealign/contrib/pipnet.h"
+#include <algorithm>
 
+#include "fastdeploy/utils/parallel.h"
 #include "fastdeploy/vision/utils/utils.h"
 
 namespace fastdeploy {
@@ -22,178 +24,7 @@ namespace vision {
 
 namespace facealign {
 
-void PIPNet::GenerateLandmarks(std::vector<FDTensor>& infer_result,
-                               FaceAlignmentResult* result, float img_height,
-                               float img_width) {
-  FDTensor outputs_cls = infer_result.at(0);
-  FDTensor outputs_x = infer_result.at(1);
-  FDTensor outputs_y = infer_result.at(2);
-  FDTensor outputs_nb_x = infer_result.at(3);
-  FDTensor outputs_nb_y = infer_result.at(4);
-  int grid_h = outputs_cls.shape[2];  // 8
-  int grid_w = outputs_cls.shape[3];  // 8
-  int grid_length = grid_h * grid_w;  // 8 * 8 = 64
-  int input_h = size_[1];
-  int input_w = size_[0];
-  // fetch data from pointers
-  const float* outputs_cls_ptr = static_cast<float*>(outputs_cls.Data());
-  const float* outputs_x_ptr = static_cast<float*>(outputs_x.Data());
-  const float* outputs_y_ptr = static_cast<float*>(outputs_y.Data());
-  const float* outputs_nb_x_ptr = static_cast<float*>(outputs_nb_x.Data());
-  const float* outputs_nb_y_ptr = static_cast<float*>(outputs_nb_y.Data());
-
-  // find max_ids
-  std::vector<unsigned int> max_ids(num_landmarks_);
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    const float* score_ptr = outputs_cls_ptr + i * grid_length;
-    unsigned int max_id = 0;
-    float max_score = score_ptr[0];
-    for (unsigned int j = 0; j < grid_length; ++j) {
-      if (score_ptr[j] > max_score) {
-        max_score = score_ptr[j];
-        max_id = j;
-      }
-    }
-    max_ids[i] = max_id;  // range 0~64
-  }
-  // find x & y offsets
-  std::vector<float> output_x_select(num_landmarks_);
-  std::vector<float> output_y_select(num_landmarks_);
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    const float* offset_x_ptr = outputs_x_ptr + i * grid_length;
-    const float* offset_y_ptr = outputs_y_ptr + i * grid_length;
-    const unsigned int max_id = max_ids.at(i);
-    output_x_select[i] = offset_x_ptr[max_id];
-    output_y_select[i] = offset_y_ptr[max_id];
-  }
-
-  // find nb_x & nb_y offsets
-  std::map<unsigned int, std::vector<float>> output_nb_x_select;
-  std::map<unsigned int, std::vector<float>> output_nb_y_select;
-  // initialize offsets map
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    std::vector<float> nb_x_offset(num_nb_);
-    std::vector<float> nb_y_offset(num_nb_);
-    output_nb_x_select[i] = nb_x_offset;
-    output_nb_y_select[i] = nb_y_offset;
-  }
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    for (unsigned int j = 0; j < num_nb_; ++j) {
-      const unsigned int max_id = max_ids.at(i);
-      const float* offset_nb_x_ptr =
-          outputs_nb_x_ptr + (i * num_nb_ + j) * grid_length;
-      const float* offset_nb_y_ptr =
-          outputs_nb_y_ptr + (i * num_nb_ + j) * grid_length;
-      output_nb_x_select[i][j] = offset_nb_x_ptr[max_id];
-      output_nb_y_select[i][j] = offset_nb_y_ptr[max_id];
-    }
-  }
-
-  // calculate coords
-  std::vector<float> lms_pred_x(num_landmarks_);             // 19
-  std::vector<float> lms_pred_y(num_landmarks_);             // 19
-  std::map<unsigned int, std::vector<float>> lms_pred_nb_x;  // 19,10
-  std::map<unsigned int, std::vector<float>> lms_pred_nb_y;  // 19,10
-
-  // initialize pred maps
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    std::vector<float> nb_x_offset(num_nb_);
-    std::vector<float> nb_y_offset(num_nb_);
-    lms_pred_nb_x[i] = nb_x_offset;
-    lms_pred_nb_y[i] = nb_y_offset;
-  }
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    float cx = static_cast<float>(max_ids.at(i) % grid_w);
-    float cy = static_cast<float>(max_ids.at(i) / grid_w);
-    // calculate coords & normalize
-    lms_pred_x[i] =
-        ((cx + output_x_select[i]) * (float)net_stride_) / (float)input_w;
-    lms_pred_y[i] =
-        ((cy + output_y_select[i]) * (float)net_stride_) / (float)input_h;
-    for (unsigned int j = 0; j < num_nb_; ++j) {
-      lms_pred_nb_x[i][j] =
-          ((cx + output_nb_x_select[i][j]) * (float)net_stride_) /
-          (float)input_w;
-      lms_pred_nb_y[i][j] =
-          ((cy + output_nb_y_select[i][j]) * (float)net_stride_) /
-          (float)input_h;
-    }
-  }
-
-  // reverse indexes
-  std::map<unsigned int, std::vector<float>>
-      tmp_nb_x;  // 19,max_len_map_[num_landmarks_]
-  std::map<unsigned int, std::vector<float>>
-      tmp_nb_y;  // 19,max_len_map_[num_landmarks_]
-  // initialize reverse maps
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    std::vector<float> tmp_x(max_len_map_[num_landmarks_]);
-    std::vector<float> tmp_y(max_len_map_[num_landmarks_]);
-    tmp_nb_x[i] = tmp_x;
-    tmp_nb_y[i] = tmp_y;
-  }
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    for (unsigned int j = 0; j < max_len_map_[num_landmarks_]; ++j) {
-      unsigned int ri =
-          reverse_index1_map_[num_landmarks_]
-                             [i * max_len_map_[num_landmarks_] + j];
-      unsigned int rj =
-          reverse_index2_map_[num_landmarks_]
-                             [i * max_len_map_[num_landmarks_] + j];
-      tmp_nb_x[i][j] = lms_pred_nb_x[ri][rj];
-      tmp_nb_y[i][j] = lms_pred_nb_y[ri][rj];
-    }
-  }
-
-  // merge predictions
-  result->Clear();
-  for (unsigned int i = 0; i < num_landmarks_; ++i) {
-    float total_x = lms_pred_x[i];
-    float total_y = lms_pred_y[i];
-    for (unsigned int j = 0; j < max_len_map_[num_landmarks_]; ++j) {
-      total_x += tmp_nb_x[i][j];
-      total_y += tmp_nb_y[i][j];
-    }
-    float x = total_x / ((float)max_len_map_[num_landmarks_] + 1.f);
-    float y = total_y / ((float)max_len_map_[num_landmarks_] + 1.f);
-    x = std::min(std::max(0.f, x), 1.0f);
-    y = std::min(std::max(0.f, y), 1.0f);
-    result->landmarks.emplace_back(
-        std::array<float, 2>{x * img_width, y * img_height});
-  }
-};
-
-void PIPNet::SetNumLandmarks(const int& num_landmarks) {
-  if (std::find(supported_num_landmarks_.begin(),
-                supported_num_landmarks_.end(),
-                num_landmarks) == supported_num_landmarks_.end()) {
-    FDWARNING << "The number of landmarks should be in {19, 29, 68, 98}."
-              << std::endl;
-  }
-  num_landmarks_ = num_landmarks;
-}
-PIPNet::PIPNet(const std::string& model_file, const std::string& params_file,
-               const RuntimeOption& custom_option,
-               const ModelFormat& model_format) {
-  if (model_format == ModelFormat::ONNX) {
-    valid_cpu_backends = {Backend::OPENVINO, Backend::ORT};
-    valid_gpu_backends = {Backend::ORT, Backend::TRT};
-  } else {
-    valid_cpu_backends = {Backend::ORT};
-    valid_gpu_backends = {Backend::ORT, Backend::TRT};
-  }
-  runtime_option = custom_option;
-  runtime_option.model_format = model_format;
-  runtime_option.model_file = model_file;
-  runtime_option.params_file = params_file;
-  initialized = Initialize();
-}
-
-bool PIPNet::Initialize() {
-  // parameters for preprocess
-  size_ = {256, 256};
-  mean_vals_ = {0.485f, 0.456f, 0.406f};
-  std_vals_ = {0.229f, 0.224f, 0.225f};
+PIPNetPostprocessor::PIPNetPostprocessor() {
   num_nb_ = 10;
   net_stride_ = 32;
   num_landmarks_ = 19;
@@ -605,83 +436,142 @@ bool PIPNet::Initialize() {
       1, 9, 8, 8, 9, 9, 4, 9, 7, 7, 8, 7, 7, 8, 5, 3, 0, 2, 3, 2, 0, 3, 9, 7, 7,
       7, 9, 8, 7, 7, 8, 4, 3, 0, 3, 4, 3, 0, 2, 7, 7};
   max_len_map_[98] = 17;
-  if (!InitRuntime()) {
-    FDERROR << "Failed to initialize fastdeploy backend." << std::endl;
-    return false;
-  }
-  return true;
 }
 
-bool PIPNet::Preprocess(Mat* mat, FDTensor* output,
-                        std::map<std::string, std::array<int, 2>>* im_info) {
-  // Resize
-  int resize_w = size_[0];
-  int resize_h = size_[1];
-  if (resize_h != mat->Height() || resize_w != mat->Width()) {
-    Resize::Run(mat, resize_w, resize_h);
+void PIPNetPostprocessor::SetNumLandmarks(const int& num_landmarks) {
+  if (std::find(supported_num_landmarks_.begin(),
+                supported_num_landmarks_.end(),
+                num_landmarks) == supported_num_landmarks_.end()) {
+    FDWARNING << "The number of landmarks should be in {19, 29, 68, 98}."
+              << std::endl;
   }
-  // RGR2RGB
-  BGR2RGB::Run(mat);
+  num_landmarks_ = num_landmarks;
+}
 
-  // Normalize
-  Normalize::Run(mat, mean_vals_, std_vals_);
+void PIPNetPostprocessor::GenerateLandmarks(
+    const std::vector<FDTensor>& infer_result, int index,
+    const std::map<std::string, std::array<float, 2>>& im_info,
+    FaceAlignmentResult* result) const {
+  auto iter_in = im_info.find("input_shape");
+  auto iter_out = im_info.find("output_shape");
+  FDASSERT(iter_in != im_info.end() && iter_out != im_info.end(),
+           "Cannot find input_shape or output_shape from im_info.");
+  float img_height = iter_in->second[0];
+  float img_width = iter_in->second[1];
+  float input_h = iter_out->second[0];
+  float input_w = iter_out->second[1];
 
-  // Record output shape of preprocessed image
-  (*im_info)["output_shape"] = {mat->Height(), mat->Width()};
+  int grid_h = infer_result[0].shape[2];  // 8
+  int grid_w = infer_result[0].shape[3];  // 8
+  int grid_length = grid_h * grid_w;      // 8 * 8 = 64
+  int max_len = max_len_map_.at(num_landmarks_);
+  const std::vector<int>& reverse_index1 =
+      reverse_index1_map_.at(num_landmarks_);
+  const std::vector<int>& reverse_index2 =
+      reverse_index2_map_.at(num_landmarks_);
+  // fetch data of this image from pointers
+  int offset = index * num_landmarks_ * grid_length;
+  int nb_offset = offset * num_nb_;
+  const float* outputs_cls_ptr =
+      static_cast<const float*>(infer_result[0].Data()) + offset;
+  const float* outputs_x_ptr =
+      static_cast<const float*>(infer_result[1].Data()) + offset;
+  const float* outputs_y_ptr =
+      static_cast<const float*>(infer_result[2].Data()) + offset;
+  const float* outputs_nb_x_ptr =
+      static_cast<const float*>(infer_result[3].Data()) + nb_offset;
+  const float* outputs_nb_y_ptr =
+      static_cast<const float*>(infer_result[4].Data()) + nb_offset;
 
-  HWC2CHW::Run(mat);
-  Cast::Run(mat, "float");
-  mat->ShareWithTensor(output);
-  output->shape.insert(output->shape.begin(), 1);  // reshape to n, c, h, w
-  return true;
+  // calculate the normalized coords of each landmark and its neighbors
+  std::vector<float> lms_pred_x(num_landmarks_);              // 19
+  std::vector<float> lms_pred_y(num_landmarks_);              // 19
+  std::vector<float> lms_pred_nb_x(num_landmarks_ * num_nb_);  // 19,10
+  std::vector<float> lms_pred_nb_y(num_landmarks_ * num_nb_);  // 19,10
+  for (int i = 0; i < num_landmarks_; ++i) {
+    float max_score = 0.0f;
+    int max_id = utils::ArgMaxWithValue(outputs_cls_ptr + i * grid_length,
+                                        grid_length, &max_score);  // 0~64
+    float cx = static_cast<float>(max_id % grid_w);
+    float cy = static_cast<float>(max_id / grid_w);
+    lms_pred_x[i] =
+        (cx + outputs_x_ptr[i * grid_length + max_id]) * net_stride_ / input_w;
+    lms_pred_y[i] =
+        (cy + outputs_y_ptr[i * grid_length + max_id]) * net_stride_ / input_h;
+    for (int j = 0; j < num_nb_; ++j) {
+      int nb_index = (i * num_nb_ + j) * grid_length + max_id;
+      lms_pred_nb_x[i * num_nb_ + j] =
+          (cx + outputs_nb_x_ptr[nb_index]) * net_stride_ / input_w;
+      lms_pred_nb_y[i * num_nb_ + j] =
+          (cy + outputs_nb_y_ptr[nb_index]) * net_stride_ / input_h;
+    }
+  }
+
+  // merge the predictions with the neighbor predictions of other landmarks
+  // from the reverse indexes
+  result->Clear();
+  result->Reserve(num_landmarks_);
+  for (int i = 0; i < num_landmarks_; ++i) {
+    float total_x = lms_pred_x[i];
+    float total_y = lms_pred_y[i];
+    for (int j = 0; j < max_len; ++j) {
+      int ri = reverse_index1[i * max_len + j];
+      int rj = reverse_index2[i * max_len + j];
+      total_x += lms_pred_nb_x[ri * num_nb_ + rj];
+      total_y += lms_pred_nb_y[ri * num_nb_ + rj];
+    }
+    float x = total_x / (static_cast<float>(max_len) + 1.f);
+    float y = total_y / (static_cast<float>(max_len) + 1.f);
+    x = std::min(std::max(0.f, x), 1.0f);
+    y = std::min(std::max(0.f, y), 1.0f);
+    result->landmarks.emplace_back(
+        std::array<float, 2>{x * img_width, y * img_height});
+  }
 }
 
-bool PIPNet::Postprocess(
-    std::vector<FDTensor>& infer_result, FaceAlignmentResult* result,
-    const std::map<std::string, std::array<int, 2>>& im_info) {
-  FDASSERT(infer_result.at(0).shape[0] == 1, "Only support batch = 1 now.");
-  if (infer_result.at(0).dtype != FDDataType::FP32) {
+bool PIPNetPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<FaceAlignmentResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  if (infer_result.size() < 5) {
+    FDERROR << "PIPNet should have 5 output tensors, but now it has "
+            << infer_result.size() << "." << std::endl;
+    return false;
+  }
+  if (infer_result[0].dtype != FDDataType::FP32) {
     FDERROR << "Only support post process with float32 data." << std::endl;
     return false;
   }
-
-  auto iter_in = im_info.find("input_shape");
-  FDASSERT(iter_in != im_info.end(), "Cannot find input_shape from im_info.");
-  int in_h = iter_in->second[0];
-  int in_w = iter_in->second[1];
-  GenerateLandmarks(infer_result, result, in_h, in_w);
-
-  return true;
-}
-
-bool PIPNet::Predict(cv::Mat* im, FaceAlignmentResult* result) {
-  Mat mat(*im);
-  std::vector<FDTensor> input_tensors(1);
-
-  std::map<std::string, std::array<int, 2>> im_info;
-
-  // Record the shape of image and the shape of preprocessed image
-  im_info["input_shape"] = {mat.Height(), mat.Width()};
-  im_info["output_shape"] = {mat.Height(), mat.Width()};
-
-  if (!Preprocess(&mat, &input_tensors[0], &im_info)) {
-    FDERROR << "Failed to preprocess input image." << std::endl;
+  if (max_len_map_.find(num_landmarks_) == max_len_map_.end()) {
+    FDERROR << "The number of landmarks should be in {19, 29, 68, 98}, but "
+            << "now it's " << num_landmarks_ << "." << std::endl;
     return false;
   }
-  input_tensors[0].name = InputInfoOfRuntime(0).name;
-  std::vector<FDTensor> output_tensors;
-  if (!Infer(input_tensors, &output_tensors)) {
-    FDERROR << "Failed to inference." << std::endl;
+  int batch = infer_result[0].shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of outputs and ims_info should be the same."
+            << std::endl;
     return false;
   }
-
-  if (!Postprocess(output_tensors, result, im_info)) {
-    FDERROR << "Failed to post process." << std::endl;
+  if (infer_result[0].shape[1] != num_landmarks_) {
+    FDERROR << "The number of landmarks of the model is "
+            << infer_result[0].shape[1] << ", but now num_landmarks is "
+            << num_landmarks_ << "." << std::endl;
     return false;
   }
+
+  results->resize(batch);
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      GenerateLandmarks(infer_result, bs, ims_info[bs], &(*results)[bs]);
+    }
+  });
   return true;
 }
 
 }  // namespace facealign
+
 }  // namespace vision
-}  // namespace fastdeploy
\ No newline at end of file
+
+}  // namespace fastdeploy
@@ -0,0 +1,71 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facealign {
+
+/*! @brief Postprocessor object for PIPNet serials model.
+ */
+class FASTDEPLOY_DECL PIPNetPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for PIPNet serials model
+   */
+  PIPNetPostprocessor();
+
+  /** \brief Process the result of runtime and fill to FaceAlignmentResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, the heatmap, offsets and neighbor offsets of the landmarks
+   * \param[in] results The output result of face alignment
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<FaceAlignmentResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+
+  /// Set the number of landmarks, should be one of {19, 29, 68, 98}, default num_landmarks = 19
+  void SetNumLandmarks(const int& num_landmarks);
+
+  /// Get the number of landmarks, default num_landmarks = 19
+  int GetNumLandmarks() const { return num_landmarks_; }
+
+ protected:
+  void GenerateLandmarks(
+      const std::vector<FDTensor>& infer_result, int index,
+      const std::map<std::string, std::array<float, 2>>& im_info,
+      FaceAlignmentResult* result) const;
+
+  std::map<int, int> max_len_map_;
+  std::map<int, std::vector<int>> reverse_index1_map_;
+  std::map<int, std::vector<int>> reverse_index2_map_;
+  int num_nb_;
+  int net_stride_;
+  // Now PIPNet support num_landmarks in {19, 29, 68, 98}
+  std::vector<int> supported_num_landmarks_;
+  // number of landmarks
+  int num_landmarks_;
+};
+
+}  // namespace facealign
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,48 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/facealign/contrib/pipnet/preprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facealign {
+
+PIPNetPreprocessor::PIPNetPreprocessor() {
+  size_ = {256, 256};
+  mean_vals_ = {0.485f, 0.456f, 0.406f};
+  std_vals_ = {0.229f, 0.224f, 0.225f};
+}
+
+bool PIPNetPreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  // pipnet's preprocess steps
+  // 1. resize
+  // 2. BGR->RGB, normalize and HWC->CHW in one pass
+  if (size_[1] != mat->Height() || size_[0] != mat->Width()) {
+    if (!Resize::Run(mat, size_[0], size_[1], -1, -1, cv::INTER_LINEAR, false,
+                     mat->proc_lib)) {
+      return false;
+    }
+  }
+  return NormalizeAndPermute::Run(mat, mean_vals_, std_vals_, true,
+                                  std::vector<float>(), std::vector<float>(),
+                                  mat->proc_lib, true);
+}
+
+}  // namespace facealign
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,73 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/vision/common/processors/per_image_preprocessor.h"
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facealign {
+
+/*! @brief Preprocessor object for PIPNet serials model.
+ */
+class FASTDEPLOY_DECL PIPNetPreprocessor : public PerImagePreprocessor {
+ public:
+  /** \brief Create a preprocessor instance for PIPNet serials model
+   */
+  PIPNetPreprocessor();
+
+  /// Set target size, tuple of (width, height), default size = {256, 256}
+  void SetSize(const std::vector<int>& size) { size_ = size; }
+
+  /// Get target size, tuple of (width, height), default size = {256, 256}
+  std::vector<int> GetSize() const { return size_; }
+
+  /// Set the mean values for normalization, default mean_vals = {0.485f, 0.456f, 0.406f}
+  void SetMeanVals(const std::vector<float>& mean_vals) {
+    mean_vals_ = mean_vals;
+  }
+
+  /// Get the mean values for normalization, default mean_vals = {0.485f, 0.456f, 0.406f}
+  std::vector<float> GetMeanVals() const { return mean_vals_; }
+
+  /// Set the std values for normalization, default std_vals = {0.229f, 0.224f, 0.225f}
+  void SetStdVals(const std::vector<float>& std_vals) { std_vals_ = std_vals; }
+
+  /// Get the std values for normalization, default std_vals = {0.229f, 0.224f, 0.225f}
+  std::vector<float> GetStdVals() const { return std_vals_; }
+
+ protected:
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info);
+
+  // target size, tuple of (width, height), default size = {256, 256}
+  std::vector<int> size_;
+
+  // Mean parameters for normalize, size should be the the same as channels,
+  // default mean_vals = {0.485f, 0.456f, 0.406f}
+  std::vector<float> mean_vals_;
+
+  // Std parameters for normalize, size should be the the same as channels,
+  // default std_vals = {0.229f, 0.224f, 0.225f}
+  std::vector<float> std_vals_;
+};
+
+}  // namespace facealign
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -67,7 +67,10 @@ void BindCenterFace(pybind11::module& m) {
            [](vision::facedet::CenterFace& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::FaceDetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict", [](vision::facedet::CenterFace& self, std::vector<pybind11::array>& data) {
@@ -76,7 +79,10 @@ void BindCenterFace(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::FaceDetectionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       })
       .def_property_readonly("preprocessor", &vision::facedet::CenterFace::GetPreprocessor)
@@ -0,0 +1,236 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/facedet/contrib/retinaface/postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/utils/utils.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+namespace {
+
+struct RetinaAnchor {
+  float cx;
+  float cy;
+  float s_kx;
+  float s_ky;
+};
+
+void GenerateRetinaAnchors(const std::vector<int>& size,
+                           const std::vector<int>& downsample_strides,
+                           const std::vector<std::vector<int>>& min_sizes,
+                           std::vector<RetinaAnchor>* anchors) {
+  // size: tuple of input (width, height)
+  // downsample_strides: downsample strides (steps), e.g (8,16,32)
+  // min_sizes: width and height for each anchor,
+  // e.g {{16, 32}, {64, 128}, {256, 512}}
+  int h = size[1];
+  int w = size[0];
+  std::vector<std::vector<int>> feature_maps;
+  for (auto s : downsample_strides) {
+    feature_maps.push_back(
+        {static_cast<int>(
+             std::ceil(static_cast<float>(h) / static_cast<float>(s))),
+         static_cast<int>(
+             std::ceil(static_cast<float>(w) / static_cast<float>(s)))});
+  }
+
+  (*anchors).clear();
+  const size_t num_feature_map = feature_maps.size();
+  // reference: layers/functions/prior_box.py#L21
+  for (size_t k = 0; k < num_feature_map; ++k) {
+    auto f_map = feature_maps.at(k);       // e.g [640//8,640//8]
+    auto tmp_min_sizes = min_sizes.at(k);  // e.g [8,16]
+    int f_h = f_map.at(0);
+    int f_w = f_map.at(1);
+    for (size_t i = 0; i < f_h; ++i) {
+      for (size_t j = 0; j < f_w; ++j) {
+        for (auto min_size : tmp_min_sizes) {
+          float s_kx =
+              static_cast<float>(min_size) / static_cast<float>(w);  // e.g 16/w
+          float s_ky =
+              static_cast<float>(min_size) / static_cast<float>(h);  // e.g 16/h
+          // (x + 0.5) * step / w normalized loc mapping to input width
+          // (y + 0.5) * step / h normalized loc mapping to input height
+          float s = static_cast<float>(downsample_strides.at(k));
+          float cx = (static_cast<float>(j) + 0.5f) * s / static_cast<float>(w);
+          float cy = (static_cast<float>(i) + 0.5f) * s / static_cast<float>(h);
+          (*anchors).emplace_back(
+              RetinaAnchor{cx, cy, s_kx, s_ky});  // without clip
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+RetinaFacePostprocessor::RetinaFacePostprocessor() {
+  conf_threshold_ = 0.25;
+  nms_threshold_ = 0.4;
+  variance_ = {0.1f, 0.2f};
+  downsample_strides_ = {8, 16, 32};
+  min_sizes_ = {{16, 32}, {64, 128}, {256, 512}};
+  landmarks_per_face_ = 5;
+}
+
+bool RetinaFacePostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<FaceDetectionResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  // retinaface has 3 output tensors, boxes & conf & landmarks
+  if (infer_result.size() != 3) {
+    FDERROR << "The default number of output tensor must be 3 according to "
+               "retinaface."
+            << std::endl;
+    return false;
+  }
+  const FDTensor& boxes_tensor = infer_result[0];      // (N,n,4)
+  const FDTensor& conf_tensor = infer_result[1];       // (N,n,2)
+  const FDTensor& landmarks_tensor = infer_result[2];  // (N,n,10)
+  if (boxes_tensor.dtype != FDDataType::FP32 ||
+      conf_tensor.dtype != FDDataType::FP32 ||
+      landmarks_tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = boxes_tensor.shape[0];
+  if (conf_tensor.shape[0] != batch || landmarks_tensor.shape[0] != batch ||
+      static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of boxes, scores, landmarks and ims_info "
+               "should be the same."
+            << std::endl;
+    return false;
+  }
+  const size_t num_bboxes = boxes_tensor.shape[1];  // n
+  results->resize(batch);
+  if (batch == 0) {
+    return true;
+  }
+
+  // The images of a batch are resized to the same output_shape, so the
+  // anchors are generated once for all of them
+  auto iter_out = ims_info[0].find("output_shape");
+  FDASSERT((iter_out != ims_info[0].end()),
+           "Cannot find output_shape from im_info.");
+  std::vector<int> size = {static_cast<int>(iter_out->second[1]),
+                           static_cast<int>(iter_out->second[0])};
+  std::vector<RetinaAnchor> anchors;
+  GenerateRetinaAnchors(size, downsample_strides_, min_sizes_, &anchors);
+  if (anchors.size() != num_bboxes) {
+    FDERROR << "The number of anchors " << anchors.size()
+            << " doesn't match the number of boxes " << num_bboxes
+            << ", please check downsample_strides and min_sizes." << std::endl;
+    return false;
+  }
+
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      FaceDetectionResult* result = &((*results)[bs]);
+      result->Clear();
+      // must be setup landmarks_per_face before reserve
+      result->landmarks_per_face = landmarks_per_face_;
+
+      const float* boxes_ptr =
+          static_cast<const float*>(boxes_tensor.Data()) + bs * num_bboxes * 4;
+      const float* conf_ptr =
+          static_cast<const float*>(conf_tensor.Data()) + bs * num_bboxes * 2;
+      const float* landmarks_ptr =
+          static_cast<const float*>(landmarks_tensor.Data()) +
+          bs * num_bboxes * landmarks_per_face_ * 2;
+      // fetch original image shape
+      auto iter_ipt = ims_info[bs].find("input_shape");
+      FDASSERT((iter_ipt != ims_info[bs].end()),
+               "Cannot find input_shape from im_info.");
+      float ipt_h = iter_ipt->second[0];
+      float ipt_w = iter_ipt->second[1];
+
+      // decode bounding boxes
+      for (size_t i = 0; i < num_bboxes; ++i) {
+        float confidence = conf_ptr[2 * i + 1];
+        // filter boxes by conf_threshold
+        if (confidence <= conf_threshold_) {
+          continue;
+        }
+        float prior_cx = anchors[i].cx;
+        float prior_cy = anchors[i].cy;
+        float prior_s_kx = anchors[i].s_kx;
+        float prior_s_ky = anchors[i].s_ky;
+
+        // fetch offsets (dx,dy,dw,dh)
+        float dx = boxes_ptr[4 * i + 0];
+        float dy = boxes_ptr[4 * i + 1];
+        float dw = boxes_ptr[4 * i + 2];
+        float dh = boxes_ptr[4 * i + 3];
+        // reference: Pytorch_Retinaface/utils/box_utils.py
+        float x = prior_cx + dx * variance_[0] * prior_s_kx;
+        float y = prior_cy + dy * variance_[0] * prior_s_ky;
+        float w = prior_s_kx * std::exp(dw * variance_[1]);
+        float h = prior_s_ky * std::exp(dh * variance_[1]);  // (0.~1.)
+        // from (x,y,w,h) to (x1,y1,x2,y2)
+        float x1 = (x - w / 2.f) * ipt_w;
+        float y1 = (y - h / 2.f) * ipt_h;
+        float x2 = (x + w / 2.f) * ipt_w;
+        float y2 = (y + h / 2.f) * ipt_h;
+        result->boxes.emplace_back(std::array<float, 4>{x1, y1, x2, y2});
+        result->scores.push_back(confidence);
+        // decode landmarks (default 5 landmarks)
+        // reference: utils/box_utils.py#L241
+        const float* landmarks = landmarks_ptr + i * landmarks_per_face_ * 2;
+        for (int j = 0; j < landmarks_per_face_ * 2; j += 2) {
+          float lx = (prior_cx + landmarks[j] * variance_[0] * prior_s_kx) *
+                     ipt_w;
+          float ly =
+              (prior_cy + landmarks[j + 1] * variance_[0] * prior_s_ky) *
+              ipt_h;
+          result->landmarks.emplace_back(std::array<float, 2>{lx, ly});
+        }
+      }
+
+      if (result->boxes.size() == 0) {
+        continue;
+      }
+
+      utils::NMS(result, nms_threshold_);
+
+      // clip box
+      for (size_t i = 0; i < result->boxes.size(); ++i) {
+        for (int j = 0; j < 4; ++j) {
+          float bound = (j % 2 == 0 ? ipt_w : ipt_h) - 1.0f;
+          result->boxes[i][j] =
+              std::min(std::max(result->boxes[i][j], 0.0f), bound);
+        }
+      }
+      // clip landmarks
+      for (size_t i = 0; i < result->landmarks.size(); ++i) {
+        result->landmarks[i][0] =
+            std::min(std::max(result->landmarks[i][0], 0.0f), ipt_w - 1.0f);
+        result->landmarks[i][1] =
+            std::min(std::max(result->landmarks[i][1], 0.0f), ipt_h - 1.0f);
+      }
+    }
+  });
+  return true;
+}
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
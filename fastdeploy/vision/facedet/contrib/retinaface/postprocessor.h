@@ -0,0 +1,106 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+/*! @brief Postprocessor object for RetinaFace serials model.
+ */
+class FASTDEPLOY_DECL RetinaFacePostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for RetinaFace serials model
+   */
+  RetinaFacePostprocessor();
+
+  /** \brief Process the result of runtime and fill to FaceDetectionResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, boxes in shape [N, num_boxes, 4], scores in shape [N, num_boxes, 2] and landmarks in shape [N, num_boxes, 2 * landmarks_per_face]
+   * \param[in] results The output result of detection
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<FaceDetectionResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+
+  /// Set conf_threshold, default 0.25
+  void SetConfThreshold(const float& conf_threshold) {
+    conf_threshold_ = conf_threshold;
+  }
+
+  /// Get conf_threshold, default 0.25
+  float GetConfThreshold() const { return conf_threshold_; }
+
+  /// Set nms_threshold, default 0.4
+  void SetNMSThreshold(const float& nms_threshold) {
+    nms_threshold_ = nms_threshold;
+  }
+
+  /// Get nms_threshold, default 0.4
+  float GetNMSThreshold() const { return nms_threshold_; }
+
+  /// Set variance in RetinaFace's prior-box(anchor) generate process, default (0.1, 0.2)
+  void SetVariance(const std::vector<float>& variance) {
+    variance_ = variance;
+  }
+
+  /// Get variance, default (0.1, 0.2)
+  std::vector<float> GetVariance() const { return variance_; }
+
+  /// Set downsample strides (namely, steps) to generate anchors, default (8, 16, 32)
+  void SetDownsampleStrides(const std::vector<int>& downsample_strides) {
+    downsample_strides_ = downsample_strides;
+  }
+
+  /// Get downsample strides, default (8, 16, 32)
+  std::vector<int> GetDownsampleStrides() const { return downsample_strides_; }
+
+  /// Set min sizes, width and height for each anchor, default {{16, 32}, {64, 128}, {256, 512}}
+  void SetMinSizes(const std::vector<std::vector<int>>& min_sizes) {
+    min_sizes_ = min_sizes;
+  }
+
+  /// Get min sizes, default {{16, 32}, {64, 128}, {256, 512}}
+  std::vector<std::vector<int>> GetMinSizes() const { return min_sizes_; }
+
+  /// Set landmarks_per_face, default 5
+  void SetLandmarksPerFace(int landmarks_per_face) {
+    landmarks_per_face_ = landmarks_per_face;
+  }
+
+  /// Get landmarks_per_face, default 5
+  int GetLandmarksPerFace() const { return landmarks_per_face_; }
+
+ protected:
+  float conf_threshold_;
+  float nms_threshold_;
+  std::vector<float> variance_;
+  std::vector<int> downsample_strides_;
+  std::vector<std::vector<int>> min_sizes_;
+  int landmarks_per_face_;
+};
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
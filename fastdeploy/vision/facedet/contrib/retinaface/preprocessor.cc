@@ -0,0 +1,48 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/facedet/contrib/retinaface/preprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+RetinaFacePreprocessor::RetinaFacePreprocessor() {
+  size_ = {640, 640};
+}
+
+bool RetinaFacePreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  // retinaface's preprocess steps
+  // 1. resize
+  // 2. convert and HWC->CHW in one pass
+  if (size_[1] != mat->Height() || size_[0] != mat->Width()) {
+    if (!Resize::Run(mat, size_[0], size_[1], -1, -1, cv::INTER_LINEAR, false,
+                     mat->proc_lib)) {
+      return false;
+    }
+  }
+  // Compute `result = mat * alpha + beta` directly by channel
+  // Reference: detect.py#L94
+  std::vector<float> alpha = {1.f, 1.f, 1.f};
+  std::vector<float> beta = {-104.f, -117.f, -123.f};  // BGR;
+  return ConvertAndPermute::Run(mat, alpha, beta, false, mat->proc_lib);
+}
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
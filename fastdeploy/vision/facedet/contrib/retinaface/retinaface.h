@@ -13,16 +13,17 @@
 // limitations under the License.
 
 #pragma once
+
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/facedet/contrib/retinaface/postprocessor.h"
+#include "fastdeploy/vision/facedet/contrib/retinaface/preprocessor.h"
 
 namespace fastdeploy {
 
 namespace vision {
-/** \brief All object face detection model APIs are defined inside this namespace
- *
- */
+
 namespace facedet {
 /*! @brief RetinaFace model object used when to load a RetinaFace model exported by RetinaFace.
  */
@@ -40,7 +41,8 @@ class FASTDEPLOY_DECL RetinaFace : public FastDeployModel {
              const ModelFormat& model_format = ModelFormat::ONNX);
 
   std::string ModelName() const { return "Pytorch_Retinaface"; }
-  /** \brief Predict the face detection result for an input image
+
+  /** \brief DEPRECATED Predict the face detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output face detection result will be writen to this structure
@@ -52,41 +54,33 @@ class FASTDEPLOY_DECL RetinaFace : public FastDeployModel {
                        float conf_threshold = 0.25f,
                        float nms_iou_threshold = 0.4f);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default (640, 640)
-  */
-  std::vector<int> size;
-  /*! @brief
-  Argument for image postprocessing step, variance in RetinaFace's prior-box(anchor) generate process, default (0.1, 0.2)
-  */
-  std::vector<float> variance;
-  /*! @brief
-  Argument for image postprocessing step, downsample strides (namely, steps) for RetinaFace to generate anchors, will take (8,16,32) as default values
-  */
-  std::vector<int> downsample_strides;
-  /*! @brief
-  Argument for image postprocessing step, min sizes, width and height for each anchor, default min_sizes = {{16, 32}, {64, 128}, {256, 512}}
-  */
-  std::vector<std::vector<int>> min_sizes;
-  /*! @brief
-  Argument for image postprocessing step, landmarks_per_face, default 5 in RetinaFace
-  */
-  int landmarks_per_face;
-
- private:
-  bool Initialize();
+  /** \brief Predict the face detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output face detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, FaceDetectionResult* result);
 
-  bool Preprocess(Mat* mat, FDTensor* output,
-                  std::map<std::string, std::array<float, 2>>* im_info);
+  /** \brief Predict the face detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output face detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<FaceDetectionResult>* results);
 
-  bool Postprocess(std::vector<FDTensor>& infer_result,
-                   FaceDetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
+  /// Get preprocessor reference of RetinaFace
+  virtual RetinaFacePreprocessor& GetPreprocessor() { return preprocessor_; }
 
-  bool IsDynamicInput() const { return is_dynamic_input_; }
+  /// Get postprocessor reference of RetinaFace
+  virtual RetinaFacePostprocessor& GetPostprocessor() { return postprocessor_; }
 
-  bool is_dynamic_input_;
+ protected:
+  bool Initialize();
+  RetinaFacePreprocessor preprocessor_;
+  RetinaFacePostprocessor postprocessor_;
 };
 
 }  // namespace facedet
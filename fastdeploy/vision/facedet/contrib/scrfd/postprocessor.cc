@@ -0,0 +1,197 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/facedet/contrib/scrfd/postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/utils/utils.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+SCRFDPostprocessor::SCRFDPostprocessor() {
+  conf_threshold_ = 0.25;
+  nms_threshold_ = 0.4;
+  downsample_strides_ = {8, 16, 32};
+  landmarks_per_face_ = 5;
+  use_kps_ = true;
+  max_nms_ = 30000;
+  num_anchors_ = 2;
+}
+
+bool SCRFDPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<FaceDetectionResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  // number of downsample_strides
+  int fmc = downsample_strides_.size();
+  if (fmc != 3 && fmc != 5) {
+    FDERROR << "The number of downsample_strides must be 3 or 5." << std::endl;
+    return false;
+  }
+  // scrfd has 6,9,10,15 output tensors, the scores, boxes and key points of
+  // each stride
+  int num_outputs = use_kps_ ? 3 * fmc : 2 * fmc;
+  if (static_cast<int>(infer_result.size()) < num_outputs) {
+    FDERROR << "The default number of output tensor must be " << num_outputs
+            << " according to scrfd, but got " << infer_result.size() << "."
+            << std::endl;
+    return false;
+  }
+  for (int i = 0; i < num_outputs; ++i) {
+    if (infer_result[i].dtype != FDDataType::FP32) {
+      FDERROR << "Only support post process with float32 data." << std::endl;
+      return false;
+    }
+  }
+  int batch = infer_result[0].shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of infer_result and ims_info should be the "
+               "same."
+            << std::endl;
+    return false;
+  }
+  results->resize(batch);
+  if (batch == 0) {
+    return true;
+  }
+
+  // The images of a batch have the same output_shape, the points of each
+  // stride are laid out as [grid_h, grid_w, num_anchors]
+  auto iter_out = ims_info[0].find("output_shape");
+  FDASSERT(iter_out != ims_info[0].end(),
+           "Cannot find output_shape from im_info.");
+  int out_h = static_cast<int>(iter_out->second[0]);
+  int out_w = static_cast<int>(iter_out->second[1]);
+  std::vector<int> num_grid_w(fmc);
+  for (int f = 0; f < fmc; ++f) {
+    num_grid_w[f] = out_w / downsample_strides_[f];
+    int64_t num_points = static_cast<int64_t>(out_h / downsample_strides_[f]) *
+                         num_grid_w[f] * num_anchors_;
+    if (infer_result[f].shape[1] != num_points) {
+      FDERROR << "The number of points " << infer_result[f].shape[1]
+              << " of stride " << downsample_strides_[f]
+              << " doesn't match the output shape, please check "
+                 "downsample_strides and num_anchors."
+              << std::endl;
+      return false;
+    }
+  }
+
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      FaceDetectionResult* result = &((*results)[bs]);
+      result->Clear();
+      // must be setup landmarks_per_face before reserve, force it to 0 if
+      // use_kps has been set as 'false'.
+      result->landmarks_per_face = use_kps_ ? landmarks_per_face_ : 0;
+
+      // scale the boxes to the origin image shape
+      auto iter_ipt = ims_info[bs].find("input_shape");
+      FDASSERT(iter_ipt != ims_info[bs].end(),
+               "Cannot find input_shape from im_info.");
+      float ipt_h = iter_ipt->second[0];
+      float ipt_w = iter_ipt->second[1];
+      float scale = std::min(out_h / ipt_h, out_w / ipt_w);
+      float pad_h = (out_h - ipt_h * scale) / 2.0f;
+      float pad_w = (out_w - ipt_w * scale) / 2.0f;
+
+      int count = 0;
+      // loop each stride
+      for (int f = 0; f < fmc && count < max_nms_; ++f) {
+        const int64_t num_points = infer_result[f].shape[1];
+        const float* score_ptr =
+            static_cast<const float*>(infer_result[f].Data()) +
+            bs * num_points;
+        const float* bbox_ptr =
+            static_cast<const float*>(infer_result[f + fmc].Data()) +
+            bs * num_points * 4;
+        const float* landmarks_ptr = nullptr;
+        if (use_kps_) {
+          landmarks_ptr =
+              static_cast<const float*>(infer_result[f + 2 * fmc].Data()) +
+              bs * num_points * landmarks_per_face_ * 2;
+        }
+        const float current_stride = static_cast<float>(downsample_strides_[f]);
+        // loop each anchor
+        for (int64_t i = 0; i < num_points && count < max_nms_; ++i) {
+          const float cls_conf = score_ptr[i];
+          if (cls_conf < conf_threshold_) continue;  // filter
+          int64_t cell = i / num_anchors_;
+          const float cx = static_cast<float>(cell % num_grid_w[f]);
+          const float cy = static_cast<float>(cell / num_grid_w[f]);
+          // bbox
+          const float* offsets = bbox_ptr + i * 4;
+          float l = offsets[0];  // left
+          float t = offsets[1];  // top
+          float r = offsets[2];  // right
+          float b = offsets[3];  // bottom
+
+          float x1 = ((cx - l) * current_stride - pad_w) / scale;
+          float y1 = ((cy - t) * current_stride - pad_h) / scale;
+          float x2 = ((cx + r) * current_stride - pad_w) / scale;
+          float y2 = ((cy + b) * current_stride - pad_h) / scale;
+          result->boxes.emplace_back(std::array<float, 4>{x1, y1, x2, y2});
+          result->scores.push_back(cls_conf);
+          if (use_kps_) {
+            // landmarks
+            const float* kps_offsets =
+                landmarks_ptr + i * (landmarks_per_face_ * 2);
+            for (int j = 0; j < landmarks_per_face_ * 2; j += 2) {
+              float kps_x =
+                  ((cx + kps_offsets[j]) * current_stride - pad_w) / scale;
+              float kps_y =
+                  ((cy + kps_offsets[j + 1]) * current_stride - pad_h) / scale;
+              result->landmarks.emplace_back(
+                  std::array<float, 2>{kps_x, kps_y});
+            }
+          }
+          count += 1;  // limit boxes for nms.
+        }
+      }
+
+      if (result->boxes.size() == 0) {
+        continue;
+      }
+
+      utils::NMS(result, nms_threshold_);
+
+      // clip box
+      for (size_t i = 0; i < result->boxes.size(); ++i) {
+        for (int j = 0; j < 4; ++j) {
+          float bound = (j % 2 == 0 ? ipt_w : ipt_h) - 1.0f;
+          result->boxes[i][j] =
+              std::min(std::max(result->boxes[i][j], 0.0f), bound);
+        }
+      }
+      // clip landmarks
+      for (size_t i = 0; i < result->landmarks.size(); ++i) {
+        result->landmarks[i][0] =
+            std::min(std::max(result->landmarks[i][0], 0.0f), ipt_w - 1.0f);
+        result->landmarks[i][1] =
+            std::min(std::max(result->landmarks[i][1], 0.0f), ipt_h - 1.0f);
+      }
+    }
+  });
+  return true;
+}
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
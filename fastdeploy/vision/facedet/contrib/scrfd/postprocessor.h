@@ -0,0 +1,109 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+/*! @brief Postprocessor object for SCRFD serials model.
+ */
+class FASTDEPLOY_DECL SCRFDPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for SCRFD serials model
+   */
+  SCRFDPostprocessor();
+
+  /** \brief Process the result of runtime and fill to FaceDetectionResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, the scores, boxes and key points of each downsample stride
+   * \param[in] results The output result of detection
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<FaceDetectionResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+
+  /// Set conf_threshold, default 0.25
+  void SetConfThreshold(const float& conf_threshold) {
+    conf_threshold_ = conf_threshold;
+  }
+
+  /// Get conf_threshold, default 0.25
+  float GetConfThreshold() const { return conf_threshold_; }
+
+  /// Set nms_threshold, default 0.4
+  void SetNMSThreshold(const float& nms_threshold) {
+    nms_threshold_ = nms_threshold;
+  }
+
+  /// Get nms_threshold, default 0.4
+  float GetNMSThreshold() const { return nms_threshold_; }
+
+  /// Set downsample strides (namely, steps) to generate anchors, default (8, 16, 32)
+  void SetDownsampleStrides(const std::vector<int>& downsample_strides) {
+    downsample_strides_ = downsample_strides;
+  }
+
+  /// Get downsample strides, default (8, 16, 32)
+  std::vector<int> GetDownsampleStrides() const { return downsample_strides_; }
+
+  /// Set landmarks_per_face, default 5
+  void SetLandmarksPerFace(int landmarks_per_face) {
+    landmarks_per_face_ = landmarks_per_face;
+  }
+
+  /// Get landmarks_per_face, default 5
+  int GetLandmarksPerFace() const { return landmarks_per_face_; }
+
+  /// Set whether the outputs of the model have key points, default true
+  void SetUseKps(bool use_kps) { use_kps_ = use_kps; }
+
+  /// Get whether the outputs of the model have key points, default true
+  bool GetUseKps() const { return use_kps_; }
+
+  /// Set the upperbound number of boxes processed by nms, default 30000
+  void SetMaxNMS(int max_nms) { max_nms_ = max_nms; }
+
+  /// Get the upperbound number of boxes processed by nms, default 30000
+  int GetMaxNMS() const { return max_nms_; }
+
+  /// Set the anchor number of each stride, default 2
+  void SetNumAnchors(unsigned int num_anchors) { num_anchors_ = num_anchors; }
+
+  /// Get the anchor number of each stride, default 2
+  unsigned int GetNumAnchors() const { return num_anchors_; }
+
+ protected:
+  float conf_threshold_;
+  float nms_threshold_;
+  std::vector<int> downsample_strides_;
+  int landmarks_per_face_;
+  bool use_kps_;
+  int max_nms_;
+  unsigned int num_anchors_;
+};
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,67 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fastdeploy/vision/facedet/contrib/scrfd/preprocessor.h"
+#include "fastdeploy/vision/common/processors/transform.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+SCRFDPreprocessor::SCRFDPreprocessor() {
+  padding_value_ = {0.0, 0.0, 0.0};
+  fit_by_area_ = false;
+  fit_by_round_ = false;
+#ifdef __ANDROID__
+  // Because of the low CPU performance on the Android device,
+  // we decided to hide this extra resize. It won't make much
+  // difference to the final result.
+  fit_before_letter_box_ = false;
+#endif
+  // Original Repo/tools/scrfd.py: cv2.dnn.blobFromImage(img, 1.0/128,
+  // input_size, (127.5, 127.5, 127.5), swapRB=True)
+  alpha_ = {1.f / 128.f, 1.f / 128.f, 1.f / 128.f};
+  beta_ = {-127.5f / 128.f, -127.5f / 128.f, -127.5f / 128.f};
+}
+
+bool SCRFDPreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  if (!disable_normalize_ && !disable_permute_) {
+    return LetterBoxPreprocessor::Preprocess(mat, im_info);
+  }
+  if (fit_before_letter_box_ && !ResizeToFit(mat)) {
+    return false;
+  }
+  if (!LetterBox(mat)) {
+    return false;
+  }
+  BGR2RGB::Run(mat, mat->proc_lib);
+  if (!disable_normalize_) {
+    Convert::Run(mat, alpha_, beta_, mat->proc_lib);
+  }
+  if (!disable_permute_) {
+    HWC2CHW::Run(mat, mat->proc_lib);
+    Cast::Run(mat, "float", mat->proc_lib);
+  }
+  return true;
+}
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,55 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "fastdeploy/vision/common/processors/letter_box_preprocessor.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+/*! @brief Preprocessor object for SCRFD serials model, the arguments of letterbox are set by the functions of LetterBoxPreprocessor.
+ */
+class FASTDEPLOY_DECL SCRFDPreprocessor : public LetterBoxPreprocessor {
+ public:
+  /** \brief Create a preprocessor instance for SCRFD serials model
+   */
+  SCRFDPreprocessor();
+
+  /// This function will disable normalize in preprocessing step.
+  void DisableNormalize() { disable_normalize_ = true; }
+
+  /// This function will disable hwc2chw in preprocessing step.
+  void DisablePermute() { disable_permute_ = true; }
+
+ protected:
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info);
+
+  // for recording the switch of normalize
+  bool disable_normalize_ = false;
+
+  // for recording the switch of hwc2chw
+  bool disable_permute_ = false;
+};
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -13,10 +13,12 @@
 // limitations under the License.
 
 #pragma once
-#include <unordered_map>
+
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/facedet/contrib/scrfd/postprocessor.h"
+#include "fastdeploy/vision/facedet/contrib/scrfd/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -39,7 +41,8 @@ class FASTDEPLOY_DECL SCRFD : public FastDeployModel {
         const ModelFormat& model_format = ModelFormat::ONNX);
 
   std::string ModelName() const { return "scrfd"; }
-  /** \brief Predict the face detection result for an input image
+
+  /** \brief DEPRECATED Predict the face detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output face detection result will be writen to this structure
@@ -51,83 +54,41 @@ class FASTDEPLOY_DECL SCRFD : public FastDeployModel {
                        float conf_threshold = 0.25f,
                        float nms_iou_threshold = 0.4f);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default (640, 640)
-  */
-  std::vector<int> size;
-  // padding value, size should be the same as channels
-
-  std::vector<float> padding_value;
-  // only pad to the minimum rectange which height and width is times of stride
-  bool is_mini_pad;
-  // while is_mini_pad = false and is_no_pad = true,
-  // will resize the image to the set size
-  bool is_no_pad;
-  // if is_scale_up is false, the input image only can be zoom out,
-  // the maximum resize scale cannot exceed 1.0
-  bool is_scale_up;
-  // padding stride, for is_mini_pad
-  int stride;
-  /*! @brief
-  Argument for image postprocessing step, downsample strides (namely, steps) for SCRFD to generate anchors, will take (8,16,32) as default values
-  */
-  std::vector<int> downsample_strides;
-  /*! @brief
-  Argument for image postprocessing step, landmarks_per_face, default 5 in SCRFD
-  */
-  int landmarks_per_face;
-  /*! @brief
-  Argument for image postprocessing step, the outputs of onnx file with key points features or not, default true
-  */
-  bool use_kps;
-  /*! @brief
-  Argument for image postprocessing step, the upperbond number of boxes processed by nms, default 30000
-  */
-  int max_nms;
-  /*! @brief
-  Argument for image postprocessing step, anchor number of each stride, default 2
-  */
-  unsigned int num_anchors;
-
-  /// This function will disable normalize and hwc2chw in preprocessing step.
-  void DisableNormalize();
-
-  /// This function will disable hwc2chw in preprocessing step.
-  void DisablePermute();
- private:
-  bool Initialize();
-
-  bool Preprocess(Mat* mat, FDTensor* output,
-                  std::map<std::string, std::array<float, 2>>* im_info);
-
-  bool Postprocess(std::vector<FDTensor>& infer_result,
-                   FaceDetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
-
-  void GeneratePoints();
+  /** \brief Predict the face detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output face detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, FaceDetectionResult* result);
 
-  void LetterBox(Mat* mat, const std::vector<int>& size,
-                 const std::vector<float>& color, bool _auto,
-                 bool scale_fill = false, bool scale_up = true,
-                 int stride = 32);
+  /** \brief Predict the face detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output face detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<FaceDetectionResult>* results);
 
-  bool is_dynamic_input_;
+  /// Get preprocessor reference of SCRFD
+  virtual SCRFDPreprocessor& GetPreprocessor() { return preprocessor_; }
 
-  bool center_points_is_update_;
+  /// Get postprocessor reference of SCRFD
+  virtual SCRFDPostprocessor& GetPostprocessor() { return postprocessor_; }
 
-  typedef struct {
-    float cx;
-    float cy;
-  } SCRFDPoint;
+  /// This function will disable normalize in preprocessing step.
+  void DisableNormalize() { preprocessor_.DisableNormalize(); }
 
-  std::unordered_map<int, std::vector<SCRFDPoint>> center_points_;
+  /// This function will disable hwc2chw in preprocessing step.
+  void DisablePermute() { preprocessor_.DisablePermute(); }
 
-  // for recording the switch of normalize
-  bool disable_normalize_ = false;
-  // for recording the switch of hwc2chw
-  bool disable_permute_ = false;
+ protected:
+  bool Initialize();
+  SCRFDPreprocessor preprocessor_;
+  SCRFDPostprocessor postprocessor_;
 };
+
 }  // namespace facedet
 }  // namespace vision
 }  // namespace fastdeploy
@@ -0,0 +1,150 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "fastdeploy/pybind/main.h"
+
+namespace fastdeploy {
+void BindSCRFD(pybind11::module& m) {
+  pybind11::class_<vision::facedet::SCRFDPreprocessor,
+                   vision::ProcessorManager>(m, "SCRFDPreprocessor")
+      .def(pybind11::init<>())
+      .def("run", [](vision::facedet::SCRFDPreprocessor& self,
+                     std::vector<pybind11::array>& im_list) {
+        std::vector<vision::FDMat> images;
+        for (size_t i = 0; i < im_list.size(); ++i) {
+          images.push_back(vision::WrapMat(PyArrayToCvMat(im_list[i])));
+        }
+        std::vector<FDTensor> outputs;
+        std::vector<std::map<std::string, std::array<float, 2>>> ims_info;
+        if (!self.Run(&images, &outputs, &ims_info)) {
+          throw std::runtime_error(
+              "Failed to preprocess the input data in SCRFDPreprocessor.");
+        }
+        for (size_t i = 0; i < outputs.size(); ++i) {
+          outputs[i].StopSharing();
+        }
+        return make_pair(outputs, ims_info);
+      })
+      .def("disable_normalize",
+           &vision::facedet::SCRFDPreprocessor::DisableNormalize)
+      .def("disable_permute",
+           &vision::facedet::SCRFDPreprocessor::DisablePermute)
+      .def_property("size",
+                    &vision::facedet::SCRFDPreprocessor::GetSize,
+                    &vision::facedet::SCRFDPreprocessor::SetSize)
+      .def_property("padding_value",
+                    &vision::facedet::SCRFDPreprocessor::GetPaddingValue,
+                    &vision::facedet::SCRFDPreprocessor::SetPaddingValue)
+      .def_property("is_scale_up",
+                    &vision::facedet::SCRFDPreprocessor::GetScaleUp,
+                    &vision::facedet::SCRFDPreprocessor::SetScaleUp)
+      .def_property("is_mini_pad",
+                    &vision::facedet::SCRFDPreprocessor::GetMiniPad,
+                    &vision::facedet::SCRFDPreprocessor::SetMiniPad)
+      .def_property("is_no_pad",
+                    &vision::facedet::SCRFDPreprocessor::GetNoPad,
+                    &vision::facedet::SCRFDPreprocessor::SetNoPad)
+      .def_property("stride",
+                    &vision::facedet::SCRFDPreprocessor::GetStride,
+                    &vision::facedet::SCRFDPreprocessor::SetStride);
+
+  pybind11::class_<vision::facedet::SCRFDPostprocessor>(
+      m, "SCRFDPostprocessor")
+      .def(pybind11::init<>())
+      .def("run",
+           [](vision::facedet::SCRFDPostprocessor& self,
+              std::vector<FDTensor>& inputs,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::FaceDetectionResult> results;
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "SCRFDPostprocessor.");
+             }
+             return results;
+           })
+      .def("run",
+           [](vision::facedet::SCRFDPostprocessor& self,
+              std::vector<pybind11::array>& input_array,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::FaceDetectionResult> results;
+             std::vector<FDTensor> inputs;
+             PyArrayToTensorList(input_array, &inputs, /*share_buffer=*/true);
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "SCRFDPostprocessor.");
+             }
+             return results;
+           })
+      .def_property("conf_threshold",
+                    &vision::facedet::SCRFDPostprocessor::GetConfThreshold,
+                    &vision::facedet::SCRFDPostprocessor::SetConfThreshold)
+      .def_property("nms_threshold",
+                    &vision::facedet::SCRFDPostprocessor::GetNMSThreshold,
+                    &vision::facedet::SCRFDPostprocessor::SetNMSThreshold)
+      .def_property("downsample_strides",
+                    &vision::facedet::SCRFDPostprocessor::GetDownsampleStrides,
+                    &vision::facedet::SCRFDPostprocessor::SetDownsampleStrides)
+      .def_property("landmarks_per_face",
+                    &vision::facedet::SCRFDPostprocessor::GetLandmarksPerFace,
+                    &vision::facedet::SCRFDPostprocessor::SetLandmarksPerFace)
+      .def_property("use_kps",
+                    &vision::facedet::SCRFDPostprocessor::GetUseKps,
+                    &vision::facedet::SCRFDPostprocessor::SetUseKps)
+      .def_property("max_nms",
+                    &vision::facedet::SCRFDPostprocessor::GetMaxNMS,
+                    &vision::facedet::SCRFDPostprocessor::SetMaxNMS)
+      .def_property("num_anchors",
+                    &vision::facedet::SCRFDPostprocessor::GetNumAnchors,
+                    &vision::facedet::SCRFDPostprocessor::SetNumAnchors);
+
+  pybind11::class_<vision::facedet::SCRFD, FastDeployModel>(m, "SCRFD")
+      .def(pybind11::init<std::string, std::string, RuntimeOption,
+                          ModelFormat>())
+      .def("predict",
+           [](vision::facedet::SCRFD& self, pybind11::array& data) {
+             auto mat = PyArrayToCvMat(data);
+             vision::FaceDetectionResult res;
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
+             return res;
+           })
+      .def("batch_predict",
+           [](vision::facedet::SCRFD& self,
+              std::vector<pybind11::array>& data) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::FaceDetectionResult> results;
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
+             return results;
+           })
+      .def("disable_normalize", &vision::facedet::SCRFD::DisableNormalize)
+      .def("disable_permute", &vision::facedet::SCRFD::DisablePermute)
+      .def_property_readonly("preprocessor",
+                             &vision::facedet::SCRFD::GetPreprocessor)
+      .def_property_readonly("postprocessor",
+                             &vision::facedet::SCRFD::GetPostprocessor);
+}
+}  // namespace fastdeploy
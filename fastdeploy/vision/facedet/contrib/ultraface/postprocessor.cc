@@ -0,0 +1,116 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/facedet/contrib/ultraface/postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/utils/utils.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+UltraFacePostprocessor::UltraFacePostprocessor() {
+  conf_threshold_ = 0.7;
+  nms_threshold_ = 0.3;
+}
+
+bool UltraFacePostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<FaceDetectionResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  // ultraface has 2 output tensors, scores & boxes
+  if (infer_result.size() != 2) {
+    FDERROR << "The default number of output tensor must be 2 according to "
+               "ultraface."
+            << std::endl;
+    return false;
+  }
+  const FDTensor& scores_tensor = infer_result[0];  // (N,4420,2)
+  const FDTensor& boxes_tensor = infer_result[1];   // (N,4420,4)
+  if (scores_tensor.dtype != FDDataType::FP32 ||
+      boxes_tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = boxes_tensor.shape[0];
+  if (scores_tensor.shape[0] != batch || static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of scores, boxes and ims_info should be the "
+               "same."
+            << std::endl;
+    return false;
+  }
+  const size_t num_bboxes = boxes_tensor.shape[1];  // e.g 4420
+  results->resize(batch);
+
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      FaceDetectionResult* result = &((*results)[bs]);
+      result->Clear();
+      // must be setup landmarks_per_face before reserve.
+      // ultraface detector does not detect landmarks by default.
+      result->landmarks_per_face = 0;
+
+      const float* scores_ptr =
+          static_cast<const float*>(scores_tensor.Data()) +
+          bs * num_bboxes * 2;
+      const float* boxes_ptr =
+          static_cast<const float*>(boxes_tensor.Data()) + bs * num_bboxes * 4;
+      // fetch original image shape
+      auto iter_ipt = ims_info[bs].find("input_shape");
+      FDASSERT((iter_ipt != ims_info[bs].end()),
+               "Cannot find input_shape from im_info.");
+      float ipt_h = iter_ipt->second[0];
+      float ipt_w = iter_ipt->second[1];
+
+      // decode bounding boxes
+      for (size_t i = 0; i < num_bboxes; ++i) {
+        float confidence = scores_ptr[2 * i + 1];
+        // filter boxes by conf_threshold
+        if (confidence <= conf_threshold_) {
+          continue;
+        }
+        float x1 = boxes_ptr[4 * i + 0] * ipt_w;
+        float y1 = boxes_ptr[4 * i + 1] * ipt_h;
+        float x2 = boxes_ptr[4 * i + 2] * ipt_w;
+        float y2 = boxes_ptr[4 * i + 3] * ipt_h;
+        result->boxes.emplace_back(std::array<float, 4>{x1, y1, x2, y2});
+        result->scores.push_back(confidence);
+      }
+
+      if (result->boxes.size() == 0) {
+        continue;
+      }
+
+      utils::NMS(result, nms_threshold_);
+
+      // clip box
+      for (size_t i = 0; i < result->boxes.size(); ++i) {
+        for (int j = 0; j < 4; ++j) {
+          float bound = (j % 2 == 0 ? ipt_w : ipt_h) - 1.0f;
+          result->boxes[i][j] =
+              std::min(std::max(result->boxes[i][j], 0.0f), bound);
+        }
+      }
+    }
+  });
+  return true;
+}
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
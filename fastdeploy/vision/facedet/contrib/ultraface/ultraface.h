@@ -11,11 +11,12 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #pragma once
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/facedet/contrib/ultraface/postprocessor.h"
+#include "fastdeploy/vision/facedet/contrib/ultraface/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -40,7 +41,8 @@ class FASTDEPLOY_DECL UltraFace : public FastDeployModel {
   std::string ModelName() const {
     return "Linzaer/Ultra-Light-Fast-Generic-Face-Detector-1MB";
   }
-  /** \brief Predict the face detection result for an input image
+
+  /** \brief DEPRECATED Predict the face detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output face detection result will be writen to this structure
@@ -52,25 +54,37 @@ class FASTDEPLOY_DECL UltraFace : public FastDeployModel {
                        float conf_threshold = 0.7f,
                        float nms_iou_threshold = 0.3f);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default (320, 240)
-  */
-  std::vector<int> size;
-
- private:
-  bool Initialize();
+  /** \brief Predict the face detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output face detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, FaceDetectionResult* result);
 
-  bool Preprocess(Mat* mat, FDTensor* outputs,
-                  std::map<std::string, std::array<float, 2>>* im_info);
+  /** \brief Predict the face detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output face detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<FaceDetectionResult>* results);
 
-  bool Postprocess(std::vector<FDTensor>& infer_result,
-                   FaceDetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
+  /// Get preprocessor reference of UltraFace
+  virtual UltraFacePreprocessor& GetPreprocessor() {
+    return preprocessor_;
+  }
 
-  bool IsDynamicInput() const { return is_dynamic_input_; }
+  /// Get postprocessor reference of UltraFace
+  virtual UltraFacePostprocessor& GetPostprocessor() {
+    return postprocessor_;
+  }
 
-  bool is_dynamic_input_;
+ protected:
+  bool Initialize();
+  UltraFacePreprocessor preprocessor_;
+  UltraFacePostprocessor postprocessor_;
 };
 
 }  // namespace facedet
@@ -0,0 +1,142 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/facedet/contrib/yolov5face/postprocessor.h"
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/utils/utils.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+YOLOv5FacePostprocessor::YOLOv5FacePostprocessor() {
+  conf_threshold_ = 0.25;
+  nms_threshold_ = 0.5;
+  landmarks_per_face_ = 5;
+}
+
+bool YOLOv5FacePostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<FaceDetectionResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  // infer_result: (N,n,16) 16=4+1+10+1
+  const FDTensor& tensor = infer_result[0];
+  if (tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = tensor.shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of infer_result and ims_info should be the "
+               "same."
+            << std::endl;
+    return false;
+  }
+  const int64_t num_rows = tensor.shape[1];
+  const int64_t row_size = tensor.shape[2];
+  // the class score follows the objectness and the landmarks
+  const int64_t cls_index = 5 + landmarks_per_face_ * 2;
+  if (cls_index >= row_size) {
+    FDERROR << "The size of each output row " << row_size
+            << " is too small for " << landmarks_per_face_ << " landmarks."
+            << std::endl;
+    return false;
+  }
+  results->resize(batch);
+
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      FaceDetectionResult* result = &((*results)[bs]);
+      result->Clear();
+      // must be setup landmarks_per_face before reserve
+      result->landmarks_per_face = landmarks_per_face_;
+
+      const float* data =
+          static_cast<const float*>(tensor.Data()) + bs * num_rows * row_size;
+      for (int64_t i = 0; i < num_rows; ++i) {
+        const float* reg_cls_ptr = data + i * row_size;
+        float obj_conf = reg_cls_ptr[4];
+        float cls_conf = reg_cls_ptr[cls_index];
+        float confidence = obj_conf * cls_conf;
+        // filter boxes by conf_threshold
+        if (confidence <= conf_threshold_) {
+          continue;
+        }
+        float x = reg_cls_ptr[0];
+        float y = reg_cls_ptr[1];
+        float w = reg_cls_ptr[2];
+        float h = reg_cls_ptr[3];
+
+        // convert from [x, y, w, h] to [x1, y1, x2, y2]
+        result->boxes.emplace_back(std::array<float, 4>{
+            (x - w / 2.f), (y - h / 2.f), (x + w / 2.f), (y + h / 2.f)});
+        result->scores.push_back(confidence);
+        // decode landmarks (default 5 landmarks)
+        const float* landmarks_ptr = reg_cls_ptr + 5;
+        for (int j = 0; j < landmarks_per_face_ * 2; j += 2) {
+          result->landmarks.emplace_back(
+              std::array<float, 2>{landmarks_ptr[j], landmarks_ptr[j + 1]});
+        }
+      }
+
+      if (result->boxes.size() == 0) {
+        continue;
+      }
+
+      utils::NMS(result, nms_threshold_);
+
+      // scale the boxes to the origin image shape
+      auto iter_out = ims_info[bs].find("output_shape");
+      auto iter_ipt = ims_info[bs].find("input_shape");
+      FDASSERT(iter_out != ims_info[bs].end() &&
+                   iter_ipt != ims_info[bs].end(),
+               "Cannot find input_shape or output_shape from im_info.");
+      float out_h = iter_out->second[0];
+      float out_w = iter_out->second[1];
+      float ipt_h = iter_ipt->second[0];
+      float ipt_w = iter_ipt->second[1];
+      float scale = std::min(out_h / ipt_h, out_w / ipt_w);
+      float pad_h = (out_h - ipt_h * scale) / 2.f;
+      float pad_w = (out_w - ipt_w * scale) / 2.f;
+      // scale and clip box
+      for (size_t i = 0; i < result->boxes.size(); ++i) {
+        for (int j = 0; j < 4; ++j) {
+          float pad = j % 2 == 0 ? pad_w : pad_h;
+          float bound = (j % 2 == 0 ? ipt_w : ipt_h) - 1.0f;
+          result->boxes[i][j] = std::min(
+              std::max((result->boxes[i][j] - pad) / scale, 0.0f), bound);
+        }
+      }
+      // scale and clip landmarks
+      for (size_t i = 0; i < result->landmarks.size(); ++i) {
+        result->landmarks[i][0] = std::min(
+            std::max((result->landmarks[i][0] - pad_w) / scale, 0.0f),
+            ipt_w - 1.0f);
+        result->landmarks[i][1] = std::min(
+            std::max((result->landmarks[i][1] - pad_h) / scale, 0.0f),
+            ipt_h - 1.0f);
+      }
+    }
+  });
+  return true;
+}
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,38 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fastdeploy/vision/facedet/contrib/yolov5face/preprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace facedet {
+
+YOLOv5FacePreprocessor::YOLOv5FacePreprocessor() {
+  fit_by_area_ = false;
+#ifdef __ANDROID__
+  // Because of the low CPU performance on the Android device,
+  // we decided to hide this extra resize. It won't make much
+  // difference to the final result.
+  fit_before_letter_box_ = false;
+#endif
+}
+
+}  // namespace facedet
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -13,9 +13,12 @@
 // limitations under the License.
 
 #pragma once
+
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/facedet/contrib/yolov5face/postprocessor.h"
+#include "fastdeploy/vision/facedet/contrib/yolov5face/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -38,7 +41,8 @@ class FASTDEPLOY_DECL YOLOv5Face : public FastDeployModel {
              const ModelFormat& model_format = ModelFormat::ONNX);
 
   std::string ModelName() const { return "yolov5-face"; }
-  /** \brief Predict the face detection result for an input image
+
+  /** \brief DEPRECATED Predict the face detection result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output face detection result will be writen to this structure
@@ -50,45 +54,33 @@ class FASTDEPLOY_DECL YOLOv5Face : public FastDeployModel {
                        float conf_threshold = 0.25,
                        float nms_iou_threshold = 0.5);
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default size = {640, 640}
-  */
-  std::vector<int> size;
-  // padding value, size should be the same as channels
+  /** \brief Predict the face detection result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output face detection result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, FaceDetectionResult* result);
 
-  std::vector<float> padding_value;
-  // only pad to the minimum rectange which height and width is times of stride
-  bool is_mini_pad;
-  // while is_mini_pad = false and is_no_pad = true,
-  // will resize the image to the set size
+  /** \brief Predict the face detection results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output face detection result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<FaceDetectionResult>* results);
 
-  bool is_no_pad;
-  // if is_scale_up is false, the input image only can be zoom out,
-  // the maximum resize scale cannot exceed 1.0
+  /// Get preprocessor reference of YOLOv5Face
+  virtual YOLOv5FacePreprocessor& GetPreprocessor() { return preprocessor_; }
 
-  bool is_scale_up;
-  // padding stride, for is_mini_pad
-  int stride;
-  /*! @brief
-    Argument for image postprocessing step, setup the number of landmarks for per face (if have), default 5 in
-    official yolov5face note that, the outupt tensor's shape must be:
-    (1,n,4+1+2*landmarks_per_face+1=box+obj+landmarks+cls), default 5
-  */
-  int landmarks_per_face;
+  /// Get postprocessor reference of YOLOv5Face
+  virtual YOLOv5FacePostprocessor& GetPostprocessor() { return postprocessor_; }
 
- private:
+ protected:
   bool Initialize();
-
-  bool Preprocess(Mat* mat, FDTensor* outputs,
-                  std::map<std::string, std::array<float, 2>>* im_info);
-
-  bool Postprocess(FDTensor& infer_result, FaceDetectionResult* result,
-                   const std::map<std::string, std::array<float, 2>>& im_info,
-                   float conf_threshold, float nms_iou_threshold);
-
-  bool IsDynamicInput() const { return is_dynamic_input_; }
-
-  bool is_dynamic_input_;
+  YOLOv5FacePreprocessor preprocessor_;
+  YOLOv5FacePostprocessor postprocessor_;
 };
 
 }  // namespace facedet
@@ -70,7 +70,10 @@ void BindYOLOv7Face(pybind11::module& m) {
            [](vision::facedet::YOLOv7Face& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::FaceDetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict", [](vision::facedet::YOLOv7Face& self, std::vector<pybind11::array>& data) {
@@ -79,7 +82,10 @@ void BindYOLOv7Face(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::FaceDetectionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       })
       .def_property_readonly("preprocessor", &vision::facedet::YOLOv7Face::GetPreprocessor)
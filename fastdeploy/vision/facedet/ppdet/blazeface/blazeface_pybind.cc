@@ -66,7 +66,10 @@ void BindBlazeFace(pybind11::module& m) {
            [](vision::facedet::BlazeFace& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::FaceDetectionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict", [](vision::facedet::BlazeFace& self, std::vector<pybind11::array>& data) {
@@ -75,7 +78,10 @@ void BindBlazeFace(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::FaceDetectionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       })
       .def_property_readonly("preprocessor", &vision::facedet::BlazeFace::GetPreprocessor)
@@ -71,7 +71,10 @@ void BindAdaFace(pybind11::module& m) {
       .def("predict", [](vision::faceid::AdaFace& self, pybind11::array& data) {
         cv::Mat im = PyArrayToCvMat(data);
         vision::FaceRecognitionResult result;
-        self.Predict(im, &result);
+        {
+          pybind11::gil_scoped_release release;
+          self.Predict(im, &result);
+        }
         return result;
       })
       .def("batch_predict", [](vision::faceid::AdaFace& self, std::vector<pybind11::array>& data) {
@@ -80,7 +83,10 @@ void BindAdaFace(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::FaceRecognitionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       })
       .def_property_readonly("preprocessor", &vision::faceid::AdaFace::GetPreprocessor)
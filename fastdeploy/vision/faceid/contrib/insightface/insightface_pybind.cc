@@ -94,7 +94,10 @@ void BindInsightFace(pybind11::module& m) {
               pybind11::array& data) {
              cv::Mat im = PyArrayToCvMat(data);
              vision::FaceRecognitionResult result;
-             self.Predict(im, &result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(im, &result);
+             }
              return result;
            })
       .def("batch_predict",
@@ -105,7 +108,10 @@ void BindInsightFace(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::FaceRecognitionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly(
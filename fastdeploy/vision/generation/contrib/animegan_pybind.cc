@@ -23,7 +23,10 @@ void BindAnimeGAN(pybind11::module& m) {
            [](vision::generation::AnimeGAN& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              cv::Mat res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              auto ret = pybind11::array_t<unsigned char>(
                    {res.rows, res.cols, res.channels()}, res.data);
              return ret;
@@ -35,7 +38,10 @@ void BindAnimeGAN(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<cv::Mat> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         std::vector<pybind11::array_t<unsigned char>> ret;
         for(size_t i = 0; i < results.size(); ++i){
           ret.push_back(pybind11::array_t<unsigned char>(
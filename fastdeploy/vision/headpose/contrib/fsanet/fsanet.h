@@ -11,11 +11,12 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #pragma once
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/headpose/contrib/fsanet/postprocessor.h"
+#include "fastdeploy/vision/headpose/contrib/fsanet/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -34,29 +35,50 @@ class FASTDEPLOY_DECL FSANet : public FastDeployModel {
    * \param[in] model_format Model format of the loaded model, default is ONNX format
    */
   FSANet(const std::string& model_file, const std::string& params_file = "",
-             const RuntimeOption& custom_option = RuntimeOption(),
-             const ModelFormat& model_format = ModelFormat::ONNX);
+         const RuntimeOption& custom_option = RuntimeOption(),
+         const ModelFormat& model_format = ModelFormat::ONNX);
 
   std::string ModelName() const { return "FSANet"; }
-  /** \brief Predict the face detection result for an input image
+
+  /** \brief DEPRECATED Predict the head pose result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
-   * \param[in] result The output face detection result will be writen to this structure
+   * \param[in] result The output head pose result will be writen to this structure
    * \return true if the prediction successed, otherwise false
    */
   virtual bool Predict(cv::Mat* im, HeadPoseResult* result);
 
-  /// tuple of (width, height), default (64, 64)
-  std::vector<int> size;
+  /** \brief Predict the head pose result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output head pose result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, HeadPoseResult* result);
+
+  /** \brief Predict the head pose results for a batch of input images, e.g. the faces cropped from one image
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output head pose result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<HeadPoseResult>* results);
 
- private:
-  bool Initialize();
+  /// Get preprocessor reference of FSANet
+  virtual FSANetPreprocessor& GetPreprocessor() {
+    return preprocessor_;
+  }
 
-  bool Preprocess(Mat* mat, FDTensor* outputs,
-                  std::map<std::string, std::array<int, 2>>* im_info);
+  /// Get postprocessor reference of FSANet
+  virtual FSANetPostprocessor& GetPostprocessor() {
+    return postprocessor_;
+  }
 
-  bool Postprocess(FDTensor& infer_result, HeadPoseResult* result,
-                   const std::map<std::string, std::array<int, 2>>& im_info);
+ protected:
+  bool Initialize();
+  FSANetPreprocessor preprocessor_;
+  FSANetPostprocessor postprocessor_;
 };
 
 }  // namespace headpose
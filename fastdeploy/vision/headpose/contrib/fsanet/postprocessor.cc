@@ -0,0 +1,61 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/headpose/contrib/fsanet/postprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace headpose {
+
+bool FSANetPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<HeadPoseResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  const FDTensor& angles_tensor = infer_result[0];
+  if (angles_tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = angles_tensor.shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of outputs and ims_info should be the same."
+            << std::endl;
+    return false;
+  }
+  int num_values = angles_tensor.Numel() / batch;
+  if (num_values < 3) {
+    FDERROR << "FSANet should output 3 euler angles for each image, but now "
+            << "it outputs " << num_values << "." << std::endl;
+    return false;
+  }
+  results->resize(batch);
+  const float* data = static_cast<const float*>(angles_tensor.Data());
+  for (int bs = 0; bs < batch; ++bs) {
+    HeadPoseResult* result = &((*results)[bs]);
+    result->Clear();
+    // yaw, pitch and roll
+    for (int i = 0; i < 3; ++i) {
+      result->euler_angles.emplace_back(data[bs * num_values + i]);
+    }
+  }
+  return true;
+}
+
+}  // namespace headpose
+
+}  // namespace vision
+
+}  // namespace fastdeploy
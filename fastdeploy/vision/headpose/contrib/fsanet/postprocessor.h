@@ -0,0 +1,49 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace headpose {
+
+/*! @brief Postprocessor object for FSANet serials model.
+ */
+class FASTDEPLOY_DECL FSANetPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for FSANet serials model
+   */
+  FSANetPostprocessor() {}
+
+  /** \brief Process the result of runtime and fill to HeadPoseResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, the euler angles are in the first tensor with shape [N, 3]
+   * \param[in] results The output result of head pose
+   * \param[in] ims_info The shape info list, record input_shape and output_shape
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<HeadPoseResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+};
+
+}  // namespace headpose
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -1,5 +1,10 @@
 #include "fastdeploy/vision/keypointdet/pptinypose/pptinypose.h"
 
+#include <atomic>
+#include <cstring>
+
+#include "fastdeploy/utils/parallel.h"
+#include "fastdeploy/vision/common/processors/normalize_and_permute_kernel.h"
 #include "fastdeploy/vision/utils/utils.h"
 #include "yaml-cpp/yaml.h"
 #include "fastdeploy/vision.h"
@@ -8,6 +13,21 @@ namespace fastdeploy {
 namespace vision {
 namespace keypointdetection {
 
+namespace {
+
+// The affine transform to warp the whole person image to the input size
+cv::Mat GetPersonTransform(const Mat& mat, int width, int height) {
+  float origin_width = static_cast<float>(mat.Width());
+  float origin_height = static_cast<float>(mat.Height());
+  std::vector<float> center = {origin_width / 2.0f, origin_height / 2.0f};
+  std::vector<float> scale = {origin_width, origin_height};
+  cv::Mat trans_matrix(2, 3, CV_64FC1);
+  GetAffineTransform(center, scale, 0, {width, height}, &trans_matrix, 0);
+  return trans_matrix;
+}
+
+}  // namespace
+
 PPTinyPose::PPTinyPose(const std::string& model_file,
                        const std::string& params_file,
                        const std::string& config_file,
@@ -88,27 +108,50 @@ bool PPTinyPose::BuildPreprocessPipelineFromConfig() {
       return false;
     }
   }
+
+  // The default pipeline could be fused in BatchPreprocess
+  fused_alpha_.clear();
+  fused_beta_.clear();
+  std::vector<std::string> names;
+  for (const auto& processor : processors_) {
+    names.push_back(processor->Name());
+  }
+  const std::vector<std::string> fusible_names = {
+      "BGR2RGB", "WarpAffine", "Normalize", "Cast", "HWC2CHW"};
+  if (names == fusible_names) {
+    auto normalize = dynamic_cast<Normalize*>(processors_[2].get());
+    if (!normalize->GetSwapRB()) {
+      fused_alpha_ = normalize->GetAlpha();
+      fused_beta_ = normalize->GetBeta();
+    }
+  }
   return true;
 }
 
-bool PPTinyPose::Preprocess(Mat* mat, std::vector<FDTensor>* outputs) {
+bool PPTinyPose::SetBatchSize(int batch_size) {
+  if (batch_size < -1 || batch_size == 0) {
+    FDERROR << "batch_size > 0 or batch_size == -1." << std::endl;
+    return false;
+  }
+  batch_size_ = batch_size;
+  return true;
+}
+
+bool PPTinyPose::ApplyProcessors(Mat* mat) {
   for (size_t i = 0; i < processors_.size(); ++i) {
     if (processors_[i]->Name().compare("WarpAffine") == 0) {
       auto processor = dynamic_cast<WarpAffine*>(processors_[i].get());
-      float origin_width = static_cast<float>(mat->Width());
-      float origin_height = static_cast<float>(mat->Height());
-      std::vector<float> center = {origin_width / 2.0f, origin_height / 2.0f};
-      std::vector<float> scale = {origin_width, origin_height};
       int resize_width = -1;
       int resize_height = -1;
       std::tie(resize_width, resize_height) = processor->GetWidthAndHeight();
-      cv::Mat trans_matrix(2, 3, CV_64FC1);
-      GetAffineTransform(center, scale, 0, {resize_width, resize_height},
-                         &trans_matrix, 0);
-      if (!(processor->SetTransformMatrix(trans_matrix))) {
-        FDERROR << "Failed to set transform matrix of "
-                << processors_[i]->Name() << " processor." << std::endl;
+      cv::Mat trans_matrix =
+          GetPersonTransform(*mat, resize_width, resize_height);
+      if (!WarpAffine::Run(mat, trans_matrix, resize_width, resize_height)) {
+        FDERROR << "Failed to process image data in "
+                << processors_[i]->Name() << "." << std::endl;
+        return false;
       }
+      continue;
     }
     if (!(*(processors_[i].get()))(mat)) {
       FDERROR << "Failed to process image data in " << processors_[i]->Name()
@@ -116,6 +159,13 @@ bool PPTinyPose::Preprocess(Mat* mat, std::vector<FDTensor>* outputs) {
       return false;
     }
   }
+  return true;
+}
+
+bool PPTinyPose::Preprocess(Mat* mat, std::vector<FDTensor>* outputs) {
+  if (!ApplyProcessors(mat)) {
+    return false;
+  }
 
   outputs->resize(1);
   (*outputs)[0].name = InputInfoOfRuntime(0).name;
@@ -127,63 +177,175 @@ bool PPTinyPose::Preprocess(Mat* mat, std::vector<FDTensor>* outputs) {
   return true;
 }
 
+bool PPTinyPose::BatchPreprocess(std::vector<Mat>* mats,
+                                 std::vector<FDTensor>* outputs) {
+  bool fused = !fused_alpha_.empty();
+  for (size_t i = 0; fused && i < mats->size(); ++i) {
+    fused = (*mats)[i].GetOpenCVMat()->type() == CV_8UC3;
+  }
+  if (fused) {
+    return FusedBatchPreprocess(mats, outputs);
+  }
+
+  std::atomic<bool> success(true);
+  fastdeploy::utils::ParallelFor(mats->size(), [&](int64_t begin,
+                                                   int64_t end) {
+    for (int64_t i = begin; i < end && success; ++i) {
+      if (!ApplyProcessors(&((*mats)[i]))) {
+        success = false;
+      }
+    }
+  });
+  if (!success) {
+    return false;
+  }
+
+  // All the persons are warped to the same size, and copied into the
+  // [N, c, h, w] tensor, whose buffer is reused between the batches
+  FDTensor first;
+  (*mats)[0].ShareWithTensor(&first);
+  std::vector<int64_t> shape = first.Shape();
+  shape.insert(shape.begin(), static_cast<int64_t>(mats->size()));
+  outputs->resize(1);
+  FDTensor* batch = &((*outputs)[0]);
+  batch->Resize(shape, first.Dtype(), InputInfoOfRuntime(0).name);
+  const size_t nbytes = first.Nbytes();
+  uint8_t* batch_data = reinterpret_cast<uint8_t*>(batch->MutableData());
+  fastdeploy::utils::ParallelFor(mats->size(), [&](int64_t begin,
+                                                   int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      FDTensor tensor;
+      (*mats)[i].ShareWithTensor(&tensor);
+      FDASSERT(tensor.Nbytes() == nbytes,
+               "The preprocessed persons should have the same shape.");
+      std::memcpy(batch_data + i * nbytes, tensor.Data(), nbytes);
+    }
+  });
+  return true;
+}
+
+bool PPTinyPose::FusedBatchPreprocess(std::vector<Mat>* mats,
+                                      std::vector<FDTensor>* outputs) {
+  auto warp_affine = dynamic_cast<WarpAffine*>(processors_[1].get());
+  int width = -1;
+  int height = -1;
+  std::tie(width, height) = warp_affine->GetWidthAndHeight();
+  outputs->resize(1);
+  FDTensor* batch = &((*outputs)[0]);
+  batch->Resize({static_cast<int64_t>(mats->size()), 3, height, width},
+                FDDataType::FP32, InputInfoOfRuntime(0).name);
+  float* batch_data = reinterpret_cast<float*>(batch->MutableData());
+  const int64_t person_size = 3 * static_cast<int64_t>(height) * width;
+  // Each person is warped in uint8, then converted to RGB, normalized and
+  // permuted into its slice of the batched tensor in a single pass
+  fastdeploy::utils::ParallelFor(mats->size(), [&](int64_t begin,
+                                                   int64_t end) {
+    cv::Mat warped;
+    for (int64_t i = begin; i < end; ++i) {
+      Mat* mat = &((*mats)[i]);
+      cv::Mat trans_matrix = GetPersonTransform(*mat, width, height);
+      cv::warpAffine(*(mat->GetOpenCVMat()), warped, trans_matrix,
+                     cv::Size(width, height), cv::INTER_LINEAR,
+                     cv::BORDER_CONSTANT, cv::Scalar());
+      NormalizeAndPermuteUint8(warped.ptr<uint8_t>(), height, width, 3,
+                               warped.step[0], fused_alpha_.data(),
+                               fused_beta_.data(), true,
+                               batch_data + i * person_size);
+    }
+  });
+  return true;
+}
+
 bool PPTinyPose::Postprocess(std::vector<FDTensor>& infer_result,
                              KeyPointDetectionResult* result,
                              const std::vector<float>& center,
                              const std::vector<float>& scale) {
   FDASSERT(infer_result[0].shape[0] == 1,
            "Only support batch = 1 in FastDeploy now.");
-  result->Clear();
-
-  if (infer_result.size() == 1) {
-    FDTensor result_copy = infer_result[0];
-    result_copy.Reshape({result_copy.shape[0], result_copy.shape[1],
-                         result_copy.shape[2] * result_copy.shape[3]});
-    infer_result.resize(2);
-    function::ArgMax(result_copy, &infer_result[1], -1);
+  std::vector<KeyPointDetectionResult> results;
+  if (!BatchPostprocess(infer_result, &results, {center}, {scale})) {
+    return false;
   }
+  *result = std::move(results[0]);
+  return true;
+}
 
-  // Calculate output length
-  int outdata_size =
-      std::accumulate(infer_result[0].shape.begin(),
-                      infer_result[0].shape.end(), 1, std::multiplies<int>());
-  int idxdata_size =
-      std::accumulate(infer_result[1].shape.begin(),
-                      infer_result[1].shape.end(), 1, std::multiplies<int>());
-
-  if (outdata_size < 6) {
+bool PPTinyPose::BatchPostprocess(
+    std::vector<FDTensor>& infer_result,
+    std::vector<KeyPointDetectionResult>* results,
+    const std::vector<std::vector<float>>& centers,
+    const std::vector<std::vector<float>>& scales) {
+  const FDTensor& heatmaps = infer_result[0];
+  int batch = static_cast<int>(heatmaps.shape[0]);
+  if (batch != static_cast<int>(centers.size()) ||
+      batch != static_cast<int>(scales.size())) {
+    FDERROR << "The batch size of inference result " << batch
+            << " should be the same as the number of persons "
+            << centers.size() << "." << std::endl;
+    return false;
+  }
+  int num_joints = static_cast<int>(heatmaps.shape[1]);
+  int64_t heatmap_size = heatmaps.Numel() / std::max(batch, 1);
+  if (heatmaps.Numel() < 6) {
     FDWARNING << "PPTinyPose No object detected." << std::endl;
   }
-  float* out_data = static_cast<float*>(infer_result[0].Data());
-  void* idx_data = infer_result[1].Data();
-  int idx_dtype = infer_result[1].dtype;
-  std::vector<int> out_data_shape(infer_result[0].shape.begin(),
-                                  infer_result[0].shape.end());
-  std::vector<int> idx_data_shape(infer_result[1].shape.begin(),
-                                  infer_result[1].shape.end());
-  std::vector<float> preds(out_data_shape[1] * 3, 0);
-  std::vector<float> heatmap(out_data, out_data + outdata_size);
-  std::vector<int64_t> idxout(idxdata_size);
-  if (idx_dtype == FDDataType::INT32) {
-    std::copy(static_cast<int32_t*>(idx_data),
-              static_cast<int32_t*>(idx_data) + idxdata_size, idxout.begin());
-  } else if (idx_dtype == FDDataType::INT64) {
-    std::copy(static_cast<int64_t*>(idx_data),
-              static_cast<int64_t*>(idx_data) + idxdata_size, idxout.begin());
+
+  // The argmax of each heatmap, which is computed from the heatmaps if the
+  // model has only one output
+  FDTensor argmax;
+  const FDTensor* indices = nullptr;
+  if (infer_result.size() == 1) {
+    FDTensor flatten;
+    flatten.SetExternalData(
+        {heatmaps.shape[0], heatmaps.shape[1],
+         heatmaps.shape[2] * heatmaps.shape[3]},
+        heatmaps.Dtype(), const_cast<void*>(heatmaps.Data()));
+    function::ArgMax(flatten, &argmax, -1);
+    indices = &argmax;
   } else {
+    indices = &infer_result[1];
+  }
+  if (indices->dtype != FDDataType::INT32 &&
+      indices->dtype != FDDataType::INT64) {
     FDERROR << "Only support process inference result with INT32/INT64 data "
                "type, but now it's "
-            << idx_dtype << "." << std::endl;
-  }
-  GetFinalPredictions(heatmap, out_data_shape, idxout, center, scale, &preds,
-                      this->use_dark);
-  result->Reserve(outdata_size);
-  result->num_joints = out_data_shape[1];
-  result->keypoints.clear();
-  for (int i = 0; i < out_data_shape[1]; i++) {
-    result->keypoints.push_back({preds[i * 3 + 1], preds[i * 3 + 2]});
-    result->scores.push_back(preds[i * 3]);
+            << indices->dtype << "." << std::endl;
+    return false;
   }
+
+  std::vector<int> out_data_shape = {1, num_joints,
+                                     static_cast<int>(heatmaps.shape[2]),
+                                     static_cast<int>(heatmaps.shape[3])};
+  const float* out_data = static_cast<const float*>(heatmaps.Data());
+  results->resize(batch);
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      std::vector<float> heatmap(out_data + i * heatmap_size,
+                                 out_data + (i + 1) * heatmap_size);
+      std::vector<int64_t> idxout(num_joints);
+      if (indices->dtype == FDDataType::INT32) {
+        const int32_t* idx_data =
+            static_cast<const int32_t*>(indices->Data()) + i * num_joints;
+        std::copy(idx_data, idx_data + num_joints, idxout.begin());
+      } else {
+        const int64_t* idx_data =
+            static_cast<const int64_t*>(indices->Data()) + i * num_joints;
+        std::copy(idx_data, idx_data + num_joints, idxout.begin());
+      }
+      std::vector<float> preds(num_joints * 3, 0);
+      GetFinalPredictions(heatmap, out_data_shape, idxout, centers[i],
+                          scales[i], &preds, this->use_dark);
+
+      KeyPointDetectionResult* result = &((*results)[i]);
+      result->Clear();
+      result->Reserve(num_joints);
+      result->num_joints = num_joints;
+      for (int j = 0; j < num_joints; j++) {
+        result->keypoints.push_back({preds[j * 3 + 1], preds[j * 3 + 2]});
+        result->scores.push_back(preds[j * 3]);
+      }
+    }
+  });
   return true;
 }
 
@@ -217,60 +379,100 @@ bool PPTinyPose::Predict(cv::Mat* im, KeyPointDetectionResult* result) {
 
 bool PPTinyPose::Predict(cv::Mat* im, KeyPointDetectionResult* result,
                          const DetectionResult& detection_result) {
+  std::vector<KeyPointDetectionResult> results;
+  if (!BatchPredict({*im}, &results, {detection_result})) {
+    return false;
+  }
+  *result = std::move(results[0]);
+  return true;
+}
+
+bool PPTinyPose::BatchPredict(
+    const std::vector<cv::Mat>& images,
+    std::vector<KeyPointDetectionResult>* results,
+    const std::vector<DetectionResult>& detection_results) {
+  if (images.size() != detection_results.size()) {
+    FDERROR << "The number of images " << images.size()
+            << " should be the same as the number of detection results "
+            << detection_results.size() << "." << std::endl;
+    return false;
+  }
+  results->resize(images.size());
+  for (auto& result : *results) {
+    result.Clear();
+  }
+
+  // Crop the persons of all the images, the crops share the image data
   std::vector<Mat> crop_imgs;
+  std::vector<size_t> image_ids;
   std::vector<std::vector<float>> center_bs;
   std::vector<std::vector<float>> scale_bs;
-  int crop_imgs_num = 0;
-  int box_num = detection_result.boxes.size();
-  for (int i = 0; i < box_num; i++) {
-    auto box = detection_result.boxes[i];
-    auto label_id = detection_result.label_ids[i];
-    int channel = im->channels();
-    cv::Mat cv_crop_img(0, 0, CV_32SC(channel));
-    Mat crop_img(cv_crop_img);
-    std::vector<float> rect(box.begin(), box.end());
-    std::vector<float> center;
-    std::vector<float> scale;
-    if (label_id == 0) {
-      Mat mat(*im);
+  for (size_t i = 0; i < images.size(); ++i) {
+    const DetectionResult& detection_result = detection_results[i];
+    for (size_t j = 0; j < detection_result.boxes.size(); ++j) {
+      if (detection_result.label_ids[j] != 0) {
+        continue;
+      }
+      Mat mat(images[i]);
+      cv::Mat cv_crop_img(0, 0, CV_32SC(images[i].channels()));
+      Mat crop_img(cv_crop_img);
+      std::vector<float> rect(detection_result.boxes[j].begin(),
+                              detection_result.boxes[j].end());
+      std::vector<float> center;
+      std::vector<float> scale;
       utils::CropImageByBox(mat, &crop_img, rect, &center, &scale);
+      crop_imgs.emplace_back(crop_img);
+      image_ids.push_back(i);
       center_bs.emplace_back(center);
       scale_bs.emplace_back(scale);
-      crop_imgs.emplace_back(crop_img);
-      crop_imgs_num += 1;
     }
   }
-  for (int i = 0; i < crop_imgs_num; i++) {
-    std::vector<FDTensor> processed_data;
-    if (!Preprocess(&crop_imgs[i], &processed_data)) {
+
+  // The batch size is limited by the model if its batch dimension is fixed
+  size_t batch_size = batch_size_ == -1 ? crop_imgs.size()
+                                        : static_cast<size_t>(batch_size_);
+  std::vector<int> input_shape = InputInfoOfRuntime(0).shape;
+  if (!input_shape.empty() && input_shape[0] > 0) {
+    batch_size = std::min(batch_size, static_cast<size_t>(input_shape[0]));
+  }
+  std::vector<KeyPointDetectionResult> crop_results;
+  for (size_t start = 0; start < crop_imgs.size(); start += batch_size) {
+    size_t end = std::min(crop_imgs.size(), start + batch_size);
+    std::vector<Mat> batch_imgs(crop_imgs.begin() + start,
+                                crop_imgs.begin() + end);
+    std::vector<std::vector<float>> batch_centers(center_bs.begin() + start,
+                                                  center_bs.begin() + end);
+    std::vector<std::vector<float>> batch_scales(scale_bs.begin() + start,
+                                                 scale_bs.begin() + end);
+    if (!BatchPreprocess(&batch_imgs, &reused_input_tensors_)) {
       FDERROR << "Failed to preprocess input data while using model:"
               << ModelName() << "." << std::endl;
       return false;
     }
-    std::vector<FDTensor> infer_result;
-    if (!Infer(processed_data, &infer_result)) {
+    if (!Infer()) {
       FDERROR << "Failed to inference while using model:" << ModelName() << "."
               << std::endl;
       return false;
     }
-    KeyPointDetectionResult one_cropimg_result;
-    if (!Postprocess(infer_result, &one_cropimg_result, center_bs[i],
-                     scale_bs[i])) {
+    if (!BatchPostprocess(reused_output_tensors_, &crop_results, batch_centers,
+                          batch_scales)) {
       FDERROR << "Failed to postprocess while using model:" << ModelName()
               << "." << std::endl;
       return false;
     }
-    if (result->num_joints == -1) {
-      result->num_joints = one_cropimg_result.num_joints;
+    for (size_t i = start; i < end; ++i) {
+      KeyPointDetectionResult* result = &((*results)[image_ids[i]]);
+      const KeyPointDetectionResult& crop_result = crop_results[i - start];
+      if (result->num_joints == -1) {
+        result->num_joints = crop_result.num_joints;
+      }
+      result->keypoints.insert(result->keypoints.end(),
+                               crop_result.keypoints.begin(),
+                               crop_result.keypoints.end());
+      result->scores.insert(result->scores.end(), crop_result.scores.begin(),
+                            crop_result.scores.end());
     }
-    std::copy(one_cropimg_result.keypoints.begin(),
-              one_cropimg_result.keypoints.end(),
-              std::back_inserter(result->keypoints));
-    std::copy(one_cropimg_result.scores.begin(),
-              one_cropimg_result.scores.end(),
-              std::back_inserter(result->scores));
   }
-
   return true;
 }
 
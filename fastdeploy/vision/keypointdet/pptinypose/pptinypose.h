@@ -64,6 +64,24 @@ class FASTDEPLOY_DECL PPTinyPose : public FastDeployModel {
   bool Predict(cv::Mat* im, KeyPointDetectionResult* result,
                const DetectionResult& detection_result);
 
+  /** \brief Predict the keypoint detection results with given detection results for a batch of images, the persons of all the images are inferred together in batches
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output keypoint detection result list, the keypoints of all the persons in an image are concatenated
+   * \param[in] detection_results The pedestrian detection results of the images, which are used to crop the persons
+   * \return true if the keypoint prediction successed, otherwise false
+   */
+  bool BatchPredict(const std::vector<cv::Mat>& images,
+                    std::vector<KeyPointDetectionResult>* results,
+                    const std::vector<DetectionResult>& detection_results);
+
+  /** \brief Set the max number of persons inferred in one batch, -1 means all the persons in one batch, default 8
+   */
+  bool SetBatchSize(int batch_size);
+
+  /// Get the max number of persons inferred in one batch
+  int GetBatchSize() const { return batch_size_; }
+
   /** \brief Whether using Distribution-Aware Coordinate Representation for Human Pose Estimation(DARK for short) in postprocess, default is true
    */
   bool use_dark = true;
@@ -87,19 +105,43 @@ class FASTDEPLOY_DECL PPTinyPose : public FastDeployModel {
   /// Preprocess an input image, and set the preprocessed results to `outputs`
   bool Preprocess(Mat* mat, std::vector<FDTensor>* outputs);
 
+  /// Preprocess the cropped persons in parallel into one batched tensor in `outputs`, the default pipeline writes the persons into the tensor directly without copy
+  bool BatchPreprocess(std::vector<Mat>* mats, std::vector<FDTensor>* outputs);
+
   /// Postprocess the inferenced results, and set the final result to `result`
   bool Postprocess(std::vector<FDTensor>& infer_result,
                    KeyPointDetectionResult* result,
                    const std::vector<float>& center,
                    const std::vector<float>& scale);
 
+  /// Postprocess the batched inferenced results in parallel, the center and scale of each person are used to map the keypoints back to the image
+  bool BatchPostprocess(std::vector<FDTensor>& infer_result,
+                        std::vector<KeyPointDetectionResult>* results,
+                        const std::vector<std::vector<float>>& centers,
+                        const std::vector<std::vector<float>>& scales);
+
  private:
+  // Apply the processors on mat, the processors are not modified so the
+  // images can be processed in parallel
+  bool ApplyProcessors(Mat* mat);
+  // BatchPreprocess of the default pipeline: BGR2RGB, WarpAffine, Normalize,
+  // Cast and HWC2CHW, which warps the persons and writes them into the
+  // batched tensor directly
+  bool FusedBatchPreprocess(std::vector<Mat>* mats,
+                            std::vector<FDTensor>* outputs);
+
   std::vector<std::shared_ptr<Processor>> processors_;
   std::string config_file_;
   // for recording the switch of hwc2chw
   bool disable_permute_ = false;
   // for recording the switch of normalize
   bool disable_normalize_ = false;
+  // the max number of persons inferred in one batch
+  int batch_size_ = 8;
+  // The alpha and beta of Normalize if the pipeline could be fused, refer to
+  // FusedBatchPreprocess(), empty otherwise
+  std::vector<float> fused_alpha_;
+  std::vector<float> fused_beta_;
 };
 }  // namespace keypointdetection
 }  // namespace vision
@@ -24,7 +24,10 @@ void BindPPTinyPose(pybind11::module& m) {
               pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::KeyPointDetectionResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
       .def(
@@ -33,9 +36,31 @@ void BindPPTinyPose(pybind11::module& m) {
              vision::DetectionResult& detection_result) {
             auto mat = PyArrayToCvMat(data);
             vision::KeyPointDetectionResult res;
-            self.Predict(&mat, &res, detection_result);
+            {
+              pybind11::gil_scoped_release release;
+              self.Predict(&mat, &res, detection_result);
+            }
             return res;
           })
+      .def("batch_predict",
+           [](vision::keypointdetection::PPTinyPose& self,
+              std::vector<pybind11::array>& data,
+              std::vector<vision::DetectionResult>& detection_results) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::KeyPointDetectionResult> results;
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results, detection_results);
+             }
+             return results;
+           })
+      .def("set_batch_size",
+           &vision::keypointdetection::PPTinyPose::SetBatchSize)
+      .def("get_batch_size",
+           &vision::keypointdetection::PPTinyPose::GetBatchSize)
       .def("disable_normalize",
            [](vision::keypointdetection::PPTinyPose& self) {
              self.DisableNormalize();
@@ -11,11 +11,12 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #pragma once
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/matting/contrib/modnet/postprocessor.h"
+#include "fastdeploy/vision/matting/contrib/modnet/preprocessor.h"
 
 namespace fastdeploy {
 
@@ -39,38 +40,45 @@ class FASTDEPLOY_DECL MODNet : public FastDeployModel {
 
   std::string ModelName() const { return "matting/MODNet"; }
 
-  /*! @brief
-  Argument for image preprocessing step, tuple of (width, height), decide the target size after resize, default (256, 256)
-  */
-  std::vector<int> size;
-  /*! @brief
-  Argument for image preprocessing step, parameters for normalization, size should be the the same as channels, default alpha = {1.f / 127.5f, 1.f / 127.5f, 1.f / 127.5f}
-  */
-  std::vector<float> alpha;
-  /*! @brief
-  Argument for image preprocessing step, parameters for normalization, size should be the the same as channels, default beta = {-1.f, -1.f, -1.f}
-  */
-  std::vector<float> beta;
-  /*! @brief
-  Argument for image preprocessing step, whether to swap the B and R channel, such as BGR->RGB, default true.
-  */
-  bool swap_rb;
+  /** \brief DEPRECATED Predict the matting result for an input image, remove at 1.0 version
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output matting result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(cv::Mat* im, MattingResult* result);
+
   /** \brief Predict the matting result for an input image
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output matting result will be writen to this structure
    * \return true if the prediction successed, otherwise false
    */
-  bool Predict(cv::Mat* im, MattingResult* result);
+  virtual bool Predict(const cv::Mat& im, MattingResult* result);
 
- private:
-  bool Initialize();
+  /** \brief Predict the matting results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output matting result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<MattingResult>* results);
+
+  /// Get preprocessor reference of MODNet
+  virtual MODNetPreprocessor& GetPreprocessor() {
+    return preprocessor_;
+  }
 
-  bool Preprocess(Mat* mat, FDTensor* output,
-                  std::map<std::string, std::array<int, 2>>* im_info);
+  /// Get postprocessor reference of MODNet
+  virtual MODNetPostprocessor& GetPostprocessor() {
+    return postprocessor_;
+  }
 
-  bool Postprocess(std::vector<FDTensor>& infer_result, MattingResult* result,
-                   const std::map<std::string, std::array<int, 2>>& im_info);
+ protected:
+  bool Initialize();
+  MODNetPreprocessor preprocessor_;
+  MODNetPostprocessor postprocessor_;
 };
 
 }  // namespace matting
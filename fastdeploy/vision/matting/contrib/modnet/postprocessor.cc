@@ -0,0 +1,88 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/matting/contrib/modnet/postprocessor.h"
+
+#include <cstring>
+
+#include "fastdeploy/utils/parallel.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace matting {
+
+bool MODNetPostprocessor::Run(
+    const std::vector<FDTensor>& infer_result,
+    std::vector<MattingResult>* results,
+    const std::vector<std::map<std::string, std::array<float, 2>>>&
+        ims_info) {
+  if (infer_result.size() != 1) {
+    FDERROR << "The default number of output tensor must be 1 according to "
+            << "modnet, but now it's " << infer_result.size() << "."
+            << std::endl;
+    return false;
+  }
+  const FDTensor& alpha_tensor = infer_result[0];  // (N, 1, h, w)
+  if (alpha_tensor.dtype != FDDataType::FP32) {
+    FDERROR << "Only support post process with float32 data." << std::endl;
+    return false;
+  }
+  int batch = alpha_tensor.shape[0];
+  if (static_cast<int>(ims_info.size()) != batch) {
+    FDERROR << "The batch size of outputs and ims_info should be the same."
+            << std::endl;
+    return false;
+  }
+  int out_h = alpha_tensor.shape[2];
+  int out_w = alpha_tensor.shape[3];
+
+  results->resize(batch);
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t bs = begin; bs < end; ++bs) {
+      auto iter_ipt = ims_info[bs].find("input_shape");
+      FDASSERT(iter_ipt != ims_info[bs].end(),
+               "Cannot find input_shape from im_info.");
+      int ipt_h = static_cast<int>(iter_ipt->second[0]);
+      int ipt_w = static_cast<int>(iter_ipt->second[1]);
+
+      float* alpha_ptr = const_cast<float*>(
+          static_cast<const float*>(alpha_tensor.Data()) +
+          bs * out_h * out_w);
+      Mat alpha_resized = Mat::Create(out_h, out_w, 1, FDDataType::FP32,
+                                      alpha_ptr);  // ref-only, zero copy.
+      if ((out_h != ipt_h) || (out_w != ipt_w)) {
+        Resize::Run(&alpha_resized, ipt_w, ipt_h, -1, -1);
+      }
+
+      MattingResult* result = &((*results)[bs]);
+      result->Clear();
+      // note: must be setup shape before Resize
+      result->contain_foreground = false;
+      result->shape = {static_cast<int64_t>(ipt_h),
+                       static_cast<int64_t>(ipt_w)};
+      int numel = ipt_h * ipt_w;
+      result->Resize(numel);
+      std::memcpy(result->alpha.data(), alpha_resized.Data(),
+                  numel * sizeof(float));
+    }
+  });
+  return true;
+}
+
+}  // namespace matting
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -0,0 +1,47 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/matting/contrib/modnet/preprocessor.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace matting {
+
+MODNetPreprocessor::MODNetPreprocessor() {
+  size_ = {256, 256};
+  alpha_ = {1.f / 127.5f, 1.f / 127.5f, 1.f / 127.5f};
+  beta_ = {-1.f, -1.f, -1.f};  // RGB
+  swap_rb_ = true;
+}
+
+bool MODNetPreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  // modnet's preprocess steps
+  // 1. resize
+  // 2. BGR->RGB, convert and HWC->CHW in one pass
+  if (size_[1] != mat->Height() || size_[0] != mat->Width()) {
+    if (!Resize::Run(mat, size_[0], size_[1], -1, -1, cv::INTER_LINEAR, false,
+                     mat->proc_lib)) {
+      return false;
+    }
+  }
+  return ConvertAndPermute::Run(mat, alpha_, beta_, swap_rb_, mat->proc_lib);
+}
+
+}  // namespace matting
+
+}  // namespace vision
+
+}  // namespace fastdeploy
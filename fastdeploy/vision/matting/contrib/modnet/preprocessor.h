@@ -0,0 +1,74 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/vision/common/processors/per_image_preprocessor.h"
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+
+namespace vision {
+
+namespace matting {
+
+/*! @brief Preprocessor object for MODNet serials model.
+ */
+class FASTDEPLOY_DECL MODNetPreprocessor : public PerImagePreprocessor {
+ public:
+  /** \brief Create a preprocessor instance for MODNet serials model
+   */
+  MODNetPreprocessor();
+
+  /// Set target size, tuple of (width, height), default size = {256, 256}
+  void SetSize(const std::vector<int>& size) { size_ = size; }
+
+  /// Get target size, tuple of (width, height), default size = {256, 256}
+  std::vector<int> GetSize() const { return size_; }
+
+  /// Set alpha for normalization `x' = x * alpha + beta`, default alpha = {1.f / 127.5f, 1.f / 127.5f, 1.f / 127.5f}
+  void SetAlpha(const std::vector<float>& alpha) { alpha_ = alpha; }
+
+  /// Get alpha for normalization, default alpha = {1.f / 127.5f, 1.f / 127.5f, 1.f / 127.5f}
+  std::vector<float> GetAlpha() const { return alpha_; }
+
+  /// Set beta for normalization `x' = x * alpha + beta`, default beta = {-1.f, -1.f, -1.f}
+  void SetBeta(const std::vector<float>& beta) { beta_ = beta; }
+
+  /// Get beta for normalization, default beta = {-1.f, -1.f, -1.f}
+  std::vector<float> GetBeta() const { return beta_; }
+
+  /// Set whether to swap the B and R channel, such as BGR->RGB, default true
+  void SetSwapRB(bool swap_rb) { swap_rb_ = swap_rb; }
+
+  /// Get whether to swap the B and R channel, default true
+  bool GetSwapRB() const { return swap_rb_; }
+
+ protected:
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info);
+
+  // target size, tuple of (width, height), default size = {256, 256}
+  std::vector<int> size_;
+  // parameters for normalization, size should be the the same as channels
+  std::vector<float> alpha_;
+  std::vector<float> beta_;
+  // whether to swap the B and R channel, default true
+  bool swap_rb_;
+};
+
+}  // namespace matting
+
+}  // namespace vision
+
+}  // namespace fastdeploy
@@ -14,6 +14,10 @@
 
 #include "fastdeploy/vision/matting/contrib/rvm.h"
 
+#include <set>
+
+#include "fastdeploy/function/concat.h"
+#include "fastdeploy/utils/parallel.h"
 #include "fastdeploy/utils/perf.h"
 #include "fastdeploy/vision/utils/utils.h"
 
@@ -23,6 +27,25 @@ namespace vision {
 
 namespace matting {
 
+namespace {
+
+// The number of the recurrent states r1i~r4i
+const int kNumStates = 4;
+
+// Copy the batch_id-th sample of the batched tensor src to dst, the buffer of
+// dst is reused if it is large enough
+void CopyBatchSample(const FDTensor& src, int batch_id, FDTensor* dst) {
+  std::vector<int64_t> shape = src.shape;
+  shape[0] = 1;
+  dst->Resize(shape, src.dtype, src.name);
+  size_t nbytes = dst->Nbytes();
+  memcpy(dst->MutableData(),
+         static_cast<const uint8_t*>(src.CpuData()) + batch_id * nbytes,
+         nbytes);
+}
+
+}  // namespace
+
 RobustVideoMatting::RobustVideoMatting(const std::string& model_file,
                                        const std::string& params_file,
                                        const RuntimeOption& custom_option,
@@ -53,6 +76,43 @@ bool RobustVideoMatting::Initialize() {
     FDERROR << "Failed to initialize fastdeploy backend." << std::endl;
     return false;
   }
+  default_session_ = CreateSession();
+  return true;
+}
+
+int RobustVideoMatting::CreateSession() {
+  int session = next_session_++;
+  std::vector<FDTensor>& states = sessions_[session];
+  states.resize(kNumStates);
+  for (auto& state : states) {
+    // The initial states are zeros broadcasted by the model
+    state.Resize({1, 1, 1, 1}, FDDataType::FP32);
+    static_cast<float*>(state.MutableData())[0] = 0.0f;
+  }
+  return session;
+}
+
+bool RobustVideoMatting::ResetSession(int session) {
+  auto iter = sessions_.find(session);
+  if (iter == sessions_.end()) {
+    FDERROR << "The session " << session << " does not exist." << std::endl;
+    return false;
+  }
+  for (auto& state : iter->second) {
+    state.Resize({1, 1, 1, 1}, FDDataType::FP32);
+    static_cast<float*>(state.MutableData())[0] = 0.0f;
+  }
+  return true;
+}
+
+bool RobustVideoMatting::ReleaseSession(int session) {
+  if (sessions_.erase(session) == 0) {
+    FDERROR << "The session " << session << " does not exist." << std::endl;
+    return false;
+  }
+  if (session == default_session_) {
+    default_session_ = -1;
+  }
   return true;
 }
 
@@ -79,15 +139,10 @@ bool RobustVideoMatting::Preprocess(
 }
 
 bool RobustVideoMatting::Postprocess(
-    std::vector<FDTensor>& infer_result, MattingResult* result,
+    std::vector<FDTensor>& infer_result, int batch_id, MattingResult* result,
     const std::map<std::string, std::array<int, 2>>& im_info) {
-  FDASSERT((infer_result.size() == 6),
-           "The default number of output tensor must be 6 according to "
-           "RobustVideoMatting.");
-  FDTensor& fgr = infer_result.at(0);    // fgr (1, 3, h, w) 0.~1.
-  FDTensor& alpha = infer_result.at(1);  // alpha (1, 1, h, w) 0.~1.
-  FDASSERT((fgr.shape[0] == 1), "Only support batch = 1 now.");
-  FDASSERT((alpha.shape[0] == 1), "Only support batch = 1 now.");
+  FDTensor& fgr = infer_result.at(0);    // fgr (n, 3, h, w) 0.~1.
+  FDTensor& alpha = infer_result.at(1);  // alpha (n, 1, h, w) 0.~1.
   if (fgr.dtype != FDDataType::FP32) {
     FDERROR << "Only support post process with float32 data." << std::endl;
     return false;
@@ -96,16 +151,6 @@ bool RobustVideoMatting::Postprocess(
     FDERROR << "Only support post process with float32 data." << std::endl;
     return false;
   }
-  // update context
-  if (video_mode) {
-    for (size_t i = 0; i < 4; ++i) {
-      FDTensor& rki = infer_result.at(i + 2);
-      dynamic_inputs_dims_[i] = rki.shape;
-      dynamic_inputs_datas_[i].resize(rki.Numel());
-      memcpy(dynamic_inputs_datas_[i].data(), rki.Data(),
-             rki.Numel() * FDDataTypeSize(rki.dtype));
-    }
-  }
 
   auto iter_in = im_info.find("input_shape");
   auto iter_out = im_info.find("output_shape");
@@ -115,19 +160,26 @@ bool RobustVideoMatting::Postprocess(
   int out_w = iter_out->second[1];
   int in_h = iter_in->second[0];
   int in_w = iter_in->second[1];
+  int out_numel = out_h * out_w;
 
   // for alpha
-  float* alpha_ptr = static_cast<float*>(alpha.Data());
+  float* alpha_ptr =
+      static_cast<float*>(alpha.Data()) + batch_id * out_numel;
   Mat alpha_resized = Mat::Create(out_h, out_w, 1, FDDataType::FP32,
                                   alpha_ptr);  // ref-only, zero copy.
   if ((out_h != in_h) || (out_w != in_w)) {
     Resize::Run(&alpha_resized, in_w, in_h, -1, -1);
   }
 
-  // for foreground
-  float* fgr_ptr = static_cast<float*>(fgr.Data());
-  Mat fgr_resized = Mat::Create(out_h, out_w, 1, FDDataType::FP32,
-                                fgr_ptr);  // ref-only, zero copy.
+  // for foreground, CHW -> HWC
+  float* fgr_ptr = static_cast<float*>(fgr.Data()) + batch_id * 3 * out_numel;
+  std::vector<cv::Mat> fgr_planes = {
+      cv::Mat(out_h, out_w, CV_32FC1, fgr_ptr),
+      cv::Mat(out_h, out_w, CV_32FC1, fgr_ptr + out_numel),
+      cv::Mat(out_h, out_w, CV_32FC1, fgr_ptr + 2 * out_numel)};
+  cv::Mat fgr_hwc;
+  cv::merge(fgr_planes, fgr_hwc);
+  Mat fgr_resized(fgr_hwc);
   if ((out_h != in_h) || (out_w != in_w)) {
     Resize::Run(&fgr_resized, in_w, in_h, -1, -1);
   }
@@ -139,42 +191,184 @@ bool RobustVideoMatting::Postprocess(
   int nbytes = numel * sizeof(float);
   result->Resize(numel);
   memcpy(result->alpha.data(), alpha_resized.Data(), nbytes);
-  memcpy(result->foreground.data(), fgr_resized.Data(), nbytes);
+  memcpy(result->foreground.data(), fgr_resized.Data(), 3 * nbytes);
   return true;
 }
 
-bool RobustVideoMatting::Predict(cv::Mat* im, MattingResult* result) {
-  Mat mat(*im);
-  int inputs_nums = NumInputsOfRuntime();
-  std::vector<FDTensor> input_tensors(inputs_nums);
-  std::map<std::string, std::array<int, 2>> im_info;
-  // Record the shape of image and the shape of preprocessed image
-  im_info["input_shape"] = {mat.Height(), mat.Width()};
-  im_info["output_shape"] = {mat.Height(), mat.Width()};
-  // convert vector to FDTensor
-  for (size_t i = 1; i < inputs_nums; ++i) {
-    input_tensors[i].SetExternalData(dynamic_inputs_dims_[i - 1],
-                                     FDDataType::FP32,
-                                     dynamic_inputs_datas_[i - 1].data());
-    input_tensors[i].device = Device::CPU;
-  }
-  if (!Preprocess(&mat, &input_tensors[0], &im_info)) {
-    FDERROR << "Failed to preprocess input image." << std::endl;
-    return false;
+bool RobustVideoMatting::BatchInfer(
+    const std::vector<std::vector<FDTensor>*>& states,
+    const std::vector<std::vector<FDTensor>*>& next_states,
+    std::vector<Mat>* mats, std::vector<MattingResult*>* results) {
+  size_t batch = mats->size();
+  std::vector<std::map<std::string, std::array<int, 2>>> ims_info(batch);
+  std::vector<FDTensor> tensors(batch);
+  std::vector<int> success(batch, 1);
+  // The frames are resized to the same size, preprocess them in parallel
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      // Record the shape of image and the shape of preprocessed image
+      ims_info[i]["input_shape"] = {(*mats)[i].Height(), (*mats)[i].Width()};
+      ims_info[i]["output_shape"] = {(*mats)[i].Height(), (*mats)[i].Width()};
+      success[i] = Preprocess(&(*mats)[i], &tensors[i], &ims_info[i]);
+    }
+  });
+  for (size_t i = 0; i < batch; ++i) {
+    if (!success[i]) {
+      FDERROR << "Failed to preprocess input image." << std::endl;
+      return false;
+    }
+  }
+
+  reused_input_tensors_.resize(NumInputsOfRuntime());
+  if (batch == 1) {
+    reused_input_tensors_[0] = std::move(tensors[0]);
+  } else {
+    function::Concat(tensors, &reused_input_tensors_[0], 0);
+  }
+  // The states of one session are fed without copy, while the states of
+  // several sessions have to be concatenated into one batch
+  for (int k = 0; k < kNumStates; ++k) {
+    FDTensor& input = reused_input_tensors_[k + 1];
+    if (batch == 1) {
+      FDTensor& state = (*states[0])[k];
+      input.SetExternalData(state.shape, state.dtype, state.MutableData(),
+                            state.device, state.device_id);
+      continue;
+    }
+    std::vector<FDTensor> batch_states(batch);
+    for (size_t i = 0; i < batch; ++i) {
+      FDTensor& state = (*states[i])[k];
+      batch_states[i].SetExternalData(state.shape, state.dtype,
+                                      state.MutableData(), state.device,
+                                      state.device_id);
+    }
+    function::Concat(batch_states, &input, 0);
   }
-  for (size_t i = 0; i < inputs_nums; ++i) {
-    input_tensors[i].name = InputInfoOfRuntime(i).name;
+  reused_input_tensors_[kNumStates + 1].SetExternalData(
+      {1}, FDDataType::FP32, downsample_ratio_.data());
+  for (size_t i = 0; i < reused_input_tensors_.size(); ++i) {
+    reused_input_tensors_[i].name = InputInfoOfRuntime(i).name;
   }
-  std::vector<FDTensor> output_tensors;
-  if (!Infer(input_tensors, &output_tensors)) {
+
+  if (!Infer(reused_input_tensors_, &reused_output_tensors_)) {
     FDERROR << "Failed to inference." << std::endl;
     return false;
   }
+  FDASSERT((reused_output_tensors_.size() == 6),
+           "The default number of output tensor must be 6 according to "
+           "RobustVideoMatting.");
+
+  for (size_t i = 0; i < batch; ++i) {
+    if (!Postprocess(reused_output_tensors_, i, (*results)[i], ims_info[i])) {
+      FDERROR << "Failed to post process." << std::endl;
+      return false;
+    }
+  }
+
+  // update context, only after the frames are processed successfully
+  if (video_mode) {
+    for (int k = 0; k < kNumStates; ++k) {
+      FDTensor& output = reused_output_tensors_[k + 2];
+      // Swap the buffers of r(k)o and the next states, if the next states
+      // are the states consumed by this inference, the next inference writes
+      // r(k)o to their buffers
+      if (batch == 1 && !output.IsShared() && output.device == Device::CPU) {
+        std::swap(output, (*next_states[0])[k]);
+        continue;
+      }
+      for (size_t i = 0; i < batch; ++i) {
+        CopyBatchSample(output, i, &(*next_states[i])[k]);
+      }
+    }
+  }
+  return true;
+}
 
-  if (!Postprocess(output_tensors, result, im_info)) {
-    FDERROR << "Failed to post process." << std::endl;
+bool RobustVideoMatting::Predict(cv::Mat* im, MattingResult* result) {
+  if (default_session_ < 0) {
+    default_session_ = CreateSession();
+  }
+  return Predict(default_session_, *im, result);
+}
+
+bool RobustVideoMatting::Predict(int session, const cv::Mat& im,
+                                 MattingResult* result) {
+  std::vector<MattingResult> results;
+  if (!BatchPredict({session}, {im}, &results)) {
     return false;
   }
+  *result = std::move(results[0]);
+  return true;
+}
+
+bool RobustVideoMatting::BatchPredict(const std::vector<int>& sessions,
+                                      const std::vector<cv::Mat>& images,
+                                      std::vector<MattingResult>* results) {
+  if (sessions.size() != images.size()) {
+    FDERROR << "The size of sessions(" << sessions.size()
+            << ") should be the same as the size of images(" << images.size()
+            << ")." << std::endl;
+    return false;
+  }
+  // Group the frames by the shape of the states, the states of the sessions
+  // which have not inferred any frame are the initial [1, 1, 1, 1] zeros
+  std::map<std::vector<std::vector<int64_t>>, std::vector<size_t>> groups;
+  std::set<int> visited;
+  for (size_t i = 0; i < sessions.size(); ++i) {
+    if (images[i].empty() || images[i].channels() != 3) {
+      FDERROR << "The image " << i << " should be a 3-channel image."
+              << std::endl;
+      return false;
+    }
+    auto iter = sessions_.find(sessions[i]);
+    if (iter == sessions_.end()) {
+      FDERROR << "The session " << sessions[i] << " does not exist."
+              << std::endl;
+      return false;
+    }
+    if (!visited.insert(sessions[i]).second) {
+      FDERROR << "The session " << sessions[i]
+              << " appears more than once, its frames depend on each other "
+                 "and cannot be inferred in one batch."
+              << std::endl;
+      return false;
+    }
+    std::vector<std::vector<int64_t>> shapes;
+    for (const auto& state : iter->second) {
+      shapes.push_back(state.shape);
+    }
+    groups[shapes].push_back(i);
+  }
+
+  // With several groups, the next states are staged and the sessions are
+  // only updated after all the groups succeed, so a failed group leaves all
+  // the sessions unchanged. A single group updates the states in place.
+  results->resize(images.size());
+  std::vector<std::vector<FDTensor>> staged_states;
+  if (groups.size() > 1) {
+    staged_states.resize(images.size(), std::vector<FDTensor>(kNumStates));
+  }
+  for (const auto& group : groups) {
+    std::vector<std::vector<FDTensor>*> states;
+    std::vector<std::vector<FDTensor>*> next_states;
+    std::vector<Mat> mats;
+    std::vector<MattingResult*> group_results;
+    for (size_t i : group.second) {
+      states.push_back(&sessions_[sessions[i]]);
+      next_states.push_back(staged_states.empty() ? states.back()
+                                                  : &staged_states[i]);
+      mats.push_back(WrapMat(images[i]));
+      group_results.push_back(&(*results)[i]);
+    }
+    if (!BatchInfer(states, next_states, &mats, &group_results)) {
+      return false;
+    }
+  }
+  if (video_mode) {
+    for (size_t i = 0; i < staged_states.size(); ++i) {
+      std::swap(sessions_[sessions[i]], staged_states[i]);
+    }
+  }
   return true;
 }
 
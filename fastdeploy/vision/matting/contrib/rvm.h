@@ -52,6 +52,38 @@ class FASTDEPLOY_DECL RobustVideoMatting : public FastDeployModel {
    */
   bool Predict(cv::Mat* im, MattingResult* result);
 
+  /** \brief Create a session which owns the recurrent states of one video stream, so that one model can serve several streams
+   *
+   * \return The handle of the session, used by Predict/BatchPredict/ResetSession/ReleaseSession
+   */
+  int CreateSession();
+
+  /// Reset the recurrent states of a session to the initial zero states, e.g. when the scene of the stream changes
+  bool ResetSession(int session);
+
+  /// Release a session and its recurrent states
+  bool ReleaseSession(int session);
+
+  /** \brief Predict the matting result for the next frame of a session
+   *
+   * \param[in] session The handle returned by CreateSession()
+   * \param[in] im The input frame data, comes from cv::imread() or cv::VideoCapture
+   * \param[in] result The output matting result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  bool Predict(int session, const cv::Mat& im, MattingResult* result);
+
+  /** \brief Predict the matting results for the next frames of several sessions, the frames whose sessions have recurrent states of the same shape are inferred in one batch. If the prediction fails, the recurrent states of all the sessions are unchanged
+   *
+   * \param[in] sessions The handles of the sessions, each session should appear at most once
+   * \param[in] images The input frames, images[i] is the next frame of sessions[i]
+   * \param[in] results The output matting results will be writen to this vector
+   * \return true if the prediction successed, otherwise false
+   */
+  bool BatchPredict(const std::vector<int>& sessions,
+                    const std::vector<cv::Mat>& images,
+                    std::vector<MattingResult>* results);
+
   /// Preprocess image size, the default is (1080, 1920)
   std::vector<int> size;
 
@@ -61,33 +93,36 @@ class FASTDEPLOY_DECL RobustVideoMatting : public FastDeployModel {
   /// Whether convert to RGB, Set to false if you have converted YUV format images to RGB outside the model, dafault true // NOLINT
   bool swap_rb;
 
+ protected:
+  RobustVideoMatting() {}
+
  private:
   bool Initialize();
   /// Preprocess an input image, and set the preprocessed results to `outputs`
   bool Preprocess(Mat* mat, FDTensor* output,
                   std::map<std::string, std::array<int, 2>>* im_info);
 
-  /// Postprocess the inferenced results, and set the final result to `result`
-  bool Postprocess(std::vector<FDTensor>& infer_result, MattingResult* result,
+  /// Postprocess the batch_id-th result of the inferenced results, and set the final result to `result`
+  bool Postprocess(std::vector<FDTensor>& infer_result, int batch_id,
+                   MattingResult* result,
                    const std::map<std::string, std::array<int, 2>>& im_info);
 
-  /// Init dynamic inputs datas
-  std::vector<std::vector<float>> dynamic_inputs_datas_ = {
-     {0.0f},  // r1i
-     {0.0f},  // r2i
-     {0.0f},  // r3i
-     {0.0f},  // r4i
-     {0.25f},  // downsample_ratio
-  };
-
-  /// Init dynamic inputs dims
-  std::vector<std::vector<int64_t>> dynamic_inputs_dims_ = {
-     {1, 1, 1, 1},  // r1i
-     {1, 1, 1, 1},  // r2i
-     {1, 1, 1, 1},  // r3i
-     {1, 1, 1, 1},  // r4i
-     {1},  // downsample_ratio
-  };
+  /// Infer the frames of the sessions whose recurrent states have the same shape in one batch, the recurrent outputs are written to next_states after all the frames are postprocessed
+  bool BatchInfer(const std::vector<std::vector<FDTensor>*>& states,
+                  const std::vector<std::vector<FDTensor>*>& next_states,
+                  std::vector<Mat>* mats,
+                  std::vector<MattingResult*>* results);
+
+  /// The recurrent states r1i~r4i of the next frame of each session. The
+  /// states are swapped with the outputs r1o~r4o after each frame, so the
+  /// buffers of the states are reused as the outputs of the next frame.
+  std::map<int, std::vector<FDTensor>> sessions_;
+  int next_session_ = 0;
+  /// The session used by Predict(cv::Mat*, MattingResult*)
+  int default_session_ = -1;
+
+  /// The downsample_ratio input
+  std::vector<float> downsample_ratio_ = {0.25f};
 };
 
 }  // namespace matting
@@ -24,9 +24,54 @@ void BindRobustVideoMatting(pybind11::module& m) {
            [](vision::matting::RobustVideoMatting& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::MattingResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
+      .def("create_session",
+           &vision::matting::RobustVideoMatting::CreateSession)
+      .def("reset_session", &vision::matting::RobustVideoMatting::ResetSession)
+      .def("release_session",
+           &vision::matting::RobustVideoMatting::ReleaseSession)
+      .def("predict_session",
+           [](vision::matting::RobustVideoMatting& self, int session,
+              pybind11::array& data) {
+             auto mat = PyArrayToCvMat(data);
+             vision::MattingResult res;
+             bool success;
+             {
+               pybind11::gil_scoped_release release;
+               success = self.Predict(session, mat, &res);
+             }
+             if (!success) {
+               throw std::runtime_error(
+                   "Failed to predict the frame of the session in "
+                   "RobustVideoMatting.");
+             }
+             return res;
+           })
+      .def("batch_predict",
+           [](vision::matting::RobustVideoMatting& self,
+              std::vector<int>& sessions, std::vector<pybind11::array>& data) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::MattingResult> results;
+             bool success;
+             {
+               pybind11::gil_scoped_release release;
+               success = self.BatchPredict(sessions, images, &results);
+             }
+             if (!success) {
+               throw std::runtime_error(
+                   "Failed to predict the frames of the sessions in "
+                   "RobustVideoMatting.");
+             }
+             return results;
+           })
       .def_readwrite("size", &vision::matting::RobustVideoMatting::size)
       .def_readwrite("video_mode", &vision::matting::RobustVideoMatting::video_mode)
       .def_readwrite("swap_rb", &vision::matting::RobustVideoMatting::swap_rb);
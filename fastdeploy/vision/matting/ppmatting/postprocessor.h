@@ -0,0 +1,44 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+namespace vision {
+namespace matting {
+/*! @brief Postprocessor object for PPMatting serials model.
+ */
+class FASTDEPLOY_DECL PPMattingPostprocessor {
+ public:
+  /** \brief Create a postprocessor instance for PPMatting serials model
+   */
+  PPMattingPostprocessor() {}
+
+  /** \brief Process the result of runtime and fill to MattingResult structure
+   *
+   * \param[in] infer_result The inference result from runtime, the alpha matte with shape [N, 1, H, W]
+   * \param[in] results The output result of matting
+   * \param[in] ims_info The shape info list, record input_shape, resized_shape and output_shape
+   * \return true if the postprocess successed, otherwise false
+   */
+  bool Run(const std::vector<FDTensor>& infer_result,
+           std::vector<MattingResult>* results,
+           const std::vector<std::map<std::string, std::array<float, 2>>>&
+               ims_info);
+};
+
+}  // namespace matting
+}  // namespace vision
+}  // namespace fastdeploy
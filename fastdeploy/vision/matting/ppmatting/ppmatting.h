@@ -15,6 +15,8 @@
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/matting/ppmatting/postprocessor.h"
+#include "fastdeploy/vision/matting/ppmatting/preprocessor.h"
 
 namespace fastdeploy {
 namespace vision {
@@ -40,7 +42,8 @@ class FASTDEPLOY_DECL PPMatting : public FastDeployModel {
             const ModelFormat& model_format = ModelFormat::ONNX);
 
   std::string ModelName() const { return "PaddleMatting"; }
-  /** \brief Predict the matting result for an input image
+
+  /** \brief DEPRECATED Predict the matting result for an input image, remove at 1.0 version
    *
    * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
    * \param[in] result The output matting result will be writen to this structure
@@ -48,20 +51,37 @@ class FASTDEPLOY_DECL PPMatting : public FastDeployModel {
    */
   virtual bool Predict(cv::Mat* im, MattingResult* result);
 
- private:
-  bool Initialize();
+  /** \brief Predict the matting result for an input image
+   *
+   * \param[in] im The input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format
+   * \param[in] result The output matting result will be writen to this structure
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool Predict(const cv::Mat& im, MattingResult* result);
 
-  bool BuildPreprocessPipelineFromConfig();
+  /** \brief Predict the matting results for a batch of input images
+   *
+   * \param[in] images The input image list, each element comes from cv::imread()
+   * \param[in] results The output matting result list
+   * \return true if the prediction successed, otherwise false
+   */
+  virtual bool BatchPredict(const std::vector<cv::Mat>& images,
+                            std::vector<MattingResult>* results);
 
-  bool Preprocess(Mat* mat, FDTensor* outputs,
-                  std::map<std::string, std::array<int, 2>>* im_info);
+  /// Get preprocessor reference of PPMatting
+  virtual PPMattingPreprocessor& GetPreprocessor() {
+    return preprocessor_;
+  }
 
-  bool Postprocess(std::vector<FDTensor>& infer_result, MattingResult* result,
-                   const std::map<std::string, std::array<int, 2>>& im_info);
+  /// Get postprocessor reference of PPMatting
+  virtual PPMattingPostprocessor& GetPostprocessor() {
+    return postprocessor_;
+  }
 
-  std::vector<std::shared_ptr<Processor>> processors_;
-  std::string config_file_;
-  bool is_fixed_input_shape_;
+ protected:
+  bool Initialize();
+  PPMattingPreprocessor preprocessor_;
+  PPMattingPostprocessor postprocessor_;
 };
 
 }  // namespace matting
@@ -15,6 +15,59 @@
 
 namespace fastdeploy {
 void BindPPMatting(pybind11::module& m) {
+  pybind11::class_<vision::matting::PPMattingPreprocessor,
+                   vision::ProcessorManager>(m, "PPMattingPreprocessor")
+      .def(pybind11::init<std::string>())
+      .def("run", [](vision::matting::PPMattingPreprocessor& self,
+                     std::vector<pybind11::array>& im_list) {
+        std::vector<vision::FDMat> images;
+        for (size_t i = 0; i < im_list.size(); ++i) {
+          images.push_back(vision::WrapMat(PyArrayToCvMat(im_list[i])));
+        }
+        std::vector<FDTensor> outputs;
+        std::vector<std::map<std::string, std::array<float, 2>>> ims_info;
+        if (!self.Run(&images, &outputs, &ims_info)) {
+          throw std::runtime_error(
+              "Failed to preprocess the input data in PPMattingPreprocessor.");
+        }
+        for (size_t i = 0; i < outputs.size(); ++i) {
+          outputs[i].StopSharing();
+        }
+        return make_pair(outputs, ims_info);
+      });
+
+  pybind11::class_<vision::matting::PPMattingPostprocessor>(
+      m, "PPMattingPostprocessor")
+      .def(pybind11::init<>())
+      .def("run",
+           [](vision::matting::PPMattingPostprocessor& self,
+              std::vector<FDTensor>& inputs,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::MattingResult> results;
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "PPMattingPostprocessor.");
+             }
+             return results;
+           })
+      .def("run",
+           [](vision::matting::PPMattingPostprocessor& self,
+              std::vector<pybind11::array>& input_array,
+              const std::vector<std::map<std::string, std::array<float, 2>>>&
+                  ims_info) {
+             std::vector<vision::MattingResult> results;
+             std::vector<FDTensor> inputs;
+             PyArrayToTensorList(input_array, &inputs, /*share_buffer=*/true);
+             if (!self.Run(inputs, &results, ims_info)) {
+               throw std::runtime_error(
+                   "Failed to postprocess the runtime result in "
+                   "PPMattingPostprocessor.");
+             }
+             return results;
+           });
+
   pybind11::class_<vision::matting::PPMatting, FastDeployModel>(m, "PPMatting")
       .def(pybind11::init<std::string, std::string, std::string, RuntimeOption,
                           ModelFormat>())
@@ -22,8 +75,29 @@ void BindPPMatting(pybind11::module& m) {
            [](vision::matting::PPMatting& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::MattingResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
-           });
+           })
+      .def("batch_predict",
+           [](vision::matting::PPMatting& self,
+              std::vector<pybind11::array>& data) {
+             std::vector<cv::Mat> images;
+             for (size_t i = 0; i < data.size(); ++i) {
+               images.push_back(PyArrayToCvMat(data[i]));
+             }
+             std::vector<vision::MattingResult> results;
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
+             return results;
+           })
+      .def_property_readonly("preprocessor",
+                             &vision::matting::PPMatting::GetPreprocessor)
+      .def_property_readonly("postprocessor",
+                             &vision::matting::PPMatting::GetPostprocessor);
 }
 }  // namespace fastdeploy
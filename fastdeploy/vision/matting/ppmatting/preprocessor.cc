@@ -0,0 +1,143 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/matting/ppmatting/preprocessor.h"
+
+#include "yaml-cpp/yaml.h"
+
+namespace fastdeploy {
+namespace vision {
+namespace matting {
+
+PPMattingPreprocessor::PPMattingPreprocessor(const std::string& config_file) {
+  config_file_ = config_file;
+  FDASSERT(BuildPreprocessPipelineFromConfig(),
+           "Failed to create PPMattingPreprocessor.");
+  initialized_ = true;
+}
+
+bool PPMattingPreprocessor::BuildPreprocessPipelineFromConfig() {
+  processors_.clear();
+  YAML::Node cfg;
+  processors_.push_back(std::make_shared<BGR2RGB>());
+  try {
+    cfg = YAML::LoadFile(config_file_);
+  } catch (YAML::BadFile& e) {
+    FDERROR << "Failed to load yaml file " << config_file_
+            << ", maybe you should check this file." << std::endl;
+    return false;
+  }
+
+  FDASSERT((cfg["Deploy"]["input_shape"]),
+           "The yaml file should include input_shape parameters");
+  // input_shape
+  // b c h w
+  auto input_shape = cfg["Deploy"]["input_shape"].as<std::vector<int>>();
+  FDASSERT(input_shape.size() == 4,
+           "The input_shape in yaml file need to be 4-dimensions, but now its "
+           "dimension is %zu.",
+           input_shape.size());
+
+  is_fixed_input_shape_ = false;
+  if (input_shape[2] > 0 && input_shape[3] > 0) {
+    is_fixed_input_shape_ = true;
+  }
+  if (input_shape[2] < 0 || input_shape[3] < 0) {
+    FDWARNING << "Detected dynamic input shape of your model, only Paddle "
+                 "Inference / OpenVINO support this model now."
+              << std::endl;
+  }
+  if (cfg["Deploy"]["transforms"]) {
+    auto preprocess_cfg = cfg["Deploy"]["transforms"];
+    int long_size = -1;
+    for (const auto& op : preprocess_cfg) {
+      FDASSERT(op.IsMap(),
+               "Require the transform information in yaml be Map type.");
+      if (op["type"].as<std::string>() == "LimitShort") {
+        int max_short = op["max_short"] ? op["max_short"].as<int>() : -1;
+        int min_short = op["min_short"] ? op["min_short"].as<int>() : -1;
+        if (is_fixed_input_shape_) {
+          // if the input shape is fixed, will resize by scale, and the max
+          // shape will not exceed input_shape
+          long_size = max_short;
+          std::vector<int> max_size = {input_shape[2], input_shape[3]};
+          processors_.push_back(
+              std::make_shared<ResizeByShort>(long_size, 1, true, max_size));
+        } else {
+          processors_.push_back(
+              std::make_shared<LimitShort>(max_short, min_short));
+        }
+      } else if (op["type"].as<std::string>() == "ResizeToIntMult") {
+        if (is_fixed_input_shape_) {
+          std::vector<int> max_size = {input_shape[2], input_shape[3]};
+          processors_.push_back(
+              std::make_shared<ResizeByShort>(long_size, 1, true, max_size));
+        } else {
+          int mult_int = op["mult_int"] ? op["mult_int"].as<int>() : 32;
+          processors_.push_back(std::make_shared<LimitByStride>(mult_int));
+        }
+      } else if (op["type"].as<std::string>() == "Normalize") {
+        std::vector<float> mean = {0.5, 0.5, 0.5};
+        std::vector<float> std = {0.5, 0.5, 0.5};
+        if (op["mean"]) {
+          mean = op["mean"].as<std::vector<float>>();
+        }
+        if (op["std"]) {
+          std = op["std"].as<std::vector<float>>();
+        }
+        processors_.push_back(std::make_shared<Normalize>(mean, std));
+      } else if (op["type"].as<std::string>() == "ResizeByShort") {
+        long_size = op["short_size"].as<int>();
+        if (is_fixed_input_shape_) {
+          std::vector<int> max_size = {input_shape[2], input_shape[3]};
+          processors_.push_back(
+              std::make_shared<ResizeByShort>(long_size, 1, true, max_size));
+        } else {
+          processors_.push_back(std::make_shared<ResizeByShort>(long_size));
+        }
+      }
+    }
+  }
+  processors_.push_back(std::make_shared<Cast>("float"));
+  // the default padding value is {127.5,127.5,127.5} so after normalizing,
+  // ((127.5/255)-0.5)/0.5 = 0.0
+  std::vector<float> value = {0.0, 0.0, 0.0};
+  pad_op_ = std::make_shared<PadToSize>(input_shape[3], input_shape[2], value);
+
+  return true;
+}
+
+bool PPMattingPreprocessor::Preprocess(
+    FDMat* mat, std::map<std::string, std::array<float, 2>>* im_info) {
+  for (size_t i = 0; i < processors_.size(); ++i) {
+    if (!(*(processors_[i].get()))(mat)) {
+      FDERROR << "Failed to process image data in " << processors_[i]->Name()
+              << "." << std::endl;
+      return false;
+    }
+  }
+  // Record the shape before padding, the padded area is cropped from the
+  // alpha matte in postprocessing
+  (*im_info)["resized_shape"] = {static_cast<float>(mat->Height()),
+                                 static_cast<float>(mat->Width())};
+  if (!(*pad_op_)(mat)) {
+    FDERROR << "Failed to process image data in " << pad_op_->Name() << "."
+            << std::endl;
+    return false;
+  }
+  return HWC2CHW::Run(mat, mat->proc_lib);
+}
+
+}  // namespace matting
+}  // namespace vision
+}  // namespace fastdeploy
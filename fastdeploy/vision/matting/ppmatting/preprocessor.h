@@ -0,0 +1,48 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include "fastdeploy/vision/common/processors/per_image_preprocessor.h"
+#include "fastdeploy/vision/common/processors/transform.h"
+#include "fastdeploy/vision/common/result.h"
+
+namespace fastdeploy {
+namespace vision {
+namespace matting {
+/*! @brief Preprocessor object for PPMatting serials model, the shape before padding is recorded as resized_shape in ims_info besides input_shape and output_shape.
+ */
+class FASTDEPLOY_DECL PPMattingPreprocessor : public PerImagePreprocessor {
+ public:
+  /** \brief Create a preprocessor instance for PPMatting serials model
+   *
+   * \param[in] config_file Path of configuration file for deployment, e.g PPMatting-512/deploy.yml
+   */
+  explicit PPMattingPreprocessor(const std::string& config_file);
+
+ protected:
+  bool BuildPreprocessPipelineFromConfig();
+
+  virtual bool Preprocess(FDMat* mat,
+                          std::map<std::string, std::array<float, 2>>* im_info);
+
+  // the processors before padding, which are built from the config file
+  std::vector<std::shared_ptr<Processor>> processors_;
+  std::shared_ptr<PadToSize> pad_op_;
+  std::string config_file_;
+  bool is_fixed_input_shape_ = false;
+  bool initialized_ = false;
+};
+
+}  // namespace matting
+}  // namespace vision
+}  // namespace fastdeploy
@@ -13,60 +13,106 @@
 // limitations under the License.
 
 #include "fastdeploy/vision/ocr/ppocr/det_postprocessor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "fastdeploy/utils/parallel.h"
 #include "fastdeploy/utils/perf.h"
 #include "fastdeploy/vision/ocr/ppocr/utils/ocr_utils.h"
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace fastdeploy {
 namespace vision {
 namespace ocr {
 
+namespace {
+
+// Set bits[x] to 255 if src[x] * 255 >= thresh, otherwise 0
+void ThresholdRow(const float* src, int width, float thresh, uint8_t* bits) {
+  int x = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+  const __m128 vscale = _mm_set1_ps(255.0f);
+  const __m128 vthresh = _mm_set1_ps(thresh);
+  for (; x + 16 <= width; x += 16) {
+    __m128i m0 = _mm_castps_si128(_mm_cmpge_ps(
+        _mm_mul_ps(_mm_loadu_ps(src + x), vscale), vthresh));
+    __m128i m1 = _mm_castps_si128(_mm_cmpge_ps(
+        _mm_mul_ps(_mm_loadu_ps(src + x + 4), vscale), vthresh));
+    __m128i m2 = _mm_castps_si128(_mm_cmpge_ps(
+        _mm_mul_ps(_mm_loadu_ps(src + x + 8), vscale), vthresh));
+    __m128i m3 = _mm_castps_si128(_mm_cmpge_ps(
+        _mm_mul_ps(_mm_loadu_ps(src + x + 12), vscale), vthresh));
+    // The masks of -1 and 0 are kept by the signed saturation
+    __m128i m = _mm_packs_epi16(_mm_packs_epi32(m0, m1),
+                                _mm_packs_epi32(m2, m3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bits + x), m);
+  }
+#elif defined(__ARM_NEON)
+  const float32x4_t vscale = vdupq_n_f32(255.0f);
+  const float32x4_t vthresh = vdupq_n_f32(thresh);
+  for (; x + 8 <= width; x += 8) {
+    uint32x4_t m0 =
+        vcgeq_f32(vmulq_f32(vld1q_f32(src + x), vscale), vthresh);
+    uint32x4_t m1 =
+        vcgeq_f32(vmulq_f32(vld1q_f32(src + x + 4), vscale), vthresh);
+    uint16x8_t m = vcombine_u16(vmovn_u32(m0), vmovn_u32(m1));
+    vst1_u8(bits + x, vmovn_u16(m));
+  }
+#endif
+  for (; x < width; ++x) {
+    bits[x] = src[x] * 255.0f >= thresh ? 255 : 0;
+  }
+}
+
+}  // namespace
+
 bool DBDetectorPostprocessor::SingleBatchPostprocessor(
     const float* out_data, int n2, int n3,
     const std::array<int, 4>& det_img_info,
-    std::vector<std::array<int, 8>>* boxes_result) {
-  int n = n2 * n3;
+    std::vector<std::array<int, 8>>* boxes_result,
+    std::vector<uint8_t>* bitmap, std::vector<double>* row_sums) {
+  bitmap->resize(static_cast<size_t>(n2) * n3);
+  row_sums->resize(static_cast<size_t>(n2) * (n3 + 1));
 
-  // prepare bitmap
-  std::vector<float> pred(n, 0.0);
-  std::vector<unsigned char> cbuf(n, ' ');
+  // Threshold the probability map to bitmap, which is the same as
+  // thresholding the uint8 map `prob * 255` by `det_db_thresh * 255`, and
+  // compute the row prefix sums for the box scores at the same time
+  const float bit_thresh = std::floor(det_db_thresh_ * 255) + 1;
+  utils::ParallelFor(
+      n2,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t y = begin; y < end; ++y) {
+          const float* src = out_data + y * n3;
+          ThresholdRow(src, n3, bit_thresh, bitmap->data() + y * n3);
+          double* sums = row_sums->data() + y * (n3 + 1);
+          double acc = 0.0;
+          sums[0] = 0.0;
+          for (int x = 0; x < n3; ++x) {
+            acc += src[x];
+            sums[x + 1] = acc;
+          }
+        }
+      },
+      std::max(1, 65536 / std::max(n3, 1)));
 
-  for (int i = 0; i < n; i++) {
-    pred[i] = float(out_data[i]);
-    cbuf[i] = (unsigned char)((out_data[i]) * 255);
-  }
-  cv::Mat cbuf_map(n2, n3, CV_8UC1, (unsigned char*)cbuf.data());
-  cv::Mat pred_map(n2, n3, CV_32F, (float*)pred.data());
-
-  const double threshold = det_db_thresh_ * 255;
-  const double maxvalue = 255;
-  cv::Mat bit_map;
-  cv::threshold(cbuf_map, bit_map, threshold, maxvalue, cv::THRESH_BINARY);
+  cv::Mat bit_map(n2, n3, CV_8UC1, bitmap->data());
   if (use_dilation_) {
     cv::Mat dila_ele =
         cv::getStructuringElement(cv::MORPH_RECT, cv::Size(2, 2));
     cv::dilate(bit_map, bit_map, dila_ele);
   }
 
-  std::vector<std::vector<std::vector<int>>> boxes;
-
-  boxes = util_post_processor_.BoxesFromBitmap(
-      pred_map, bit_map, det_db_box_thresh_, det_db_unclip_ratio_,
-      det_db_score_mode_);
-
-  boxes = util_post_processor_.FilterTagDetRes(boxes, det_img_info);
-
-  // boxes to boxes_result
-  for (int i = 0; i < boxes.size(); i++) {
-    std::array<int, 8> new_box;
-    int k = 0;
-    for (auto& vec : boxes[i]) {
-      for (auto& e : vec) {
-        new_box[k++] = e;
-      }
-    }
-    boxes_result->emplace_back(new_box);
-  }
-
+  util_post_processor_.BoxesFromBitmap(row_sums->data(), bit_map,
+                                       det_db_box_thresh_,
+                                       det_db_unclip_ratio_,
+                                       det_db_score_mode_, boxes_result);
+  util_post_processor_.FilterTagDetRes(det_img_info, boxes_result);
   return true;
 }
 
@@ -84,12 +130,22 @@ bool DBDetectorPostprocessor::Run(
   const float* tensor_data = reinterpret_cast<const float*>(tensor.Data());
 
   results->resize(batch);
-  for (int i_batch = 0; i_batch < batch; ++i_batch) {
-    SingleBatchPostprocessor(tensor_data, tensor.shape[2], tensor.shape[3],
-                             batch_det_img_info[i_batch],
-                             &results->at(i_batch));
-    tensor_data = tensor_data + length;
+  if (bitmap_buffers_.size() < batch) {
+    bitmap_buffers_.resize(batch);
+    row_sum_buffers_.resize(batch);
   }
+  // The batch items are processed in parallel, the rows of each item are
+  // processed in parallel while there's only one item
+  utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t i_batch = begin; i_batch < end; ++i_batch) {
+      SingleBatchPostprocessor(tensor_data + i_batch * length,
+                               tensor.shape[2], tensor.shape[3],
+                               batch_det_img_info[i_batch],
+                               &results->at(i_batch),
+                               &bitmap_buffers_[i_batch],
+                               &row_sum_buffers_[i_batch]);
+    }
+  });
   return true;
 }
 
@@ -75,9 +75,15 @@ class FASTDEPLOY_DECL DBDetectorPostprocessor {
   std::string det_db_score_mode_ = "slow";
   bool use_dilation_ = false;
   PostProcessor util_post_processor_;
+  // The bitmap and row prefix sums of probability map for each batch item,
+  // which are reused between calls
+  std::vector<std::vector<uint8_t>> bitmap_buffers_;
+  std::vector<std::vector<double>> row_sum_buffers_;
   bool SingleBatchPostprocessor(const float* out_data, int n2, int n3,
                                 const std::array<int, 4>& det_img_info,
-                                std::vector<std::array<int, 8>>* boxes_result);
+                                std::vector<std::array<int, 8>>* boxes_result,
+                                std::vector<uint8_t>* bitmap,
+                                std::vector<double>* row_sums);
 };
 
 }  // namespace ocr
@@ -118,7 +118,10 @@ void BindPPOCRModel(pybind11::module& m) {
            [](vision::ocr::DBDetector& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult ocr_result;
-             self.Predict(mat, &ocr_result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &ocr_result);
+             }
              return ocr_result;
            })
       .def("batch_predict", [](vision::ocr::DBDetector& self,
@@ -128,7 +131,10 @@ void BindPPOCRModel(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::OCRResult> ocr_results;
-        self.BatchPredict(images, &ocr_results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &ocr_results);
+        }
         return ocr_results;
       });
 
@@ -213,7 +219,10 @@ void BindPPOCRModel(pybind11::module& m) {
            [](vision::ocr::Classifier& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult ocr_result;
-             self.Predict(mat, &ocr_result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &ocr_result);
+             }
              return ocr_result;
            })
       .def("batch_predict", [](vision::ocr::Classifier& self,
@@ -223,7 +232,10 @@ void BindPPOCRModel(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         vision::OCRResult ocr_result;
-        self.BatchPredict(images, &ocr_result);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &ocr_result);
+        }
         return ocr_result;
       });
 
@@ -237,6 +249,13 @@ void BindPPOCRModel(pybind11::module& m) {
       .def_property("rec_image_shape",
                     &vision::ocr::RecognizerPreprocessor::GetRecImageShape,
                     &vision::ocr::RecognizerPreprocessor::SetRecImageShape)
+      .def_property("width_buckets",
+                    &vision::ocr::RecognizerPreprocessor::GetWidthBuckets,
+                    &vision::ocr::RecognizerPreprocessor::SetWidthBuckets)
+      .def("get_padding_waste_ratio",
+           &vision::ocr::RecognizerPreprocessor::GetPaddingWasteRatio)
+      .def("reset_padding_statistics",
+           &vision::ocr::RecognizerPreprocessor::ResetPaddingStatistics)
       .def("set_normalize",
            [](vision::ocr::RecognizerPreprocessor& self,
               const std::vector<float>& mean, const std::vector<float>& std,
@@ -309,7 +328,10 @@ void BindPPOCRModel(pybind11::module& m) {
            [](vision::ocr::Recognizer& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult ocr_result;
-             self.Predict(mat, &ocr_result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &ocr_result);
+             }
              return ocr_result;
            })
       .def("batch_predict", [](vision::ocr::Recognizer& self,
@@ -319,7 +341,10 @@ void BindPPOCRModel(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         vision::OCRResult ocr_result;
-        self.BatchPredict(images, &ocr_result);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &ocr_result);
+        }
         return ocr_result;
       });
 
@@ -399,7 +424,10 @@ void BindPPOCRModel(pybind11::module& m) {
            [](vision::ocr::StructureV2Table& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult ocr_result;
-             self.Predict(mat, &ocr_result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &ocr_result);
+             }
              return ocr_result;
            })
       .def("batch_predict", [](vision::ocr::StructureV2Table& self,
@@ -410,7 +438,10 @@ void BindPPOCRModel(pybind11::module& m) {
         }
 
         std::vector<vision::OCRResult> ocr_results;
-        self.BatchPredict(images, &ocr_results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &ocr_results);
+        }
         return ocr_results;
       });
 
@@ -509,7 +540,10 @@ void BindPPOCRModel(pybind11::module& m) {
            [](vision::ocr::StructureV2Layout& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::DetectionResult result;
-             self.Predict(mat, &result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &result);
+             }
              return result;
            })
       .def("batch_predict", [](vision::ocr::StructureV2Layout& self,
@@ -519,7 +553,10 @@ void BindPPOCRModel(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::DetectionResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       });
 
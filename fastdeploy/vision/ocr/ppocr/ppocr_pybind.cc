@@ -34,7 +34,10 @@ void BindPPOCRv4(pybind11::module& m) {
            [](pipeline::PPOCRv4& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -44,7 +47,10 @@ void BindPPOCRv4(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::OCRResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            });
 }
@@ -66,7 +72,10 @@ void BindPPOCRv3(pybind11::module& m) {
            [](pipeline::PPOCRv3& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -76,7 +85,10 @@ void BindPPOCRv3(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::OCRResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            });
 }
@@ -98,7 +110,10 @@ void BindPPOCRv2(pybind11::module& m) {
            [](pipeline::PPOCRv2& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -108,7 +123,10 @@ void BindPPOCRv2(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::OCRResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            });
 }
@@ -129,7 +147,10 @@ void BindPPStructureV2Table(pybind11::module& m) {
            [](pipeline::PPStructureV2Table& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::OCRResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
       .def("batch_predict", [](pipeline::PPStructureV2Table& self,
@@ -139,7 +160,10 @@ void BindPPStructureV2Table(pybind11::module& m) {
           images.push_back(PyArrayToCvMat(data[i]));
         }
         std::vector<vision::OCRResult> results;
-        self.BatchPredict(images, &results);
+        {
+          pybind11::gil_scoped_release release;
+          self.BatchPredict(images, &results);
+        }
         return results;
       });
 }
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include "fastdeploy/vision/ocr/ppocr/ppocr_v2.h"
+
+#include <iterator>
+
 #include "fastdeploy/utils/perf.h"
 #include "fastdeploy/vision/ocr/ppocr/utils/ocr_utils.h"
 
@@ -121,55 +124,77 @@ bool PPOCRv2::BatchPredict(const std::vector<cv::Mat>& images,
     (*batch_result)[i_batch].boxes = batch_boxes[i_batch];
   }
   
+  // Pool the croped images of all the input images, so the classifier and
+  // recognizer run with full batches even there're few boxes in each image.
+  // The croped images of the i-th input image are in
+  // [image_offsets[i], image_offsets[i + 1]) of image_list
+  std::vector<cv::Mat> image_list;
+  std::vector<size_t> image_offsets(images.size() + 1, 0);
   for(int i_batch = 0; i_batch < images.size(); ++i_batch) {
-    fastdeploy::vision::OCRResult& ocr_result = (*batch_result)[i_batch];
     // Get croped images by detection result
-    const std::vector<std::array<int, 8>>& boxes = ocr_result.boxes;
+    const std::vector<std::array<int, 8>>& boxes = (*batch_result)[i_batch].boxes;
     const cv::Mat& img = images[i_batch];
-    std::vector<cv::Mat> image_list;
     if (boxes.size() == 0) {
       image_list.emplace_back(img);
     }else{
-      image_list.resize(boxes.size());
       for (size_t i_box = 0; i_box < boxes.size(); ++i_box) {
-        image_list[i_box] = vision::ocr::GetRotateCropImage(img, boxes[i_box]);
+        image_list.emplace_back(vision::ocr::GetRotateCropImage(img, boxes[i_box]));
       }
     }
-    std::vector<int32_t>* cls_labels_ptr = &ocr_result.cls_labels;
-    std::vector<float>* cls_scores_ptr = &ocr_result.cls_scores;
+    image_offsets[i_batch + 1] = image_list.size();
+  }
 
-    std::vector<std::string>* text_ptr = &ocr_result.text;
-    std::vector<float>* rec_scores_ptr = &ocr_result.rec_scores;
+  std::vector<int32_t> cls_labels;
+  std::vector<float> cls_scores;
+  std::vector<std::string> texts;
+  std::vector<float> rec_scores;
 
-    if (nullptr != classifier_) {
-      for(size_t start_index = 0; start_index < image_list.size(); start_index+=cls_batch_size_) {
-        size_t end_index = std::min(start_index + cls_batch_size_, image_list.size());
-        if (!classifier_->BatchPredict(image_list, cls_labels_ptr, cls_scores_ptr, start_index, end_index)) {
-          FDERROR << "There's error while recognizing image in PPOCR." << std::endl;
-          return false;
-        }else{
-          for (size_t i_img = start_index; i_img < end_index; ++i_img) {
-            if(cls_labels_ptr->at(i_img) % 2 == 1 && cls_scores_ptr->at(i_img) > classifier_->GetPostprocessor().GetClsThresh()) {
-              cv::rotate(image_list[i_img], image_list[i_img], 1);
-            }
+  if (nullptr != classifier_) {
+    size_t cls_batch_size = cls_batch_size_ == -1 ? image_list.size() : cls_batch_size_;
+    for(size_t start_index = 0; start_index < image_list.size(); start_index+=cls_batch_size) {
+      size_t end_index = std::min(start_index + cls_batch_size, image_list.size());
+      if (!classifier_->BatchPredict(image_list, &cls_labels, &cls_scores, start_index, end_index)) {
+        FDERROR << "There's error while recognizing image in PPOCR." << std::endl;
+        return false;
+      }else{
+        for (size_t i_img = start_index; i_img < end_index; ++i_img) {
+          if(cls_labels.at(i_img) % 2 == 1 && cls_scores.at(i_img) > classifier_->GetPostprocessor().GetClsThresh()) {
+            cv::rotate(image_list[i_img], image_list[i_img], 1);
           }
         }
       }
     }
+  }
 
-    std::vector<float> width_list;
-    for (int i = 0; i < image_list.size(); i++) {
-      width_list.push_back(float(image_list[i].cols) / image_list[i].rows);
+  // Sort all the croped images by aspect ratio, so the images in one batch
+  // have similar widths and less padding
+  std::vector<float> width_list;
+  for (int i = 0; i < image_list.size(); i++) {
+    width_list.push_back(float(image_list[i].cols) / image_list[i].rows);
+  }
+  std::vector<int> indices = vision::ocr::ArgSort(width_list);
+
+  size_t rec_batch_size = rec_batch_size_ == -1 ? image_list.size() : rec_batch_size_;
+  for(size_t start_index = 0; start_index < image_list.size(); start_index+=rec_batch_size) {
+    size_t end_index = std::min(start_index + rec_batch_size, image_list.size());
+    if (!recognizer_->BatchPredict(image_list, &texts, &rec_scores, start_index, end_index, indices)) {
+      FDERROR << "There's error while recognizing image in PPOCR." << std::endl;
+      return false;
     }
-    std::vector<int> indices = vision::ocr::ArgSort(width_list);
+  }
 
-    for(size_t start_index = 0; start_index < image_list.size(); start_index+=rec_batch_size_) {
-      size_t end_index = std::min(start_index + rec_batch_size_, image_list.size());
-      if (!recognizer_->BatchPredict(image_list, text_ptr, rec_scores_ptr, start_index, end_index, indices)) {
-        FDERROR << "There's error while recognizing image in PPOCR." << std::endl;
-        return false;
-      }
+  // Scatter the results back to each input image
+  for(int i_batch = 0; i_batch < images.size(); ++i_batch) {
+    fastdeploy::vision::OCRResult& ocr_result = (*batch_result)[i_batch];
+    size_t begin = image_offsets[i_batch];
+    size_t end = image_offsets[i_batch + 1];
+    if (nullptr != classifier_) {
+      ocr_result.cls_labels.assign(cls_labels.begin() + begin, cls_labels.begin() + end);
+      ocr_result.cls_scores.assign(cls_scores.begin() + begin, cls_scores.begin() + end);
     }
+    ocr_result.text.assign(std::make_move_iterator(texts.begin() + begin),
+                           std::make_move_iterator(texts.begin() + end));
+    ocr_result.rec_scores.assign(rec_scores.begin() + begin, rec_scores.begin() + end);
   }
   return true;
 }
@@ -13,9 +13,15 @@
 // limitations under the License.
 
 #include "fastdeploy/vision/ocr/ppocr/rec_postprocessor.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "fastdeploy/utils/parallel.h"
 #include "fastdeploy/utils/perf.h"
 #include "fastdeploy/vision/ocr/ppocr/utils/ocr_utils.h"
 #include "fastdeploy/utils/utils.h"
+#include "fastdeploy/vision/utils/utils.h"
 
 namespace fastdeploy {
 namespace vision {
@@ -44,6 +50,9 @@ RecognizerPostprocessor::RecognizerPostprocessor(){
 RecognizerPostprocessor::RecognizerPostprocessor(const std::string& label_path) {
   // init label_lsit
   label_list_ = ReadDict(label_path);
+  for (const auto& label : label_list_) {
+    max_label_bytes_ = std::max(max_label_bytes_, label.size());
+  }
   initialized_ = true;
 }
 
@@ -57,20 +66,19 @@ bool RecognizerPostprocessor::SingleBatchPostprocessor(const float* out_data,
   int last_index = 0;
   int count = 0;
   float max_value = 0.0f;
+  const int seq_len = static_cast<int>(output_shape[1]);
+  const int num_classes = static_cast<int>(output_shape[2]);
+  str_res.clear();
+  str_res.reserve(seq_len * max_label_bytes_);
 
-  for (int n = 0; n < output_shape[1]; n++) {
-    argmax_idx = int(
-        std::distance(&out_data[n * output_shape[2]],
-                      std::max_element(&out_data[n * output_shape[2]],
-                                       &out_data[(n + 1) * output_shape[2]])));
-
-    max_value = float(*std::max_element(&out_data[n * output_shape[2]],
-                                        &out_data[(n + 1) * output_shape[2]]));
+  for (int n = 0; n < seq_len; n++) {
+    argmax_idx = utils::ArgMaxWithValue(out_data + n * num_classes,
+                                        num_classes, &max_value);
 
     if (argmax_idx > 0 && (!(n > 0 && argmax_idx == last_index))) {
       score += max_value;
       count += 1;
-      if(argmax_idx > label_list_.size()) {
+      if (argmax_idx >= static_cast<int>(label_list_.size())) {
         FDERROR << "The output index: " << argmax_idx << " is larger than the size of label_list: "
         << label_list_.size() << ". Please check the label file!" << std::endl;
         return false; 
@@ -124,17 +132,25 @@ bool RecognizerPostprocessor::Run(const std::vector<FDTensor>& tensors,
   rec_scores->resize(total_size);
   
   const float* tensor_data = reinterpret_cast<const float*>(tensor.Data());
-  for (int i_batch = 0; i_batch < batch; ++i_batch) {
-    size_t real_index = i_batch+start_index;
-    if (indices.size() != 0) {
-      real_index = indices[i_batch+start_index];
-    }
-    if(!SingleBatchPostprocessor(tensor_data + i_batch * length,
-                                 tensor.shape,
-                                 &texts->at(real_index),
-                                 &rec_scores->at(real_index))) {
-      return false;
+  // The batch items write to the different results, so they are decoded
+  // in parallel
+  std::atomic<bool> success(true);
+  fastdeploy::utils::ParallelFor(batch, [&](int64_t begin, int64_t end) {
+    for (int64_t i_batch = begin; i_batch < end; ++i_batch) {
+      size_t real_index = i_batch + start_index;
+      if (indices.size() != 0) {
+        real_index = indices[i_batch + start_index];
+      }
+      if (!SingleBatchPostprocessor(tensor_data + i_batch * length,
+                                    tensor.shape,
+                                    &texts->at(real_index),
+                                    &rec_scores->at(real_index))) {
+        success = false;
+      }
     }
+  });
+  if (!success) {
+    return false;
   }
 
   return true;
@@ -53,6 +53,8 @@ class FASTDEPLOY_DECL RecognizerPostprocessor {
                               std::string* text, float* rec_score);
   bool initialized_ = false;
   std::vector<std::string> label_list_;
+  // The max length of labels in bytes, to reserve the output text
+  size_t max_label_bytes_ = 0;
 };
 
 }  // namespace ocr
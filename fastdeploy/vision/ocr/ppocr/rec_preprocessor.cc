@@ -14,6 +14,8 @@
 
 #include "fastdeploy/vision/ocr/ppocr/rec_preprocessor.h"
 
+#include <algorithm>
+
 #include "fastdeploy/function/concat.h"
 #include "fastdeploy/utils/perf.h"
 #include "fastdeploy/vision/ocr/ppocr/utils/ocr_utils.h"
@@ -37,15 +39,51 @@ RecognizerPreprocessor::RecognizerPreprocessor() {
   cast_op_ = std::make_shared<Cast>("float");
 }
 
+void RecognizerPreprocessor::SetWidthBuckets(
+    const std::vector<int>& width_buckets) {
+  width_buckets_ = width_buckets;
+  std::sort(width_buckets_.begin(), width_buckets_.end());
+  bucket_caches_.clear();
+  overflow_cache_ = FDTensor();
+}
+
+int RecognizerPreprocessor::BucketWidth(int width) const {
+  auto iter =
+      std::lower_bound(width_buckets_.begin(), width_buckets_.end(), width);
+  if (iter == width_buckets_.end()) {
+    return width;
+  }
+  return *iter;
+}
+
+int RecognizerPreprocessor::GetPaddedWidth(int width, int height) const {
+  int img_h = rec_image_shape_[1];
+  int img_w = rec_image_shape_[2];
+  if (static_shape_infer_) {
+    return img_w;
+  }
+  float max_wh_ratio = std::max(img_w * 1.0f / img_h, width * 1.0f / height);
+  return BucketWidth(int(img_h * max_wh_ratio));
+}
+
+float RecognizerPreprocessor::GetPaddingWasteRatio() const {
+  int64_t total_columns = valid_columns_ + padded_columns_;
+  if (total_columns == 0) {
+    return 0.0f;
+  }
+  return static_cast<float>(padded_columns_) / total_columns;
+}
+
 void RecognizerPreprocessor::OcrRecognizerResizeImage(
-    FDMat* mat, float max_wh_ratio, const std::vector<int>& rec_image_shape,
+    FDMat* mat, int padded_width, const std::vector<int>& rec_image_shape,
     bool static_shape_infer) {
   int img_h, img_w;
   img_h = rec_image_shape[1];
   img_w = rec_image_shape[2];
+  int valid_width = img_w;
 
   if (!static_shape_infer) {
-    img_w = int(img_h * max_wh_ratio);
+    img_w = padded_width;
     float ratio = float(mat->Width()) / float(mat->Height());
 
     int resize_w;
@@ -56,6 +94,7 @@ void RecognizerPreprocessor::OcrRecognizerResizeImage(
     }
     resize_op_->SetWidthAndHeight(resize_w, img_h);
     (*resize_op_)(mat);
+    valid_width = resize_w;
     pad_op_->SetPaddingSize(0, 0, 0, int(img_w - mat->Width()));
     (*pad_op_)(mat);
   } else {
@@ -63,14 +102,18 @@ void RecognizerPreprocessor::OcrRecognizerResizeImage(
       // Reszie W to 320
       resize_op_->SetWidthAndHeight(img_w, img_h);
       (*resize_op_)(mat);
+      valid_width = img_w;
     } else {
       resize_op_->SetWidthAndHeight(mat->Width(), img_h);
       (*resize_op_)(mat);
+      valid_width = mat->Width();
       // Pad to 320
       pad_op_->SetPaddingSize(0, 0, 0, int(img_w - mat->Width()));
       (*pad_op_)(mat);
     }
   }
+  valid_columns_ += valid_width;
+  padded_columns_ += img_w - valid_width;
 }
 
 bool RecognizerPreprocessor::Run(std::vector<FDMat>* images,
@@ -109,9 +152,24 @@ bool RecognizerPreprocessor::Apply(FDMatBatch* image_batch,
     max_wh_ratio = std::max(max_wh_ratio, ori_wh_ratio);
   }
 
+  int padded_width = int(img_h * max_wh_ratio);
+  if (!width_buckets_.empty() && !static_shape_infer_) {
+    padded_width = BucketWidth(padded_width);
+    // Reuse the batched tensor of this bucket, which has the same width for
+    // all the batches. The widths above the largest bucket share one tensor,
+    // otherwise every distinct width would keep its own tensor
+    if (!CudaUsed()) {
+      if (padded_width > width_buckets_.back()) {
+        image_batch->input_cache = &overflow_cache_;
+      } else {
+        image_batch->input_cache = &bucket_caches_[padded_width];
+      }
+    }
+  }
+
   for (size_t i = 0; i < image_batch->mats->size(); ++i) {
     FDMat* mat = &(image_batch->mats->at(i));
-    OcrRecognizerResizeImage(mat, max_wh_ratio, rec_image_shape_,
+    OcrRecognizerResizeImage(mat, padded_width, rec_image_shape_,
                              static_shape_infer_);
   }
 
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #pragma once
+#include <map>
+
 #include "fastdeploy/vision/common/processors/transform.h"
 #include "fastdeploy/vision/common/processors/manager.h"
 #include "fastdeploy/vision/common/result.h"
@@ -79,16 +81,50 @@ class FASTDEPLOY_DECL RecognizerPreprocessor : public ProcessorManager {
   /// This function will disable hwc2chw in preprocessing step.
   void DisablePermute() { disable_normalize_ = true; }
 
+  /** \brief Set the width buckets of the recognition preprocess, e.g {320, 640, 960, 1280}. The images in a batch will be padded to the smallest bucket not less than their widths after resize, instead of the width of the longest image, and the images wider than the largest bucket are padded to their own widths. Recognizer::BatchPredict() will run the images of different buckets in different batches, so a long text line won't enlarge the whole batch. It doesn't work while static_shape_infer is true
+   *
+   * \param[in] width_buckets The widths of buckets, empty means to disable bucketing, which is the default
+   */
+  void SetWidthBuckets(const std::vector<int>& width_buckets);
+  /// Get the width buckets of the recognition preprocess
+  std::vector<int> GetWidthBuckets() const { return width_buckets_; }
+
+  /** \brief Get the width of an input image after resize and padding in the preprocess, the image is not in a batch with wider images
+   *
+   * \param[in] width The width of input image
+   * \param[in] height The height of input image
+   * \return The width in the input tensor, i.e the width of bucket while the width buckets are set
+   */
+  int GetPaddedWidth(int width, int height) const;
+
+  /// Get the ratio of the padded pixels in all the preprocessed images since created or ResetPaddingStatistics() called, which indicates the computation wasted on padding by recognizer
+  float GetPaddingWasteRatio() const;
+  /// Reset the statistics of padding
+  void ResetPaddingStatistics() {
+    valid_columns_ = 0;
+    padded_columns_ = 0;
+  }
+
  private:
-  void OcrRecognizerResizeImage(FDMat* mat, float max_wh_ratio,
+  void OcrRecognizerResizeImage(FDMat* mat, int padded_width,
                               const std::vector<int>& rec_image_shape,
                               bool static_shape_infer);
+  int BucketWidth(int width) const;
   // for recording the switch of hwc2chw
   bool disable_permute_ = false;
   // for recording the switch of normalize
   bool disable_normalize_ = false;
   std::vector<int> rec_image_shape_ = {3, 48, 320};
   bool static_shape_infer_ = false;
+  std::vector<int> width_buckets_;
+  // The batched input tensors of each width bucket, which are reused by the
+  // batches of the same bucket
+  std::map<int, FDTensor> bucket_caches_;
+  // The batched input tensor of the batches wider than the largest bucket
+  FDTensor overflow_cache_;
+  // Columns of the images and the padding in the preprocessed images
+  int64_t valid_columns_ = 0;
+  int64_t padded_columns_ = 0;
   std::shared_ptr<Resize> resize_op_;
   std::shared_ptr<Pad> pad_op_;
   std::shared_ptr<NormalizeAndPermute> normalize_permute_op_;
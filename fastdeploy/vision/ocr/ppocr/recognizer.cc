@@ -14,6 +14,9 @@
 
 #include "fastdeploy/vision/ocr/ppocr/recognizer.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "fastdeploy/utils/perf.h"
 #include "fastdeploy/vision/ocr/ppocr/utils/ocr_utils.h"
 
@@ -108,6 +111,48 @@ bool Recognizer::BatchPredict(const std::vector<cv::Mat>& images,
     FDERROR << "indices.size() should be 0 or images.size()." << std::endl;
     return false;
   }
+  if (preprocessor_.GetWidthBuckets().empty() ||
+      preprocessor_.GetStaticShapeInfer() || end_index > total_size ||
+      end_index <= start_index) {
+    return BatchPredictOnce(images, texts, rec_scores, start_index, end_index,
+                            indices);
+  }
+
+  // Group the images by their width buckets, each group runs as a batch
+  std::vector<int> bucket_indices(indices);
+  if (bucket_indices.empty()) {
+    bucket_indices.resize(total_size);
+    std::iota(bucket_indices.begin(), bucket_indices.end(), 0);
+  }
+  std::vector<int> widths(total_size, 0);
+  for (size_t i = start_index; i < end_index; ++i) {
+    int index = bucket_indices[i];
+    widths[index] =
+        preprocessor_.GetPaddedWidth(images[index].cols, images[index].rows);
+  }
+  std::stable_sort(bucket_indices.begin() + start_index,
+                   bucket_indices.begin() + end_index,
+                   [&widths](int a, int b) { return widths[a] < widths[b]; });
+  size_t group_start = start_index;
+  for (size_t i = start_index + 1; i <= end_index; ++i) {
+    if (i == end_index ||
+        widths[bucket_indices[i]] != widths[bucket_indices[group_start]]) {
+      if (!BatchPredictOnce(images, texts, rec_scores, group_start, i,
+                            bucket_indices)) {
+        return false;
+      }
+      group_start = i;
+    }
+  }
+  return true;
+}
+
+bool Recognizer::BatchPredictOnce(const std::vector<cv::Mat>& images,
+                                  std::vector<std::string>* texts,
+                                  std::vector<float>* rec_scores,
+                                  size_t start_index, size_t end_index,
+                                  const std::vector<int>& indices) {
+  size_t total_size = images.size();
   std::vector<FDMat> fd_images = WrapMat(images);
   if (!preprocessor_.Run(&fd_images, &reused_input_tensors_, start_index,
                          end_index, indices)) {
@@ -90,6 +90,16 @@ class FASTDEPLOY_DECL Recognizer : public FastDeployModel {
   virtual bool BatchPredict(const std::vector<cv::Mat>& images,
                std::vector<std::string>* texts, std::vector<float>* rec_scores);
 
+  /** \brief BatchPredict the images in [start_index, end_index) and get OCR recognition model result. If the width buckets of preprocessor are set, the images of different buckets are predicted in different batches.
+   *
+   * \param[in] images The list of input image data, comes from cv::imread(), is a 3-D array with layout HWC, BGR format.
+   * \param[in] texts The list of text results of rec model will be written into this vector.
+   * \param[in] rec_scores The list of sccore result of rec model will be written into this vector.
+   * \param[in] start_index The start index of the images to predict
+   * \param[in] end_index The end index of the images to predict
+   * \param[in] indices The i-th image to predict is images[indices[i]], empty means images[i]
+   * \return true if the prediction is successed, otherwise false.
+   */
   virtual bool BatchPredict(const std::vector<cv::Mat>& images,
                std::vector<std::string>* texts, std::vector<float>* rec_scores,
                size_t start_index, size_t end_index,
@@ -107,6 +117,10 @@ class FASTDEPLOY_DECL Recognizer : public FastDeployModel {
 
  private:
   bool Initialize();
+  bool BatchPredictOnce(const std::vector<cv::Mat>& images,
+                        std::vector<std::string>* texts,
+                        std::vector<float>* rec_scores, size_t start_index,
+                        size_t end_index, const std::vector<int>& indices);
   RecognizerPreprocessor preprocessor_;
   RecognizerPostprocessor postprocessor_;
 };
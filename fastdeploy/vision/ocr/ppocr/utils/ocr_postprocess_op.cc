@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "ocr_postprocess_op.h"
+#include <algorithm>
 #include <map>
 #include "clipper.h"
 
@@ -20,231 +21,196 @@ namespace fastdeploy {
 namespace vision {
 namespace ocr {
 
-void PostProcessor::GetContourArea(const std::vector<std::vector<float>> &box,
-                                   float unclip_ratio, float &distance) {
-  int pts_num = 4;
+void PostProcessor::GetMiniBoxes(const cv::RotatedRect &box,
+                                 std::array<cv::Point2f, 4> *points,
+                                 float *ssid) {
+  *ssid = std::max(box.size.width, box.size.height);
+
+  cv::Point2f pts[4];
+  box.points(pts);
+  // Keep the order of the points with the same x as GetMiniBoxes above
+  std::stable_sort(pts, pts + 4, [](const cv::Point2f &a, const cv::Point2f &b) {
+    return a.x < b.x;
+  });
+
+  bool left_swap = pts[1].y <= pts[0].y;
+  bool right_swap = pts[3].y <= pts[2].y;
+  (*points)[0] = left_swap ? pts[1] : pts[0];
+  (*points)[1] = right_swap ? pts[3] : pts[2];
+  (*points)[2] = right_swap ? pts[2] : pts[3];
+  (*points)[3] = left_swap ? pts[0] : pts[1];
+}
+
+cv::RotatedRect PostProcessor::UnClip(const std::array<cv::Point2f, 4> &box,
+                                      float unclip_ratio) {
   float area = 0.0f;
   float dist = 0.0f;
-  for (int i = 0; i < pts_num; i++) {
-    area += box[i][0] * box[(i + 1) % pts_num][1] -
-            box[i][1] * box[(i + 1) % pts_num][0];
-    dist += sqrtf((box[i][0] - box[(i + 1) % pts_num][0]) *
-                      (box[i][0] - box[(i + 1) % pts_num][0]) +
-                  (box[i][1] - box[(i + 1) % pts_num][1]) *
-                      (box[i][1] - box[(i + 1) % pts_num][1]));
+  for (int i = 0; i < 4; i++) {
+    const cv::Point2f &p0 = box[i];
+    const cv::Point2f &p1 = box[(i + 1) % 4];
+    area += p0.x * p1.y - p0.y * p1.x;
+    dist += sqrtf((p0.x - p1.x) * (p0.x - p1.x) + (p0.y - p1.y) * (p0.y - p1.y));
   }
   area = fabs(float(area / 2.0));
-
-  distance = area * unclip_ratio / dist;
-}
-
-cv::RotatedRect PostProcessor::UnClip(std::vector<std::vector<float>> box,
-                                      const float &unclip_ratio) {
-  float distance = 1.0;
-
-  GetContourArea(box, unclip_ratio, distance);
+  float distance = area * unclip_ratio / dist;
 
   ClipperLib::ClipperOffset offset;
   ClipperLib::Path p;
-  p << ClipperLib::IntPoint(int(box[0][0]), int(box[0][1]))
-    << ClipperLib::IntPoint(int(box[1][0]), int(box[1][1]))
-    << ClipperLib::IntPoint(int(box[2][0]), int(box[2][1]))
-    << ClipperLib::IntPoint(int(box[3][0]), int(box[3][1]));
+  for (int i = 0; i < 4; i++) {
+    p << ClipperLib::IntPoint(int(box[i].x), int(box[i].y));
+  }
   offset.AddPath(p, ClipperLib::jtRound, ClipperLib::etClosedPolygon);
 
   ClipperLib::Paths soln;
   offset.Execute(soln, distance);
   std::vector<cv::Point2f> points;
-
-  for (int j = 0; j < soln.size(); j++) {
-    for (int i = 0; i < soln[soln.size() - 1].size(); i++) {
+  for (size_t j = 0; j < soln.size(); j++) {
+    for (size_t i = 0; i < soln[j].size(); i++) {
       points.emplace_back(soln[j][i].X, soln[j][i].Y);
     }
   }
-  cv::RotatedRect res;
   if (points.size() <= 0) {
-    res = cv::RotatedRect(cv::Point2f(0, 0), cv::Size2f(1, 1), 0);
-  } else {
-    res = cv::minAreaRect(points);
+    return cv::RotatedRect(cv::Point2f(0, 0), cv::Size2f(1, 1), 0);
   }
-  return res;
+  return cv::minAreaRect(points);
 }
 
-float **PostProcessor::Mat2Vec(cv::Mat mat) {
-  auto **array = new float *[mat.rows];
-  for (int i = 0; i < mat.rows; ++i) array[i] = new float[mat.cols];
-  for (int i = 0; i < mat.rows; ++i) {
-    for (int j = 0; j < mat.cols; ++j) {
-      array[i][j] = mat.at<float>(i, j);
-    }
+void PostProcessor::OrderPointsClockwise(std::array<int, 8> *box) {
+  cv::Point pts[4];
+  for (int i = 0; i < 4; i++) {
+    pts[i] = cv::Point((*box)[2 * i], (*box)[2 * i + 1]);
   }
-
-  return array;
-}
-
-std::vector<std::vector<int>> PostProcessor::OrderPointsClockwise(
-    std::vector<std::vector<int>> pts) {
-  std::vector<std::vector<int>> box = pts;
-  std::sort(box.begin(), box.end(), XsortInt);
-
-  std::vector<std::vector<int>> leftmost = {box[0], box[1]};
-  std::vector<std::vector<int>> rightmost = {box[2], box[3]};
-
-  if (leftmost[0][1] > leftmost[1][1]) std::swap(leftmost[0], leftmost[1]);
-
-  if (rightmost[0][1] > rightmost[1][1]) std::swap(rightmost[0], rightmost[1]);
-
-  std::vector<std::vector<int>> rect = {leftmost[0], rightmost[0], rightmost[1],
-                                        leftmost[1]};
-  return rect;
-}
-
-std::vector<std::vector<float>> PostProcessor::Mat2Vector(cv::Mat mat) {
-  std::vector<std::vector<float>> img_vec;
-  std::vector<float> tmp;
-
-  for (int i = 0; i < mat.rows; ++i) {
-    tmp.clear();
-    for (int j = 0; j < mat.cols; ++j) {
-      tmp.push_back(mat.at<float>(i, j));
-    }
-    img_vec.push_back(tmp);
+  std::stable_sort(pts, pts + 4, [](const cv::Point &a, const cv::Point &b) {
+    return a.x < b.x;
+  });
+  if (pts[0].y > pts[1].y) std::swap(pts[0], pts[1]);
+  if (pts[2].y > pts[3].y) std::swap(pts[2], pts[3]);
+  // top-left, top-right, bottom-right, bottom-left
+  const cv::Point rect[4] = {pts[0], pts[2], pts[3], pts[1]};
+  for (int i = 0; i < 4; i++) {
+    (*box)[2 * i] = rect[i].x;
+    (*box)[2 * i + 1] = rect[i].y;
   }
-  return img_vec;
-}
-
-bool PostProcessor::XsortFp32(std::vector<float> a, std::vector<float> b) {
-  if (a[0] != b[0]) return a[0] < b[0];
-  return false;
 }
 
-bool PostProcessor::XsortInt(std::vector<int> a, std::vector<int> b) {
-  if (a[0] != b[0]) return a[0] < b[0];
-  return false;
-}
-
-std::vector<std::vector<float>> PostProcessor::GetMiniBoxes(cv::RotatedRect box,
-                                                            float &ssid) {
-  ssid = std::max(box.size.width, box.size.height);
-
-  cv::Mat points;
-  cv::boxPoints(box, points);
-
-  auto array = Mat2Vector(points);
-  std::sort(array.begin(), array.end(), XsortFp32);
-
-  std::vector<float> idx1 = array[0], idx2 = array[1], idx3 = array[2],
-                     idx4 = array[3];
-  if (array[3][1] <= array[2][1]) {
-    idx2 = array[3];
-    idx3 = array[2];
-  } else {
-    idx2 = array[2];
-    idx3 = array[3];
+// Append the row spans of the 8-connected line from p0 to p1 drawn by
+// cv::line, which goes from the left end point with Bresenham's algorithm
+static void AppendLineSpans(cv::Point p0, cv::Point p1,
+                            std::vector<cv::Vec3i> *spans) {
+  if (p1.x < p0.x) std::swap(p0, p1);
+  int dx = p1.x - p0.x;
+  int dy = std::abs(p1.y - p0.y);
+  int step_y = p1.y < p0.y ? -1 : 1;
+  int x = p0.x;
+  int y = p0.y;
+  if (dy > dx) {
+    // One pixel in each row
+    int err = dy - 2 * dx;
+    for (int k = 0; k <= dy; ++k, y += step_y) {
+      spans->emplace_back(y, x, x);
+      if (err < 0) {
+        ++x;
+        err += 2 * dy;
+      }
+      err -= 2 * dx;
+    }
+    return;
   }
-  if (array[1][1] <= array[0][1]) {
-    idx1 = array[1];
-    idx4 = array[0];
-  } else {
-    idx1 = array[0];
-    idx4 = array[1];
+  // One run of pixels in each row
+  int err = dx - 2 * dy;
+  int x_begin = x;
+  for (int k = 0; k < dx; ++k) {
+    bool step = err < 0;
+    err += step ? 2 * dx - 2 * dy : -2 * dy;
+    ++x;
+    if (step) {
+      spans->emplace_back(y, x_begin, x - 1);
+      y += step_y;
+      x_begin = x;
+    }
   }
-
-  array[0] = idx1;
-  array[1] = idx2;
-  array[2] = idx3;
-  array[3] = idx4;
-
-  return array;
+  spans->emplace_back(y, x_begin, x);
 }
 
-float PostProcessor::PolygonScoreAcc(std::vector<cv::Point> contour,
-                                     cv::Mat pred) {
-  int width = pred.cols;
-  int height = pred.rows;
-  std::vector<float> box_x;
-  std::vector<float> box_y;
-  for (int i = 0; i < contour.size(); ++i) {
-    box_x.push_back(contour[i].x);
-    box_y.push_back(contour[i].y);
+float PostProcessor::PolygonScoreScanline(
+    const cv::Point *points, int num_points, const double *row_sums,
+    int width, int height, std::vector<cv::Vec3i> *spans,
+    std::vector<std::pair<int, int64_t>> *crossings) {
+  // Collect the spans (y, x_begin, x_end) of the polygon in each row the
+  // same as cv::fillPoly, which draws the outline by cv::line and fills the
+  // inside by the crossings of the edges with the scanlines in 16-bit fixed
+  // point
+  const int shift = 16;
+  spans->clear();
+  crossings->clear();
+  for (int i = 0; i < num_points; ++i) {
+    const cv::Point &p0 = points[i];
+    const cv::Point &p1 = points[(i + 1) % num_points];
+    AppendLineSpans(p0, p1, spans);
+    if (p0.y == p1.y) {
+      continue;
+    }
+    const cv::Point &top = p0.y < p1.y ? p0 : p1;
+    const cv::Point &bottom = p0.y < p1.y ? p1 : p0;
+    int64_t x = static_cast<int64_t>(top.x) * (1 << shift);
+    int64_t dx = static_cast<int64_t>(bottom.x - top.x) * (1 << shift) /
+                 (bottom.y - top.y);
+    // The bottom row is excluded so each row has even crossings
+    for (int y = top.y; y < bottom.y; ++y, x += dx) {
+      crossings->emplace_back(y, x);
+    }
   }
-
-  int xmin =
-      clamp(int(std::floor(*(std::min_element(box_x.begin(), box_x.end())))), 0,
-            width - 1);
-  int xmax =
-      clamp(int(std::ceil(*(std::max_element(box_x.begin(), box_x.end())))), 0,
-            width - 1);
-  int ymin =
-      clamp(int(std::floor(*(std::min_element(box_y.begin(), box_y.end())))), 0,
-            height - 1);
-  int ymax =
-      clamp(int(std::ceil(*(std::max_element(box_y.begin(), box_y.end())))), 0,
-            height - 1);
-
-  cv::Mat mask;
-  mask = cv::Mat::zeros(ymax - ymin + 1, xmax - xmin + 1, CV_8UC1);
-
-  cv::Point *rook_point = new cv::Point[contour.size()];
-
-  for (int i = 0; i < contour.size(); ++i) {
-    rook_point[i] = cv::Point(int(box_x[i]) - xmin, int(box_y[i]) - ymin);
+  // The pixels between each pair of crossings are filled, from the ceil of
+  // the left one to the floor of the right one
+  std::sort(crossings->begin(), crossings->end());
+  for (size_t i = 0; i + 1 < crossings->size(); i += 2) {
+    int64_t x_begin = (*crossings)[i].second + (1 << shift) - 1;
+    int64_t x_end = (*crossings)[i + 1].second;
+    spans->emplace_back((*crossings)[i].first,
+                        static_cast<int>(x_begin >> shift),
+                        static_cast<int>(x_end >> shift));
   }
-  const cv::Point *ppt[1] = {rook_point};
-  int npt[] = {int(contour.size())};
-
-  cv::fillPoly(mask, ppt, npt, 1, cv::Scalar(1));
-
-  cv::Mat croppedImg;
-  pred(cv::Rect(xmin, ymin, xmax - xmin + 1, ymax - ymin + 1))
-      .copyTo(croppedImg);
-  float score = cv::mean(croppedImg, mask)[0];
-
-  delete[] rook_point;
-  return score;
-}
-
-float PostProcessor::BoxScoreFast(std::vector<std::vector<float>> box_array,
-                                  cv::Mat pred) {
-  auto array = box_array;
-  int width = pred.cols;
-  int height = pred.rows;
-
-  float box_x[4] = {array[0][0], array[1][0], array[2][0], array[3][0]};
-  float box_y[4] = {array[0][1], array[1][1], array[2][1], array[3][1]};
-
-  int xmin = clamp(int(std::floor(*(std::min_element(box_x, box_x + 4)))), 0,
-                   width - 1);
-  int xmax = clamp(int(std::ceil(*(std::max_element(box_x, box_x + 4)))), 0,
-                   width - 1);
-  int ymin = clamp(int(std::floor(*(std::min_element(box_y, box_y + 4)))), 0,
-                   height - 1);
-  int ymax = clamp(int(std::ceil(*(std::max_element(box_y, box_y + 4)))), 0,
-                   height - 1);
-
-  cv::Mat mask;
-  mask = cv::Mat::zeros(ymax - ymin + 1, xmax - xmin + 1, CV_8UC1);
-
-  cv::Point root_point[4];
-  root_point[0] = cv::Point(int(array[0][0]) - xmin, int(array[0][1]) - ymin);
-  root_point[1] = cv::Point(int(array[1][0]) - xmin, int(array[1][1]) - ymin);
-  root_point[2] = cv::Point(int(array[2][0]) - xmin, int(array[2][1]) - ymin);
-  root_point[3] = cv::Point(int(array[3][0]) - xmin, int(array[3][1]) - ymin);
-  const cv::Point *ppt[1] = {root_point};
-  int npt[] = {4};
-  cv::fillPoly(mask, ppt, npt, 1, cv::Scalar(1));
-
-  cv::Mat croppedImg;
-  pred(cv::Rect(xmin, ymin, xmax - xmin + 1, ymax - ymin + 1))
-      .copyTo(croppedImg);
-
-  auto score = cv::mean(croppedImg, mask)[0];
-  return score;
+  std::sort(spans->begin(), spans->end(),
+            [](const cv::Vec3i &a, const cv::Vec3i &b) {
+              return a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]);
+            });
+
+  // Merge the overlapped spans and sum the scores by row prefix sums
+  double sum = 0.0;
+  int64_t count = 0;
+  auto accumulate_span = [&](int y, int x_begin, int x_end) {
+    if (y < 0 || y >= height) return;
+    x_begin = std::max(x_begin, 0);
+    x_end = std::min(x_end, width - 1);
+    if (x_begin > x_end) return;
+    const double *row = row_sums + static_cast<int64_t>(y) * (width + 1);
+    sum += row[x_end + 1] - row[x_begin];
+    count += x_end - x_begin + 1;
+  };
+  size_t i = 0;
+  while (i < spans->size()) {
+    int y = (*spans)[i][0];
+    int x_begin = (*spans)[i][1];
+    int x_end = (*spans)[i][2];
+    for (++i; i < spans->size() && (*spans)[i][0] == y; ++i) {
+      if ((*spans)[i][1] <= x_end + 1) {
+        x_end = std::max(x_end, (*spans)[i][2]);
+      } else {
+        accumulate_span(y, x_begin, x_end);
+        x_begin = (*spans)[i][1];
+        x_end = (*spans)[i][2];
+      }
+    }
+    accumulate_span(y, x_begin, x_end);
+  }
+  return count == 0 ? 0.0f : static_cast<float>(sum / count);
 }
 
-std::vector<std::vector<std::vector<int>>> PostProcessor::BoxesFromBitmap(
-    const cv::Mat pred, const cv::Mat bitmap, const float &box_thresh,
-    const float &det_db_unclip_ratio, const std::string &det_db_score_mode) {
+void PostProcessor::BoxesFromBitmap(const double *row_sums,
+                                    const cv::Mat &bitmap, float box_thresh,
+                                    float det_db_unclip_ratio,
+                                    const std::string &det_db_score_mode,
+                                    std::vector<std::array<int, 8>> *boxes) {
   const int min_size = 3;
   const int max_candidates = 1000;
 
@@ -252,101 +218,85 @@ std::vector<std::vector<std::vector<int>>> PostProcessor::BoxesFromBitmap(
   int height = bitmap.rows;
 
   std::vector<std::vector<cv::Point>> contours;
-  std::vector<cv::Vec4i> hierarchy;
-
-  cv::findContours(bitmap, contours, hierarchy, cv::RETR_LIST,
-                   cv::CHAIN_APPROX_SIMPLE);
-
-  int num_contours =
-      contours.size() >= max_candidates ? max_candidates : contours.size();
-
-  std::vector<std::vector<std::vector<int>>> boxes;
-
-  for (int _i = 0; _i < num_contours; _i++) {
-    if (contours[_i].size() <= 2) {
+  cv::findContours(bitmap, contours, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE);
+
+  int num_contours = std::min(static_cast<int>(contours.size()), max_candidates);
+  bool slow_mode = det_db_score_mode == "slow";
+
+  boxes->clear();
+  std::vector<cv::Vec3i> spans;
+  std::vector<std::pair<int, int64_t>> crossings;
+  std::array<cv::Point2f, 4> array;
+  std::array<cv::Point2f, 4> cliparray;
+  for (int i = 0; i < num_contours; i++) {
+    if (contours[i].size() <= 2) {
       continue;
     }
     float ssid;
-    cv::RotatedRect box = cv::minAreaRect(contours[_i]);
-    auto array = GetMiniBoxes(box, ssid);
-
-    auto box_for_unclip = array;
-    // end get_mini_box
-
+    GetMiniBoxes(cv::minAreaRect(contours[i]), &array, &ssid);
     if (ssid < min_size) {
       continue;
     }
 
     float score;
-    if (det_db_score_mode == "slow") /* compute using polygon*/
-      score = PolygonScoreAcc(contours[_i], pred);
-    else
-      score = BoxScoreFast(array, pred);
-
+    if (slow_mode) {
+      score = PolygonScoreScanline(contours[i].data(),
+                                   static_cast<int>(contours[i].size()),
+                                   row_sums, width, height, &spans, &crossings);
+    } else {
+      cv::Point box_points[4];
+      for (int k = 0; k < 4; k++) {
+        box_points[k] = cv::Point(int(array[k].x), int(array[k].y));
+      }
+      score = PolygonScoreScanline(box_points, 4, row_sums, width, height,
+                                   &spans, &crossings);
+    }
     if (score < box_thresh) continue;
 
-    // start for unclip
-    cv::RotatedRect points = UnClip(box_for_unclip, det_db_unclip_ratio);
+    cv::RotatedRect points = UnClip(array, det_db_unclip_ratio);
     if (points.size.height < 1.001 && points.size.width < 1.001) {
       continue;
     }
-    // end for unclip
-
-    cv::RotatedRect clipbox = points;
-    auto cliparray = GetMiniBoxes(clipbox, ssid);
-
+    GetMiniBoxes(points, &cliparray, &ssid);
     if (ssid < min_size + 2) continue;
 
-    int dest_width = pred.cols;
-    int dest_height = pred.rows;
-    std::vector<std::vector<int>> intcliparray;
-
-    for (int num_pt = 0; num_pt < 4; num_pt++) {
-      std::vector<int> a{
-          int(clampf(
-              roundf(cliparray[num_pt][0] / float(width) * float(dest_width)),
-              0, float(dest_width))),
-          int(clampf(
-              roundf(cliparray[num_pt][1] / float(height) * float(dest_height)),
-              0, float(dest_height)))};
-      intcliparray.push_back(a);
+    std::array<int, 8> box;
+    for (int k = 0; k < 4; k++) {
+      box[2 * k] = int(clampf(
+          roundf(cliparray[k].x / float(width) * float(width)), 0,
+          float(width)));
+      box[2 * k + 1] = int(clampf(
+          roundf(cliparray[k].y / float(height) * float(height)), 0,
+          float(height)));
     }
-    boxes.push_back(intcliparray);
-
-  }  // end for
-  return boxes;
+    boxes->push_back(box);
+  }
 }
 
-std::vector<std::vector<std::vector<int>>> PostProcessor::FilterTagDetRes(
-    std::vector<std::vector<std::vector<int>>> boxes,
-    const std::array<int,4>& det_img_info) {
+void PostProcessor::FilterTagDetRes(const std::array<int, 4> &det_img_info,
+                                    std::vector<std::array<int, 8>> *boxes) {
   int oriimg_w = det_img_info[0];
   int oriimg_h = det_img_info[1];
-  float ratio_w = float(det_img_info[2])/float(oriimg_w);
-  float ratio_h = float(det_img_info[3])/float(oriimg_h);
-
-  std::vector<std::vector<std::vector<int>>> root_points;
-  for (int n = 0; n < boxes.size(); n++) {
-    boxes[n] = OrderPointsClockwise(boxes[n]);
-    for (int m = 0; m < boxes[0].size(); m++) {
-      boxes[n][m][0] /= ratio_w;
-      boxes[n][m][1] /= ratio_h;
-
-      boxes[n][m][0] = int(_min(_max(boxes[n][m][0], 0), oriimg_w - 1));
-      boxes[n][m][1] = int(_min(_max(boxes[n][m][1], 0), oriimg_h - 1));
+  float ratio_w = float(det_img_info[2]) / float(oriimg_w);
+  float ratio_h = float(det_img_info[3]) / float(oriimg_h);
+
+  size_t num_boxes = 0;
+  for (size_t n = 0; n < boxes->size(); n++) {
+    std::array<int, 8> box = (*boxes)[n];
+    OrderPointsClockwise(&box);
+    for (int m = 0; m < 4; m++) {
+      int x = box[2 * m] / ratio_w;
+      int y = box[2 * m + 1] / ratio_h;
+      box[2 * m] = _min(_max(x, 0), oriimg_w - 1);
+      box[2 * m + 1] = _min(_max(y, 0), oriimg_h - 1);
     }
-  }
-
-  for (int n = 0; n < boxes.size(); n++) {
-    int rect_width, rect_height;
-    rect_width = int(sqrt(pow(boxes[n][0][0] - boxes[n][1][0], 2) +
-                          pow(boxes[n][0][1] - boxes[n][1][1], 2)));
-    rect_height = int(sqrt(pow(boxes[n][0][0] - boxes[n][3][0], 2) +
-                           pow(boxes[n][0][1] - boxes[n][3][1], 2)));
+    int rect_width = int(sqrt(pow(box[0] - box[2], 2) + pow(box[1] - box[3], 2)));
+    int rect_height =
+        int(sqrt(pow(box[0] - box[6], 2) + pow(box[1] - box[7], 2)));
     if (rect_width <= 4 || rect_height <= 4) continue;
-    root_points.push_back(boxes[n]);
+    (*boxes)[num_boxes++] = box;
   }
-  return root_points;
+  boxes->resize(num_boxes);
 }
 
 }  // namespace ocr
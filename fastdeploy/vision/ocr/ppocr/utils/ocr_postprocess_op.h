@@ -14,10 +14,13 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <ostream>
+#include <utility>
 #include <vector>
 #include "opencv2/core.hpp"
 #include "opencv2/imgproc.hpp"
@@ -26,57 +29,48 @@
 #include <fstream>
 #include <numeric>
 
+#include "fastdeploy/utils/utils.h"
 #include "fastdeploy/vision/ocr/ppocr/utils/clipper.h"
 
 namespace fastdeploy {
 namespace vision {
 namespace ocr {
 
-class PostProcessor {
+class FASTDEPLOY_DECL PostProcessor {
  public:
-  void GetContourArea(const std::vector<std::vector<float>> &box,
-                      float unclip_ratio, float &distance);
-
-  cv::RotatedRect UnClip(std::vector<std::vector<float>> box,
-                         const float &unclip_ratio);
-
-  float **Mat2Vec(cv::Mat mat);
-
-  std::vector<std::vector<int>> OrderPointsClockwise(
-      std::vector<std::vector<int>> pts);
-
-  std::vector<std::vector<float>> GetMiniBoxes(cv::RotatedRect box,
-                                               float &ssid);
-
-  float BoxScoreFast(std::vector<std::vector<float>> box_array, cv::Mat pred);
-  float PolygonScoreAcc(std::vector<cv::Point> contour, cv::Mat pred);
-
-  std::vector<std::vector<std::vector<int>>> BoxesFromBitmap(
-      const cv::Mat pred, const cv::Mat bitmap, const float &box_thresh,
-      const float &det_db_unclip_ratio, const std::string &det_db_score_mode);
-
-  std::vector<std::vector<std::vector<int>>> FilterTagDetRes(
-      std::vector<std::vector<std::vector<int>>> boxes,
-      const std::array<int, 4>& det_img_info);
+  // Get the 4 points of box sorted as top-left, top-right, bottom-right,
+  // bottom-left, and the length of the longer side in ssid
+  void GetMiniBoxes(const cv::RotatedRect &box,
+                    std::array<cv::Point2f, 4> *points, float *ssid);
+
+  cv::RotatedRect UnClip(const std::array<cv::Point2f, 4> &box,
+                         float unclip_ratio);
+
+  // Sort the 4 points in box, which is x0, y0, ..., x3, y3, clockwise from
+  // the top-left one
+  void OrderPointsClockwise(std::array<int, 8> *box);
+
+  // Mean of the probability map in the polygon filled the same as
+  // cv::fillPoly if the polygon is inside the map, row_sums is the row prefix sums of probability map with
+  // height * (width + 1) elements, spans and crossings are reused buffers
+  float PolygonScoreScanline(const cv::Point *points, int num_points,
+                             const double *row_sums, int width, int height,
+                             std::vector<cv::Vec3i> *spans,
+                             std::vector<std::pair<int, int64_t>> *crossings);
+
+  void BoxesFromBitmap(const double *row_sums, const cv::Mat &bitmap,
+                       float box_thresh, float det_db_unclip_ratio,
+                       const std::string &det_db_score_mode,
+                       std::vector<std::array<int, 8>> *boxes);
+
+  void FilterTagDetRes(const std::array<int, 4> &det_img_info,
+                       std::vector<std::array<int, 8>> *boxes);
 
  private:
-  static bool XsortInt(std::vector<int> a, std::vector<int> b);
-
-  static bool XsortFp32(std::vector<float> a, std::vector<float> b);
-
-  std::vector<std::vector<float>> Mat2Vector(cv::Mat mat);
-
   inline int _max(int a, int b) { return a >= b ? a : b; }
 
   inline int _min(int a, int b) { return a >= b ? b : a; }
 
-  template <class T>
-  inline T clamp(T x, T min, T max) {
-    if (x > max) return max;
-    if (x < min) return min;
-    return x;
-  }
-
   inline float clampf(float x, float min, float max) {
     if (x > max) return max;
     if (x < min) return min;
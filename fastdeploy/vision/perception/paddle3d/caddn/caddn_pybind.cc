@@ -73,7 +73,10 @@ void BindCaddn(pybind11::module& m) {
               std::vector<float>& cam_data, std::vector<float>& lidar_data) {
              auto mat = PyArrayToCvMat(data);
              vision::PerceptionResult res;
-             self.Predict(mat, cam_data, lidar_data, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, cam_data, lidar_data, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -85,7 +88,10 @@ void BindCaddn(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::PerceptionResult> results;
-             self.BatchPredict(images, cam_data, lidar_data, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, cam_data, lidar_data, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
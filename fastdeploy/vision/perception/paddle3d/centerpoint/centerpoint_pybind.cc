@@ -39,14 +39,20 @@ void BindCenterpoint(pybind11::module& m) {
       .def("predict",
            [](vision::perception::Centerpoint& self, std::string point_dir) {
              vision::PerceptionResult result;
-             self.Predict(point_dir, &result);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(point_dir, &result);
+             }
              return result;
            })
       .def("batch_predict",
            [](vision::perception::Centerpoint& self,
               std::vector<std::string>& points_dir) {
              std::vector<vision::PerceptionResult> results;
-             self.BatchPredict(points_dir, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(points_dir, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
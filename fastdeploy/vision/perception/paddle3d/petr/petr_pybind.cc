@@ -70,7 +70,10 @@ void BindPetr(pybind11::module& m) {
            [](vision::perception::Petr& self, pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::PerceptionResult res;
-             self.Predict(mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -81,7 +84,10 @@ void BindPetr(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::PerceptionResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly("preprocessor",
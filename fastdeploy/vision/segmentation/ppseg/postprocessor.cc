@@ -12,13 +12,57 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include "fastdeploy/vision/segmentation/ppseg/postprocessor.h"
-#include "fastdeploy/function/cast.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "fastdeploy/utils/parallel.h"
 #include "yaml-cpp/yaml.h"
 
 namespace fastdeploy {
 namespace vision {
 namespace segmentation {
 
+namespace {
+
+// Convert the max logits of a row to the softmax probabilities, which is
+// 1 / sum(exp(logit - max_logit)) over the classes
+void SoftmaxOfMax(const float* logits, int64_t num_classes, int64_t plane_size,
+                  int64_t width, float* scores, std::vector<float>* sums) {
+  sums->assign(width, 0.0f);
+  float* sum = sums->data();
+  for (int64_t c = 0; c < num_classes; ++c) {
+    const float* logit = logits + c * plane_size;
+    for (int64_t x = 0; x < width; ++x) {
+      sum[x] += std::exp(logit[x] - scores[x]);
+    }
+  }
+  for (int64_t x = 0; x < width; ++x) {
+    scores[x] = 1.0f / sum[x];
+  }
+}
+
+template <typename T>
+void CastLabels(const T* src, int64_t size, uint8_t* labels) {
+  for (int64_t i = 0; i < size; ++i) {
+    labels[i] = static_cast<uint8_t>(src[i]);
+  }
+}
+
+// Get the source index of the nearest neighbour interpolation, which is the
+// same as cv::INTER_NEAREST
+std::vector<int64_t> NearestIndex(int64_t src_size, int64_t dst_size) {
+  std::vector<int64_t> index(dst_size);
+  double scale = static_cast<double>(src_size) / dst_size;
+  for (int64_t i = 0; i < dst_size; ++i) {
+    index[i] = (std::min)(static_cast<int64_t>(std::floor(i * scale)),
+                          src_size - 1);
+  }
+  return index;
+}
+
+}  // namespace
+
 PaddleSegPostprocessor::PaddleSegPostprocessor(const std::string& config_file) {
   FDASSERT(ReadFromConfig(config_file), "Failed to create PaddleSegPreprocessor.");
   initialized_ = true;
@@ -54,106 +98,6 @@ bool PaddleSegPostprocessor::ReadFromConfig(const std::string& config_file) {
   return true;
 }
 
-bool PaddleSegPostprocessor::SliceOneResultFromBatchInferResults(const FDTensor& infer_results,
-                                                                 FDTensor* infer_result,
-                                                                 const std::vector<int64_t>& infer_result_shape,
-                                                                 const int64_t& start_idx) {
-  int64_t infer_batch = infer_results.shape[0];
-  if(infer_batch == 1) {
-    *infer_result = infer_results;
-    // batch is 1, so ignore
-    infer_result->shape = infer_result_shape;
-  } else {
-    if (infer_results.dtype == FDDataType::FP32) {
-      const float_t* infer_results_ptr =
-          reinterpret_cast<const float_t*>(infer_results.CpuData()) + start_idx;
-      infer_result->SetExternalData(
-          infer_result_shape, FDDataType::FP32,
-          reinterpret_cast<void*>(const_cast<float_t *>(infer_results_ptr)));
-    } else if (infer_results.dtype == FDDataType::INT64) {
-      const int64_t* infer_results_ptr =
-          reinterpret_cast<const int64_t*>(infer_results.CpuData()) + start_idx;
-      infer_result->SetExternalData(
-          infer_result_shape, FDDataType::INT64,
-          reinterpret_cast<void*>(const_cast<int64_t *>(infer_results_ptr)));
-    } else if (infer_results.dtype == FDDataType::INT32) {
-      const int32_t* infer_results_ptr =
-          reinterpret_cast<const int32_t*>(infer_results.CpuData()) + start_idx;
-      infer_result->SetExternalData(
-          infer_result_shape, FDDataType::INT32,
-          reinterpret_cast<void*>(const_cast<int32_t *>(infer_results_ptr)));
-    }  else if (infer_results.dtype == FDDataType::UINT8) {
-      const uint8_t* infer_results_ptr =
-          reinterpret_cast<const uint8_t*>(infer_results.CpuData()) + start_idx;
-      infer_result->SetExternalData(
-          infer_result_shape, FDDataType::UINT8,
-          reinterpret_cast<void*>(const_cast<uint8_t *>(infer_results_ptr)));
-    } else {
-      FDASSERT(false, 
-               "Require the data type for slicing is int64, fp32 or int32, but now "
-               "it's %s.",
-               Str(infer_results.dtype).c_str() )
-      return false;
-    }
-  }
-  return true;
-}
-
-bool PaddleSegPostprocessor::ProcessWithScoreResult(const FDTensor& infer_result,
-                                                    const int64_t& out_num,
-                                                    SegmentationResult* result) {
-  const uint8_t* argmax_infer_result_buffer = nullptr;
-  const float_t* score_infer_result_buffer = nullptr;
-  FDTensor argmax_infer_result;
-  FDTensor max_score_result;
-  std::vector<int64_t> reduce_dim{-1};
-  function::ArgMax(infer_result, &argmax_infer_result, -1, FDDataType::UINT8);
-  function::Max(infer_result, &max_score_result, reduce_dim);
-  score_infer_result_buffer = reinterpret_cast<const float_t*>(max_score_result.CpuData());
-  std::memcpy(result->score_map.data(), score_infer_result_buffer,
-            out_num * sizeof(float_t));
-  
-  argmax_infer_result_buffer =
-      reinterpret_cast<const uint8_t*>(argmax_infer_result.CpuData());
-
-  std::memcpy(result->label_map.data(), argmax_infer_result_buffer,
-            out_num * sizeof(uint8_t));
-  
-  return true;
-}
-
-bool PaddleSegPostprocessor::ProcessWithLabelResult(const FDTensor& infer_result,
-                                                    const int64_t& out_num,
-                                                    SegmentationResult* result) {
-  if (infer_result.dtype == FDDataType::INT64) {
-    const int64_t* infer_result_buffer =
-        reinterpret_cast<const int64_t*>(infer_result.CpuData());
-    for (int i = 0; i < out_num; i++) {
-      result->label_map[i] =
-          static_cast<uint8_t>(*(infer_result_buffer + i));
-    }
-  } else if (infer_result.dtype == FDDataType::INT32) {
-    const int32_t* infer_result_buffer =
-        reinterpret_cast<const int32_t*>(infer_result.CpuData());
-    for (int i = 0; i < out_num; i++) {
-      result->label_map[i] =
-          static_cast<uint8_t>(*(infer_result_buffer + i));
-    }
-  } else if (infer_result.dtype == FDDataType::UINT8) {
-    const uint8_t* infer_result_buffer =
-        reinterpret_cast<const uint8_t*>(infer_result.CpuData());
-    memcpy(result->label_map.data(), infer_result_buffer, out_num * sizeof(uint8_t));
-  }
-  else {
-    FDASSERT(false, 
-             "Require the data type to process is int64, int32 or uint8, but now "
-             "it's %s.",
-             Str(infer_result.dtype).c_str());
-    return false;
-  }
-  return true;
-}
-
 bool PaddleSegPostprocessor::Run(
     const std::vector<FDTensor>& infer_results,
     std::vector<SegmentationResult>* results,
@@ -186,97 +130,125 @@ bool PaddleSegPostprocessor::Run(
   auto iter_input_imgs_shape_list = imgs_info.find("shape_info");
   FDASSERT(iter_input_imgs_shape_list != imgs_info.end(), "Cannot find shape_info from imgs_info.");
 
-  // For Argmax Softmax function to store transformed result below
-  FDTensor transform_infer_results;
-
   int64_t infer_batch = infer_results[0].shape[0];
-  int64_t infer_channel = 0;
+  int64_t infer_channel = 1;
   int64_t infer_height = 0;
-  int64_t infer_width = 0;  
-
+  int64_t infer_width = 0;
   if (is_with_argmax_) {
     // infer_results with argmax
-    infer_channel = 1;
+    if (infer_results_dtype == FDDataType::FP32) {
+      FDERROR << "Require the data type of label map is int64 or int32 while "
+                 "the model is exported with argmax, but now it's fp32."
+              << std::endl;
+      return false;
+    }
     infer_height = infer_results[0].shape[1];
     infer_width = infer_results[0].shape[2];
   } else {
     // infer_results without argmax
-    infer_channel = 1;
+    if (infer_results_dtype != FDDataType::FP32) {
+      FDERROR << "Require the data type of logits is fp32, but now it's "
+              << Str(infer_results_dtype) << "." << std::endl;
+      return false;
+    }
+    infer_channel = infer_results[0].shape[1];
     infer_height = infer_results[0].shape[2];
     infer_width = infer_results[0].shape[3];
-    if (store_score_map_) {
-      infer_channel = infer_results[0].shape[1];
-      std::vector<int64_t> dim{0, 2, 3, 1};
-      function::Transpose(infer_results[0], &transform_infer_results, dim);
-      if (!is_with_softmax_ && apply_softmax_) {
-        function::Softmax(transform_infer_results, &transform_infer_results, 1);
-      }
-    } else {
-      function::ArgMax(infer_results[0], &transform_infer_results, 1, FDDataType::UINT8);
-      infer_results_dtype = transform_infer_results.dtype;
-    }
   }
+  int64_t infer_hw = infer_height * infer_width;
+  bool with_score_map = !is_with_argmax_ && store_score_map_;
+  bool with_softmax = with_score_map && !is_with_softmax_ && apply_softmax_;
 
-  int64_t infer_chw = infer_channel * infer_height * infer_width;
-
+  // The label map and score map are computed at the inference resolution,
+  // the ones of the resized images are stored in the buffers and upsampled
+  // with the nearest neighbour interpolation later
   results->resize(infer_batch);
-  for (int i = 0; i < infer_batch; i++) {
+  std::vector<uint8_t*> labels(infer_batch);
+  std::vector<float*> scores(infer_batch);
+  label_buffer_.resize(infer_batch * infer_hw);
+  score_buffer_.resize(is_with_argmax_ ? 0 : infer_batch * infer_hw);
+  for (int64_t i = 0; i < infer_batch; ++i) {
     SegmentationResult* result = &((*results)[i]);
     result->Clear();
-    int64_t start_idx = i * infer_chw;
-
-    FDTensor infer_result;
-    std::vector<int64_t> infer_result_shape = {infer_height, infer_width, infer_channel};
-    
-    if (is_with_argmax_) {
-      SliceOneResultFromBatchInferResults(infer_results[0], 
-                                          &infer_result,
-                                          infer_result_shape,
-                                          start_idx);
-    } else {
-      SliceOneResultFromBatchInferResults(transform_infer_results, 
-                                          &infer_result,
-                                          infer_result_shape,
-                                          start_idx);
-    }
-    bool is_resized = false;
     int input_height = iter_input_imgs_shape_list->second[i][0];
     int input_width = iter_input_imgs_shape_list->second[i][1];
-    if (input_height != infer_height || input_width != infer_width) {
-      is_resized = true;
+    result->shape = {input_height, input_width};
+    result->contain_score_map = with_score_map;
+    result->Resize(input_height * input_width);
+    bool is_resized = input_height != infer_height || input_width != infer_width;
+    labels[i] = is_resized ? label_buffer_.data() + i * infer_hw
+                           : result->label_map.data();
+    if (!is_with_argmax_) {
+      scores[i] = is_resized || !with_score_map
+                      ? score_buffer_.data() + i * infer_hw
+                      : result->score_map.data();
     }
+  }
 
-    FDMat mat;
-    // Resize interpration 
-    int interpolation = cv::INTER_LINEAR;
-    if (is_resized) {
-      if (infer_results_dtype == FDDataType::INT64 ||
-          infer_results_dtype == FDDataType::INT32 ){
-        function::Cast(infer_result, &infer_result, FDDataType::UINT8);
-        // label map resize with nearest interpolation
-        interpolation = cv::INTER_NEAREST;
-      }
-      mat = std::move(Mat::Create(infer_result, ProcLib::OPENCV));
-      Resize::Run(&mat, input_width, input_height, -1.0f, -1.0f, interpolation, false, ProcLib::OPENCV);
-      mat.ShareWithTensor(&infer_result);
-    } 
-    result->shape = infer_result.shape;
-    // output shape is 2-D HW layout, so out_num = H * W
-    int out_num =
-        std::accumulate(result->shape.begin(), result->shape.begin() + 2, 1,
-                        std::multiplies<int>());
-  
-    if (!is_with_argmax_ && store_score_map_) {
-      // output with label_map and score_map
-      result->contain_score_map = true;
-      result->Resize(out_num);
-        ProcessWithScoreResult(infer_result, out_num, result);
-    } else {
-      result->Resize(out_num);
-        ProcessWithLabelResult(infer_result, out_num, result);
+  // 1. Compute the label map and score map row by row, the logits are read
+  // in NCHW layout directly
+  const void* infer_data = infer_results[0].CpuData();
+  fastdeploy::utils::ParallelFor(
+      infer_batch * infer_height, [&](int64_t begin, int64_t end) {
+        std::vector<float> sums;
+        std::vector<int32_t> row_labels;
+        for (int64_t row = begin; row < end; ++row) {
+          int64_t i = row / infer_height;
+          int64_t y = row % infer_height;
+          int64_t offset = y * infer_width;
+          if (infer_results_dtype == FDDataType::INT64) {
+            CastLabels(reinterpret_cast<const int64_t*>(infer_data) +
+                           i * infer_hw + offset,
+                       infer_width, labels[i] + offset);
+          } else if (infer_results_dtype == FDDataType::INT32) {
+            CastLabels(reinterpret_cast<const int32_t*>(infer_data) +
+                           i * infer_hw + offset,
+                       infer_width, labels[i] + offset);
+          } else {
+            const float* logits = reinterpret_cast<const float*>(infer_data) +
+                                  i * infer_channel * infer_hw + offset;
+            row_labels.resize(infer_width);
+            vision::utils::ArgMaxOverChannels(
+                logits, infer_channel, infer_hw, infer_width,
+                row_labels.data(), scores[i] + offset);
+            CastLabels(row_labels.data(), infer_width, labels[i] + offset);
+            if (with_softmax) {
+              SoftmaxOfMax(logits, infer_channel, infer_hw, infer_width,
+                           scores[i] + offset, &sums);
+            }
+          }
+        }
+      });
+
+  // 2. Upsample the label map and score map of the resized images to the
+  // input resolution
+  for (int64_t i = 0; i < infer_batch; ++i) {
+    SegmentationResult* result = &((*results)[i]);
+    int64_t output_height = result->shape[0];
+    int64_t output_width = result->shape[1];
+    if (output_height == infer_height && output_width == infer_width) {
+      continue;
     }
-    // HWC remove C
-    result->shape.erase(result->shape.begin() + 2);
+    std::vector<int64_t> y_index = NearestIndex(infer_height, output_height);
+    std::vector<int64_t> x_index = NearestIndex(infer_width, output_width);
+    fastdeploy::utils::ParallelFor(
+        output_height, [&](int64_t begin, int64_t end) {
+          for (int64_t y = begin; y < end; ++y) {
+            const uint8_t* src_label = labels[i] + y_index[y] * infer_width;
+            uint8_t* dst_label = result->label_map.data() + y * output_width;
+            for (int64_t x = 0; x < output_width; ++x) {
+              dst_label[x] = src_label[x_index[x]];
+            }
+            if (!with_score_map) {
+              continue;
+            }
+            const float* src_score = scores[i] + y_index[y] * infer_width;
+            float* dst_score = result->score_map.data() + y * output_width;
+            for (int64_t x = 0; x < output_width; ++x) {
+              dst_score[x] = src_score[x_index[x]];
+            }
+          }
+        });
   }
   return true;
 }
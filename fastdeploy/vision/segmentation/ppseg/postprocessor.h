@@ -66,20 +66,6 @@ class FASTDEPLOY_DECL PaddleSegPostprocessor {
  private:
   virtual bool ReadFromConfig(const std::string& config_file);
 
-  virtual bool SliceOneResultFromBatchInferResults(
-                  const FDTensor& infer_results,
-                  FDTensor* infer_result,
-                  const std::vector<int64_t>& infer_result_shape,
-                  const int64_t& start_idx);
-
-  virtual bool ProcessWithScoreResult(const FDTensor& infer_result,
-                                      const int64_t& out_num,
-                                      SegmentationResult* result);
-
-  virtual bool ProcessWithLabelResult(const FDTensor& infer_result,
-                                      const int64_t& out_num,
-                                      SegmentationResult* result);
-
   bool is_with_softmax_ = false;
 
   bool is_with_argmax_ = true;
@@ -89,6 +75,10 @@ class FASTDEPLOY_DECL PaddleSegPostprocessor {
   bool store_score_map_ = false;
 
   bool initialized_ = false;
+
+  // The label map and score map of the resized images before upsampling
+  std::vector<uint8_t> label_buffer_;
+  std::vector<float> score_buffer_;
 };
 
 }  // namespace segmentation
@@ -66,7 +66,10 @@ void BindPPSeg(pybind11::module& m) {
               pybind11::array& data) {
              auto mat = PyArrayToCvMat(data);
              vision::SegmentationResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
            })
       .def("batch_predict",
@@ -77,7 +80,10 @@ void BindPPSeg(pybind11::module& m) {
                images.push_back(PyArrayToCvMat(data[i]));
              }
              std::vector<vision::SegmentationResult> results;
-             self.BatchPredict(images, &results);
+             {
+               pybind11::gil_scoped_release release;
+               self.BatchPredict(images, &results);
+             }
              return results;
            })
       .def_property_readonly(
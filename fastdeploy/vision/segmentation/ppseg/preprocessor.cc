@@ -139,14 +139,8 @@ bool PaddleSegPreprocessor::Apply(FDMatBatch* image_batch,
       }
     }
   }
-  for (size_t i = 0; i < img_num; ++i) {
-    for (size_t j = 0; j < processors_.size(); ++j) {
-      if (!(*(processors_[j].get()))(&((*images)[i]))) {
-        FDERROR << "Failed to process image data in " << processors_[i]->Name()
-                << "." << std::endl;
-        return false;
-      }
-    }
+  if (!ApplyToEachMat(image_batch, processors_)) {
+    return false;
   }
   outputs->resize(1);
   FDTensor* tensor = image_batch->Tensor();
@@ -33,10 +33,6 @@ class FASTDEPLOY_DECL EDVR : public PPMSVSR {
        const ModelFormat& model_format = ModelFormat::ONNX);
   /// model name contained EDVR
   std::string ModelName() const override { return "EDVR"; }
-
- private:
-  bool Postprocess(std::vector<FDTensor>& infer_results,
-                   std::vector<cv::Mat>& results) override;
 };
 }  // namespace sr
 }  // namespace vision
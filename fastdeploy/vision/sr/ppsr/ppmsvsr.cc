@@ -14,10 +14,61 @@
 
 #include "fastdeploy/vision/sr/ppsr/ppmsvsr.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "fastdeploy/utils/parallel.h"
+
 namespace fastdeploy {
 namespace vision {
 namespace sr {
 
+namespace {
+
+// The output is [1, n, c, h, w], or [1, c, h, w] for EDVR
+bool GetOutputFrameNum(const FDTensor& output, int* frame_num) {
+  int rank = output.shape.size();
+  if ((rank != 4 && rank != 5) || output.shape[rank - 3] != 3 ||
+      output.dtype != FDDataType::FP32) {
+    FDERROR << "The output should be float32 frames of 3 channels, in the "
+               "shape of [1, n, c, h, w] or [1, c, h, w]."
+            << std::endl;
+    return false;
+  }
+  *frame_num = rank == 5 ? output.shape[1] : 1;
+  return true;
+}
+
+// Convert the RGB CHW frame in [0, 1] of output to a BGR image
+cv::Mat OutputFrameToMat(const FDTensor& output, int frame) {
+  int rank = output.shape.size();
+  int rows = output.shape[rank - 2];
+  int cols = output.shape[rank - 1];
+  int pix_num = rows * cols;
+  const float* data =
+      static_cast<const float*>(output.Data()) + frame * 3 * pix_num;
+  cv::Mat res(rows, cols, CV_8UC3);
+  fastdeploy::utils::ParallelFor(
+      rows,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t h = begin; h < end; ++h) {
+          uint8_t* dst = res.ptr<uint8_t>(h);
+          for (int w = 0; w < cols; ++w) {
+            int index = h * cols + w;
+            for (int c = 0; c < 3; ++c) {
+              dst[w * 3 + c] = cv::saturate_cast<uint8_t>(
+                  data[(2 - c) * pix_num + index] * 255.0f);
+            }
+          }
+        }
+      },
+      16);
+  return res;
+}
+
+}  // namespace
+
+
 PPMSVSR::PPMSVSR(const std::string& model_file, const std::string& params_file,
                  const RuntimeOption& custom_option,
                  const ModelFormat& model_format) {
@@ -43,14 +94,37 @@ bool PPMSVSR::Initialize() {
   return true;
 }
 
-bool PPMSVSR::Preprocess(Mat* mat, std::vector<float>& output) {
-  BGR2RGB::Run(mat);
-  Normalize::Run(mat, mean_, scale_, true);
-  HWC2CHW::Run(mat);
-  // Csat float
-  float* ptr = static_cast<float*>(mat->Data());
-  size_t size = mat->Width() * mat->Height() * mat->Channels();
-  output = std::vector<float>(ptr, ptr + size);
+bool PPMSVSR::Preprocess(const cv::Mat& frame, float* output) {
+  if (frame.type() != CV_8UC3) {
+    FDERROR << "Only support the frames of CV_8UC3." << std::endl;
+    return false;
+  }
+  // BGR2RGB, Normalize and HWC2CHW in one pass, output = x / 255 - mean /
+  // scale, written to output directly
+  int rows = frame.rows;
+  int cols = frame.cols;
+  int pix_num = rows * cols;
+  float alpha[3];
+  float beta[3];
+  for (int c = 0; c < 3; ++c) {
+    alpha[c] = 1.0f / 255.0f / scale_[c];
+    beta[c] = -mean_[c] / scale_[c];
+  }
+  fastdeploy::utils::ParallelFor(
+      rows,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t h = begin; h < end; ++h) {
+          const uint8_t* src = frame.ptr<uint8_t>(h);
+          for (int w = 0; w < cols; ++w) {
+            int index = h * cols + w;
+            for (int c = 0; c < 3; ++c) {
+              output[c * pix_num + index] =
+                  src[w * 3 + 2 - c] * alpha[c] + beta[c];
+            }
+          }
+        }
+      },
+      16);
   return true;
 }
 
@@ -62,20 +136,20 @@ bool PPMSVSR::Predict(std::vector<cv::Mat>& imgs,
   int rows = imgs[0].rows;
   int cols = imgs[0].cols;
   int channels = imgs[0].channels();
-  std::vector<FDTensor> input_tensors;
-  input_tensors.resize(1);
-  std::vector<float> all_data_temp;
+  size_t frame_size = static_cast<size_t>(rows) * cols * channels;
+  std::vector<float> all_data(frame_num * frame_size);
   for (int i = 0; i < frame_num; i++) {
-    Mat mat(imgs[i]);
-    std::vector<float> data_temp;
-    Preprocess(&mat, data_temp);
-    all_data_temp.insert(all_data_temp.end(), data_temp.begin(),
-                         data_temp.end());
+    if (imgs[i].rows != rows || imgs[i].cols != cols ||
+        !Preprocess(imgs[i], all_data.data() + i * frame_size)) {
+      FDERROR << "Failed to preprocess the frame " << i << "." << std::endl;
+      return false;
+    }
   }
+  std::vector<FDTensor> input_tensors;
+  input_tensors.resize(1);
   // share memory in order to avoid memory copy, data type must be float32
   input_tensors[0].SetExternalData({1, frame_num, channels, rows, cols},
-                                   FDDataType::FP32, all_data_temp.data());
-  input_tensors[0].shape = {1, frame_num, channels, rows, cols};
+                                   FDDataType::FP32, all_data.data());
   input_tensors[0].name = InputInfoOfRuntime(0).name;
   std::vector<FDTensor> output_tensors;
   if (!Infer(input_tensors, &output_tensors)) {
@@ -92,39 +166,211 @@ bool PPMSVSR::Predict(std::vector<cv::Mat>& imgs,
 bool PPMSVSR::Postprocess(std::vector<FDTensor>& infer_results,
                           std::vector<cv::Mat>& results) {
   // group to image
-  // output_shape is [b, n, c, h, w] n = frame_nums b=1(default)
+  // output_shape is [b, n, c, h, w] n = frame_nums b=1(default), or [b, c,
+  // h, w] for EDVR which outputs the center frame only
   // b and n is dependence export model shape
   // see
   // https://github.com/PaddlePaddle/PaddleGAN/blob/develop/docs/zh_CN/tutorials/video_super_resolution.md
-  auto output_shape = infer_results[0].shape;
-  // PP-MSVSR
-  int h_ = output_shape[3];
-  int w_ = output_shape[4];
-  int c_ = output_shape[2];
-  int frame_num = output_shape[1];
-
-  float* out_data = static_cast<float*>(infer_results[0].Data());
-  cv::Mat temp = cv::Mat::zeros(h_, w_, CV_32FC3);  // RGB image
-  int pix_num = h_ * w_;
-  int frame_pix_num = pix_num * c_;
+  int frame_num = 0;
+  if (!GetOutputFrameNum(infer_results[0], &frame_num)) {
+    return false;
+  }
   for (int frame = 0; frame < frame_num; frame++) {
-    int index = 0;
-    for (int h = 0; h < h_; ++h) {
-      for (int w = 0; w < w_; ++w) {
-        temp.at<cv::Vec3f>(h, w) = {
-            out_data[2 * pix_num + index + frame_pix_num * frame],
-            out_data[pix_num + index + frame_pix_num * frame],
-            out_data[index + frame_pix_num * frame]};
-        index += 1;
+    results.push_back(OutputFrameToMat(infer_results[0], frame));
+  }
+  return true;
+}
+
+bool PPMSVSR::SetStreamWindow(int window_size, int stride) {
+  if (window_size < 1 || stride < 1 || stride > window_size) {
+    FDERROR << "The window size should be >= 1 and the stride should be in [1, "
+               "window_size], but now they are "
+            << window_size << " and " << stride << "." << std::endl;
+    return false;
+  }
+  if (stride != 1 && OutputsCenterFrame()) {
+    FDERROR << ModelName() << " outputs the center frame of each window, the "
+            << "stride should be 1, but now it's " << stride << "."
+            << std::endl;
+    return false;
+  }
+  window_size_ = window_size;
+  stride_ = stride;
+  ResetStream();
+  return true;
+}
+
+bool PPMSVSR::OutputsCenterFrame() {
+  return OutputInfoOfRuntime(0).shape.size() == 4;
+}
+
+void PPMSVSR::ResetStream() {
+  ring_.clear();
+  ring_.shrink_to_fit();
+  padded_window_.clear();
+  padded_window_.shrink_to_fit();
+  frame_shape_.clear();
+  num_stream_frames_ = 0;
+  stream_window_end_ = 0;
+  next_stream_output_ = 0;
+  stream_results_.clear();
+}
+
+bool PPMSVSR::PushFrame(const cv::Mat& frame) {
+  std::vector<int> shape = {frame.channels(), frame.rows, frame.cols};
+  if (num_stream_frames_ == 0) {
+    frame_shape_ = shape;
+    ring_.resize(2 * window_size_ * frame.total() * frame.channels());
+    center_frame_ = OutputsCenterFrame();
+  } else if (shape != frame_shape_) {
+    FDERROR << "The shape of frames in a stream should be the same, call "
+               "ResetStream() to start a new stream."
+            << std::endl;
+    return false;
+  }
+  size_t frame_size = frame.total() * frame.channels();
+  float* slot = ring_.data() + (num_stream_frames_ % window_size_) * frame_size;
+  if (!Preprocess(frame, slot)) {
+    FDERROR << "Failed to preprocess the frame." << std::endl;
+    return false;
+  }
+  std::memcpy(slot + window_size_ * frame_size, slot,
+              frame_size * sizeof(float));
+  ++num_stream_frames_;
+
+  if (center_frame_) {
+    // The window of the frame is completed by the new frame
+    int64_t center =
+        num_stream_frames_ - 1 - (window_size_ - 1 - window_size_ / 2);
+    return center < 0 || RunCenterFrameWindow(center);
+  }
+  int64_t window_start = num_stream_frames_ - window_size_;
+  if (window_start >= 0 && window_start % stride_ == 0) {
+    return RunStreamWindow(window_start, window_size_);
+  }
+  return true;
+}
+
+bool PPMSVSR::PopFrame(cv::Mat* result) {
+  if (stream_results_.empty()) {
+    return false;
+  }
+  *result = std::move(stream_results_.front());
+  stream_results_.pop_front();
+  return true;
+}
+
+bool PPMSVSR::FlushStream() {
+  if (center_frame_) {
+    // The windows of the last frames are padded by the last frame
+    for (int64_t center = next_stream_output_; center < num_stream_frames_;
+         ++center) {
+      if (!RunCenterFrameWindow(center)) {
+        return false;
       }
     }
-    // tmp data type is float[0-1.0],convert to uint type
-    cv::Mat res = cv::Mat::zeros(temp.size(), CV_8UC3);
-    temp.convertTo(res, CV_8UC3, 255);
-    results.push_back(res);
+    return true;
+  }
+  if (num_stream_frames_ == stream_window_end_) {
+    return true;
+  }
+  // The stream is shorter than one window, run the model with all the frames
+  if (num_stream_frames_ < window_size_) {
+    return RunStreamWindow(0, static_cast<int>(num_stream_frames_));
+  }
+  return RunStreamWindow(num_stream_frames_ - window_size_, window_size_);
+}
+
+bool PPMSVSR::RunStreamWindow(int64_t window_start, int window_size) {
+  size_t frame_size =
+      static_cast<size_t>(frame_shape_[0]) * frame_shape_[1] * frame_shape_[2];
+  float* data =
+      ring_.data() + (window_start % window_size_) * frame_size;
+  if (!InferStreamWindow(data, window_size)) {
+    return false;
+  }
+  stream_window_end_ = window_start + window_size;
+  if (!StreamPostprocess(reused_output_tensors_[0], window_start,
+                         window_size)) {
+    FDERROR << "Failed to post process." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool PPMSVSR::RunCenterFrameWindow(int64_t center) {
+  int64_t window_start = center - window_size_ / 2;
+  int64_t last = num_stream_frames_ - 1;
+  if (window_start >= 0 && window_start + window_size_ - 1 <= last) {
+    return RunStreamWindow(window_start, window_size_);
+  }
+  // The window exceeds the stream, which is padded by replicating the first
+  // or the last frame
+  size_t frame_size =
+      static_cast<size_t>(frame_shape_[0]) * frame_shape_[1] * frame_shape_[2];
+  padded_window_.resize(window_size_ * frame_size);
+  for (int i = 0; i < window_size_; ++i) {
+    int64_t frame = std::min(std::max(window_start + i, int64_t(0)), last);
+    std::memcpy(padded_window_.data() + i * frame_size,
+                ring_.data() + (frame % window_size_) * frame_size,
+                frame_size * sizeof(float));
+  }
+  if (!InferStreamWindow(padded_window_.data(), window_size_)) {
+    return false;
+  }
+  if (!StreamPostprocess(reused_output_tensors_[0], window_start,
+                         window_size_)) {
+    FDERROR << "Failed to post process." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool PPMSVSR::InferStreamWindow(float* data, int window_size) {
+  reused_input_tensors_.resize(1);
+  reused_input_tensors_[0].SetExternalData(
+      {1, window_size, frame_shape_[0], frame_shape_[1], frame_shape_[2]},
+      FDDataType::FP32, data);
+  reused_input_tensors_[0].name = InputInfoOfRuntime(0).name;
+  if (!Infer(reused_input_tensors_, &reused_output_tensors_)) {
+    FDERROR << "Failed to inference." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool PPMSVSR::StreamPostprocess(const FDTensor& output, int64_t window_start,
+                                int window_size) {
+  int frame_num = 0;
+  if (!GetOutputFrameNum(output, &frame_num)) {
+    return false;
+  }
+  // The output frames are the frames of the window, or the center frame of
+  // the window for EDVR
+  int64_t first = window_start;
+  if (center_frame_) {
+    first = window_start + window_size / 2;
+    if (frame_num != 1) {
+      FDERROR << "The model outputs " << frame_num
+              << " frames, but it should output the center frame only."
+              << std::endl;
+      return false;
+    }
+  } else if (frame_num != window_size) {
+    FDERROR << "The model outputs " << frame_num << " frames for a window of "
+            << window_size << " frames." << std::endl;
+    return false;
+  }
+  // Only the frames not output by the previous windows are converted
+  for (int frame = 0; frame < frame_num; ++frame) {
+    if (first + frame >= next_stream_output_) {
+      stream_results_.push_back(OutputFrameToMat(output, frame));
+      next_stream_output_ = first + frame + 1;
+    }
   }
   return true;
 }
+
 }  // namespace sr
 }  // namespace vision
-}  // namespace fastdeploy
\ No newline at end of file
+}  // namespace fastdeploy
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #pragma once
+#include <deque>
+
 #include "fastdeploy/fastdeploy_model.h"
 #include "fastdeploy/vision/common/processors/transform.h"
 
@@ -42,18 +44,82 @@ class FASTDEPLOY_DECL PPMSVSR : public FastDeployModel {
   virtual bool Predict(std::vector<cv::Mat>& imgs,
                        std::vector<cv::Mat>& results);
 
+  /**
+   * Set the sliding window of the streaming mode, the stream will be reset
+   * @param[in] window_size The number of frames fed to the model each time
+   * @param[in] stride The number of new frames between two adjacent windows, the windows overlap if stride < window_size. EDVR outputs the center frame of each window, so stride must be 1 for it
+   * @return true if the window is valid, otherwise false
+   */
+  bool SetStreamWindow(int window_size, int stride = 1);
+
+  /**
+   * Push a frame of the video in the streaming mode, the model runs once a window is completed, and the super resolution frames can be got by PopFrame
+   * @param[in] frame The input frame, 3-D array with layout HWC, BGR format
+   * @return true if the frame is pushed and the inference successed, otherwise false
+   */
+  bool PushFrame(const cv::Mat& frame);
+
+  /**
+   * Get the next super resolution frame in the streaming mode
+   * @param[in] result The output super resolution frame
+   * @return true if a frame is got, false if no frame is ready now
+   */
+  bool PopFrame(cv::Mat* result);
+
+  /**
+   * Run the last windows at the end of the stream, to output the frames not covered by a completed window. For EDVR, the windows of the first and the last frames are padded by replicating the first and the last frame, so every frame gets an output
+   * @return true if the inference successed, otherwise false
+   */
+  bool FlushStream();
+
+  /// Drop all the frames of the stream, start a new stream
+  void ResetStream();
+
  protected:
   PPMSVSR(){};
 
   virtual bool Initialize();
 
-  virtual bool Preprocess(Mat* mat, std::vector<float>& output);
+  /// Convert a BGR frame to the normalized RGB CHW data in output
+  virtual bool Preprocess(const cv::Mat& frame, float* output);
 
   virtual bool Postprocess(std::vector<FDTensor>& infer_results,
                            std::vector<cv::Mat>& results);
 
+  // Append the output frames of the window whose indices in the stream are not
+  // less than next_stream_output_ to stream_results_
+  bool StreamPostprocess(const FDTensor& output, int64_t window_start,
+                         int window_size);
+
+  // Whether the model outputs the center frame of each window like EDVR
+  bool OutputsCenterFrame();
+
+  // Run the window in the ring
+  bool RunStreamWindow(int64_t window_start, int window_size);
+
+  // Run the window whose center frame is center, the frames out of the
+  // stream are padded by the first or the last frame
+  bool RunCenterFrameWindow(int64_t center);
+
+  bool InferStreamWindow(float* data, int window_size);
+
   std::vector<float> mean_;
   std::vector<float> scale_;
+
+  int window_size_ = 2;
+  int stride_ = 1;
+  // The preprocessed frames, the frame i of the stream is stored at both
+  // slot i % window_size_ and slot i % window_size_ + window_size_, so each
+  // window is contiguous in the ring
+  std::vector<float> ring_;
+  // The window padded at the beginning or the end of the stream
+  std::vector<float> padded_window_;
+  bool center_frame_ = false;
+  std::vector<int> frame_shape_;
+  int64_t num_stream_frames_ = 0;
+  int64_t stream_window_end_ = 0;
+  int64_t next_stream_output_ = 0;
+  std::deque<cv::Mat> stream_results_;
 };
 }  // namespace sr
 }  // namespace vision
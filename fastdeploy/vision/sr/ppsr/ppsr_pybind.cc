@@ -27,15 +27,48 @@ void BindPPSR(pybind11::module& m) {
              }
              std::vector<cv::Mat> res;
              std::vector<pybind11::array> res_pyarray;
-             self.Predict(inputs, res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(inputs, res);
+             }
              for (auto& img : res) {
                auto ret = pybind11::array_t<unsigned char>(
                    {img.rows, img.cols, img.channels()}, img.data);
                res_pyarray.push_back(ret);
              }
              return res_pyarray;
-           });
-  pybind11::class_<vision::sr::EDVR, FastDeployModel>(m, "EDVR")
+           })
+      .def("set_stream_window", &vision::sr::PPMSVSR::SetStreamWindow)
+      .def("push_frame",
+           [](vision::sr::PPMSVSR& self, pybind11::array& data) {
+             auto mat = PyArrayToCvMat(data);
+             bool ret = false;
+             {
+               pybind11::gil_scoped_release release;
+               ret = self.PushFrame(mat);
+             }
+             return ret;
+           })
+      .def("pop_frame",
+           [](vision::sr::PPMSVSR& self) -> pybind11::object {
+             cv::Mat img;
+             if (!self.PopFrame(&img)) {
+               return pybind11::none();
+             }
+             return pybind11::array_t<unsigned char>(
+                 {img.rows, img.cols, img.channels()}, img.data);
+           })
+      .def("flush_stream",
+           [](vision::sr::PPMSVSR& self) {
+             bool ret = false;
+             {
+               pybind11::gil_scoped_release release;
+               ret = self.FlushStream();
+             }
+             return ret;
+           })
+      .def("reset_stream", &vision::sr::PPMSVSR::ResetStream);
+  pybind11::class_<vision::sr::EDVR, vision::sr::PPMSVSR>(m, "EDVR")
       .def(pybind11::init<std::string, std::string, RuntimeOption,
                           ModelFormat>())
       .def("predict",
@@ -47,7 +80,10 @@ void BindPPSR(pybind11::module& m) {
              }
              std::vector<cv::Mat> res;
              std::vector<pybind11::array> res_pyarray;
-             self.Predict(inputs, res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(inputs, res);
+             }
              for (auto& img : res) {
                auto ret = pybind11::array_t<unsigned char>(
                    {img.rows, img.cols, img.channels()}, img.data);
@@ -55,7 +91,7 @@ void BindPPSR(pybind11::module& m) {
              }
              return res_pyarray;
            });
-  pybind11::class_<vision::sr::BasicVSR, FastDeployModel>(m, "BasicVSR")
+  pybind11::class_<vision::sr::BasicVSR, vision::sr::PPMSVSR>(m, "BasicVSR")
       .def(pybind11::init<std::string, std::string, RuntimeOption,
                           ModelFormat>())
       .def("predict",
@@ -67,7 +103,10 @@ void BindPPSR(pybind11::module& m) {
              }
              std::vector<cv::Mat> res;
              std::vector<pybind11::array> res_pyarray;
-             self.Predict(inputs, res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(inputs, res);
+             }
              for (auto& img : res) {
                auto ret = pybind11::array_t<unsigned char>(
                    {img.rows, img.cols, img.channels()}, img.data);
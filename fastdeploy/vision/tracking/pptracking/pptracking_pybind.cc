@@ -29,7 +29,10 @@ void BindPPTracking(pybind11::module &m) {
             pybind11::array &data) {
              auto mat = PyArrayToCvMat(data);
              vision::MOTResult res;
-             self.Predict(&mat, &res);
+             {
+               pybind11::gil_scoped_release release;
+               self.Predict(&mat, &res);
+             }
              return res;
          })
     .def("bind_recorder", &vision::tracking::PPTracking::BindRecorder)
@@ -0,0 +1,194 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/vision/utils/utils.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace fastdeploy {
+namespace vision {
+namespace utils {
+
+namespace {
+
+// Each lane keeps the first maximum of its elements, so the first maximum
+// of array is the lane with the largest value and the smallest index
+template <int kLanes>
+int ReduceLanes(const float* values, const int32_t* indices, int start,
+                const float* array, int array_size, float* max_value) {
+  float best = values[0];
+  int best_index = indices[0];
+  for (int i = 1; i < kLanes; ++i) {
+    if (values[i] > best || (values[i] == best && indices[i] < best_index)) {
+      best = values[i];
+      best_index = indices[i];
+    }
+  }
+  for (int i = start; i < array_size; ++i) {
+    if (array[i] > best) {
+      best = array[i];
+      best_index = i;
+    }
+  }
+  *max_value = best;
+  return best_index;
+}
+
+}  // namespace
+
+int ArgMaxWithValue(const float* array, int array_size, float* max_value) {
+  int i = 0;
+#if defined(__AVX2__)
+  if (array_size >= 8) {
+    __m256 vmax = _mm256_loadu_ps(array);
+    __m256i vidx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i cur = vidx;
+    const __m256i step = _mm256_set1_epi32(8);
+    for (i = 8; i + 8 <= array_size; i += 8) {
+      cur = _mm256_add_epi32(cur, step);
+      __m256 v = _mm256_loadu_ps(array + i);
+      __m256 gt = _mm256_cmp_ps(v, vmax, _CMP_GT_OQ);
+      vmax = _mm256_blendv_ps(vmax, v, gt);
+      vidx = _mm256_blendv_epi8(vidx, cur, _mm256_castps_si256(gt));
+    }
+    alignas(32) float values[8];
+    alignas(32) int32_t indices[8];
+    _mm256_store_ps(values, vmax);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), vidx);
+    return ReduceLanes<8>(values, indices, i, array, array_size, max_value);
+  }
+#elif defined(__SSE2__)
+  if (array_size >= 4) {
+    __m128 vmax = _mm_loadu_ps(array);
+    __m128i vidx = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i cur = vidx;
+    const __m128i step = _mm_set1_epi32(4);
+    for (i = 4; i + 4 <= array_size; i += 4) {
+      cur = _mm_add_epi32(cur, step);
+      __m128 v = _mm_loadu_ps(array + i);
+      __m128 gt = _mm_cmpgt_ps(v, vmax);
+      __m128i gti = _mm_castps_si128(gt);
+      vmax = _mm_or_ps(_mm_and_ps(gt, v), _mm_andnot_ps(gt, vmax));
+      vidx = _mm_or_si128(_mm_and_si128(gti, cur), _mm_andnot_si128(gti, vidx));
+    }
+    alignas(16) float values[4];
+    alignas(16) int32_t indices[4];
+    _mm_store_ps(values, vmax);
+    _mm_store_si128(reinterpret_cast<__m128i*>(indices), vidx);
+    return ReduceLanes<4>(values, indices, i, array, array_size, max_value);
+  }
+#elif defined(__ARM_NEON)
+  if (array_size >= 4) {
+    float32x4_t vmax = vld1q_f32(array);
+    const int32_t init[4] = {0, 1, 2, 3};
+    int32x4_t vidx = vld1q_s32(init);
+    int32x4_t cur = vidx;
+    const int32x4_t step = vdupq_n_s32(4);
+    for (i = 4; i + 4 <= array_size; i += 4) {
+      cur = vaddq_s32(cur, step);
+      float32x4_t v = vld1q_f32(array + i);
+      uint32x4_t gt = vcgtq_f32(v, vmax);
+      vmax = vbslq_f32(gt, v, vmax);
+      vidx = vbslq_s32(gt, cur, vidx);
+    }
+    float values[4];
+    int32_t indices[4];
+    vst1q_f32(values, vmax);
+    vst1q_s32(indices, vidx);
+    return ReduceLanes<4>(values, indices, i, array, array_size, max_value);
+  }
+#endif
+  if (array_size <= 0) {
+    *max_value = 0.0f;
+    return -1;
+  }
+  int best_index = 0;
+  for (i = 1; i < array_size; ++i) {
+    if (array[i] > array[best_index]) {
+      best_index = i;
+    }
+  }
+  *max_value = array[best_index];
+  return best_index;
+}
+
+void ArgMaxOverChannels(const float* data, int64_t num_channels,
+                        int64_t channel_stride, int64_t width,
+                        int32_t* labels, float* max_values) {
+  int64_t x = 0;
+#if defined(__AVX2__)
+  for (; x + 8 <= width; x += 8) {
+    __m256 vmax = _mm256_loadu_ps(data + x);
+    __m256i vidx = _mm256_setzero_si256();
+    for (int64_t c = 1; c < num_channels; ++c) {
+      __m256 v = _mm256_loadu_ps(data + c * channel_stride + x);
+      __m256 gt = _mm256_cmp_ps(v, vmax, _CMP_GT_OQ);
+      vmax = _mm256_blendv_ps(vmax, v, gt);
+      vidx = _mm256_blendv_epi8(vidx, _mm256_set1_epi32(static_cast<int>(c)),
+                                _mm256_castps_si256(gt));
+    }
+    _mm256_storeu_ps(max_values + x, vmax);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(labels + x), vidx);
+  }
+#elif defined(__SSE2__)
+  for (; x + 4 <= width; x += 4) {
+    __m128 vmax = _mm_loadu_ps(data + x);
+    __m128i vidx = _mm_setzero_si128();
+    for (int64_t c = 1; c < num_channels; ++c) {
+      __m128 v = _mm_loadu_ps(data + c * channel_stride + x);
+      __m128 gt = _mm_cmpgt_ps(v, vmax);
+      __m128i gti = _mm_castps_si128(gt);
+      vmax = _mm_or_ps(_mm_and_ps(gt, v), _mm_andnot_ps(gt, vmax));
+      vidx = _mm_or_si128(
+          _mm_and_si128(gti, _mm_set1_epi32(static_cast<int>(c))),
+          _mm_andnot_si128(gti, vidx));
+    }
+    _mm_storeu_ps(max_values + x, vmax);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(labels + x), vidx);
+  }
+#elif defined(__ARM_NEON)
+  for (; x + 4 <= width; x += 4) {
+    float32x4_t vmax = vld1q_f32(data + x);
+    int32x4_t vidx = vdupq_n_s32(0);
+    for (int64_t c = 1; c < num_channels; ++c) {
+      float32x4_t v = vld1q_f32(data + c * channel_stride + x);
+      uint32x4_t gt = vcgtq_f32(v, vmax);
+      vmax = vbslq_f32(gt, v, vmax);
+      vidx = vbslq_s32(gt, vdupq_n_s32(static_cast<int32_t>(c)), vidx);
+    }
+    vst1q_f32(max_values + x, vmax);
+    vst1q_s32(labels + x, vidx);
+  }
+#endif
+  for (; x < width; ++x) {
+    float max_value = data[x];
+    int32_t label = 0;
+    for (int64_t c = 1; c < num_channels; ++c) {
+      if (data[c * channel_stride + x] > max_value) {
+        max_value = data[c * channel_stride + x];
+        label = static_cast<int32_t>(c);
+      }
+    }
+    max_values[x] = max_value;
+    labels[x] = label;
+  }
+}
+
+}  // namespace utils
+}  // namespace vision
+}  // namespace fastdeploy
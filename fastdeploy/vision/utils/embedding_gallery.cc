@@ -0,0 +1,802 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "fastdeploy/vision/utils/embedding_gallery.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// float16.h uses the F16C intrinsics if they are enabled
+#include "fastdeploy/core/float16.h"
+#include "fastdeploy/utils/parallel.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace fastdeploy {
+namespace vision {
+namespace utils {
+
+namespace {
+
+// The rows are padded to a multiple of 16 values with zeros, so the kernels
+// need no tail loops
+constexpr int kStrideAlign = 16;
+// The alignment of the rows in memory and of the sections in the file
+constexpr size_t kAlignment = 64;
+// The rows of a tile are scanned by all the queries while they are in cache
+constexpr int kTileRows = 64;
+// The queries are quantized to int16 in [-kQueryLevel, kQueryLevel] for the
+// INT8 gallery, large enough to make the error of the gallery dominate
+constexpr int kQueryLevel = 2047;
+// |<row, query>| <= 127 * kQueryLevel * dim for the INT8 gallery, so the
+// int32 accumulators can't overflow for dim <= kMaxINT8Dim
+constexpr int kMaxINT8Dim = 8192;
+static_assert(int64_t{127} * kQueryLevel * kMaxINT8Dim <=
+                  std::numeric_limits<int32_t>::max(),
+              "The int32 accumulators of the INT8 gallery may overflow.");
+constexpr char kMagic[8] = {'F', 'D', 'G', 'A', 'L', 'R', 'Y', '\0'};
+constexpr uint32_t kVersion = 1;
+
+struct GalleryFileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t precision;
+  uint32_t dim;
+  uint32_t stride;
+  uint32_t normalize;
+  uint32_t reserved;
+  uint64_t size;
+  uint64_t ids_offset;
+  uint64_t scales_offset;
+  uint64_t data_offset;
+};
+
+size_t AlignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+size_t ElementBytes(GalleryPrecision precision) {
+  if (precision == GalleryPrecision::FP16) {
+    return 2;
+  } else if (precision == GalleryPrecision::INT8) {
+    return 1;
+  }
+  return 4;
+}
+
+float InvNorm(const float* values, int n, bool normalize) {
+  if (!normalize) {
+    return 1.0f;
+  }
+  float sum = 0.0f;
+  for (int i = 0; i < n; ++i) {
+    sum += values[i] * values[i];
+  }
+  return sum > 0.0f ? 1.0f / std::sqrt(sum) : 1.0f;
+}
+
+// Quantize n values symmetrically to [-level, level] and return the scale
+template <typename T>
+float Quantize(const float* values, int n, float inv_norm, int level,
+               T* output) {
+  float max_abs = 0.0f;
+  for (int i = 0; i < n; ++i) {
+    max_abs = std::max(max_abs, std::fabs(values[i] * inv_norm));
+  }
+  if (max_abs == 0.0f) {
+    std::fill(output, output + n, T(0));
+    return 0.0f;
+  }
+  float scale = max_abs / level;
+  float inv_scale = 1.0f / scale;
+  for (int i = 0; i < n; ++i) {
+    float q = std::round(values[i] * inv_norm * inv_scale);
+    output[i] = static_cast<T>(std::min<float>(std::max<float>(q, -level),
+                                               level));
+  }
+  return scale;
+}
+
+#if defined(__AVX2__)
+float HorizontalSum(__m256 v) {
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v),
+                          _mm256_extractf128_ps(v, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  return _mm_cvtss_f32(sum);
+}
+
+int32_t HorizontalSum(__m256i v) {
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v),
+                              _mm256_extracti128_si256(v, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+  return _mm_cvtsi128_si32(sum);
+}
+#elif defined(__SSE2__)
+float HorizontalSum(__m128 v) {
+  __m128 sum = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  return _mm_cvtss_f32(sum);
+}
+
+int32_t HorizontalSum(__m128i v) {
+  __m128i sum = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+  return _mm_cvtsi128_si32(sum);
+}
+#elif defined(__ARM_NEON)
+float HorizontalSum(float32x4_t v) {
+  float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpadd_f32(sum, sum), 0);
+}
+
+int32_t HorizontalSum(int32x4_t v) {
+  int32x2_t sum = vadd_s32(vget_low_s32(v), vget_high_s32(v));
+  return vget_lane_s32(vpadd_s32(sum, sum), 0);
+}
+#endif
+
+// out[j] = <row, queries[j]> for j in [0, M), the row is loaded once for
+// the M queries
+template <int M>
+void DotFP32(const float* row, const float* queries, int stride, float* out) {
+  int i = 0;
+#if defined(__AVX2__)
+  __m256 acc[M];
+  for (int j = 0; j < M; ++j) {
+    acc[j] = _mm256_setzero_ps();
+  }
+  for (; i < stride; i += 8) {
+    __m256 r = _mm256_loadu_ps(row + i);
+    for (int j = 0; j < M; ++j) {
+      __m256 q = _mm256_loadu_ps(queries + j * stride + i);
+#if defined(__FMA__)
+      acc[j] = _mm256_fmadd_ps(r, q, acc[j]);
+#else
+      acc[j] = _mm256_add_ps(acc[j], _mm256_mul_ps(r, q));
+#endif
+    }
+  }
+  for (int j = 0; j < M; ++j) {
+    out[j] = HorizontalSum(acc[j]);
+  }
+#elif defined(__SSE2__)
+  __m128 acc[M];
+  for (int j = 0; j < M; ++j) {
+    acc[j] = _mm_setzero_ps();
+  }
+  for (; i < stride; i += 4) {
+    __m128 r = _mm_loadu_ps(row + i);
+    for (int j = 0; j < M; ++j) {
+      acc[j] = _mm_add_ps(acc[j],
+                          _mm_mul_ps(r, _mm_loadu_ps(queries + j * stride + i)));
+    }
+  }
+  for (int j = 0; j < M; ++j) {
+    out[j] = HorizontalSum(acc[j]);
+  }
+#elif defined(__ARM_NEON)
+  float32x4_t acc[M];
+  for (int j = 0; j < M; ++j) {
+    acc[j] = vdupq_n_f32(0.0f);
+  }
+  for (; i < stride; i += 4) {
+    float32x4_t r = vld1q_f32(row + i);
+    for (int j = 0; j < M; ++j) {
+      acc[j] = vmlaq_f32(acc[j], r, vld1q_f32(queries + j * stride + i));
+    }
+  }
+  for (int j = 0; j < M; ++j) {
+    out[j] = HorizontalSum(acc[j]);
+  }
+#else
+  for (int j = 0; j < M; ++j) {
+    float sum = 0.0f;
+    for (i = 0; i < stride; ++i) {
+      sum += row[i] * queries[j * stride + i];
+    }
+    out[j] = sum;
+  }
+#endif
+}
+
+// out[j] = <row, queries[j]> in int32 for j in [0, M)
+template <int M>
+void DotINT8(const int8_t* row, const int16_t* queries, int stride,
+             int32_t* out) {
+  int i = 0;
+#if defined(__AVX2__)
+  __m256i acc[M];
+  for (int j = 0; j < M; ++j) {
+    acc[j] = _mm256_setzero_si256();
+  }
+  for (; i < stride; i += 16) {
+    __m256i r = _mm256_cvtepi8_epi16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i)));
+    for (int j = 0; j < M; ++j) {
+      __m256i q = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(queries + j * stride + i));
+      acc[j] = _mm256_add_epi32(acc[j], _mm256_madd_epi16(r, q));
+    }
+  }
+  for (int j = 0; j < M; ++j) {
+    out[j] = HorizontalSum(acc[j]);
+  }
+#elif defined(__SSE2__)
+  __m128i acc[M];
+  for (int j = 0; j < M; ++j) {
+    acc[j] = _mm_setzero_si128();
+  }
+  for (; i < stride; i += 16) {
+    __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+    // Sign extend int8 to int16 without SSE4.1
+    __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(r, r), 8);
+    __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(r, r), 8);
+    for (int j = 0; j < M; ++j) {
+      const int16_t* q = queries + j * stride + i;
+      __m128i q0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+      __m128i q1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q + 8));
+      acc[j] = _mm_add_epi32(acc[j], _mm_add_epi32(_mm_madd_epi16(lo, q0),
+                                                   _mm_madd_epi16(hi, q1)));
+    }
+  }
+  for (int j = 0; j < M; ++j) {
+    out[j] = HorizontalSum(acc[j]);
+  }
+#elif defined(__ARM_NEON)
+  int32x4_t acc[M];
+  for (int j = 0; j < M; ++j) {
+    acc[j] = vdupq_n_s32(0);
+  }
+  for (; i < stride; i += 16) {
+    int8x16_t r = vld1q_s8(row + i);
+    int16x8_t lo = vmovl_s8(vget_low_s8(r));
+    int16x8_t hi = vmovl_s8(vget_high_s8(r));
+    for (int j = 0; j < M; ++j) {
+      const int16_t* q = queries + j * stride + i;
+      int16x8_t q0 = vld1q_s16(q);
+      int16x8_t q1 = vld1q_s16(q + 8);
+      acc[j] = vmlal_s16(acc[j], vget_low_s16(lo), vget_low_s16(q0));
+      acc[j] = vmlal_s16(acc[j], vget_high_s16(lo), vget_high_s16(q0));
+      acc[j] = vmlal_s16(acc[j], vget_low_s16(hi), vget_low_s16(q1));
+      acc[j] = vmlal_s16(acc[j], vget_high_s16(hi), vget_high_s16(q1));
+    }
+  }
+  for (int j = 0; j < M; ++j) {
+    out[j] = HorizontalSum(acc[j]);
+  }
+#else
+  for (int j = 0; j < M; ++j) {
+    int32_t sum = 0;
+    for (i = 0; i < stride; ++i) {
+      sum += static_cast<int32_t>(row[i]) * queries[j * stride + i];
+    }
+    out[j] = sum;
+  }
+#endif
+}
+
+void DecodeFP16(const uint16_t* input, int n, float* output) {
+  int i = 0;
+#if defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(output + i,
+                     _mm256_cvtph_ps(_mm_loadu_si128(
+                         reinterpret_cast<const __m128i*>(input + i))));
+  }
+#endif
+  for (; i < n; ++i) {
+    float16 value;
+    value.x = input[i];
+    output[i] = static_cast<float>(value);
+  }
+}
+
+struct Candidate {
+  float score;
+  int64_t id;
+};
+
+// Whether a is ranked before b, the equal scores are ranked by ids so the
+// results don't depend on the storage order and the number of threads
+bool Better(const Candidate& a, const Candidate& b) {
+  return a.score > b.score || (a.score == b.score && a.id < b.id);
+}
+
+// Keep the k best candidates, the worst one is at the front of the heap
+class TopKHeap {
+ public:
+  explicit TopKHeap(int k) : k_(k) { heap_.reserve(k); }
+
+  void Push(float score, int64_t id) {
+    if (static_cast<int>(heap_.size()) < k_) {
+      heap_.push_back({score, id});
+      std::push_heap(heap_.begin(), heap_.end(), Better);
+    } else if (score >= heap_.front().score &&
+               Better({score, id}, heap_.front())) {
+      std::pop_heap(heap_.begin(), heap_.end(), Better);
+      heap_.back() = {score, id};
+      std::push_heap(heap_.begin(), heap_.end(), Better);
+    }
+  }
+
+  std::vector<Candidate>& Data() { return heap_; }
+
+ private:
+  int k_;
+  std::vector<Candidate> heap_;
+};
+
+}  // namespace
+
+EmbeddingGallery::EmbeddingGallery(int dim, GalleryPrecision precision,
+                                   bool normalize)
+    : dim_(dim),
+      stride_(static_cast<int>(AlignUp(std::max(dim, 0), kStrideAlign))),
+      precision_(precision),
+      normalize_(normalize) {
+  FDASSERT(dim >= 0, "The dimension of embeddings should be >= 0.");
+}
+
+EmbeddingGallery::~EmbeddingGallery() { Unmap(); }
+
+size_t EmbeddingGallery::RowBytes() const {
+  return stride_ * ElementBytes(precision_);
+}
+
+void EmbeddingGallery::Reserve(size_t rows) {
+  if (rows <= capacity_ && mapped_ == nullptr) {
+    return;
+  }
+  size_t capacity = std::max(rows, capacity_);
+  if (rows > capacity_) {
+    capacity = std::max<size_t>({rows, capacity_ * 2, 64});
+  }
+  std::unique_ptr<uint8_t[]> buffer(
+      new uint8_t[capacity * RowBytes() + kAlignment]);
+  uint8_t* aligned = reinterpret_cast<uint8_t*>(
+      AlignUp(reinterpret_cast<size_t>(buffer.get()), kAlignment));
+  if (Size() > 0) {
+    std::memcpy(aligned, data_, Size() * RowBytes());
+  }
+  Unmap();
+  buffer_ = std::move(buffer);
+  owned_data_ = aligned;
+  capacity_ = capacity;
+  data_ = owned_data_;
+}
+
+void EmbeddingGallery::Swap(EmbeddingGallery* other) {
+  std::swap(dim_, other->dim_);
+  std::swap(stride_, other->stride_);
+  std::swap(precision_, other->precision_);
+  std::swap(normalize_, other->normalize_);
+  ids_.swap(other->ids_);
+  id_to_row_.swap(other->id_to_row_);
+  scales_.swap(other->scales_);
+  buffer_.swap(other->buffer_);
+  std::swap(owned_data_, other->owned_data_);
+  std::swap(capacity_, other->capacity_);
+  std::swap(mapped_, other->mapped_);
+  std::swap(mapped_size_, other->mapped_size_);
+  std::swap(data_, other->data_);
+}
+
+void EmbeddingGallery::Unmap() {
+  if (mapped_ == nullptr) {
+    return;
+  }
+#if !defined(_WIN32)
+  munmap(mapped_, mapped_size_);
+#endif
+  mapped_ = nullptr;
+  mapped_size_ = 0;
+  data_ = owned_data_;
+}
+
+void EmbeddingGallery::EncodeRow(const float* embedding, size_t row) {
+  uint8_t* dst = owned_data_ + row * RowBytes();
+  std::memset(dst, 0, RowBytes());
+  float inv_norm = InvNorm(embedding, dim_, normalize_);
+  if (precision_ == GalleryPrecision::FP32) {
+    float* values = reinterpret_cast<float*>(dst);
+    for (int i = 0; i < dim_; ++i) {
+      values[i] = embedding[i] * inv_norm;
+    }
+  } else if (precision_ == GalleryPrecision::FP16) {
+    uint16_t* values = reinterpret_cast<uint16_t*>(dst);
+    for (int i = 0; i < dim_; ++i) {
+      values[i] = float16(embedding[i] * inv_norm).x;
+    }
+  } else {
+    scales_[row] = Quantize(embedding, dim_, inv_norm, 127,
+                            reinterpret_cast<int8_t*>(dst));
+  }
+}
+
+bool EmbeddingGallery::Add(int64_t id, const std::vector<float>& embedding) {
+  return Add(std::vector<int64_t>{id}, embedding);
+}
+
+bool EmbeddingGallery::Add(const std::vector<int64_t>& ids,
+                           const std::vector<float>& embeddings) {
+  if (dim_ <= 0) {
+    FDERROR << "The dimension of the gallery is not set." << std::endl;
+    return false;
+  }
+  if (precision_ == GalleryPrecision::INT8 && dim_ > kMaxINT8Dim) {
+    FDERROR << "The dimension of the INT8 gallery should not be greater than "
+            << kMaxINT8Dim << ", but now it's " << dim_ << "." << std::endl;
+    return false;
+  }
+  if (embeddings.size() != ids.size() * dim_) {
+    FDERROR << "The size of embeddings should be " << ids.size() * dim_
+            << ", but now it's " << embeddings.size() << "." << std::endl;
+    return false;
+  }
+  size_t num_new = 0;
+  for (size_t i = 0; i < ids.size(); ++i) {
+    num_new += id_to_row_.count(ids[i]) == 0;
+  }
+  Reserve(Size() + num_new);
+
+  // Assign the rows first, the embedding of an existing id is replaced, and
+  // only the last one of the duplicated ids in the batch is written
+  std::vector<size_t> rows(ids.size());
+  std::vector<uint8_t> written(ids.size(), 0);
+  std::unordered_set<int64_t> seen;
+  for (size_t i = ids.size(); i-- > 0;) {
+    written[i] = seen.insert(ids[i]).second;
+  }
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto iter = id_to_row_.find(ids[i]);
+    if (iter != id_to_row_.end()) {
+      rows[i] = iter->second;
+    } else {
+      rows[i] = ids_.size();
+      id_to_row_[ids[i]] = rows[i];
+      ids_.push_back(ids[i]);
+      scales_.push_back(1.0f);
+    }
+  }
+  fastdeploy::utils::ParallelFor(
+      ids.size(),
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+          if (written[i]) {
+            EncodeRow(embeddings.data() + i * dim_, rows[i]);
+          }
+        }
+      },
+      256);
+  return true;
+}
+
+bool EmbeddingGallery::Remove(int64_t id) {
+  auto iter = id_to_row_.find(id);
+  if (iter == id_to_row_.end()) {
+    return false;
+  }
+  Reserve(Size());
+  // Move the last row to the removed one to keep the rows contiguous
+  size_t row = iter->second;
+  size_t last = Size() - 1;
+  id_to_row_.erase(iter);
+  if (row != last) {
+    std::memcpy(owned_data_ + row * RowBytes(), owned_data_ + last * RowBytes(),
+                RowBytes());
+    ids_[row] = ids_[last];
+    scales_[row] = scales_[last];
+    id_to_row_[ids_[row]] = row;
+  }
+  ids_.pop_back();
+  scales_.pop_back();
+  return true;
+}
+
+void EmbeddingGallery::Clear() {
+  Unmap();
+  ids_.clear();
+  id_to_row_.clear();
+  scales_.clear();
+}
+
+bool EmbeddingGallery::Search(const std::vector<float>& queries, int top_k,
+                              std::vector<int64_t>* ids,
+                              std::vector<float>* scores) const {
+  if (dim_ <= 0 || queries.size() == 0 || queries.size() % dim_ != 0) {
+    FDERROR << "The size of queries should be a positive multiple of the "
+               "dimension "
+            << dim_ << ", but now it's " << queries.size() << "." << std::endl;
+    return false;
+  }
+  if (top_k <= 0) {
+    FDERROR << "top_k should be greater than 0." << std::endl;
+    return false;
+  }
+  int num_queries = static_cast<int>(queries.size() / dim_);
+  int k = static_cast<int>(std::min<size_t>(top_k, Size()));
+  ids->resize(num_queries * k);
+  scores->resize(num_queries * k);
+  if (k == 0) {
+    return true;
+  }
+
+  // Pad the queries to stride_ in the same precision as the rows
+  std::vector<float> query_fp32;
+  std::vector<int16_t> query_int16;
+  std::vector<float> query_scales;
+  if (precision_ == GalleryPrecision::INT8) {
+    query_int16.resize(num_queries * stride_, 0);
+    query_scales.resize(num_queries);
+  } else {
+    query_fp32.resize(num_queries * stride_, 0.0f);
+  }
+  for (int q = 0; q < num_queries; ++q) {
+    const float* query = queries.data() + q * dim_;
+    float inv_norm = InvNorm(query, dim_, normalize_);
+    if (precision_ == GalleryPrecision::INT8) {
+      query_scales[q] = Quantize(query, dim_, inv_norm, kQueryLevel,
+                                 query_int16.data() + q * stride_);
+    } else {
+      for (int i = 0; i < dim_; ++i) {
+        query_fp32[q * stride_ + i] = query[i] * inv_norm;
+      }
+    }
+  }
+
+  // Each chunk of rows keeps its own top k for every query, and they are
+  // merged at the end
+  int64_t num_rows = static_cast<int64_t>(Size());
+  int64_t num_tiles = (num_rows + kTileRows - 1) / kTileRows;
+  int num_chunks = static_cast<int>(std::min<int64_t>(
+      fastdeploy::utils::GetParallelThreadNum(), num_tiles));
+  std::vector<std::vector<Candidate>> partial(num_chunks * num_queries);
+  fastdeploy::utils::ParallelFor(num_chunks, [&](int64_t begin, int64_t end) {
+    std::vector<float> tile;
+    if (precision_ == GalleryPrecision::FP16) {
+      tile.resize(kTileRows * stride_);
+    }
+    std::vector<float> dots(4);
+    std::vector<int32_t> int_dots(4);
+    for (int64_t chunk = begin; chunk < end; ++chunk) {
+      std::vector<TopKHeap> heaps(num_queries, TopKHeap(k));
+      int64_t tile_begin = num_tiles * chunk / num_chunks;
+      int64_t tile_end = num_tiles * (chunk + 1) / num_chunks;
+      for (int64_t t = tile_begin; t < tile_end; ++t) {
+        int64_t row_begin = t * kTileRows;
+        int rows = static_cast<int>(
+            std::min<int64_t>(kTileRows, num_rows - row_begin));
+        const uint8_t* tile_data = data_ + row_begin * RowBytes();
+        if (precision_ == GalleryPrecision::FP16) {
+          DecodeFP16(reinterpret_cast<const uint16_t*>(tile_data),
+                     rows * stride_, tile.data());
+        }
+        for (int q = 0; q < num_queries; q += 4) {
+          int m = std::min(4, num_queries - q);
+          for (int r = 0; r < rows; ++r) {
+            int64_t row = row_begin + r;
+            if (precision_ == GalleryPrecision::INT8) {
+              const int8_t* row_data = reinterpret_cast<const int8_t*>(
+                  tile_data + r * RowBytes());
+              const int16_t* query = query_int16.data() + q * stride_;
+              switch (m) {
+                case 4: DotINT8<4>(row_data, query, stride_, int_dots.data());
+                  break;
+                case 3: DotINT8<3>(row_data, query, stride_, int_dots.data());
+                  break;
+                case 2: DotINT8<2>(row_data, query, stride_, int_dots.data());
+                  break;
+                default: DotINT8<1>(row_data, query, stride_, int_dots.data());
+              }
+              for (int j = 0; j < m; ++j) {
+                dots[j] = int_dots[j] * scales_[row] * query_scales[q + j];
+              }
+            } else {
+              const float* row_data =
+                  precision_ == GalleryPrecision::FP16
+                      ? tile.data() + r * stride_
+                      : reinterpret_cast<const float*>(tile_data) +
+                            r * stride_;
+              const float* query = query_fp32.data() + q * stride_;
+              switch (m) {
+                case 4: DotFP32<4>(row_data, query, stride_, dots.data());
+                  break;
+                case 3: DotFP32<3>(row_data, query, stride_, dots.data());
+                  break;
+                case 2: DotFP32<2>(row_data, query, stride_, dots.data());
+                  break;
+                default: DotFP32<1>(row_data, query, stride_, dots.data());
+              }
+            }
+            for (int j = 0; j < m; ++j) {
+              heaps[q + j].Push(dots[j], ids_[row]);
+            }
+          }
+        }
+      }
+      for (int q = 0; q < num_queries; ++q) {
+        partial[chunk * num_queries + q] = std::move(heaps[q].Data());
+      }
+    }
+  });
+
+  for (int q = 0; q < num_queries; ++q) {
+    std::vector<Candidate> candidates;
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      const std::vector<Candidate>& part = partial[chunk * num_queries + q];
+      candidates.insert(candidates.end(), part.begin(), part.end());
+    }
+    std::partial_sort(candidates.begin(), candidates.begin() + k,
+                      candidates.end(), Better);
+    for (int i = 0; i < k; ++i) {
+      (*ids)[q * k + i] = candidates[i].id;
+      (*scores)[q * k + i] = candidates[i].score;
+    }
+  }
+  return true;
+}
+
+bool EmbeddingGallery::Save(const std::string& path) const {
+  GalleryFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.precision = static_cast<uint32_t>(precision_);
+  header.dim = static_cast<uint32_t>(dim_);
+  header.stride = static_cast<uint32_t>(stride_);
+  header.normalize = normalize_;
+  header.size = Size();
+  header.ids_offset = AlignUp(sizeof(header), kAlignment);
+  header.scales_offset =
+      AlignUp(header.ids_offset + Size() * sizeof(int64_t), kAlignment);
+  header.data_offset =
+      AlignUp(header.scales_offset + Size() * sizeof(float), kAlignment);
+
+  std::ofstream fout(path, std::ios::binary);
+  if (!fout) {
+    FDERROR << "Failed to open file " << path << " to write." << std::endl;
+    return false;
+  }
+  // Write the sections at their aligned offsets, the data section can be
+  // mapped directly since the mapping starts at a page boundary
+  const char zeros[kAlignment] = {0};
+  auto pad_to = [&](uint64_t offset) {
+    fout.write(zeros, offset - static_cast<uint64_t>(fout.tellp()));
+  };
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  pad_to(header.ids_offset);
+  fout.write(reinterpret_cast<const char*>(ids_.data()),
+             Size() * sizeof(int64_t));
+  pad_to(header.scales_offset);
+  fout.write(reinterpret_cast<const char*>(scales_.data()),
+             Size() * sizeof(float));
+  pad_to(header.data_offset);
+  fout.write(reinterpret_cast<const char*>(data_), Size() * RowBytes());
+  if (!fout) {
+    FDERROR << "Failed to write the gallery to " << path << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool EmbeddingGallery::Load(const std::string& path, bool use_mmap) {
+  std::ifstream fin(path, std::ios::binary | std::ios::ate);
+  if (!fin) {
+    FDERROR << "Failed to open file " << path << " to read." << std::endl;
+    return false;
+  }
+  uint64_t file_size = static_cast<uint64_t>(fin.tellg());
+  fin.seekg(0);
+  GalleryFileHeader header;
+  if (file_size < sizeof(header) ||
+      !fin.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    FDERROR << "The file " << path << " is not an embedding gallery."
+            << std::endl;
+    return false;
+  }
+  GalleryPrecision precision = static_cast<GalleryPrecision>(header.precision);
+  if (header.version != kVersion ||
+      header.precision > static_cast<uint32_t>(GalleryPrecision::INT8) ||
+      header.stride != AlignUp(header.dim, kStrideAlign) ||
+      header.data_offset + header.size * header.stride *
+                               ElementBytes(precision) > file_size) {
+    FDERROR << "The embedding gallery file " << path << " is corrupted."
+            << std::endl;
+    return false;
+  }
+  if (precision == GalleryPrecision::INT8 &&
+      header.dim > static_cast<uint32_t>(kMaxINT8Dim)) {
+    FDERROR << "The dimension of the INT8 gallery should not be greater than "
+            << kMaxINT8Dim << ", but now it's " << header.dim << "."
+            << std::endl;
+    return false;
+  }
+
+  std::vector<int64_t> ids(header.size);
+  std::vector<float> scales(header.size);
+  fin.seekg(header.ids_offset);
+  fin.read(reinterpret_cast<char*>(ids.data()), ids.size() * sizeof(int64_t));
+  fin.seekg(header.scales_offset);
+  fin.read(reinterpret_cast<char*>(scales.data()),
+           scales.size() * sizeof(float));
+  if (!fin) {
+    FDERROR << "Failed to read the embedding gallery from " << path << "."
+            << std::endl;
+    return false;
+  }
+
+  // Read into a new gallery and swap it in at last, so this gallery is
+  // unchanged if the file fails to load
+  EmbeddingGallery loaded(static_cast<int>(header.dim), precision,
+                          header.normalize != 0);
+  loaded.id_to_row_.reserve(ids.size());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    if (!loaded.id_to_row_.emplace(ids[i], i).second) {
+      FDERROR << "The embedding gallery file " << path
+              << " has duplicated id " << ids[i] << "." << std::endl;
+      return false;
+    }
+  }
+
+  size_t data_bytes = header.size * loaded.RowBytes();
+#if !defined(_WIN32)
+  if (use_mmap && data_bytes > 0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+      void* mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (mapped != MAP_FAILED) {
+        loaded.mapped_ = mapped;
+        loaded.mapped_size_ = file_size;
+        loaded.data_ =
+            static_cast<const uint8_t*>(mapped) + header.data_offset;
+      }
+    }
+  }
+#endif
+  if (loaded.mapped_ == nullptr) {
+    loaded.Reserve(header.size);
+    fin.seekg(header.data_offset);
+    if (!fin.read(reinterpret_cast<char*>(loaded.owned_data_), data_bytes)) {
+      FDERROR << "Failed to read the embedding gallery from " << path << "."
+              << std::endl;
+      return false;
+    }
+  }
+  loaded.ids_ = std::move(ids);
+  loaded.scales_ = std::move(scales);
+  Swap(&loaded);
+  return true;
+}
+
+}  // namespace utils
+}  // namespace vision
+}  // namespace fastdeploy
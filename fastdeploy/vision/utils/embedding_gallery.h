@@ -0,0 +1,146 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "fastdeploy/utils/utils.h"
+
+namespace fastdeploy {
+namespace vision {
+namespace utils {
+
+/// The storage precision of the embeddings in EmbeddingGallery
+enum class GalleryPrecision {
+  FP32,
+  FP16,  ///< Half of the memory of FP32
+  INT8   ///< A quarter of the memory of FP32, symmetric quantized per embedding, the dimension should not be greater than 8192
+};
+
+/*! @brief A gallery of embeddings for 1:N search by inner product, e.g. the embeddings of the registered faces from the faceid models
+ *
+ * The embeddings are stored contiguously in an aligned buffer, and the search runs SIMD inner products over blocks of the gallery with the threads of ParallelFor. The gallery can be saved to a file and loaded back by mmap without copying the embeddings.
+ */
+class FASTDEPLOY_DECL EmbeddingGallery {
+ public:
+  /** \brief Create an empty gallery
+   *
+   * \param[in] dim The dimension of the embeddings
+   * \param[in] precision The storage precision of the embeddings
+   * \param[in] normalize Whether to L2 normalize the embeddings and the queries, then the scores are cosine similarities
+   */
+  explicit EmbeddingGallery(int dim = 0,
+                            GalleryPrecision precision = GalleryPrecision::FP32,
+                            bool normalize = true);
+  ~EmbeddingGallery();
+
+  EmbeddingGallery(const EmbeddingGallery&) = delete;
+  EmbeddingGallery& operator=(const EmbeddingGallery&) = delete;
+
+  /** \brief Add an embedding to the gallery, the embedding of an existing id will be replaced
+   *
+   * \param[in] id The id of the embedding
+   * \param[in] embedding The embedding with dim values
+   * \return true if the embedding is added, otherwise false
+   */
+  bool Add(int64_t id, const std::vector<float>& embedding);
+
+  /** \brief Add a batch of embeddings to the gallery
+   *
+   * \param[in] ids The ids of the embeddings
+   * \param[in] embeddings The embeddings with ids.size() * dim values
+   * \return true if the embeddings are added, otherwise false
+   */
+  bool Add(const std::vector<int64_t>& ids,
+           const std::vector<float>& embeddings);
+
+  /// Remove the embedding of id, return false if id is not in the gallery
+  bool Remove(int64_t id);
+
+  /// Whether id is in the gallery
+  bool Contains(int64_t id) const { return id_to_row_.count(id) > 0; }
+
+  /// Remove all the embeddings
+  void Clear();
+
+  /** \brief Search the top_k most similar embeddings for each query
+   *
+   * \param[in] queries The queries with num_queries * dim values
+   * \param[in] top_k The number of results for each query, at most Size()
+   * \param[out] ids The ids of the results in shape [num_queries, k], sorted by scores in descending order for each query
+   * \param[out] scores The inner products of the results in shape [num_queries, k]
+   * \return true if the search successed, otherwise false
+   */
+  bool Search(const std::vector<float>& queries, int top_k,
+              std::vector<int64_t>* ids, std::vector<float>* scores) const;
+
+  /// Save the gallery to a file which can be loaded by Load
+  bool Save(const std::string& path) const;
+
+  /** \brief Load the gallery from a file saved by Save, the gallery is replaced only if the whole file is valid
+   *
+   * \param[in] path The path of the file
+   * \param[in] use_mmap Whether to map the embeddings from the file instead of reading them, the mapped embeddings are copied on the first modification
+   * \return true if the gallery is loaded, otherwise false
+   */
+  bool Load(const std::string& path, bool use_mmap = true);
+
+  /// The number of embeddings in the gallery
+  size_t Size() const { return ids_.size(); }
+
+  /// The dimension of the embeddings
+  int Dim() const { return dim_; }
+
+  /// The storage precision of the embeddings
+  GalleryPrecision Precision() const { return precision_; }
+
+  /// The ids of the embeddings in storage order
+  const std::vector<int64_t>& Ids() const { return ids_; }
+
+ private:
+  size_t RowBytes() const;
+  // Make sure the embeddings are owned and there is space for rows
+  void Reserve(size_t rows);
+  void Unmap();
+  // Exchange all the embeddings and settings with other
+  void Swap(EmbeddingGallery* other);
+  void EncodeRow(const float* embedding, size_t row);
+
+  int dim_;
+  // The number of values of each row, dim_ padded to a multiple of 16
+  int stride_;
+  GalleryPrecision precision_;
+  bool normalize_;
+
+  std::vector<int64_t> ids_;
+  std::unordered_map<int64_t, size_t> id_to_row_;
+  // The dequantization scale of each row for INT8
+  std::vector<float> scales_;
+
+  // The rows are in buffer_ or in the mapped file
+  std::unique_ptr<uint8_t[]> buffer_;
+  uint8_t* owned_data_ = nullptr;
+  size_t capacity_ = 0;
+  void* mapped_ = nullptr;
+  size_t mapped_size_ = 0;
+  const uint8_t* data_ = nullptr;
+};
+
+}  // namespace utils
+}  // namespace vision
+}  // namespace fastdeploy
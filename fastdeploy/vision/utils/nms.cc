@@ -12,128 +12,321 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "fastdeploy/utils/perf.h"
+#include "fastdeploy/utils/parallel.h"
 #include "fastdeploy/vision/utils/utils.h"
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace fastdeploy {
 namespace vision {
 namespace utils {
 
-// The implementation refers to
-// https://github.com/PaddlePaddle/PaddleDetection/blob/release/2.4/deploy/cpp/src/utils.cc
-void NMS(DetectionResult* result, float iou_threshold,
-         std::vector<int>* index) {
-  // get sorted score indices
-  std::vector<int> sorted_indices;
-  if (index != nullptr) {
-    std::map<float, int, std::greater<float>> score_map;
-    for (size_t i = 0; i < result->scores.size(); ++i) {
-      score_map.insert(std::pair<float, int>(result->scores[i], i));
-    }
-    for (auto iter : score_map) {
-      sorted_indices.push_back(iter.second);
-    }
+namespace {
+
+// The kept boxes of one NMS group in the structure-of-arrays layout, so the
+// IoU between a candidate and all of them can be computed with SIMD
+class KeptBoxes {
+ public:
+  explicit KeptBoxes(size_t capacity) {
+    x1_.reserve(capacity);
+    y1_.reserve(capacity);
+    x2_.reserve(capacity);
+    y2_.reserve(capacity);
+    area_.reserve(capacity);
   }
-  utils::SortDetectionResult(result);
 
-  std::vector<float> area_of_boxes(result->boxes.size());
-  std::vector<int> suppressed(result->boxes.size(), 0);
-  for (size_t i = 0; i < result->boxes.size(); ++i) {
-    area_of_boxes[i] = (result->boxes[i][2] - result->boxes[i][0]) *
-                       (result->boxes[i][3] - result->boxes[i][1]);
+  size_t Size() const { return area_.size(); }
+
+  void Add(const std::array<float, 4>& box, float area) {
+    x1_.push_back(box[0]);
+    y1_.push_back(box[1]);
+    x2_.push_back(box[2]);
+    y2_.push_back(box[3]);
+    area_.push_back(area);
   }
 
-  for (size_t i = 0; i < result->boxes.size(); ++i) {
-    if (suppressed[i] == 1) {
-      continue;
+  // Whether the IoU between box and any kept box is larger than
+  // iou_threshold, IoU > t is tested as inter > t * union to avoid division
+  bool Overlapped(const std::array<float, 4>& box, float area,
+                  float iou_threshold) const {
+    const int num = static_cast<int>(Size());
+    const float* x1 = x1_.data();
+    const float* y1 = y1_.data();
+    const float* x2 = x2_.data();
+    const float* y2 = y2_.data();
+    const float* areas = area_.data();
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256 bx1 = _mm256_set1_ps(box[0]);
+    const __m256 by1 = _mm256_set1_ps(box[1]);
+    const __m256 bx2 = _mm256_set1_ps(box[2]);
+    const __m256 by2 = _mm256_set1_ps(box[3]);
+    const __m256 barea = _mm256_set1_ps(area);
+    const __m256 threshold = _mm256_set1_ps(iou_threshold);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= num; i += 8) {
+      __m256 w = _mm256_sub_ps(_mm256_min_ps(_mm256_loadu_ps(x2 + i), bx2),
+                               _mm256_max_ps(_mm256_loadu_ps(x1 + i), bx1));
+      __m256 h = _mm256_sub_ps(_mm256_min_ps(_mm256_loadu_ps(y2 + i), by2),
+                               _mm256_max_ps(_mm256_loadu_ps(y1 + i), by1));
+      __m256 inter = _mm256_mul_ps(_mm256_max_ps(w, zero),
+                                   _mm256_max_ps(h, zero));
+      __m256 uni = _mm256_sub_ps(
+          _mm256_add_ps(_mm256_loadu_ps(areas + i), barea), inter);
+      __m256 gt = _mm256_cmp_ps(inter, _mm256_mul_ps(threshold, uni),
+                                _CMP_GT_OQ);
+      if (_mm256_movemask_ps(gt) != 0) {
+        return true;
+      }
     }
-    for (size_t j = i + 1; j < result->boxes.size(); ++j) {
-      if (suppressed[j] == 1) {
-        continue;
+#elif defined(__SSE2__)
+    const __m128 bx1 = _mm_set1_ps(box[0]);
+    const __m128 by1 = _mm_set1_ps(box[1]);
+    const __m128 bx2 = _mm_set1_ps(box[2]);
+    const __m128 by2 = _mm_set1_ps(box[3]);
+    const __m128 barea = _mm_set1_ps(area);
+    const __m128 threshold = _mm_set1_ps(iou_threshold);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= num; i += 4) {
+      __m128 w = _mm_sub_ps(_mm_min_ps(_mm_loadu_ps(x2 + i), bx2),
+                            _mm_max_ps(_mm_loadu_ps(x1 + i), bx1));
+      __m128 h = _mm_sub_ps(_mm_min_ps(_mm_loadu_ps(y2 + i), by2),
+                            _mm_max_ps(_mm_loadu_ps(y1 + i), by1));
+      __m128 inter = _mm_mul_ps(_mm_max_ps(w, zero), _mm_max_ps(h, zero));
+      __m128 uni =
+          _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(areas + i), barea), inter);
+      __m128 gt = _mm_cmpgt_ps(inter, _mm_mul_ps(threshold, uni));
+      if (_mm_movemask_ps(gt) != 0) {
+        return true;
       }
-      float xmin = std::max(result->boxes[i][0], result->boxes[j][0]);
-      float ymin = std::max(result->boxes[i][1], result->boxes[j][1]);
-      float xmax = std::min(result->boxes[i][2], result->boxes[j][2]);
-      float ymax = std::min(result->boxes[i][3], result->boxes[j][3]);
-      float overlap_w = std::max(0.0f, xmax - xmin);
-      float overlap_h = std::max(0.0f, ymax - ymin);
-      float overlap_area = overlap_w * overlap_h;
-      float overlap_ratio =
-          overlap_area / (area_of_boxes[i] + area_of_boxes[j] - overlap_area);
-      if (overlap_ratio > iou_threshold) {
-        suppressed[j] = 1;
+    }
+#elif defined(__ARM_NEON)
+    const float32x4_t bx1 = vdupq_n_f32(box[0]);
+    const float32x4_t by1 = vdupq_n_f32(box[1]);
+    const float32x4_t bx2 = vdupq_n_f32(box[2]);
+    const float32x4_t by2 = vdupq_n_f32(box[3]);
+    const float32x4_t barea = vdupq_n_f32(area);
+    const float32x4_t threshold = vdupq_n_f32(iou_threshold);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    for (; i + 4 <= num; i += 4) {
+      float32x4_t w = vsubq_f32(vminq_f32(vld1q_f32(x2 + i), bx2),
+                                vmaxq_f32(vld1q_f32(x1 + i), bx1));
+      float32x4_t h = vsubq_f32(vminq_f32(vld1q_f32(y2 + i), by2),
+                                vmaxq_f32(vld1q_f32(y1 + i), by1));
+      float32x4_t inter = vmulq_f32(vmaxq_f32(w, zero), vmaxq_f32(h, zero));
+      float32x4_t uni =
+          vsubq_f32(vaddq_f32(vld1q_f32(areas + i), barea), inter);
+      uint32x4_t gt = vcgtq_f32(inter, vmulq_f32(threshold, uni));
+      uint32x2_t folded = vorr_u32(vget_low_u32(gt), vget_high_u32(gt));
+      if ((vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1)) != 0) {
+        return true;
       }
     }
+#endif
+    for (; i < num; ++i) {
+      float w =
+          std::max(0.0f, std::min(x2[i], box[2]) - std::max(x1[i], box[0]));
+      float h =
+          std::max(0.0f, std::min(y2[i], box[3]) - std::max(y1[i], box[1]));
+      float inter = w * h;
+      if (inter > iou_threshold * (areas[i] + area - inter)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::vector<float> x1_;
+  std::vector<float> y1_;
+  std::vector<float> x2_;
+  std::vector<float> y2_;
+  std::vector<float> area_;
+};
+
+// Greedy NMS over the candidates in order, which are sorted by scores.
+// Stop once max_keep boxes are kept
+void GreedyNMS(const std::vector<std::array<float, 4>>& boxes,
+               const std::vector<float>& areas, const int* order, size_t num,
+               float iou_threshold, size_t max_keep, std::vector<int>* keep) {
+  keep->clear();
+  if (max_keep == 0) {
+    return;
   }
-  DetectionResult backup(*result);
-  result->Clear();
-  result->Reserve(suppressed.size());
-  for (size_t i = 0; i < suppressed.size(); ++i) {
-    if (suppressed[i] == 1) {
+  KeptBoxes kept(std::min(num, max_keep));
+  for (size_t i = 0; i < num; ++i) {
+    int idx = order[i];
+    if (kept.Overlapped(boxes[idx], areas[idx], iou_threshold)) {
       continue;
     }
-    result->boxes.emplace_back(backup.boxes[i]);
-    result->scores.push_back(backup.scores[i]);
-    result->label_ids.push_back(backup.label_ids[i]);
-    if (index != nullptr) {
-      index->push_back(sorted_indices[i]);
+    kept.Add(boxes[idx], areas[idx]);
+    keep->push_back(idx);
+    if (keep->size() >= max_keep) {
+      break;
     }
   }
 }
 
-void NMS(FaceDetectionResult* result, float iou_threshold) {
-  utils::SortDetectionResult(result);
+// Get the indices of the kept boxes in the descending order of scores. If
+// label_ids is not nullptr, only the boxes with the same label suppress each
+// other, and the labels are processed in parallel
+std::vector<int> KeepIndices(const std::vector<std::array<float, 4>>& boxes,
+                             const std::vector<float>& scores,
+                             const std::vector<int32_t>* label_ids,
+                             float iou_threshold, int top_k) {
+  const size_t num = boxes.size();
+  const size_t max_keep =
+      top_k < 0 ? num : std::min(num, static_cast<size_t>(top_k));
+  // The equal scores keep their original order, the same as
+  // SortDetectionResult
+  std::vector<int> order(num);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&scores](int lhs, int rhs) {
+    return scores[lhs] > scores[rhs];
+  });
+  std::vector<float> areas(num);
+  for (size_t i = 0; i < num; ++i) {
+    areas[i] = (boxes[i][2] - boxes[i][0]) * (boxes[i][3] - boxes[i][1]);
+  }
 
-  std::vector<float> area_of_boxes(result->boxes.size());
-  std::vector<int> suppressed(result->boxes.size(), 0);
-  for (size_t i = 0; i < result->boxes.size(); ++i) {
-    area_of_boxes[i] = (result->boxes[i][2] - result->boxes[i][0]) *
-                       (result->boxes[i][3] - result->boxes[i][1]);
+  std::vector<int> keep;
+  if (label_ids == nullptr) {
+    GreedyNMS(boxes, areas, order.data(), num, iou_threshold, max_keep, &keep);
+    return keep;
   }
 
-  for (size_t i = 0; i < result->boxes.size(); ++i) {
-    if (suppressed[i] == 1) {
-      continue;
-    }
-    for (size_t j = i + 1; j < result->boxes.size(); ++j) {
-      if (suppressed[j] == 1) {
-        continue;
-      }
-      float xmin = std::max(result->boxes[i][0], result->boxes[j][0]);
-      float ymin = std::max(result->boxes[i][1], result->boxes[j][1]);
-      float xmax = std::min(result->boxes[i][2], result->boxes[j][2]);
-      float ymax = std::min(result->boxes[i][3], result->boxes[j][3]);
-      float overlap_w = std::max(0.0f, xmax - xmin);
-      float overlap_h = std::max(0.0f, ymax - ymin);
-      float overlap_area = overlap_w * overlap_h;
-      float overlap_ratio =
-          overlap_area / (area_of_boxes[i] + area_of_boxes[j] - overlap_area);
-      if (overlap_ratio > iou_threshold) {
-        suppressed[j] = 1;
-      }
+  // Group the candidates by labels, each group is still sorted by scores
+  std::vector<int> rank(num);
+  for (size_t i = 0; i < num; ++i) {
+    rank[order[i]] = static_cast<int>(i);
+  }
+  std::stable_sort(order.begin(), order.end(), [label_ids](int lhs, int rhs) {
+    return (*label_ids)[lhs] < (*label_ids)[rhs];
+  });
+  std::vector<size_t> group_starts;
+  for (size_t i = 0; i < num; ++i) {
+    if (i == 0 || (*label_ids)[order[i]] != (*label_ids)[order[i - 1]]) {
+      group_starts.push_back(i);
     }
   }
-  FaceDetectionResult backup(*result);
-  int landmarks_per_face = result->landmarks_per_face;
+  group_starts.push_back(num);
+  const int64_t num_groups = static_cast<int64_t>(group_starts.size()) - 1;
+  std::vector<std::vector<int>> group_keeps(num_groups);
+  fastdeploy::utils::ParallelFor(
+      num_groups, [&](int64_t begin, int64_t end) {
+        for (int64_t g = begin; g < end; ++g) {
+          size_t start = group_starts[g];
+          GreedyNMS(boxes, areas, order.data() + start,
+                    group_starts[g + 1] - start, iou_threshold, max_keep,
+                    &group_keeps[g]);
+        }
+      });
+  for (const auto& group_keep : group_keeps) {
+    keep.insert(keep.end(), group_keep.begin(), group_keep.end());
+  }
+  std::sort(keep.begin(), keep.end(),
+            [&rank](int lhs, int rhs) { return rank[lhs] < rank[rhs]; });
+  if (keep.size() > max_keep) {
+    keep.resize(max_keep);
+  }
+  return keep;
+}
 
-  result->Clear();
-  // don't forget to reset the landmarks_per_face
-  // before apply Reserve method.
-  result->landmarks_per_face = landmarks_per_face;
-  result->Reserve(suppressed.size());
-  for (size_t i = 0; i < suppressed.size(); ++i) {
-    if (suppressed[i] == 1) {
+// The swaps which move the kept elements to the front in the kept order
+std::vector<std::pair<int, int>> CompactSwaps(const std::vector<int>& keep,
+                                              size_t num) {
+  std::vector<int> position(num);
+  std::vector<int> element(num);
+  std::iota(position.begin(), position.end(), 0);
+  std::iota(element.begin(), element.end(), 0);
+  std::vector<std::pair<int, int>> swaps;
+  for (size_t i = 0; i < keep.size(); ++i) {
+    int src = position[keep[i]];
+    if (src == static_cast<int>(i)) {
       continue;
     }
-    result->boxes.emplace_back(backup.boxes[i]);
-    result->scores.push_back(backup.scores[i]);
-    // landmarks (if have)
-    if (result->landmarks_per_face > 0) {
-      for (size_t j = 0; j < result->landmarks_per_face; ++j) {
-        result->landmarks.emplace_back(
-            backup.landmarks[i * result->landmarks_per_face + j]);
-      }
-    }
+    swaps.emplace_back(static_cast<int>(i), src);
+    int displaced = element[i];
+    element[src] = displaced;
+    position[displaced] = src;
+    element[i] = keep[i];
+    position[keep[i]] = static_cast<int>(i);
+  }
+  return swaps;
+}
+
+// Compact values in place with the swaps, each element has stride values
+template <typename T>
+void Compact(const std::vector<std::pair<int, int>>& swaps, size_t keep_num,
+             size_t stride, std::vector<T>* values) {
+  for (const auto& swap : swaps) {
+    auto dst = values->begin() + swap.first * stride;
+    std::swap_ranges(dst, dst + stride, values->begin() + swap.second * stride);
+  }
+  values->resize(keep_num * stride);
+}
+
+}  // namespace
+
+// The implementation refers to
+// https://github.com/PaddlePaddle/PaddleDetection/blob/release/2.4/deploy/cpp/src/utils.cc
+void NMS(DetectionResult* result, float iou_threshold,
+         std::vector<int>* index) {
+  NMS(result, iou_threshold, -1, false, index);
+}
+
+void NMS(DetectionResult* result, float iou_threshold, int top_k,
+         bool class_aware, std::vector<int>* index) {
+  const size_t num = result->boxes.size();
+  FDASSERT(result->scores.size() == num,
+           "The size of boxes and scores in DetectionResult should be the "
+           "same, but now they are %zu and %zu.",
+           num, result->scores.size());
+  FDASSERT(!class_aware || result->label_ids.size() == num,
+           "The class aware NMS requires the label_ids of all the boxes.");
+  std::vector<int> keep =
+      KeepIndices(result->boxes, result->scores,
+                  class_aware ? &result->label_ids : nullptr, iou_threshold,
+                  top_k);
+
+  auto swaps = CompactSwaps(keep, num);
+  Compact(swaps, keep.size(), 1, &result->boxes);
+  Compact(swaps, keep.size(), 1, &result->scores);
+  if (result->label_ids.size() == num) {
+    Compact(swaps, keep.size(), 1, &result->label_ids);
+  }
+  if (result->rotated_boxes.size() == num) {
+    Compact(swaps, keep.size(), 1, &result->rotated_boxes);
+  }
+  if (result->contain_masks && result->masks.size() == num) {
+    Compact(swaps, keep.size(), 1, &result->masks);
+  }
+  if (index != nullptr) {
+    *index = std::move(keep);
+  }
+}
+
+void NMS(FaceDetectionResult* result, float iou_threshold) {
+  const size_t num = result->boxes.size();
+  FDASSERT(result->scores.size() == num,
+           "The size of boxes and scores in FaceDetectionResult should be the "
+           "same, but now they are %zu and %zu.",
+           num, result->scores.size());
+  std::vector<int> keep = KeepIndices(result->boxes, result->scores, nullptr,
+                                      iou_threshold, -1);
+
+  auto swaps = CompactSwaps(keep, num);
+  Compact(swaps, keep.size(), 1, &result->boxes);
+  Compact(swaps, keep.size(), 1, &result->scores);
+  // landmarks (if have)
+  size_t landmarks_per_face = result->landmarks_per_face;
+  if (landmarks_per_face > 0 &&
+      result->landmarks.size() == num * landmarks_per_face) {
+    Compact(swaps, keep.size(), landmarks_per_face, &result->landmarks);
   }
 }
 
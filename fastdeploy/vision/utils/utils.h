@@ -15,12 +15,15 @@
 #pragma once
 
 #include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <numeric>
 #include <set>
 #include <vector>
 
 #include "fastdeploy/core/fd_tensor.h"
 #include "fastdeploy/utils/utils.h"
 #include "fastdeploy/vision/common/result.h"
+#include "fastdeploy/vision/utils/embedding_gallery.h"
 
 // #include "unsupported/Eigen/CXX11/Tensor"
 #include "fastdeploy/function/reduce.h"
@@ -31,38 +34,65 @@
 namespace fastdeploy {
 namespace vision {
 namespace utils {
-// topk sometimes is a very small value
-// so this implementation is simple but I don't think it will
-// cost too much time
-// Also there may be cause problem since we suppose the minimum value is
-// -99999999
-// Do not use this function on array which topk contains value less than
-// -99999999
+// Get the indices of the topk largest elements in array, the equal elements
+// are sorted by their indices. function::TopK is preferred for tensors.
 template <typename T>
 std::vector<int32_t> TopKIndices(const T* array, int array_size, int topk) {
-  topk = std::min(array_size, topk);
-  std::vector<int32_t> res(topk);
-  std::set<int32_t> searched;
-  for (int32_t i = 0; i < topk; ++i) {
-    T min = static_cast<T>(-99999999);
-    for (int32_t j = 0; j < array_size; ++j) {
-      if (searched.find(j) != searched.end()) {
-        continue;
-      }
-      if (*(array + j) > min) {
-        res[i] = j;
-        min = *(array + j);
-      }
-    }
-    searched.insert(res[i]);
-  }
-  return res;
+  topk = std::max(0, std::min(array_size, topk));
+  std::vector<int32_t> indices(array_size);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::partial_sort(indices.begin(), indices.begin() + topk, indices.end(),
+                    [array](int32_t lhs, int32_t rhs) {
+                      return array[lhs] > array[rhs] ||
+                             (array[lhs] == array[rhs] && lhs < rhs);
+                    });
+  indices.resize(topk);
+  return indices;
 }
 
-void NMS(DetectionResult* output, float iou_threshold = 0.5,
-         std::vector<int>* index = nullptr);
+/** \brief Get the index of the first maximum element in array and its value, vectorized with AVX2/SSE2/NEON according to the compile flags
+ *
+ * \param[in] array The input array
+ * \param[in] array_size The size of array
+ * \param[out] max_value The maximum value of array
+ * \return The index of the maximum value, -1 if array is empty
+ */
+FASTDEPLOY_DECL int ArgMaxWithValue(const float* array, int array_size,
+                                    float* max_value);
+
+/** \brief Get the index of the first maximum channel and its value for each position of planar data, e.g the logits of a row in NCHW layout. The positions are vectorized with AVX2/SSE2/NEON according to the compile flags
+ *
+ * \param[in] data The input data, the value of channel c at position x is data[c * channel_stride + x]
+ * \param[in] num_channels The number of channels, should be greater than 0
+ * \param[in] channel_stride The distance between the values of two adjacent channels
+ * \param[in] width The number of positions
+ * \param[out] labels The index of the maximum channel of each position, with width elements
+ * \param[out] max_values The maximum value of each position, with width elements
+ */
+FASTDEPLOY_DECL void ArgMaxOverChannels(const float* data,
+                                        int64_t num_channels,
+                                        int64_t channel_stride, int64_t width,
+                                        int32_t* labels, float* max_values);
+
+/// Greedy NMS on DetectionResult in place, the kept boxes are sorted by scores
+FASTDEPLOY_DECL void NMS(DetectionResult* output, float iou_threshold = 0.5,
+                         std::vector<int>* index = nullptr);
+
+/** \brief Greedy NMS on DetectionResult in place, the kept boxes are sorted by scores
+ *
+ * \param[in] output The detection result to be suppressed
+ * \param[in] iou_threshold The boxes whose IoU with a kept box is larger than iou_threshold are suppressed
+ * \param[in] top_k Keep at most top_k boxes, -1 means keep all
+ * \param[in] class_aware Whether only the boxes with the same label_id suppress each other, no coordinate offset by label_id is needed for the batched NMS
+ * \param[out] index The original indices of the kept boxes
+ */
+FASTDEPLOY_DECL void NMS(DetectionResult* output, float iou_threshold,
+                         int top_k, bool class_aware,
+                         std::vector<int>* index = nullptr);
 
-void NMS(FaceDetectionResult* result, float iou_threshold = 0.5);
+/// Greedy NMS on FaceDetectionResult in place, the landmarks are kept with boxes
+FASTDEPLOY_DECL void NMS(FaceDetectionResult* result,
+                         float iou_threshold = 0.5);
 
 /// Sort DetectionResult/FaceDetectionResult by score
 FASTDEPLOY_DECL void SortDetectionResult(DetectionResult* result);
@@ -143,7 +143,7 @@ def set_logger(enable_info=True, enable_warning=True):
     set_logger(enable_info, enable_warning)
 
 
-from .runtime import Runtime, RuntimeOption
+from .runtime import Runtime, BatchingRuntime, RuntimeOption
 from .model import FastDeployModel
 from . import c_lib_wrap as C
 from . import vision
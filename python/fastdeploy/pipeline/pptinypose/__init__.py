@@ -35,6 +35,14 @@ class PPTinyPose(object):
         """
         return self._pipeline.predict(input_image)
 
+    def batch_predict(self, images):
+        """Predict the keypoint detection results for a batch of input images
+
+        :param images: (list of numpy.ndarray)The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return: list of KeyPointDetectionResult
+        """
+        return self._pipeline.batch_predict(images)
+
     @property
     def detection_model_score_threshold(self):
         """Atrribute of PPTinyPose pipeline model. Stating the score threshold for detectin model to filter bbox before inputting pptinypose model
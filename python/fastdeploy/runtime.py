@@ -157,6 +157,47 @@ class Runtime:
         return self._runtime.get_profile_time()
 
 
+class BatchingRuntime:
+    """FastDeploy BatchingRuntime object, merges the requests from multiple threads into batches along axis 0.
+    """
+
+    def __init__(self, runtime_option, max_batch_size=8, max_delay_us=1000):
+        """Initialize a FastDeploy BatchingRuntime object.
+
+        :param runtime_option: (fastdeploy.RuntimeOption)Options for the inner Runtime, the model should support dynamic batch size
+        :param max_batch_size: (int)Max number of samples(the total size of axis 0 of the inputs) in one batch
+        :param max_delay_us: (int)Max time in microseconds the first request of a batch waits for the following requests
+        """
+
+        self._runtime = C.BatchingRuntime()
+        self.runtime_option = runtime_option
+        assert self._runtime.init(self.runtime_option._option, max_batch_size,
+                                  max_delay_us), "Initialize BatchingRuntime Failed!"
+
+    def infer(self, data):
+        """Inference with input data, can be called by multiple threads at the same time, and will block until the batch containing this request is done.
+
+        :param data: (dict[str : numpy.ndarray])The input data dict, key value must keep same with the loaded model
+        :return list of numpy.ndarray
+        :raises RuntimeError: if the inference failed
+        """
+        assert isinstance(data,
+                          dict), "The input data should be type of dict."
+        return self._runtime.infer(data)
+
+    def get_statistics(self):
+        """Get the statistics of requests and batches.
+
+        :return fastdeploy.BatchingStatistics
+        """
+        return self._runtime.get_statistics()
+
+    def reset_statistics(self):
+        """Reset the statistics of requests and batches.
+        """
+        self._runtime.reset_statistics()
+
+
 class RuntimeOption:
     """Options for FastDeploy Runtime.
     """
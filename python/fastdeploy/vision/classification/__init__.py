@@ -19,7 +19,7 @@ from .ppshitu import PPShiTuV2Detector
 from .ppshitu import PPShiTuV2Recognizer
 from .ppshitu import PPShiTuV2RecognizerPreprocessor
 from .ppshitu import PPShiTuV2RecognizerPostprocessor
-from .contrib.resnet import ResNet
+from .contrib.resnet import *
 
 PPLCNet = PaddleClasModel
 PPLCNetv2 = PaddleClasModel
@@ -16,6 +16,93 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class ResNetPreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for ResNet
+        """
+        self._manager = C.vision.classification.ResNetPreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for ResNet
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [224, 224]
+        """
+        return self._manager.size
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+    @property
+    def mean_vals(self):
+        """
+        Argument for image preprocessing step, the mean values for normalization, default mean_vals = [0.485, 0.456, 0.406]
+        """
+        return self._manager.mean_vals
+
+    @mean_vals.setter
+    def mean_vals(self, value):
+        assert isinstance(
+            value, list), "The value to set `mean_vals` must be type of list."
+        self._manager.mean_vals = value
+
+    @property
+    def std_vals(self):
+        """
+        Argument for image preprocessing step, the std values for normalization, default std_vals = [0.229, 0.224, 0.225]
+        """
+        return self._manager.std_vals
+
+    @std_vals.setter
+    def std_vals(self, value):
+        assert isinstance(
+            value, list), "The value to set `std_vals` must be type of list."
+        self._manager.std_vals = value
+
+
+class ResNetPostprocessor:
+    def __init__(self):
+        """Create a postprocessor for ResNet
+        """
+        self._postprocessor = C.vision.classification.ResNetPostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for ResNet
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of ClassifyResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
+
+    @property
+    def topk(self):
+        """
+        topk for postprocessing, default is 1
+        """
+        return self._postprocessor.topk
+
+    @topk.setter
+    def topk(self, topk):
+        assert isinstance(topk, int),\
+            "The value to set `topk` must be type of int."
+        self._postprocessor.topk = topk
 
 
 class ResNet(FastDeployModel):
@@ -50,7 +137,32 @@ class ResNet(FastDeployModel):
         :param topk: (int)The topk result by the classify confidence score, default 1
         :return: ClassifyResult
         """
-        return self._model.predict(input_image, topk)
+        self.postprocessor.topk = topk
+        return self._model.predict(input_image)
+
+    def batch_predict(self, images):
+        """Classify a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of ClassifyResult
+        """
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get ResNetPreprocessor object of the loaded model
+
+        :return ResNetPreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get ResNetPostprocessor object of the loaded model
+
+        :return ResNetPostprocessor
+        """
+        return self._model.postprocessor
 
     # Implement the setter and getter method for variables
     @property
@@ -58,21 +170,21 @@ class ResNet(FastDeployModel):
         """
         Returns the preprocess image size, default size = [224, 224];
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @property
     def mean_vals(self):
         """
         Returns the mean value of normlization, default mean_vals = [0.485f, 0.456f, 0.406f];
         """
-        return self._model.mean_vals
+        return self.preprocessor.mean_vals
 
     @property
     def std_vals(self):
         """
         Returns the std value of normlization, default std_vals = [0.229f, 0.224f, 0.225f];
         """
-        return self._model.std_vals
+        return self.preprocessor.std_vals
 
     @size.setter
     def size(self, wh):
@@ -81,16 +193,16 @@ class ResNet(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
 
     @mean_vals.setter
     def mean_vals(self, value):
         assert isinstance(
             value, list), "The value to set `mean_vals` must be type of list."
-        self._model.mean_vals = value
+        self.preprocessor.mean_vals = value
 
     @std_vals.setter
     def std_vals(self, value):
         assert isinstance(
             value, list), "The value to set `std_vals` must be type of list."
-        self._model.std_vals = value
+        self.preprocessor.std_vals = value
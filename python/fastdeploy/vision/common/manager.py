@@ -37,6 +37,18 @@ class ProcessorManager:
         """
         return self._manager.use_cuda(enable_cv_cuda, gpu_id)
 
+    def set_preprocess_threads(self, num_threads):
+        """Set the number of threads to process the images of a batch in parallel on CPU
+
+        :param: num_threads: (int) The number of threads, 1 means to process the images serially, -1 means to use the default threads number of FastDeploy
+        """
+        return self._manager.set_preprocess_threads(num_threads)
+
+    def get_preprocess_threads(self):
+        """Get the number of threads to process the images of a batch
+        """
+        return self._manager.get_preprocess_threads()
+
 
 class PyProcessorManager(ABC):
     """
@@ -54,6 +66,18 @@ class PyProcessorManager(ABC):
         """
         return self._manager.use_cuda(enable_cv_cuda, gpu_id)
 
+    def set_preprocess_threads(self, num_threads):
+        """Set the number of threads to process the images of a batch in parallel on CPU
+
+        :param: num_threads: (int) The number of threads, 1 means to process the images serially, -1 means to use the default threads number of FastDeploy
+        """
+        return self._manager.set_preprocess_threads(num_threads)
+
+    def get_preprocess_threads(self):
+        """Get the number of threads to process the images of a batch
+        """
+        return self._manager.get_preprocess_threads()
+
     def __call__(self, images):
         image_batch = C.vision.FDMatBatch()
         image_batch.from_mats(images)
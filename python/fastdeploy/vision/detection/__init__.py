@@ -14,15 +14,15 @@
 
 from __future__ import absolute_import
 from .contrib.yolov7 import *
-from .contrib.yolor import YOLOR
-from .contrib.scaled_yolov4 import ScaledYOLOv4
-from .contrib.nanodet_plus import NanoDetPlus
-from .contrib.yolox import YOLOX
+from .contrib.yolor import *
+from .contrib.scaled_yolov4 import *
+from .contrib.nanodet_plus import *
+from .contrib.yolox import *
 from .contrib.yolov5 import *
 from .contrib.yolov5seg import *
 from .contrib.fastestdet import *
-from .contrib.yolov5lite import YOLOv5Lite
-from .contrib.yolov6 import YOLOv6
+from .contrib.yolov5lite import *
+from .contrib.yolov6 import *
 from .contrib.yolov7end2end_trt import YOLOv7End2EndTRT
 from .contrib.yolov7end2end_ort import YOLOv7End2EndORT
 from .contrib.yolov8 import *
@@ -16,6 +16,138 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class YOLOv6Preprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for YOLOv6
+        """
+        self._manager = C.vision.detection.YOLOv6Preprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for YOLOv6
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [640, 640]
+        """
+        return self._manager.size
+
+    @property
+    def padding_value(self):
+        #  padding value, size should be the same as channels
+        return self._manager.padding_value
+
+    @property
+    def is_scale_up(self):
+        # if is_scale_up is false, the input image only can be zoom out, the maximum resize scale cannot exceed 1.0
+        return self._manager.is_scale_up
+
+    @property
+    def is_mini_pad(self):
+        # only pad to the minimum rectange which height and width is times of stride
+        return self._manager.is_mini_pad
+
+    @property
+    def is_no_pad(self):
+        # while is_mini_pad = false and is_no_pad = true, will resize the image to the set size
+        return self._manager.is_no_pad
+
+    @property
+    def stride(self):
+        # padding stride, for is_mini_pad
+        return self._manager.stride
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+    @padding_value.setter
+    def padding_value(self, value):
+        assert isinstance(
+            value,
+            list), "The value to set `padding_value` must be type of list."
+        self._manager.padding_value = value
+
+    @is_scale_up.setter
+    def is_scale_up(self, value):
+        assert isinstance(
+            value,
+            bool), "The value to set `is_scale_up` must be type of bool."
+        self._manager.is_scale_up = value
+
+    @is_mini_pad.setter
+    def is_mini_pad(self, value):
+        assert isinstance(
+            value,
+            bool), "The value to set `is_mini_pad` must be type of bool."
+        self._manager.is_mini_pad = value
+
+    @is_no_pad.setter
+    def is_no_pad(self, value):
+        assert isinstance(
+            value, bool), "The value to set `is_no_pad` must be type of bool."
+        self._manager.is_no_pad = value
+
+    @stride.setter
+    def stride(self, value):
+        assert isinstance(
+            value, int), "The value to set `stride` must be type of int."
+        self._manager.stride = value
+
+
+class YOLOv6Postprocessor:
+    def __init__(self):
+        """Create a postprocessor for YOLOv6
+        """
+        self._postprocessor = C.vision.detection.YOLOv6Postprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for YOLOv6
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of DetectionResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
+
+    @property
+    def conf_threshold(self):
+        """
+        confidence threshold for postprocessing, default is 0.25
+        """
+        return self._postprocessor.conf_threshold
+
+    @property
+    def nms_threshold(self):
+        """
+        nms threshold for postprocessing, default is 0.5
+        """
+        return self._postprocessor.nms_threshold
+
+    @conf_threshold.setter
+    def conf_threshold(self, conf_threshold):
+        assert isinstance(conf_threshold, float),\
+            "The value to set `conf_threshold` must be type of float."
+        self._postprocessor.conf_threshold = conf_threshold
+
+    @nms_threshold.setter
+    def nms_threshold(self, nms_threshold):
+        assert isinstance(nms_threshold, float),\
+            "The value to set `nms_threshold` must be type of float."
+        self._postprocessor.nms_threshold = nms_threshold
 
 
 class YOLOv6(FastDeployModel):
@@ -39,6 +171,8 @@ class YOLOv6(FastDeployModel):
             model_file, params_file, self._runtime_option, model_format)
         # 通过self.initialized判断整个模型的初始化是否成功
         assert self.initialized, "YOLOv6 initialize failed."
+        # max_wh is kept for compatibility, it is not used since NMS is class aware
+        self._max_wh = 4096.0
 
     def predict(self, input_image, conf_threshold=0.25, nms_iou_threshold=0.5):
         """Detect an input image
@@ -48,8 +182,40 @@ class YOLOv6(FastDeployModel):
         :param nms_iou_threshold: iou threashold for NMS, default is 0.5
         :return: DetectionResult
         """
-        return self._model.predict(input_image, conf_threshold,
-                                   nms_iou_threshold)
+        self.postprocessor.conf_threshold = conf_threshold
+        self.postprocessor.nms_threshold = nms_iou_threshold
+        return self._model.predict(input_image)
+
+    def use_cuda_preprocessing(self, max_image_size=3840 * 2160):
+        """Use CUDA to preprocess the images, the same as `model.preprocessor.use_cuda()`
+
+        :param max_image_size: (int)DEPRECATED, not used any more, it was the max size of the input image to allocate the CUDA buffers
+        """
+        self._model.use_cuda_preprocessing(max_image_size)
+
+    def batch_predict(self, images):
+        """Detect a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of DetectionResult
+        """
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get YOLOv6Preprocessor object of the loaded model
+
+        :return YOLOv6Preprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get YOLOv6Postprocessor object of the loaded model
+
+        :return YOLOv6Postprocessor
+        """
+        return self._model.postprocessor
 
     # 一些跟YOLOv6模型有关的属性封装
     # 多数是预处理相关，可通过修改如model.size = [1280, 1280]改变预处理时resize的大小（前提是模型支持）
@@ -58,37 +224,32 @@ class YOLOv6(FastDeployModel):
         """
         Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [640, 640]
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @property
     def padding_value(self):
         #  padding value, size should be the same as channels
-        return self._model.padding_value
+        return self.preprocessor.padding_value
 
     @property
     def is_no_pad(self):
         # while is_mini_pad = false and is_no_pad = true, will resize the image to the set size
-        return self._model.is_no_pad
+        return self.preprocessor.is_no_pad
 
     @property
     def is_mini_pad(self):
         # only pad to the minimum rectange which height and width is times of stride
-        return self._model.is_mini_pad
+        return self.preprocessor.is_mini_pad
 
     @property
     def is_scale_up(self):
         # if is_scale_up is false, the input image only can be zoom out, the maximum resize scale cannot exceed 1.0
-        return self._model.is_scale_up
+        return self.preprocessor.is_scale_up
 
     @property
     def stride(self):
         # padding stride, for is_mini_pad
-        return self._model.stride
-
-    @property
-    def max_wh(self):
-        # for offseting the boxes by classes when using NMS
-        return self._model.max_wh
+        return self.preprocessor.stride
 
     @size.setter
     def size(self, wh):
@@ -97,43 +258,56 @@ class YOLOv6(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
 
     @padding_value.setter
     def padding_value(self, value):
         assert isinstance(
             value,
             list), "The value to set `padding_value` must be type of list."
-        self._model.padding_value = value
+        self.preprocessor.padding_value = value
 
     @is_no_pad.setter
     def is_no_pad(self, value):
         assert isinstance(
             value, bool), "The value to set `is_no_pad` must be type of bool."
-        self._model.is_no_pad = value
+        self.preprocessor.is_no_pad = value
 
     @is_mini_pad.setter
     def is_mini_pad(self, value):
         assert isinstance(
             value,
             bool), "The value to set `is_mini_pad` must be type of bool."
-        self._model.is_mini_pad = value
+        self.preprocessor.is_mini_pad = value
 
     @is_scale_up.setter
     def is_scale_up(self, value):
         assert isinstance(
             value,
             bool), "The value to set `is_scale_up` must be type of bool."
-        self._model.is_scale_up = value
+        self.preprocessor.is_scale_up = value
 
     @stride.setter
     def stride(self, value):
         assert isinstance(
             value, int), "The value to set `stride` must be type of int."
-        self._model.stride = value
+        self.preprocessor.stride = value
+
+    @property
+    def max_wh(self):
+        """
+        DEPRECATED, the offset of boxes by classes in NMS, not used any more since NMS is class aware now, remove at 1.0 version
+        """
+        logging.warning(
+            "DEPRECATED: max_wh is not used any more, since NMS is class aware now."
+        )
+        return self._max_wh
 
     @max_wh.setter
     def max_wh(self, value):
+        logging.warning(
+            "DEPRECATED: max_wh is not used any more, since NMS is class aware now."
+        )
         assert isinstance(
             value, float), "The value to set `max_wh` must be type of float."
-        self._model.max_wh = value
+        self._max_wh = value
@@ -77,6 +77,20 @@ class YOLOv7Preprocessor:
             bool), "The value to set `is_scale_up` must be type of bool."
         self._preprocessor.is_scale_up = value
 
+    @property
+    def fused_letter_box(self):
+        """
+        whether to resize, pad and normalize the images in a single pass, default false
+        """
+        return self._preprocessor.fused_letter_box
+
+    @fused_letter_box.setter
+    def fused_letter_box(self, value):
+        assert isinstance(
+            value,
+            bool), "The value to set `fused_letter_box` must be type of bool."
+        self._preprocessor.fused_letter_box = value
+
 
 class YOLOv7Postprocessor:
     def __init__(self):
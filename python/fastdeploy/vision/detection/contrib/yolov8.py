@@ -104,6 +104,20 @@ class YOLOv8Preprocessor:
             stride, int), "The value to set `stride` must be type of int."
         self._preprocessor.stride = value
 
+    @property
+    def fused_letter_box(self):
+        """
+        whether to resize, pad and normalize the images in a single pass, default false
+        """
+        return self._preprocessor.fused_letter_box
+
+    @fused_letter_box.setter
+    def fused_letter_box(self, value):
+        assert isinstance(
+            value,
+            bool), "The value to set `fused_letter_box` must be type of bool."
+        self._preprocessor.fused_letter_box = value
+
 
 class YOLOv8Postprocessor:
     def __init__(self):
@@ -16,6 +16,134 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class YOLOXPreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for YOLOX
+        """
+        self._manager = C.vision.detection.YOLOXPreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for YOLOX
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [640, 640]
+        """
+        return self._manager.size
+
+    @property
+    def padding_value(self):
+        #  padding value, size should be the same as channels
+        return self._manager.padding_value
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+    @padding_value.setter
+    def padding_value(self, value):
+        assert isinstance(
+            value,
+            list), "The value to set `padding_value` must be type of list."
+        self._manager.padding_value = value
+
+
+class YOLOXPostprocessor:
+    def __init__(self):
+        """Create a postprocessor for YOLOX
+        """
+        self._postprocessor = C.vision.detection.YOLOXPostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for YOLOX
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of DetectionResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
+
+    @property
+    def conf_threshold(self):
+        """
+        confidence threshold for postprocessing, default is 0.25
+        """
+        return self._postprocessor.conf_threshold
+
+    @property
+    def nms_threshold(self):
+        """
+        nms threshold for postprocessing, default is 0.5
+        """
+        return self._postprocessor.nms_threshold
+
+    @property
+    def is_decode_exported(self):
+        """
+        whether the model_file was exported with decode module.
+        The official YOLOX/tools/export_onnx.py script will export ONNX file without decode module.
+        Please set it 'true' manually if the model file was exported with decode module.
+        Defalut False.
+        """
+        return self._postprocessor.is_decode_exported
+
+    @property
+    def downsample_strides(self):
+        """
+        downsample strides for YOLOX to generate anchors, will take (8,16,32) as default values, might have stride=64.
+        """
+        return self._postprocessor.downsample_strides
+
+    @property
+    def max_wh(self):
+        # for offseting the boxes by classes when using NMS
+        return self._postprocessor.max_wh
+
+    @conf_threshold.setter
+    def conf_threshold(self, conf_threshold):
+        assert isinstance(conf_threshold, float),\
+            "The value to set `conf_threshold` must be type of float."
+        self._postprocessor.conf_threshold = conf_threshold
+
+    @nms_threshold.setter
+    def nms_threshold(self, nms_threshold):
+        assert isinstance(nms_threshold, float),\
+            "The value to set `nms_threshold` must be type of float."
+        self._postprocessor.nms_threshold = nms_threshold
+
+    @is_decode_exported.setter
+    def is_decode_exported(self, value):
+        assert isinstance(
+            value,
+            bool), "The value to set `is_decode_exported` must be type of bool."
+        self._postprocessor.is_decode_exported = value
+
+    @downsample_strides.setter
+    def downsample_strides(self, value):
+        assert isinstance(
+            value,
+            list), "The value to set `downsample_strides` must be type of list."
+        self._postprocessor.downsample_strides = value
+
+    @max_wh.setter
+    def max_wh(self, value):
+        assert isinstance(
+            value, float), "The value to set `max_wh` must be type of float."
+        self._postprocessor.max_wh = value
 
 
 class YOLOX(FastDeployModel):
@@ -48,8 +176,33 @@ class YOLOX(FastDeployModel):
         :param nms_iou_threshold: iou threashold for NMS, default is 0.5
         :return: DetectionResult
         """
-        return self._model.predict(input_image, conf_threshold,
-                                   nms_iou_threshold)
+        self.postprocessor.conf_threshold = conf_threshold
+        self.postprocessor.nms_threshold = nms_iou_threshold
+        return self._model.predict(input_image)
+
+    def batch_predict(self, images):
+        """Detect a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of DetectionResult
+        """
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get YOLOXPreprocessor object of the loaded model
+
+        :return YOLOXPreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get YOLOXPostprocessor object of the loaded model
+
+        :return YOLOXPostprocessor
+        """
+        return self._model.postprocessor
 
     # 一些跟YOLOX模型有关的属性封装
     # 多数是预处理相关，可通过修改如model.size = [1280, 1280]改变预处理时resize的大小（前提是模型支持）
@@ -58,12 +211,12 @@ class YOLOX(FastDeployModel):
         """
         Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [640, 640]
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @property
     def padding_value(self):
         #  padding value, size should be the same as channels
-        return self._model.padding_value
+        return self.preprocessor.padding_value
 
     @property
     def is_decode_exported(self):
@@ -73,19 +226,19 @@ class YOLOX(FastDeployModel):
         Please set it 'true' manually if the model file was exported with decode module.
         Defalut False.
         """
-        return self._model.is_decode_exported
+        return self.postprocessor.is_decode_exported
 
     @property
     def downsample_strides(self):
         """
         downsample strides for YOLOX to generate anchors, will take (8,16,32) as default values, might have stride=64.
         """
-        return self._model.downsample_strides
+        return self.postprocessor.downsample_strides
 
     @property
     def max_wh(self):
         # for offseting the boxes by classes when using NMS
-        return self._model.max_wh
+        return self.postprocessor.max_wh
 
     @size.setter
     def size(self, wh):
@@ -94,31 +247,31 @@ class YOLOX(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
 
     @padding_value.setter
     def padding_value(self, value):
         assert isinstance(
             value,
             list), "The value to set `padding_value` must be type of list."
-        self._model.padding_value = value
+        self.preprocessor.padding_value = value
 
     @is_decode_exported.setter
     def is_decode_exported(self, value):
         assert isinstance(
             value,
             bool), "The value to set `is_decode_exported` must be type of bool."
-        self._model.is_decode_exported = value
+        self.postprocessor.is_decode_exported = value
 
     @downsample_strides.setter
     def downsample_strides(self, value):
         assert isinstance(
             value,
             list), "The value to set `downsample_strides` must be type of list."
-        self._model.downsample_strides = value
+        self.postprocessor.downsample_strides = value
 
     @max_wh.setter
     def max_wh(self, value):
         assert isinstance(
             value, float), "The value to set `max_wh` must be type of float."
-        self._model.max_wh = value
+        self.postprocessor.max_wh = value
@@ -13,6 +13,6 @@
 # limitations under the License.
 
 from __future__ import absolute_import
-from .contrib.pfld import PFLD
-from .contrib.pipnet import PIPNet
+from .contrib.pfld import *
+from .contrib.pipnet import *
 from .contrib.face_landmark_1000 import FaceLandmark1000
@@ -16,6 +16,54 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class PFLDPreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for PFLD
+        """
+        self._manager = C.vision.facealign.PFLDPreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for PFLD
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [112, 112]
+        """
+        return self._manager.size
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+
+class PFLDPostprocessor:
+    def __init__(self):
+        """Create a postprocessor for PFLD
+        """
+        self._postprocessor = C.vision.facealign.PFLDPostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for PFLD
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of FaceAlignmentResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
 
 
 class PFLD(FastDeployModel):
@@ -48,12 +96,37 @@ class PFLD(FastDeployModel):
 
         return self._model.predict(input_image)
 
+    def batch_predict(self, images):
+        """Detect the landmarks of a batch of input images, e.g. the faces cropped from one image
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of FaceAlignmentResult
+        """
+
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get PFLDPreprocessor object of the loaded model
+
+        :return PFLDPreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get PFLDPostprocessor object of the loaded model
+
+        :return PFLDPostprocessor
+        """
+        return self._model.postprocessor
+
     @property
     def size(self):
         """
         Returns the preprocess image size, default (112, 112)
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @size.setter
     def size(self, wh):
@@ -65,4 +138,4 @@ class PFLD(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
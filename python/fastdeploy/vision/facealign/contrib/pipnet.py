@@ -16,6 +16,93 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class PIPNetPreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for PIPNet
+        """
+        self._manager = C.vision.facealign.PIPNetPreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for PIPNet
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [256, 256]
+        """
+        return self._manager.size
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+    @property
+    def mean_vals(self):
+        """
+        Argument for image preprocessing step, the mean values for normalization, default mean_vals = [0.485, 0.456, 0.406]
+        """
+        return self._manager.mean_vals
+
+    @mean_vals.setter
+    def mean_vals(self, value):
+        assert isinstance(
+            value, list), "The value to set `mean_vals` must be type of list."
+        self._manager.mean_vals = value
+
+    @property
+    def std_vals(self):
+        """
+        Argument for image preprocessing step, the std values for normalization, default std_vals = [0.229, 0.224, 0.225]
+        """
+        return self._manager.std_vals
+
+    @std_vals.setter
+    def std_vals(self, value):
+        assert isinstance(
+            value, list), "The value to set `std_vals` must be type of list."
+        self._manager.std_vals = value
+
+
+class PIPNetPostprocessor:
+    def __init__(self):
+        """Create a postprocessor for PIPNet
+        """
+        self._postprocessor = C.vision.facealign.PIPNetPostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for PIPNet
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of FaceAlignmentResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
+
+    @property
+    def num_landmarks(self):
+        """
+        Argument for postprocessing step, the number of landmarks, should be one of {19, 29, 68, 98}, default num_landmarks = 19
+        """
+        return self._postprocessor.num_landmarks
+
+    @num_landmarks.setter
+    def num_landmarks(self, value):
+        assert isinstance(
+            value, int), "The value to set `num_landmarks` must be type of int."
+        self._postprocessor.num_landmarks = value
 
 
 class PIPNet(FastDeployModel):
@@ -26,7 +113,7 @@ class PIPNet(FastDeployModel):
                  model_format=ModelFormat.ONNX):
         """Load a face alignment model exported by PIPNet.
 
-        :param model_file: (str)Path of model file, e.g ./PIPNet.onnx
+        :param model_file: (str)Path of model file, e.g ./pipnet.onnx
         :param params_file: (str)Path of parameters file, if the model_fomat is ModelFormat.ONNX, this param will be ignored, can be set as empty string
         :param runtime_option: (fastdeploy.RuntimeOption)RuntimeOption for inference this model, if it's None, will use the default backend on CPU
         :param model_format: (fastdeploy.ModelForamt)Model format of the loaded model, default is ONNX
@@ -48,33 +135,37 @@ class PIPNet(FastDeployModel):
 
         return self._model.predict(input_image)
 
-    @property
-    def size(self):
-        """
-        Returns the preprocess image size, default (256, 256)
+    def batch_predict(self, images):
+        """Detect the landmarks of a batch of input images, e.g. the faces cropped from one image
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of FaceAlignmentResult
         """
-        return self._model.size
+
+        return self._model.batch_predict(images)
 
     @property
-    def mean_vals(self):
-        """
-        Returns the mean value of normlization, default mean_vals = [0.485f, 0.456f, 0.406f];
+    def preprocessor(self):
+        """Get PIPNetPreprocessor object of the loaded model
+
+        :return PIPNetPreprocessor
         """
-        return self._model.mean_vals
+        return self._model.preprocessor
 
     @property
-    def std_vals(self):
-        """
-        Returns the std value of normlization, default std_vals = [0.229f, 0.224f, 0.225f];
+    def postprocessor(self):
+        """Get PIPNetPostprocessor object of the loaded model
+
+        :return PIPNetPostprocessor
         """
-        return self._model.std_vals
+        return self._model.postprocessor
 
     @property
-    def num_landmarks(self):
+    def size(self):
         """
-        Returns the number of landmarks
+        Returns the preprocess image size, default (256, 256)
         """
-        return self._model.num_landmarks
+        return self.preprocessor.size
 
     @size.setter
     def size(self, wh):
@@ -86,22 +177,43 @@ class PIPNet(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
+
+    @property
+    def mean_vals(self):
+        """
+        Returns the mean value of normlization, default mean_vals = [0.485, 0.456, 0.406]
+        """
+        return self.preprocessor.mean_vals
 
     @mean_vals.setter
     def mean_vals(self, value):
         assert isinstance(
             value, list), "The value to set `mean_vals` must be type of list."
-        self._model.mean_vals = value
+        self.preprocessor.mean_vals = value
+
+    @property
+    def std_vals(self):
+        """
+        Returns the std value of normlization, default std_vals = [0.229, 0.224, 0.225]
+        """
+        return self.preprocessor.std_vals
 
     @std_vals.setter
     def std_vals(self, value):
         assert isinstance(
             value, list), "The value to set `std_vals` must be type of list."
-        self._model.std_vals = value
+        self.preprocessor.std_vals = value
+
+    @property
+    def num_landmarks(self):
+        """
+        Returns the number of landmarks, default 19
+        """
+        return self.postprocessor.num_landmarks
 
     @num_landmarks.setter
     def num_landmarks(self, value):
         assert isinstance(
-            value, int), "The value to set `std_vals` must be type of int."
-        self._model.num_landmarks = value
+            value, int), "The value to set `num_landmarks` must be type of int."
+        self.postprocessor.num_landmarks = value
@@ -16,6 +16,137 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class RetinaFacePreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for RetinaFace
+        """
+        self._manager = C.vision.facedet.RetinaFacePreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for RetinaFace
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default (640, 640)
+        """
+        return self._manager.size
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+
+class RetinaFacePostprocessor:
+    def __init__(self):
+        """Create a postprocessor for RetinaFace
+        """
+        self._postprocessor = C.vision.facedet.RetinaFacePostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for RetinaFace
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of FaceDetectionResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
+
+    @property
+    def conf_threshold(self):
+        """
+        confidence threshold for postprocessing, default is 0.25
+        """
+        return self._postprocessor.conf_threshold
+
+    @property
+    def nms_threshold(self):
+        """
+        nms threshold for postprocessing, default is 0.4
+        """
+        return self._postprocessor.nms_threshold
+
+    @property
+    def variance(self):
+        """
+        Argument for image postprocessing step, variance in RetinaFace's prior-box(anchor) generate process, default (0.1, 0.2)
+        """
+        return self._postprocessor.variance
+
+    @property
+    def downsample_strides(self):
+        """
+        Argument for image postprocessing step, downsample strides (namely, steps) for RetinaFace to generate anchors, will take (8,16,32) as default values
+        """
+        return self._postprocessor.downsample_strides
+
+    @property
+    def min_sizes(self):
+        """
+        Argument for image postprocessing step, min sizes, width and height for each anchor, default min_sizes = [[16, 32], [64, 128], [256, 512]]
+        """
+        return self._postprocessor.min_sizes
+
+    @property
+    def landmarks_per_face(self):
+        """
+        Argument for image postprocessing step, landmarks_per_face, default 5 in RetinaFace
+        """
+        return self._postprocessor.landmarks_per_face
+
+    @conf_threshold.setter
+    def conf_threshold(self, conf_threshold):
+        assert isinstance(conf_threshold, float),\
+            "The value to set `conf_threshold` must be type of float."
+        self._postprocessor.conf_threshold = conf_threshold
+
+    @nms_threshold.setter
+    def nms_threshold(self, nms_threshold):
+        assert isinstance(nms_threshold, float),\
+            "The value to set `nms_threshold` must be type of float."
+        self._postprocessor.nms_threshold = nms_threshold
+
+    @variance.setter
+    def variance(self, value):
+        assert isinstance(value, (list, tuple)),\
+            "The value to set `variance` must be type of tuple or list."
+        assert len(value) == 2,\
+            "The value to set `variance` must contatins 2 elements".format(
+            len(value))
+        self._postprocessor.variance = value
+
+    @downsample_strides.setter
+    def downsample_strides(self, value):
+        assert isinstance(
+            value,
+            list), "The value to set `downsample_strides` must be type of list."
+        self._postprocessor.downsample_strides = value
+
+    @min_sizes.setter
+    def min_sizes(self, value):
+        assert isinstance(
+            value, list), "The value to set `min_sizes` must be type of list."
+        self._postprocessor.min_sizes = value
+
+    @landmarks_per_face.setter
+    def landmarks_per_face(self, value):
+        assert isinstance(
+            value,
+            int), "The value to set `landmarks_per_face` must be type of int."
+        self._postprocessor.landmarks_per_face = value
 
 
 class RetinaFace(FastDeployModel):
@@ -48,8 +179,33 @@ class RetinaFace(FastDeployModel):
         :param nms_iou_threshold: iou threashold for NMS, default is 0.3
         :return: FaceDetectionResult
         """
-        return self._model.predict(input_image, conf_threshold,
-                                   nms_iou_threshold)
+        self.postprocessor.conf_threshold = conf_threshold
+        self.postprocessor.nms_threshold = nms_iou_threshold
+        return self._model.predict(input_image)
+
+    def batch_predict(self, images):
+        """Detect the faces in a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of FaceDetectionResult
+        """
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get RetinaFacePreprocessor object of the loaded model
+
+        :return RetinaFacePreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get RetinaFacePostprocessor object of the loaded model
+
+        :return RetinaFacePostprocessor
+        """
+        return self._model.postprocessor
 
     # 一些跟模型有关的属性封装
     # 多数是预处理相关，可通过修改如model.size = [640, 480]改变预处理时resize的大小（前提是模型支持）
@@ -58,35 +214,35 @@ class RetinaFace(FastDeployModel):
         """
         Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default (640, 640)
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @property
     def variance(self):
         """
         Argument for image postprocessing step, variance in RetinaFace's prior-box(anchor) generate process, default (0.1, 0.2)
         """
-        return self._model.variance
+        return self.postprocessor.variance
 
     @property
     def downsample_strides(self):
         """
         Argument for image postprocessing step, downsample strides (namely, steps) for RetinaFace to generate anchors, will take (8,16,32) as default values
         """
-        return self._model.downsample_strides
+        return self.postprocessor.downsample_strides
 
     @property
     def min_sizes(self):
         """
         Argument for image postprocessing step, min sizes, width and height for each anchor, default min_sizes = [[16, 32], [64, 128], [256, 512]]
         """
-        return self._model.min_sizes
+        return self.postprocessor.min_sizes
 
     @property
     def landmarks_per_face(self):
         """
         Argument for image postprocessing step, landmarks_per_face, default 5 in RetinaFace
         """
-        return self._model.landmarks_per_face
+        return self.postprocessor.landmarks_per_face
 
     @size.setter
     def size(self, wh):
@@ -95,33 +251,33 @@ class RetinaFace(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
 
     @variance.setter
     def variance(self, value):
-        assert isinstance(v, (list, tuple)),\
+        assert isinstance(value, (list, tuple)),\
             "The value to set `variance` must be type of tuple or list."
         assert len(value) == 2,\
             "The value to set `variance` must contatins 2 elements".format(
             len(value))
-        self._model.variance = value
+        self.postprocessor.variance = value
 
     @downsample_strides.setter
     def downsample_strides(self, value):
         assert isinstance(
             value,
             list), "The value to set `downsample_strides` must be type of list."
-        self._model.downsample_strides = value
+        self.postprocessor.downsample_strides = value
 
     @min_sizes.setter
     def min_sizes(self, value):
         assert isinstance(
             value, list), "The value to set `min_sizes` must be type of list."
-        self._model.min_sizes = value
+        self.postprocessor.min_sizes = value
 
     @landmarks_per_face.setter
     def landmarks_per_face(self, value):
         assert isinstance(
             value,
             int), "The value to set `landmarks_per_face` must be type of int."
-        self._model.landmarks_per_face = value
+        self.postprocessor.landmarks_per_face = value
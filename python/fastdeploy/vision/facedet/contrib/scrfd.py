@@ -16,6 +16,220 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class SCRFDPreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for SCRFD
+        """
+        self._manager = C.vision.facedet.SCRFDPreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for SCRFD
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    def disable_normalize(self):
+        """
+        This function will disable normalize in preprocessing step.
+        """
+        self._manager.disable_normalize()
+
+    def disable_permute(self):
+        """
+        This function will disable hwc2chw in preprocessing step.
+        """
+        self._manager.disable_permute()
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default (640, 640)
+        """
+        return self._manager.size
+
+    @property
+    def padding_value(self):
+        #  padding value, size should be the same as channels
+        return self._manager.padding_value
+
+    @property
+    def is_scale_up(self):
+        # if is_scale_up is false, the input image only can be zoom out, the maximum resize scale cannot exceed 1.0
+        return self._manager.is_scale_up
+
+    @property
+    def is_mini_pad(self):
+        # only pad to the minimum rectange which height and width is times of stride
+        return self._manager.is_mini_pad
+
+    @property
+    def is_no_pad(self):
+        # while is_mini_pad = false and is_no_pad = true, will resize the image to the set size
+        return self._manager.is_no_pad
+
+    @property
+    def stride(self):
+        # padding stride, for is_mini_pad
+        return self._manager.stride
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+    @padding_value.setter
+    def padding_value(self, value):
+        assert isinstance(
+            value,
+            list), "The value to set `padding_value` must be type of list."
+        self._manager.padding_value = value
+
+    @is_scale_up.setter
+    def is_scale_up(self, value):
+        assert isinstance(
+            value,
+            bool), "The value to set `is_scale_up` must be type of bool."
+        self._manager.is_scale_up = value
+
+    @is_mini_pad.setter
+    def is_mini_pad(self, value):
+        assert isinstance(
+            value,
+            bool), "The value to set `is_mini_pad` must be type of bool."
+        self._manager.is_mini_pad = value
+
+    @is_no_pad.setter
+    def is_no_pad(self, value):
+        assert isinstance(
+            value, bool), "The value to set `is_no_pad` must be type of bool."
+        self._manager.is_no_pad = value
+
+    @stride.setter
+    def stride(self, value):
+        assert isinstance(
+            value, int), "The value to set `stride` must be type of int."
+        self._manager.stride = value
+
+
+class SCRFDPostprocessor:
+    def __init__(self):
+        """Create a postprocessor for SCRFD
+        """
+        self._postprocessor = C.vision.facedet.SCRFDPostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for SCRFD
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of FaceDetectionResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
+
+    @property
+    def conf_threshold(self):
+        """
+        confidence threshold for postprocessing, default is 0.25
+        """
+        return self._postprocessor.conf_threshold
+
+    @property
+    def nms_threshold(self):
+        """
+        nms threshold for postprocessing, default is 0.4
+        """
+        return self._postprocessor.nms_threshold
+
+    @property
+    def downsample_strides(self):
+        """
+        Argument for image postprocessing step,
+        downsample strides (namely, steps) for SCRFD to generate anchors,
+        will take (8,16,32) as default values
+        """
+        return self._postprocessor.downsample_strides
+
+    @property
+    def landmarks_per_face(self):
+        """
+        Argument for image postprocessing step, landmarks_per_face, default 5 in SCRFD
+        """
+        return self._postprocessor.landmarks_per_face
+
+    @property
+    def use_kps(self):
+        """
+        Argument for image postprocessing step,
+        the outputs of onnx file with key points features or not, default true
+        """
+        return self._postprocessor.use_kps
+
+    @property
+    def max_nms(self):
+        """
+        Argument for image postprocessing step, the upperbond number of boxes processed by nms, default 30000
+        """
+        return self._postprocessor.max_nms
+
+    @property
+    def num_anchors(self):
+        """
+        Argument for image postprocessing step, anchor number of each stride, default 2
+        """
+        return self._postprocessor.num_anchors
+
+    @conf_threshold.setter
+    def conf_threshold(self, conf_threshold):
+        assert isinstance(conf_threshold, float),\
+            "The value to set `conf_threshold` must be type of float."
+        self._postprocessor.conf_threshold = conf_threshold
+
+    @nms_threshold.setter
+    def nms_threshold(self, nms_threshold):
+        assert isinstance(nms_threshold, float),\
+            "The value to set `nms_threshold` must be type of float."
+        self._postprocessor.nms_threshold = nms_threshold
+
+    @downsample_strides.setter
+    def downsample_strides(self, value):
+        assert isinstance(
+            value,
+            list), "The value to set `downsample_strides` must be type of list."
+        self._postprocessor.downsample_strides = value
+
+    @landmarks_per_face.setter
+    def landmarks_per_face(self, value):
+        assert isinstance(
+            value,
+            int), "The value to set `landmarks_per_face` must be type of int."
+        self._postprocessor.landmarks_per_face = value
+
+    @use_kps.setter
+    def use_kps(self, value):
+        assert isinstance(
+            value, bool), "The value to set `use_kps` must be type of bool."
+        self._postprocessor.use_kps = value
+
+    @max_nms.setter
+    def max_nms(self, value):
+        assert isinstance(
+            value, int), "The value to set `max_nms` must be type of int."
+        self._postprocessor.max_nms = value
+
+    @num_anchors.setter
+    def num_anchors(self, value):
+        assert isinstance(
+            value, int), "The value to set `num_anchors` must be type of int."
+        self._postprocessor.num_anchors = value
 
 
 class SCRFD(FastDeployModel):
@@ -48,8 +262,33 @@ class SCRFD(FastDeployModel):
         :param nms_iou_threshold: iou threashold for NMS, default is 0.3
         :return: FaceDetectionResult
         """
-        return self._model.predict(input_image, conf_threshold,
-                                   nms_iou_threshold)
+        self.postprocessor.conf_threshold = conf_threshold
+        self.postprocessor.nms_threshold = nms_iou_threshold
+        return self._model.predict(input_image)
+
+    def batch_predict(self, images):
+        """Detect the faces in a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of FaceDetectionResult
+        """
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get SCRFDPreprocessor object of the loaded model
+
+        :return SCRFDPreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get SCRFDPostprocessor object of the loaded model
+
+        :return SCRFDPostprocessor
+        """
+        return self._model.postprocessor
 
     def disable_normalize(self):
         """
@@ -70,32 +309,32 @@ class SCRFD(FastDeployModel):
         """
         Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default (640, 640)
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @property
     def padding_value(self):
         #  padding value, size should be the same as channels
-        return self._model.padding_value
+        return self.preprocessor.padding_value
 
     @property
     def is_no_pad(self):
         # while is_mini_pad = false and is_no_pad = true, will resize the image to the set size
-        return self._model.is_no_pad
+        return self.preprocessor.is_no_pad
 
     @property
     def is_mini_pad(self):
         # only pad to the minimum rectange which height and width is times of stride
-        return self._model.is_mini_pad
+        return self.preprocessor.is_mini_pad
 
     @property
     def is_scale_up(self):
         # if is_scale_up is false, the input image only can be zoom out, the maximum resize scale cannot exceed 1.0
-        return self._model.is_scale_up
+        return self.preprocessor.is_scale_up
 
     @property
     def stride(self):
         # padding stride, for is_mini_pad
-        return self._model.stride
+        return self.preprocessor.stride
 
     @property
     def downsample_strides(self):
@@ -104,14 +343,14 @@ class SCRFD(FastDeployModel):
         downsample strides (namely, steps) for SCRFD to generate anchors,
         will take (8,16,32) as default values
         """
-        return self._model.downsample_strides
+        return self.postprocessor.downsample_strides
 
     @property
     def landmarks_per_face(self):
         """
         Argument for image postprocessing step, landmarks_per_face, default 5 in SCRFD
         """
-        return self._model.landmarks_per_face
+        return self.postprocessor.landmarks_per_face
 
     @property
     def use_kps(self):
@@ -119,21 +358,21 @@ class SCRFD(FastDeployModel):
         Argument for image postprocessing step,
         the outputs of onnx file with key points features or not, default true
         """
-        return self._model.use_kps
+        return self.postprocessor.use_kps
 
     @property
     def max_nms(self):
         """
         Argument for image postprocessing step, the upperbond number of boxes processed by nms, default 30000
         """
-        return self._model.max_nms
+        return self.postprocessor.max_nms
 
     @property
     def num_anchors(self):
         """
         Argument for image postprocessing step, anchor number of each stride, default 2
         """
-        return self._model.num_anchors
+        return self.postprocessor.num_anchors
 
     @size.setter
     def size(self, wh):
@@ -142,69 +381,69 @@ class SCRFD(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
 
     @padding_value.setter
     def padding_value(self, value):
         assert isinstance(
             value,
             list), "The value to set `padding_value` must be type of list."
-        self._model.padding_value = value
+        self.preprocessor.padding_value = value
 
     @is_no_pad.setter
     def is_no_pad(self, value):
         assert isinstance(
             value, bool), "The value to set `is_no_pad` must be type of bool."
-        self._model.is_no_pad = value
+        self.preprocessor.is_no_pad = value
 
     @is_mini_pad.setter
     def is_mini_pad(self, value):
         assert isinstance(
             value,
             bool), "The value to set `is_mini_pad` must be type of bool."
-        self._model.is_mini_pad = value
+        self.preprocessor.is_mini_pad = value
 
     @is_scale_up.setter
     def is_scale_up(self, value):
         assert isinstance(
             value,
             bool), "The value to set `is_scale_up` must be type of bool."
-        self._model.is_scale_up = value
+        self.preprocessor.is_scale_up = value
 
     @stride.setter
     def stride(self, value):
         assert isinstance(
             value, int), "The value to set `stride` must be type of int."
-        self._model.stride = value
+        self.preprocessor.stride = value
 
     @downsample_strides.setter
     def downsample_strides(self, value):
         assert isinstance(
             value,
             list), "The value to set `downsample_strides` must be type of list."
-        self._model.downsample_strides = value
+        self.postprocessor.downsample_strides = value
 
     @landmarks_per_face.setter
     def landmarks_per_face(self, value):
         assert isinstance(
             value,
             int), "The value to set `landmarks_per_face` must be type of int."
-        self._model.landmarks_per_face = value
+        self.postprocessor.landmarks_per_face = value
 
     @use_kps.setter
     def use_kps(self, value):
         assert isinstance(
             value, bool), "The value to set `use_kps` must be type of bool."
-        self._model.use_kps = value
+        self.postprocessor.use_kps = value
 
     @max_nms.setter
     def max_nms(self, value):
         assert isinstance(
             value, int), "The value to set `max_nms` must be type of int."
-        self._model.max_nms = value
+        self.postprocessor.max_nms = value
 
     @num_anchors.setter
     def num_anchors(self, value):
         assert isinstance(
             value, int), "The value to set `num_anchors` must be type of int."
-        self._model.num_anchors = value
+        self.postprocessor.num_anchors = value
@@ -16,6 +16,80 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class UltraFacePreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for UltraFace
+        """
+        self._manager = C.vision.facedet.UltraFacePreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for UltraFace
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [320, 240]
+        """
+        return self._manager.size
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+
+class UltraFacePostprocessor:
+    def __init__(self):
+        """Create a postprocessor for UltraFace
+        """
+        self._postprocessor = C.vision.facedet.UltraFacePostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for UltraFace
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of FaceDetectionResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
+
+    @property
+    def conf_threshold(self):
+        """
+        confidence threshold for postprocessing, default is 0.7
+        """
+        return self._postprocessor.conf_threshold
+
+    @property
+    def nms_threshold(self):
+        """
+        nms threshold for postprocessing, default is 0.3
+        """
+        return self._postprocessor.nms_threshold
+
+    @conf_threshold.setter
+    def conf_threshold(self, conf_threshold):
+        assert isinstance(conf_threshold, float),\
+            "The value to set `conf_threshold` must be type of float."
+        self._postprocessor.conf_threshold = conf_threshold
+
+    @nms_threshold.setter
+    def nms_threshold(self, nms_threshold):
+        assert isinstance(nms_threshold, float),\
+            "The value to set `nms_threshold` must be type of float."
+        self._postprocessor.nms_threshold = nms_threshold
 
 
 class UltraFace(FastDeployModel):
@@ -31,34 +105,54 @@ class UltraFace(FastDeployModel):
         :param runtime_option: (fastdeploy.RuntimeOption)RuntimeOption for inference this model, if it's None, will use the default backend on CPU
         :param model_format: (fastdeploy.ModelForamt)Model format of the loaded model
         """
-        # 调用基函数进行backend_option的初始化
-        # 初始化后的option保存在self._runtime_option
         super(UltraFace, self).__init__(runtime_option)
 
         self._model = C.vision.facedet.UltraFace(
             model_file, params_file, self._runtime_option, model_format)
-        # 通过self.initialized判断整个模型的初始化是否成功
         assert self.initialized, "UltraFace initialize failed."
 
     def predict(self, input_image, conf_threshold=0.7, nms_iou_threshold=0.3):
-        """Detect the location and key points of human faces from an input image
+        """Detect the location of human faces from an input image
 
         :param input_image: (numpy.ndarray)The input image data, 3-D array with layout HWC, BGR format
         :param conf_threshold: confidence threashold for postprocessing, default is 0.7
         :param nms_iou_threshold: iou threashold for NMS, default is 0.3
         :return: FaceDetectionResult
         """
-        return self._model.predict(input_image, conf_threshold,
-                                   nms_iou_threshold)
+        self.postprocessor.conf_threshold = conf_threshold
+        self.postprocessor.nms_threshold = nms_iou_threshold
+        return self._model.predict(input_image)
+
+    def batch_predict(self, images):
+        """Detect the location of human faces from a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of FaceDetectionResult
+        """
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get UltraFacePreprocessor object of the loaded model
+
+        :return UltraFacePreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get UltraFacePostprocessor object of the loaded model
+
+        :return UltraFacePostprocessor
+        """
+        return self._model.postprocessor
 
-    # 一些跟UltraFace模型有关的属性封装
-    # 多数是预处理相关，可通过修改如model.size = [640, 480]改变预处理时resize的大小（前提是模型支持）
     @property
     def size(self):
         """
         Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default (320, 240)
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @size.setter
     def size(self, wh):
@@ -67,4 +161,4 @@ class UltraFace(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
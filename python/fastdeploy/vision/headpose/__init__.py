@@ -13,4 +13,4 @@
 # limitations under the License.
 
 from __future__ import absolute_import
-from .contrib.fsanet import FSANet
+from .contrib.fsanet import *
@@ -54,6 +54,30 @@ class PPTinyPose(FastDeployModel):
         else:
             return self._model.predict(input_image)
 
+    def batch_predict(self, images, detection_results):
+        """Detect keypoints in a batch of input images, the persons of all the images are inferred in batches
+
+        :param images: (list of numpy.ndarray)The input image list, each element is a 3-D array with layout HWC, BGR format
+        :param detection_results: (list of DetectionResult)Pre-detected boxes result of each image
+        :return: list of KeyPointDetectionResult
+        """
+        assert len(images) == len(
+            detection_results
+        ), "The number of images and detection_results should be the same."
+        return self._model.batch_predict(images, detection_results)
+
+    def set_batch_size(self, batch_size):
+        """Set the max number of persons inferred in one batch
+
+        :param batch_size: (int)The max number of persons, -1 means all the persons in one batch
+        """
+        return self._model.set_batch_size(batch_size)
+
+    def get_batch_size(self):
+        """Get the max number of persons inferred in one batch
+        """
+        return self._model.get_batch_size()
+
     @property
     def use_dark(self):
         """Atrribute of PPTinyPose model. Stating whether using Distribution-Aware Coordinate Representation for Human Pose Estimation(DARK for short) in postprocess, default is True
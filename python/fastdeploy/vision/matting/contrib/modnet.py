@@ -16,6 +16,99 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class MODNetPreprocessor(ProcessorManager):
+    def __init__(self):
+        """Create a preprocessor for MODNet
+        """
+        self._manager = C.vision.matting.MODNetPreprocessor()
+
+    def run(self, input_ims):
+        """Preprocess input images for MODNet
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+    @property
+    def size(self):
+        """
+        Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [256, 256]
+        """
+        return self._manager.size
+
+    @size.setter
+    def size(self, wh):
+        assert isinstance(wh, (list, tuple)),\
+            "The value to set `size` must be type of tuple or list."
+        assert len(wh) == 2,\
+            "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
+            len(wh))
+        self._manager.size = wh
+
+    @property
+    def alpha(self):
+        """
+        Argument for image preprocessing step, alpha value for normalization, default alpha = [1.0 / 127.5, 1.0 / 127.5, 1.0 / 127.5]
+        """
+        return self._manager.alpha
+
+    @alpha.setter
+    def alpha(self, value):
+        assert isinstance(value, (list, tuple)),\
+            "The value to set `alpha` must be type of tuple or list."
+        assert len(value) == 3,\
+            "The value to set `alpha` must contatins 3 elements for each channels, but now it contains {} elements.".format(
+            len(value))
+        self._manager.alpha = value
+
+    @property
+    def beta(self):
+        """
+        Argument for image preprocessing step, beta value for normalization, default beta = [-1.0, -1.0, -1.0]
+        """
+        return self._manager.beta
+
+    @beta.setter
+    def beta(self, value):
+        assert isinstance(value, (list, tuple)),\
+            "The value to set `beta` must be type of tuple or list."
+        assert len(value) == 3,\
+            "The value to set `beta` must contatins 3 elements for each channels, but now it contains {} elements.".format(
+            len(value))
+        self._manager.beta = value
+
+    @property
+    def swap_rb(self):
+        """
+        Argument for image preprocessing step, whether to swap the B and R channel, such as BGR->RGB, default True.
+        """
+        return self._manager.swap_rb
+
+    @swap_rb.setter
+    def swap_rb(self, value):
+        assert isinstance(
+            value, bool), "The value to set `swap_rb` must be type of bool."
+        self._manager.swap_rb = value
+
+
+class MODNetPostprocessor:
+    def __init__(self):
+        """Create a postprocessor for MODNet
+        """
+        self._postprocessor = C.vision.matting.MODNetPostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for MODNet
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape and output_shape
+        :return: list of MattingResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
 
 
 class MODNet(FastDeployModel):
@@ -48,6 +141,31 @@ class MODNet(FastDeployModel):
         """
         return self._model.predict(input_image)
 
+    def batch_predict(self, images):
+        """Predict the matting results for a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of MattingResult
+        """
+
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get MODNetPreprocessor object of the loaded model
+
+        :return MODNetPreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get MODNetPostprocessor object of the loaded model
+
+        :return MODNetPostprocessor
+        """
+        return self._model.postprocessor
+
     # 一些跟模型有关的属性封装
     # 多数是预处理相关，可通过修改如model.size = [256, 256]改变预处理时resize的大小（前提是模型支持）
     @property
@@ -55,28 +173,28 @@ class MODNet(FastDeployModel):
         """
         Argument for image preprocessing step, the preprocess image size, tuple of (width, height), default size = [256,256]
         """
-        return self._model.size
+        return self.preprocessor.size
 
     @property
     def alpha(self):
         """
         Argument for image preprocessing step, alpha value for normalization, default alpha = {1.f / 127.5f, 1.f / 127.5f, 1.f / 127.5f}
         """
-        return self._model.alpha
+        return self.preprocessor.alpha
 
     @property
     def beta(self):
         """
         Argument for image preprocessing step, beta value for normalization, default beta = {-1.f, -1.f, -1.f}
         """
-        return self._model.beta
+        return self.preprocessor.beta
 
     @property
     def swap_rb(self):
         """
         Argument for image preprocessing step, whether to swap the B and R channel, such as BGR->RGB, default True.
         """
-        return self._model.swap_rb
+        return self.preprocessor.swap_rb
 
     @size.setter
     def size(self, wh):
@@ -85,7 +203,7 @@ class MODNet(FastDeployModel):
         assert len(wh) == 2,\
             "The value to set `size` must contatins 2 elements means [width, height], but now it contains {} elements.".format(
             len(wh))
-        self._model.size = wh
+        self.preprocessor.size = wh
 
     @alpha.setter
     def alpha(self, value):
@@ -94,7 +212,7 @@ class MODNet(FastDeployModel):
         assert len(value) == 3,\
             "The value to set `alpha` must contatins 3 elements for each channels, but now it contains {} elements.".format(
             len(value))
-        self._model.alpha = value
+        self.preprocessor.alpha = value
 
     @beta.setter
     def beta(self, value):
@@ -103,10 +221,10 @@ class MODNet(FastDeployModel):
         assert len(value) == 3,\
             "The value to set `beta` must contatins 3 elements for each channels, but now it contains {} elements.".format(
             len(value))
-        self._model.beta = value
+        self.preprocessor.beta = value
 
     @swap_rb.setter
     def swap_rb(self, value):
         assert isinstance(
             value, bool), "The value to set `swap_rb` must be type of bool."
-        self._model.swap_rb = value
+        self.preprocessor.swap_rb = value
@@ -45,6 +45,49 @@ class RobustVideoMatting(FastDeployModel):
         """
         return self._model.predict(input_image)
 
+    def create_session(self):
+        """Create a session which owns the recurrent states of one video stream, so that one model can serve several streams
+
+        :return: (int)The handle of the session
+        """
+        return self._model.create_session()
+
+    def reset_session(self, session):
+        """Reset the recurrent states of a session to the initial zero states
+
+        :param session: (int)The handle returned by create_session()
+        :return: (bool)False if the session does not exist
+        """
+        return self._model.reset_session(session)
+
+    def release_session(self, session):
+        """Release a session and its recurrent states
+
+        :param session: (int)The handle returned by create_session()
+        :return: (bool)False if the session does not exist
+        """
+        return self._model.release_session(session)
+
+    def predict_session(self, session, input_image):
+        """Matting the next frame of a session
+
+        :param session: (int)The handle returned by create_session()
+        :param input_image: (numpy.ndarray)The input frame data, 3-D array with layout HWC, BGR format
+        :return: MattingResult
+        :raises RuntimeError: If the session does not exist or the prediction fails
+        """
+        return self._model.predict_session(session, input_image)
+
+    def batch_predict(self, sessions, images):
+        """Matting the next frames of several sessions, the frames whose sessions have recurrent states of the same shape are inferred in one batch
+
+        :param sessions: (list of int)The handles of the sessions, each session should appear at most once
+        :param images: (list of numpy.ndarray)The input frames, images[i] is the next frame of sessions[i]
+        :return: list of MattingResult
+        :raises RuntimeError: If the prediction fails, the recurrent states of all the sessions are unchanged then
+        """
+        return self._model.batch_predict(sessions, images)
+
     @property
     def size(self):
         """
@@ -16,6 +16,41 @@ from __future__ import absolute_import
 import logging
 from .... import FastDeployModel, ModelFormat
 from .... import c_lib_wrap as C
+from ...common import ProcessorManager
+
+
+class PPMattingPreprocessor(ProcessorManager):
+    def __init__(self, config_file):
+        """Create a preprocessor for PPMatting from configuration file
+
+        :param config_file: (str)Path of configuration file for deployment, e.g PPMatting-512/deploy.yml
+        """
+        self._manager = C.vision.matting.PPMattingPreprocessor(
+            config_file)
+
+    def run(self, input_ims):
+        """Preprocess input images for PPMatting
+
+        :param: input_ims: (list of numpy.ndarray)The input image
+        :return: list of FDTensor
+        """
+        return self._manager.run(input_ims)
+
+
+class PPMattingPostprocessor:
+    def __init__(self):
+        """Create a postprocessor for PPMatting
+        """
+        self._postprocessor = C.vision.matting.PPMattingPostprocessor()
+
+    def run(self, runtime_results, ims_info):
+        """Postprocess the runtime results for PPMatting
+
+        :param: runtime_results: (list of FDTensor)The output FDTensor results from runtime
+        :param: ims_info: (list of dict)Record input_shape, resized_shape and output_shape
+        :return: list of MattingResult(If the runtime_results is predict by batched samples, the length of this list equals to the batch size)
+        """
+        return self._postprocessor.run(runtime_results, ims_info)
 
 
 class PPMatting(FastDeployModel):
@@ -49,3 +84,28 @@ class PPMatting(FastDeployModel):
         """
         assert input_image is not None, "The input image data is None."
         return self._model.predict(input_image)
+
+    def batch_predict(self, images):
+        """Predict the matting results for a batch of input images
+
+        :param images: (list of numpy.ndarray) The input image list, each element is a 3-D array with layout HWC, BGR format
+        :return list of MattingResult
+        """
+
+        return self._model.batch_predict(images)
+
+    @property
+    def preprocessor(self):
+        """Get PPMattingPreprocessor object of the loaded model
+
+        :return PPMattingPreprocessor
+        """
+        return self._model.preprocessor
+
+    @property
+    def postprocessor(self):
+        """Get PPMattingPostprocessor object of the loaded model
+
+        :return PPMattingPostprocessor
+        """
+        return self._model.postprocessor
@@ -529,6 +529,27 @@ class RecognizerPreprocessor(ProcessorManager):
             list), "The value to set `rec_image_shape` must be type of list."
         self._manager.rec_image_shape = value
 
+    @property
+    def width_buckets(self):
+        return self._manager.width_buckets
+
+    @width_buckets.setter
+    def width_buckets(self, value):
+        assert isinstance(
+            value,
+            list), "The value to set `width_buckets` must be type of list."
+        self._manager.width_buckets = value
+
+    def get_padding_waste_ratio(self):
+        """Get the ratio of the padded pixels in the preprocessed images
+        """
+        return self._manager.get_padding_waste_ratio()
+
+    def reset_padding_statistics(self):
+        """Reset the statistics of padding
+        """
+        self._manager.reset_padding_statistics()
+
     def disable_normalize(self):
         """
         This function will disable normalize in preprocessing step.
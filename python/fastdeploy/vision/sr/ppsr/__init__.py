@@ -46,6 +46,43 @@ class PPMSVSR(FastDeployModel):
         assert input_images is not None, "The input image data is None."
         return self._model.predict(input_images)
 
+    def set_stream_window(self, window_size, stride=1):
+        """Set the sliding window of the streaming mode, the stream will be reset
+
+        :param window_size: (int)The number of frames fed to the model each time
+        :param stride: (int)The number of new frames between two adjacent windows, the windows overlap if stride < window_size. EDVR outputs the center frame of each window, so stride must be 1 for it
+        :return: bool
+        """
+        return self._model.set_stream_window(window_size, stride)
+
+    def push_frame(self, frame):
+        """Push a frame of the video in the streaming mode, the model runs once a window is completed
+
+        :param frame: (numpy.ndarray)The input frame, 3-D array with layout HWC, BGR format
+        :return: bool
+        """
+        assert frame is not None, "The input frame is None."
+        return self._model.push_frame(frame)
+
+    def pop_frame(self):
+        """Get the next super resolution frame in the streaming mode
+
+        :return: numpy.ndarray, or None if no frame is ready now
+        """
+        return self._model.pop_frame()
+
+    def flush_stream(self):
+        """Run the last windows at the end of the stream, to output the frames not covered by a completed window. For EDVR, the windows of the first and the last frames are padded by replicating the first and the last frame, so every frame gets an output
+
+        :return: bool
+        """
+        return self._model.flush_stream()
+
+    def reset_stream(self):
+        """Drop all the frames of the stream, start a new stream
+        """
+        self._model.reset_stream()
+
 
 class EDVR(PPMSVSR):
     def __init__(self,
@@ -0,0 +1,119 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "fastdeploy/core/allocate.h"
+#include "fastdeploy/core/fd_tensor.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+class CountingHostAllocator : public SystemHostAllocator {
+ public:
+  void* Allocate(size_t size) override {
+    ++allocate_count;
+    return SystemHostAllocator::Allocate(size);
+  }
+  void Free(void* ptr, size_t size) override {
+    ++free_count;
+    SystemHostAllocator::Free(ptr, size);
+  }
+  int allocate_count = 0;
+  int free_count = 0;
+};
+
+TEST(fastdeploy, host_memory_pool) {
+  HostMemoryPool pool;
+  void* ptr = pool.Allocate(1000);
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+  auto stat = pool.GetStatistics();
+  ASSERT_EQ(stat.hits, 0);
+  ASSERT_EQ(stat.misses, 1);
+  ASSERT_EQ(stat.bytes_in_use, 1024);
+
+  pool.Free(ptr, 1000);
+  stat = pool.GetStatistics();
+  ASSERT_EQ(stat.bytes_held, 1024);
+  ASSERT_EQ(stat.bytes_in_use, 0);
+
+  // The sizes in the same class reuse the cached block
+  void* ptr2 = pool.Allocate(900);
+  ASSERT_EQ(ptr, ptr2);
+  stat = pool.GetStatistics();
+  ASSERT_EQ(stat.hits, 1);
+  ASSERT_EQ(stat.bytes_held, 0);
+  pool.Free(ptr2, 900);
+
+  // The blocks released by the other thread are reused through the pool
+  std::thread worker([&pool]() {
+    void* p = pool.Allocate(10 * 1024 * 1024);
+    pool.Free(p, 10 * 1024 * 1024);
+  });
+  worker.join();
+  void* large = pool.Allocate(10 * 1024 * 1024);
+  stat = pool.GetStatistics();
+  ASSERT_EQ(stat.hits, 2);
+  ASSERT_EQ(stat.misses, 2);
+  pool.Free(large, 10 * 1024 * 1024);
+
+  pool.Trim();
+  stat = pool.GetStatistics();
+  ASSERT_EQ(stat.bytes_held, 0);
+  ASSERT_EQ(stat.bytes_in_use, 0);
+}
+
+TEST(fastdeploy, fd_tensor_host_allocator) {
+  auto allocator = std::make_shared<CountingHostAllocator>();
+  SetHostAllocator(allocator);
+  {
+    FDTensor tensor;
+    tensor.Allocate({4}, FDDataType::INT32);
+    int32_t* data = reinterpret_cast<int32_t*>(tensor.MutableData());
+    for (int i = 0; i < 4; ++i) {
+      data[i] = i;
+    }
+    // Growing keeps the data
+    tensor.Resize(std::vector<int64_t>({16}));
+    data = reinterpret_cast<int32_t*>(tensor.MutableData());
+    for (int i = 0; i < 4; ++i) {
+      ASSERT_EQ(data[i], i);
+    }
+    ASSERT_EQ(allocator->allocate_count, 2);
+    ASSERT_EQ(allocator->free_count, 1);
+    FDTensor moved(std::move(tensor));
+  }
+  ASSERT_EQ(allocator->free_count, 2);
+  SetHostAllocator(nullptr);
+  ASSERT_EQ(GetHostAllocator(), GetDefaultHostMemoryPool());
+}
+
+TEST(fastdeploy, fd_tensor_host_memory_pool_reuse) {
+  // The tensors allocated repeatedly reuse the cached block of the pool
+  auto pool = GetDefaultHostMemoryPool();
+  auto start = pool->GetStatistics();
+  const int repeat = 100;
+  for (int i = 0; i < repeat; ++i) {
+    FDTensor tensor;
+    tensor.Allocate({1, 3, 640, 640}, FDDataType::FP32);
+    reinterpret_cast<float*>(tensor.MutableData())[0] = 1.0f;
+  }
+  auto end = pool->GetStatistics();
+  ASSERT_GE(end.hits - start.hits, repeat - 1);
+}
+
+}  // namespace fastdeploy
@@ -0,0 +1,53 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <vector>
+
+#include "fastdeploy/utils/parallel.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+TEST(fastdeploy, parallel_for) {
+  std::vector<int> data(1000, 0);
+  utils::ParallelFor(data.size(), [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      data[i] += i;
+    }
+  }, 1, 4);
+  for (size_t i = 0; i < data.size(); ++i) {
+    ASSERT_EQ(data[i], i);
+  }
+
+  // Nested calls run serially in the worker threads
+  std::atomic<int64_t> sum{0};
+  utils::ParallelFor(8, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      utils::ParallelFor(100, [&](int64_t b, int64_t e) {
+        for (int64_t j = b; j < e; ++j) {
+          sum += j;
+        }
+      });
+    }
+  });
+  ASSERT_EQ(sum, 8 * 4950);
+
+  // Empty range
+  utils::ParallelFor(0, [&](int64_t begin, int64_t end) { sum = -1; });
+  ASSERT_EQ(sum, 8 * 4950);
+}
+
+}  // namespace fastdeploy
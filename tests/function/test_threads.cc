@@ -0,0 +1,150 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <dirent.h>
+#endif
+#include "fastdeploy/core/fd_tensor.h"
+#include "fastdeploy/function/elementwise.h"
+#include "fastdeploy/function/reduce.h"
+#include "fastdeploy/function/softmax.h"
+#include "fastdeploy/function/threads.h"
+#include "fastdeploy/function/transpose.h"
+#include "glog/logging.h"
+#include "gtest_utils.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+namespace function {
+
+// Run func with 1 thread and 4 threads, and check the outputs are the same
+static void CheckKernel(const std::function<void(FDTensor*)>& func,
+                        float epsilon = 1e-6f) {
+  CheckShape check_shape;
+  CheckData check_data;
+  FDTensor expected, output;
+
+  SetNumThreads(1);
+  func(&expected);
+  SetNumThreads(4);
+  func(&output);
+  SetNumThreads(1);
+
+  check_shape(expected.shape, output.shape);
+  ASSERT_EQ(expected.Dtype(), output.Dtype());
+  if (expected.Dtype() == FDDataType::INT64) {
+    check_data(reinterpret_cast<const int64_t*>(expected.Data()),
+               reinterpret_cast<const int64_t*>(output.Data()),
+               expected.Numel());
+  } else {
+    check_data(reinterpret_cast<const float*>(expected.Data()),
+               reinterpret_cast<const float*>(output.Data()),
+               expected.Numel(), epsilon);
+  }
+}
+
+TEST(fastdeploy, function_num_threads) {
+  ASSERT_EQ(GetNumThreads(), 1);
+  SetNumThreads(2);
+  ASSERT_EQ(GetNumThreads(), 2);
+  SetNumThreads(-1);
+  ASSERT_EQ(GetNumThreads(),
+            std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+  SetNumThreads(1);
+  ASSERT_EQ(GetNumThreads(), 1);
+
+  // The kernels can run in several threads while changing the device
+  std::vector<float> data(64 * 64, 1.0f);
+  FDTensor x;
+  x.SetExternalData({64, 64}, FDDataType::FP32, data.data());
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&x, i]() {
+      for (int j = 0; j < 50; ++j) {
+        FDTensor out;
+        Sum(x, &out, {1});
+        ASSERT_EQ(reinterpret_cast<const float*>(out.Data())[0], 64.0f);
+        if (j % 10 == 0) {
+          SetNumThreads(i % 2 + 1);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  SetNumThreads(1);
+}
+
+#ifdef __linux__
+// The number of threads of this process
+static int CountProcessThreads() {
+  DIR* dir = opendir("/proc/self/task");
+  if (dir == nullptr) {
+    return -1;
+  }
+  int count = 0;
+  while (dirent* entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') {
+      ++count;
+    }
+  }
+  closedir(dir);
+  return count;
+}
+
+TEST(fastdeploy, function_num_threads_release) {
+  // The replaced thread pools are released, instead of being cached for
+  // each number of threads
+  SetNumThreads(1);
+  int num_threads = CountProcessThreads();
+  for (int n = 2; n <= 8; ++n) {
+    SetNumThreads(n);
+    FDTensor x, out;
+    x.Allocate({64, 64}, FDDataType::FP32);
+    Sum(x, &out, {1});
+  }
+  SetNumThreads(1);
+  ASSERT_EQ(CountProcessThreads(), num_threads);
+}
+#endif
+
+TEST(fastdeploy, function_num_threads_kernels) {
+  // The segmentation logits of 19 classes, the benchmark of the full size
+  // 1x19x1024x2048 is in benchmark/cpp/benchmark_function_threads.cc
+  std::vector<int64_t> shape = {1, 19, 64, 96};
+  FDTensor x;
+  x.Allocate(shape, FDDataType::FP32);
+  float* data = reinterpret_cast<float*>(x.MutableData());
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(-5.0f, 5.0f);
+  for (int64_t i = 0; i < x.Numel(); ++i) {
+    data[i] = dist(rng);
+  }
+
+  CheckKernel([&x](FDTensor* out) { Transpose(x, out, {0, 2, 3, 1}); });
+  CheckKernel([&x](FDTensor* out) { ArgMax(x, out, 1); });
+  CheckKernel([&x](FDTensor* out) { Max(x, out, {1}); });
+  CheckKernel([&x](FDTensor* out) { Softmax(x, out, 1); });
+  CheckKernel([&x](FDTensor* out) { Add(x, x, out); });
+  // The partial sums are added in the different order
+  CheckKernel([&x](FDTensor* out) { Sum(x, out, {2, 3}); }, 1e-3f);
+}
+
+}  // namespace function
+}  // namespace fastdeploy
@@ -0,0 +1,128 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/core/fd_tensor.h"
+#include "fastdeploy/core/float16.h"
+#include "fastdeploy/function/sort.h"
+#include "fastdeploy/function/topk.h"
+#include "glog/logging.h"
+#include "gtest_utils.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace fastdeploy {
+namespace function {
+
+TEST(fastdeploy, topk) {
+  CheckShape check_shape;
+  CheckData check_data;
+  FDTensor x, out, indices;
+  // Shape: [2, 3, 2]
+  std::vector<float> x_data = {0.5, 0.1, 0.9, 0.3, 0.9, 0.7,
+                               0.2, 0.8, 0.4, 0.6, 0.1, 0.8};
+  x.SetExternalData({2, 3, 2}, FDDataType::FP32, x_data.data());
+
+  // The largest 2 along axis 1, the equal elements are sorted by indices
+  TopK(x, &out, &indices, 2, 1);
+  std::vector<float> expected_out = {0.9, 0.7, 0.9, 0.3, 0.4, 0.8, 0.2, 0.8};
+  std::vector<int64_t> expected_indices = {1, 2, 2, 1, 1, 0, 0, 2};
+  check_shape(out.shape, {2, 2, 2});
+  check_shape(indices.shape, {2, 2, 2});
+  check_data(reinterpret_cast<const float*>(out.Data()), expected_out.data(),
+             expected_out.size());
+  check_data(reinterpret_cast<const int64_t*>(indices.Data()),
+             expected_indices.data(), expected_indices.size());
+
+  // The smallest 1 along the last axis with int32 indices
+  TopK(x, &out, &indices, 1, -1, false, true, FDDataType::INT32);
+  expected_out = {0.1, 0.3, 0.7, 0.2, 0.4, 0.1};
+  std::vector<int32_t> expected_indices32 = {1, 1, 1, 0, 0, 0};
+  check_shape(out.shape, {2, 3, 1});
+  check_data(reinterpret_cast<const float*>(out.Data()), expected_out.data(),
+             expected_out.size());
+  check_data(reinterpret_cast<const int32_t*>(indices.Data()),
+             expected_indices32.data(), expected_indices32.size());
+
+  // k is clipped to the size of axis, and out can be the same as x
+  FDTensor y;
+  y.Resize({2, 3, 2}, FDDataType::FP32);
+  std::memcpy(y.MutableData(), x_data.data(), x_data.size() * sizeof(float));
+  TopK(y, &y, &indices, 10, 2);
+  expected_out = {0.5, 0.1, 0.9, 0.3, 0.9, 0.7, 0.8, 0.2, 0.6, 0.4, 0.8, 0.1};
+  check_shape(y.shape, {2, 3, 2});
+  check_data(reinterpret_cast<const float*>(y.Data()), expected_out.data(),
+             expected_out.size());
+
+  // k <= 0 gets an empty result along axis
+  TopK(x, &out, &indices, 0, 1);
+  check_shape(out.shape, {2, 0, 2});
+  check_shape(indices.shape, {2, 0, 2});
+  TopK(x, &out, &indices, -1, -1);
+  check_shape(out.shape, {2, 3, 0});
+  ASSERT_EQ(indices.Numel(), 0);
+}
+
+TEST(fastdeploy, topk_fp16_int) {
+  CheckData check_data;
+  FDTensor x, out, indices;
+  std::vector<float16> x_data = {float16(1.5f), float16(-2.0f), float16(3.0f),
+                                 float16(0.5f)};
+  x.SetExternalData({4}, FDDataType::FP16, x_data.data());
+  TopK(x, &out, &indices, 2);
+  ASSERT_EQ(out.Dtype(), FDDataType::FP16);
+  const float16* out_data = reinterpret_cast<const float16*>(out.Data());
+  ASSERT_EQ(static_cast<float>(out_data[0]), 3.0f);
+  ASSERT_EQ(static_cast<float>(out_data[1]), 1.5f);
+
+  std::vector<int32_t> int_data = {4, 7, 1, 7, 3};
+  x.SetExternalData({5}, FDDataType::INT32, int_data.data());
+  TopK(x, &out, &indices, 3, 0, true, false);
+  std::vector<int64_t> result(reinterpret_cast<const int64_t*>(indices.Data()),
+                              reinterpret_cast<const int64_t*>(indices.Data()) +
+                                  3);
+  std::sort(result.begin(), result.end());
+  std::vector<int64_t> expected_indices = {0, 1, 3};
+  check_data(result.data(), expected_indices.data(), expected_indices.size());
+}
+
+TEST(fastdeploy, topk_large) {
+  CheckData check_data;
+  // The large-vocabulary classifier with batch 64
+  std::vector<float> x_data(64 * 10000);
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+  for (auto& v : x_data) {
+    v = dist(rng);
+  }
+  FDTensor x, out, indices, sorted, sorted_indices;
+  x.SetExternalData({64, 10000}, FDDataType::FP32, x_data.data());
+
+  Sort(x, &sorted, &sorted_indices, -1, true);
+  TopK(x, &out, &indices, 5);
+
+  for (int i = 0; i < 64; ++i) {
+    check_data(reinterpret_cast<const float*>(out.Data()) + i * 5,
+               reinterpret_cast<const float*>(sorted.Data()) + i * 10000, 5);
+    check_data(reinterpret_cast<const int64_t*>(indices.Data()) + i * 5,
+               reinterpret_cast<const int64_t*>(sorted_indices.Data()) +
+                   i * 10000,
+               5);
+  }
+}
+
+}  // namespace function
+}  // namespace fastdeploy
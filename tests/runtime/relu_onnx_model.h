@@ -0,0 +1,107 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "fastdeploy/core/fd_tensor.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+// Number of elements of the input and output of the Relu model
+static const int kReluNumel = 16;
+
+// Append a varint field or a length-delimited field of protobuf
+inline void AppendProtoVarint(int field, uint64_t value, std::string* out) {
+  out->push_back(static_cast<char>(field << 3));
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+inline void AppendProtoBytes(int field, const std::string& value,
+                             std::string* out) {
+  out->push_back(static_cast<char>((field << 3) | 2));
+  uint64_t size = value.size();
+  while (size >= 0x80) {
+    out->push_back(static_cast<char>((size & 0x7F) | 0x80));
+    size >>= 7;
+  }
+  out->push_back(static_cast<char>(size));
+  out->append(value);
+}
+
+// ValueInfoProto of a float tensor with shape [1, kReluNumel]
+inline std::string ReluValueInfo(const std::string& name) {
+  std::string dim0, dim1, shape, tensor_type, type, value_info;
+  AppendProtoVarint(1, 1, &dim0);
+  AppendProtoVarint(1, kReluNumel, &dim1);
+  AppendProtoBytes(1, dim0, &shape);
+  AppendProtoBytes(1, dim1, &shape);
+  AppendProtoVarint(1, 1, &tensor_type);  // FLOAT
+  AppendProtoBytes(2, shape, &tensor_type);
+  AppendProtoBytes(1, tensor_type, &type);
+  AppendProtoBytes(1, name, &value_info);
+  AppendProtoBytes(2, type, &value_info);
+  return value_info;
+}
+
+// Write an ONNX model computing y = Relu(x) to the gtest temp dir, and
+// return its path
+inline std::string WriteReluOnnxModel(const std::string& file_name) {
+  std::string node, graph, opset, model;
+  AppendProtoBytes(1, "x", &node);
+  AppendProtoBytes(2, "y", &node);
+  AppendProtoBytes(4, "Relu", &node);
+  AppendProtoBytes(1, node, &graph);
+  AppendProtoBytes(2, "relu", &graph);
+  AppendProtoBytes(11, ReluValueInfo("x"), &graph);
+  AppendProtoBytes(12, ReluValueInfo("y"), &graph);
+  AppendProtoVarint(2, 13, &opset);
+  AppendProtoVarint(1, 7, &model);  // ir_version
+  AppendProtoBytes(7, graph, &model);
+  AppendProtoBytes(8, opset, &model);
+
+  std::string path = testing::TempDir() + file_name;
+  std::ofstream fout(path, std::ios::binary);
+  fout.write(model.data(), model.size());
+  return path;
+}
+
+// Input of the Relu model for the request with the given index
+inline std::vector<float> ReluRequestInput(int request) {
+  std::vector<float> data(kReluNumel);
+  for (int i = 0; i < kReluNumel; ++i) {
+    data[i] = static_cast<float>((request * 7 + i) % 11 - 5);
+  }
+  return data;
+}
+
+inline void CheckReluOutput(int request, const std::vector<FDTensor>& out) {
+  ASSERT_EQ(out.size(), 1);
+  ASSERT_EQ(out[0].Numel(), kReluNumel);
+  std::vector<float> input = ReluRequestInput(request);
+  const float* data = static_cast<const float*>(out[0].Data());
+  for (int i = 0; i < kReluNumel; ++i) {
+    ASSERT_EQ(data[i], std::max(input[i], 0.0f));
+  }
+}
+
+}  // namespace fastdeploy
@@ -0,0 +1,243 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/core/config.h"
+
+#ifdef ENABLE_ORT_BACKEND
+#include <algorithm>
+#include <chrono>  // NOLINT
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "fastdeploy/runtime.h"
+#include "glog/logging.h"
+#include "gtest_utils.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+// Append a varint field or a length-delimited field of protobuf
+static void AppendVarint(int field, uint64_t value, std::string* out) {
+  out->push_back(static_cast<char>(field << 3));
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+static void AppendBytes(int field, const std::string& value,
+                        std::string* out) {
+  out->push_back(static_cast<char>((field << 3) | 2));
+  uint64_t size = value.size();
+  while (size >= 0x80) {
+    out->push_back(static_cast<char>((size & 0x7F) | 0x80));
+    size >>= 7;
+  }
+  out->push_back(static_cast<char>(size));
+  out->append(value);
+}
+
+// ValueInfoProto of a float tensor with shape [batch, length]
+static std::string FloatValueInfo(const std::string& name) {
+  std::string dim0, dim1, shape, tensor_type, type, value_info;
+  AppendBytes(2, "batch", &dim0);
+  AppendBytes(2, "length", &dim1);
+  AppendBytes(1, dim0, &shape);
+  AppendBytes(1, dim1, &shape);
+  AppendVarint(1, 1, &tensor_type);  // FLOAT
+  AppendBytes(2, shape, &tensor_type);
+  AppendBytes(1, tensor_type, &type);
+  AppendBytes(1, name, &value_info);
+  AppendBytes(2, type, &value_info);
+  return value_info;
+}
+
+// An ONNX model computing y = Relu(x)
+static std::string ReluOnnxModel() {
+  std::string node, graph, opset, model;
+  AppendBytes(1, "x", &node);
+  AppendBytes(2, "y", &node);
+  AppendBytes(4, "Relu", &node);
+  AppendBytes(1, node, &graph);
+  AppendBytes(2, "relu", &graph);
+  AppendBytes(11, FloatValueInfo("x"), &graph);
+  AppendBytes(12, FloatValueInfo("y"), &graph);
+  AppendVarint(2, 13, &opset);
+  AppendVarint(1, 7, &model);  // ir_version
+  AppendBytes(7, graph, &model);
+  AppendBytes(8, opset, &model);
+  return model;
+}
+
+static std::string WriteReluModel() {
+  std::string path = testing::TempDir() + "test_batching_runtime.onnx";
+  std::ofstream fout(path, std::ios::binary);
+  std::string model = ReluOnnxModel();
+  fout.write(model.data(), model.size());
+  return path;
+}
+
+static std::unique_ptr<BatchingRuntime> CreateBatchingRuntime(
+    const std::string& path, int max_batch_size, int max_delay_us) {
+  RuntimeOption option;
+  option.SetModelPath(path, "", ModelFormat::ONNX);
+  option.UseCpu();
+  option.UseOrtBackend();
+  option.SetCpuThreadNum(1);
+  std::unique_ptr<BatchingRuntime> runtime(new BatchingRuntime());
+  if (!runtime->Init(option, max_batch_size, max_delay_us)) {
+    return nullptr;
+  }
+  return runtime;
+}
+
+static std::vector<float> RequestInput(int request, int numel) {
+  std::vector<float> data(numel);
+  for (int i = 0; i < numel; ++i) {
+    data[i] = static_cast<float>((request * 7 + i) % 11 - 5);
+  }
+  return data;
+}
+
+// Run one request of shape [batch, length] and check it against Relu
+static bool InferAndCheck(BatchingRuntime* runtime, int request, int batch,
+                          int length) {
+  std::vector<float> data = RequestInput(request, batch * length);
+  std::vector<FDTensor> inputs(1);
+  inputs[0].SetExternalData({batch, length}, FDDataType::FP32, data.data());
+  inputs[0].name = "x";
+  std::vector<FDTensor> outputs;
+  if (!runtime->Infer(inputs, &outputs)) {
+    return false;
+  }
+  if (outputs.size() != 1 ||
+      outputs[0].shape != std::vector<int64_t>({batch, length})) {
+    return false;
+  }
+  const float* result = static_cast<const float*>(outputs[0].Data());
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (result[i] != std::max(data[i], 0.0f)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(fastdeploy, batching_runtime_mixed_shapes) {
+  std::string path = WriteReluModel();
+  std::unique_ptr<BatchingRuntime> runtime =
+      CreateBatchingRuntime(path, 8, 2000);
+  ASSERT_TRUE(runtime != nullptr);
+
+  // The threads send requests of different batch sizes and lengths, each
+  // request only gets its own results back
+  const int num_threads = 8;
+  const int num_requests = 16;
+  std::vector<std::thread> threads;
+  std::vector<int> failures(num_threads, 0);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int r = 0; r < num_requests; ++r) {
+        int batch = 1 + (t + r) % 3;
+        int length = (t % 2 == 0) ? 16 : 8;
+        if (!InferAndCheck(runtime.get(), t * num_requests + r, batch,
+                           length)) {
+          ++failures[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int t = 0; t < num_threads; ++t) {
+    ASSERT_EQ(failures[t], 0);
+  }
+  BatchingStatistics stat = runtime->GetStatistics();
+  ASSERT_EQ(stat.num_requests, num_threads * num_requests);
+  int64_t merged = 0;
+  for (const auto& item : stat.batch_size_histogram) {
+    merged += item.first * item.second;
+  }
+  ASSERT_EQ(merged, stat.num_requests);
+  std::remove(path.c_str());
+}
+
+TEST(fastdeploy, batching_runtime_incompatible_not_counted) {
+  std::string path = WriteReluModel();
+  // A batch of 2 samples, the first request waits up to 1 second
+  std::unique_ptr<BatchingRuntime> runtime =
+      CreateBatchingRuntime(path, 2, 1000000);
+  ASSERT_TRUE(runtime != nullptr);
+
+  // The second request cannot be merged with the first one, so it must not
+  // fill the batch of the first one, which waits for the third request
+  std::vector<bool> successes(3, false);
+  std::vector<std::thread> threads;
+  const int lengths[3] = {16, 8, 16};
+  for (int r = 0; r < 3; ++r) {
+    threads.emplace_back([&, r]() {
+      successes[r] = InferAndCheck(runtime.get(), r, 1, lengths[r]);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int r = 0; r < 3; ++r) {
+    ASSERT_TRUE(successes[r]);
+  }
+  BatchingStatistics stat = runtime->GetStatistics();
+  ASSERT_EQ(stat.num_batches, 2);
+  ASSERT_EQ(stat.batch_size_histogram[2], 1);
+  ASSERT_EQ(stat.batch_size_histogram[1], 1);
+  std::remove(path.c_str());
+}
+
+TEST(fastdeploy, batching_runtime_max_delay) {
+  std::string path = WriteReluModel();
+  const int max_delay_us = 100000;
+  std::unique_ptr<BatchingRuntime> runtime =
+      CreateBatchingRuntime(path, 8, max_delay_us);
+  ASSERT_TRUE(runtime != nullptr);
+
+  // A single request never fills the batch, it runs after max_delay_us
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(InferAndCheck(runtime.get(), 0, 2, 16));
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  ASSERT_GE(elapsed, max_delay_us);
+  BatchingStatistics stat = runtime->GetStatistics();
+  ASSERT_EQ(stat.num_batches, 1);
+  ASSERT_EQ(stat.batch_size_histogram[1], 1);
+
+  // A full batch doesn't wait for the timeout
+  runtime->ResetStatistics();
+  start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(InferAndCheck(runtime.get(), 1, 8, 16));
+  elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count();
+  ASSERT_LT(elapsed, max_delay_us);
+  std::remove(path.c_str());
+}
+
+}  // namespace fastdeploy
+#endif
@@ -0,0 +1,92 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/core/config.h"
+
+#ifdef ENABLE_ORT_BACKEND
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fastdeploy/runtime.h"
+#include "glog/logging.h"
+#include "gtest_utils.h"
+#include "runtime/relu_onnx_model.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+static bool InferRelu(Runtime* runtime, int request,
+                      std::vector<FDTensor>* outputs) {
+  std::vector<float> data = ReluRequestInput(request);
+  std::vector<FDTensor> inputs(1);
+  inputs[0].SetExternalData({1, kReluNumel}, FDDataType::FP32, data.data());
+  inputs[0].name = "x";
+  return runtime->Infer(inputs, outputs);
+}
+
+TEST(fastdeploy, ort_clone) {
+  std::string path = WriteReluOnnxModel("test_ort_clone.onnx");
+  RuntimeOption option;
+  option.SetModelPath(path, "", ModelFormat::ONNX);
+  option.UseCpu();
+  option.UseOrtBackend();
+  std::unique_ptr<Runtime> runtime(new Runtime());
+  ASSERT_TRUE(runtime->Init(option));
+
+  // The clones share the session, and each of them infers in its own
+  // thread with its own IoBinding
+  const int num_clones = 4;
+  const int num_requests = 32;
+  std::vector<std::unique_ptr<Runtime>> clones;
+  for (int i = 0; i < num_clones; ++i) {
+    clones.emplace_back(runtime->Clone());
+    ASSERT_TRUE(clones.back() != nullptr);
+  }
+  std::vector<int> failures(num_clones, 0);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_clones; ++i) {
+    threads.emplace_back([&, i]() {
+      for (int r = 0; r < num_requests; ++r) {
+        int request = i * num_requests + r;
+        std::vector<FDTensor> outputs;
+        if (!InferRelu(clones[i].get(), request, &outputs)) {
+          ++failures[i];
+          continue;
+        }
+        CheckReluOutput(request, outputs);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int i = 0; i < num_clones; ++i) {
+    ASSERT_EQ(failures[i], 0);
+  }
+
+  // The shared session outlives the runtime it was cloned from
+  runtime.reset();
+  for (int i = 0; i < num_clones; ++i) {
+    std::vector<FDTensor> outputs;
+    ASSERT_TRUE(InferRelu(clones[i].get(), i, &outputs));
+    CheckReluOutput(i, outputs);
+  }
+  std::remove(path.c_str());
+}
+
+}  // namespace fastdeploy
+#endif
@@ -0,0 +1,136 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/core/config.h"
+
+#if defined(ENABLE_ORT_BACKEND) && !defined(NON_64_PLATFORM)
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "fastdeploy/runtime/backends/ort/ops/multiclass_nms.h"
+#include "glog/logging.h"
+#include "gtest_utils.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+struct TestMultiClassNmsKernel : public MultiClassNmsKernel {
+  TestMultiClassNmsKernel() {
+    background_label = -1;
+    keep_top_k = 100;
+    nms_eta = 1.0;
+    nms_threshold = 0.6;
+    nms_top_k = 1000;
+    normalized = true;
+    score_threshold = 0.01;
+  }
+};
+
+// The previous implementation of MultiClassNmsKernel::FastNMS, used as the
+// baseline of results and time cost
+void ReferenceFastNMS(const float* boxes, const float* scores, int num_boxes,
+                      float score_threshold, int top_k, float nms_threshold,
+                      std::vector<int>* keep_indices) {
+  std::vector<std::pair<float, int>> sorted_indices;
+  for (int i = 0; i < num_boxes; ++i) {
+    if (scores[i] > score_threshold) {
+      sorted_indices.push_back(std::make_pair(scores[i], i));
+    }
+  }
+  std::stable_sort(
+      sorted_indices.begin(), sorted_indices.end(),
+      [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+        return a.first > b.first;
+      });
+  if (top_k > -1 && top_k < static_cast<int>(sorted_indices.size())) {
+    sorted_indices.resize(top_k);
+  }
+  auto area = [](const float* box) {
+    if (box[2] < box[0] || box[3] < box[1]) {
+      return 0.f;
+    }
+    return (box[2] - box[0]) * (box[3] - box[1]);
+  };
+  while (sorted_indices.size() != 0) {
+    const int idx = sorted_indices.front().second;
+    bool keep = true;
+    for (size_t k = 0; k < keep_indices->size() && keep; ++k) {
+      const float* box1 = boxes + idx * 4;
+      const float* box2 = boxes + (*keep_indices)[k] * 4;
+      float overlap = 0.f;
+      if (!(box2[0] > box1[2] || box2[2] < box1[0] || box2[1] > box1[3] ||
+            box2[3] < box1[1])) {
+        float inter_w = std::min(box1[2], box2[2]) - std::max(box1[0], box2[0]);
+        float inter_h = std::min(box1[3], box2[3]) - std::max(box1[1], box2[1]);
+        float inter_area = inter_w * inter_h;
+        overlap = inter_area / (area(box1) + area(box2) - inter_area);
+      }
+      keep = overlap <= nms_threshold;
+    }
+    if (keep) {
+      keep_indices->push_back(idx);
+    }
+    sorted_indices.erase(sorted_indices.begin());
+  }
+}
+
+TEST(fastdeploy, ort_multiclass_nms) {
+  const int num_boxes = 5000;
+  const int num_classes = 80;
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> coord(0.f, 1.f);
+  std::uniform_real_distribution<float> size(0.01f, 0.2f);
+  std::uniform_real_distribution<float> score(0.f, 0.05f);
+  std::vector<float> boxes(num_boxes * 4);
+  for (int i = 0; i < num_boxes; ++i) {
+    boxes[i * 4] = coord(rng);
+    boxes[i * 4 + 1] = coord(rng);
+    boxes[i * 4 + 2] = boxes[i * 4] + size(rng);
+    boxes[i * 4 + 3] = boxes[i * 4 + 1] + size(rng);
+  }
+  std::vector<float> scores(num_classes * num_boxes);
+  for (auto& s : scores) {
+    s = score(rng);
+  }
+
+  TestMultiClassNmsKernel kernel;
+  std::map<int, std::vector<int>> indices;
+  kernel.NMSForEachSample(boxes.data(), scores.data(), num_boxes, num_classes,
+                          &indices);
+
+  std::vector<std::vector<int>> expected(num_classes);
+  for (int i = 0; i < num_classes; ++i) {
+    ReferenceFastNMS(boxes.data(), scores.data() + i * num_boxes, num_boxes,
+                     0.01, 1000, 0.6, &expected[i]);
+  }
+
+  // Check the results before keep_top_k
+  for (int i = 0; i < num_classes; ++i) {
+    std::vector<int> result;
+    TestMultiClassNmsKernel single_kernel;
+    single_kernel.FastNMS(boxes.data(), scores.data() + i * num_boxes,
+                          num_boxes, &result);
+    ASSERT_EQ(result, expected[i]);
+  }
+  int num_det = 0;
+  for (const auto& item : indices) {
+    num_det += item.second.size();
+  }
+  ASSERT_EQ(num_det, 100);
+}
+
+}  // namespace fastdeploy
+#endif
@@ -0,0 +1,76 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/core/config.h"
+
+#ifdef ENABLE_ORT_BACKEND
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fastdeploy/runtime.h"
+#include "glog/logging.h"
+#include "gtest_utils.h"
+#include "runtime/relu_onnx_model.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+TEST(fastdeploy, ort_persistent_binding) {
+  std::string path = WriteReluOnnxModel("test_ort_persistent_binding.onnx");
+  RuntimeOption option;
+  option.SetModelPath(path, "", ModelFormat::ONNX);
+  option.UseCpu();
+  option.UseOrtBackend();
+  option.ort_option.enable_persistent_binding = true;
+  Runtime runtime;
+  ASSERT_TRUE(runtime.Init(option));
+
+  std::vector<FDTensor> inputs(1);
+  inputs[0].name = "x";
+  std::vector<FDTensor> outputs;
+
+  // The same input buffer is refilled in place, the output buffer is bound
+  // once and reused
+  std::vector<float> data = ReluRequestInput(0);
+  inputs[0].SetExternalData({1, kReluNumel}, FDDataType::FP32, data.data());
+  ASSERT_TRUE(runtime.Infer(inputs, &outputs));
+  CheckReluOutput(0, outputs);
+  const void* output_ptr = outputs[0].Data();
+  for (int r = 1; r < 4; ++r) {
+    std::vector<float> next = ReluRequestInput(r);
+    std::copy(next.begin(), next.end(), data.begin());
+    ASSERT_TRUE(runtime.Infer(inputs, &outputs));
+    CheckReluOutput(r, outputs);
+    ASSERT_EQ(outputs[0].Data(), output_ptr);
+  }
+
+  // A new input buffer is rebound
+  std::vector<float> other = ReluRequestInput(5);
+  inputs[0].SetExternalData({1, kReluNumel}, FDDataType::FP32, other.data());
+  ASSERT_TRUE(runtime.Infer(inputs, &outputs));
+  CheckReluOutput(5, outputs);
+
+  // New output tensors are rebound as well
+  std::vector<FDTensor> other_outputs;
+  ASSERT_TRUE(runtime.Infer(inputs, &other_outputs));
+  CheckReluOutput(5, other_outputs);
+  CheckReluOutput(5, outputs);
+  std::remove(path.c_str());
+}
+
+}  // namespace fastdeploy
+#endif
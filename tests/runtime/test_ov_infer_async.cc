@@ -0,0 +1,113 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fastdeploy/core/config.h"
+
+#ifdef ENABLE_OPENVINO_BACKEND
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fastdeploy/runtime.h"
+#include "glog/logging.h"
+#include "gtest_utils.h"
+#include "runtime/relu_onnx_model.h"
+#include "gtest/gtest.h"
+
+namespace fastdeploy {
+
+static std::unique_ptr<Runtime> CreateReluRuntime(const std::string& path) {
+  RuntimeOption option;
+  option.SetModelPath(path, "", ModelFormat::ONNX);
+  option.UseCpu();
+  option.UseOpenVINOBackend();
+  option.openvino_option.SetInferRequestNum(4);
+  std::unique_ptr<Runtime> runtime(new Runtime());
+  if (!runtime->Init(option)) {
+    return nullptr;
+  }
+  return runtime;
+}
+
+TEST(fastdeploy, ov_infer_async) {
+  std::string path = WriteReluOnnxModel("test_ov_infer_async.onnx");
+  std::unique_ptr<Runtime> runtime = CreateReluRuntime(path);
+  ASSERT_TRUE(runtime != nullptr);
+
+  // Many threads share the requests pool of one runtime
+  const int num_threads = 8;
+  const int num_requests = 32;
+  std::vector<std::thread> threads;
+  std::vector<int> failures(num_threads, 0);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int r = 0; r < num_requests; ++r) {
+        int request = t * num_requests + r;
+        std::vector<float> data = ReluRequestInput(request);
+        std::vector<FDTensor> inputs(1);
+        inputs[0].SetExternalData({1, kReluNumel}, FDDataType::FP32,
+                                  data.data());
+        inputs[0].name = "x";
+        std::vector<FDTensor> outputs;
+        if (!runtime->InferAsync(inputs, &outputs).get()) {
+          ++failures[t];
+          continue;
+        }
+        CheckReluOutput(request, outputs);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int t = 0; t < num_threads; ++t) {
+    ASSERT_EQ(failures[t], 0);
+  }
+  std::remove(path.c_str());
+}
+
+TEST(fastdeploy, ov_infer_async_destroy_in_flight) {
+  std::string path = WriteReluOnnxModel("test_ov_infer_async.onnx");
+  std::unique_ptr<Runtime> runtime = CreateReluRuntime(path);
+  ASSERT_TRUE(runtime != nullptr);
+
+  // The inputs and outputs have to outlive the requests
+  const int num_requests = 64;
+  std::vector<std::vector<float>> datas(num_requests);
+  std::vector<std::vector<FDTensor>> inputs(num_requests);
+  std::vector<std::vector<FDTensor>> outputs(num_requests);
+  std::vector<std::future<bool>> futures;
+  for (int r = 0; r < num_requests; ++r) {
+    datas[r] = ReluRequestInput(r);
+    inputs[r].resize(1);
+    inputs[r][0].SetExternalData({1, kReluNumel}, FDDataType::FP32,
+                                 datas[r].data());
+    inputs[r][0].name = "x";
+    futures.push_back(runtime->InferAsync(inputs[r], &outputs[r]));
+  }
+  // Destroy the backend while the last requests are still running, the
+  // destructor waits for their callbacks
+  runtime.reset();
+  for (int r = 0; r < num_requests; ++r) {
+    ASSERT_TRUE(futures[r].get());
+    CheckReluOutput(r, outputs[r]);
+  }
+  std::remove(path.c_str());
+}
+
+}  // namespace fastdeploy
+#endif
@@ -0,0 +1,96 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <random>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+static int ReferenceArgMax(const std::vector<float>& array, float* max_value) {
+  if (array.empty()) {
+    *max_value = 0.0f;
+    return -1;
+  }
+  int best_index = 0;
+  for (size_t i = 1; i < array.size(); ++i) {
+    if (array[i] > array[best_index]) {
+      best_index = static_cast<int>(i);
+    }
+  }
+  *max_value = array[best_index];
+  return best_index;
+}
+
+// The values are multiples of 1/8, so that many elements tie on the maximum
+static std::vector<float> RandomArray(int size, int seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dis(-8, 8);
+  std::vector<float> data(size);
+  for (auto& v : data) {
+    v = dis(gen) / 8.0f;
+  }
+  return data;
+}
+
+static void CheckArgMax(const std::vector<float>& array) {
+  float expect_value = 0.0f;
+  int expect = ReferenceArgMax(array, &expect_value);
+  float max_value = -1.0f;
+  int index = vision::utils::ArgMaxWithValue(
+      array.data(), static_cast<int>(array.size()), &max_value);
+  ASSERT_EQ(index, expect) << "array size: " << array.size();
+  ASSERT_EQ(max_value, expect_value) << "array size: " << array.size();
+}
+
+TEST(fastdeploy, argmax_with_value) {
+  // The sizes around the vector widths of SSE2/NEON and AVX2, which are not
+  // multiples of them go through the scalar tail
+  for (int size = 0; size <= 67; ++size) {
+    for (int seed = 0; seed < 8; ++seed) {
+      CheckArgMax(RandomArray(size, size * 8 + seed));
+    }
+  }
+  for (int size : {1000, 1001, 6625, 6627}) {
+    CheckArgMax(RandomArray(size, size));
+  }
+}
+
+TEST(fastdeploy, argmax_with_value_ties) {
+  // All the elements tie, the first one wins
+  for (int size : {1, 3, 4, 7, 8, 9, 17, 31}) {
+    CheckArgMax(std::vector<float>(size, 0.5f));
+  }
+  // The maximum appears in different lanes and in the tail, the smallest
+  // index of them wins
+  for (int size : {9, 13, 16, 23, 37}) {
+    for (int first = 0; first < size; ++first) {
+      for (int second = first + 1; second < size; ++second) {
+        std::vector<float> array(size, -1.0f);
+        array[first] = 2.0f;
+        array[second] = 2.0f;
+        float max_value = 0.0f;
+        ASSERT_EQ(vision::utils::ArgMaxWithValue(array.data(), size,
+                                                 &max_value),
+                  first);
+        ASSERT_EQ(max_value, 2.0f);
+      }
+    }
+  }
+}
+
+}  // namespace fastdeploy
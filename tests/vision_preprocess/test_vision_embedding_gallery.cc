@@ -0,0 +1,163 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+static std::vector<float> RandomEmbeddings(int num, int dim, int seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> value(0.0f, 1.0f);
+  std::vector<float> embeddings(static_cast<size_t>(num) * dim);
+  for (auto& v : embeddings) {
+    v = value(rng);
+  }
+  return embeddings;
+}
+
+TEST(fastdeploy, vision_embedding_gallery) {
+  CheckData check_data;
+  const int dim = 4;
+  vision::utils::EmbeddingGallery gallery(dim);
+  ASSERT_TRUE(gallery.Add({10, 20, 30}, {1, 0, 0, 0, 0, 2, 0, 0, 1, 1, 0, 0}));
+  ASSERT_FALSE(gallery.Add(40, {1, 0}));
+  ASSERT_EQ(gallery.Size(), 3);
+
+  std::vector<int64_t> ids;
+  std::vector<float> scores;
+  // Two queries, the scores are cosine similarities
+  ASSERT_TRUE(gallery.Search({0, 3, 0, 0, 1, 0, 0, 0}, 2, &ids, &scores));
+  ASSERT_EQ(ids, std::vector<int64_t>({20, 30, 10, 30}));
+  check_data(scores.data(), std::vector<float>({1.0f, 0.70710678f, 1.0f,
+                                                0.70710678f}).data(),
+             scores.size());
+
+  // Replace and remove by id
+  ASSERT_TRUE(gallery.Add(10, {0, 0, 1, 0}));
+  ASSERT_TRUE(gallery.Remove(20));
+  ASSERT_FALSE(gallery.Remove(20));
+  ASSERT_TRUE(gallery.Search({1, 0, 0, 0}, 5, &ids, &scores));
+  ASSERT_EQ(ids, std::vector<int64_t>({30, 10}));
+
+  // Save and load back by mmap, the mapped gallery is still writable
+  std::string path = testing::TempDir() + "test_vision_embedding_gallery.bin";
+  ASSERT_TRUE(gallery.Save(path));
+  vision::utils::EmbeddingGallery loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  ASSERT_EQ(loaded.Dim(), dim);
+  ASSERT_TRUE(loaded.Add(50, {1, 0, 0, 0}));
+  ASSERT_TRUE(loaded.Search({1, 0, 0, 0}, 1, &ids, &scores));
+  ASSERT_EQ(ids, std::vector<int64_t>({50}));
+  std::remove(path.c_str());
+}
+
+TEST(fastdeploy, vision_embedding_gallery_load_failure) {
+  const int dim = 4;
+  vision::utils::EmbeddingGallery gallery(dim);
+  ASSERT_TRUE(gallery.Add({1234567, 7654321}, {1, 0, 0, 0, 0, 1, 0, 0}));
+  std::string path =
+      testing::TempDir() + "test_vision_embedding_gallery_dup.bin";
+  ASSERT_TRUE(gallery.Save(path));
+
+  // Duplicate the first id in the saved file
+  std::string content;
+  {
+    std::ifstream fin(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(fin),
+                   std::istreambuf_iterator<char>());
+  }
+  int64_t first = 1234567;
+  int64_t second = 7654321;
+  size_t pos = content.find(
+      std::string(reinterpret_cast<const char*>(&second), sizeof(second)));
+  ASSERT_NE(pos, std::string::npos);
+  content.replace(pos, sizeof(first),
+                  std::string(reinterpret_cast<const char*>(&first),
+                              sizeof(first)));
+  {
+    std::ofstream fout(path, std::ios::binary);
+    fout.write(content.data(), content.size());
+  }
+
+  // The gallery is unchanged after the failed Load
+  vision::utils::EmbeddingGallery loaded(2);
+  ASSERT_TRUE(loaded.Add(5, {1, 0}));
+  ASSERT_FALSE(loaded.Load(path));
+  ASSERT_FALSE(loaded.Load(path + ".not_exist"));
+  ASSERT_EQ(loaded.Dim(), 2);
+  ASSERT_EQ(loaded.Ids(), std::vector<int64_t>({5}));
+  std::vector<int64_t> ids;
+  std::vector<float> scores;
+  ASSERT_TRUE(loaded.Search({0, 1}, 1, &ids, &scores));
+  ASSERT_EQ(ids, std::vector<int64_t>({5}));
+  std::remove(path.c_str());
+}
+
+TEST(fastdeploy, vision_embedding_gallery_precisions) {
+  // 512 is the embedding size of the faceid models, the benchmark of the
+  // large galleries is in benchmark/cpp/benchmark_embedding_gallery.cc
+  const int dim = 512;
+  const int num = 2000;
+  const int num_queries = 5;
+  std::vector<float> queries = RandomEmbeddings(num_queries, dim, 1);
+  std::vector<float> embeddings = RandomEmbeddings(num, dim, 2);
+  std::vector<int64_t> gallery_ids(num);
+  for (int i = 0; i < num; ++i) {
+    gallery_ids[i] = i;
+  }
+  // The queries are close to the last added embeddings
+  std::vector<float> targets(queries);
+  for (int i = 0; i < num_queries * dim; ++i) {
+    targets[i] = embeddings[(num - num_queries) * dim + i] + 0.5f * queries[i];
+  }
+  for (auto precision : {vision::utils::GalleryPrecision::FP32,
+                         vision::utils::GalleryPrecision::FP16,
+                         vision::utils::GalleryPrecision::INT8}) {
+    vision::utils::EmbeddingGallery gallery(dim, precision);
+    ASSERT_TRUE(gallery.Add(gallery_ids, embeddings));
+    std::vector<int64_t> ids;
+    std::vector<float> scores;
+    ASSERT_TRUE(gallery.Search(targets, 10, &ids, &scores));
+    ASSERT_EQ(ids.size(), num_queries * 10);
+    for (int q = 0; q < num_queries; ++q) {
+      ASSERT_EQ(ids[q * 10], num - num_queries + q);
+      for (int k = 1; k < 10; ++k) {
+        ASSERT_GE(scores[q * 10 + k - 1], scores[q * 10 + k]);
+      }
+    }
+  }
+}
+
+TEST(fastdeploy, vision_embedding_gallery_int8_dim) {
+  // The int32 accumulators of the INT8 gallery limit its dimension
+  const int dim = 8192 + 16;
+  std::vector<float> embedding = RandomEmbeddings(1, dim, 0);
+  vision::utils::EmbeddingGallery int8_gallery(
+      dim, vision::utils::GalleryPrecision::INT8);
+  ASSERT_FALSE(int8_gallery.Add(0, embedding));
+  vision::utils::EmbeddingGallery fp32_gallery(dim);
+  ASSERT_TRUE(fp32_gallery.Add(0, embedding));
+}
+
+}  // namespace fastdeploy
@@ -0,0 +1,95 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+TEST(fastdeploy, opencv_letter_box_normalize_permute) {
+  CheckShape check_shape;
+  CheckData check_data;
+
+  std::vector<float> padding_value({114.0, 115.0, 116.0});
+  std::vector<float> alpha(3, 1.0f / 255.0f);
+  std::vector<float> beta(3, 0.0f);
+  // (height, width, resize_h, resize_w, top, bottom, left, right) for
+  // 1080p frame to 640x640, upsampling and no resize
+  std::vector<std::array<int, 8>> cases = {
+      {1080, 1920, 360, 640, 140, 140, 0, 0},
+      {100, 60, 200, 120, 0, 0, 4, 4},
+      {64, 48, 64, 48, 1, 2, 3, 4}};
+  for (const auto& c : cases) {
+    cv::Mat mat(c[0], c[1], CV_8UC3);
+    cv::randu(mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    vision::Mat mat_expected(mat);
+    if (c[2] != c[0] || c[3] != c[1]) {
+      vision::Resize::Run(&mat_expected, c[3], c[2]);
+    }
+    vision::Pad::Run(&mat_expected, c[4], c[5], c[6], c[7], padding_value);
+    vision::ConvertAndPermute::Run(&mat_expected, alpha, beta, true);
+
+    vision::Mat mat_fused(mat);
+    vision::LetterBoxNormalizePermute::Run(&mat_fused, c[3], c[2], c[4], c[5],
+                                           c[6], c[7], padding_value, alpha,
+                                           beta, true);
+
+    FDTensor expected;
+    FDTensor fused;
+    mat_expected.ShareWithTensor(&expected);
+    mat_fused.ShareWithTensor(&fused);
+    check_shape(expected.shape, fused.shape);
+    // OpenCV rounds the resized pixels to uint8
+    check_data(reinterpret_cast<const float*>(expected.Data()),
+               reinterpret_cast<const float*>(fused.Data()), expected.Numel(),
+               1.0f / 255.0f);
+  }
+}
+
+TEST(fastdeploy, yolov5_fused_letter_box) {
+  CheckShape check_shape;
+  CheckData check_data;
+
+  cv::Mat mat0(480, 640, CV_8UC3);
+  cv::Mat mat1(720, 1280, CV_8UC3);
+  cv::randu(mat0, cv::Scalar::all(0), cv::Scalar::all(255));
+  cv::randu(mat1, cv::Scalar::all(0), cv::Scalar::all(255));
+
+  vision::detection::YOLOv5Preprocessor preprocessor;
+  std::vector<vision::FDMat> images = vision::WrapMat({mat0, mat1});
+  std::vector<FDTensor> expected;
+  std::vector<std::map<std::string, std::array<float, 2>>> expected_info;
+  ASSERT_TRUE(preprocessor.Run(&images, &expected, &expected_info));
+
+  preprocessor.SetFusedLetterBox(true);
+  images = vision::WrapMat({mat0, mat1});
+  std::vector<FDTensor> fused;
+  std::vector<std::map<std::string, std::array<float, 2>>> fused_info;
+  ASSERT_TRUE(preprocessor.Run(&images, &fused, &fused_info));
+
+  check_shape(expected[0].shape, fused[0].shape);
+  check_data(reinterpret_cast<const float*>(expected[0].Data()),
+             reinterpret_cast<const float*>(fused[0].Data()),
+             expected[0].Numel(), 1.0f / 255.0f);
+  for (size_t i = 0; i < expected_info.size(); ++i) {
+    ASSERT_EQ(expected_info[i]["input_shape"], fused_info[i]["input_shape"]);
+    ASSERT_EQ(expected_info[i]["output_shape"], fused_info[i]["output_shape"]);
+  }
+}
+
+}  // namespace fastdeploy
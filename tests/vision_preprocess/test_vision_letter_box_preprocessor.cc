@@ -0,0 +1,88 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+// The images of a batch are letterboxed to the same shape in parallel, the
+// slices of the batched tensor should be the same as processing them alone
+template <typename T>
+void CheckLetterBoxBatch(T* batched, T* single) {
+  CheckShape check_shape;
+  CheckData check_data;
+
+  // Larger and smaller than the target size, with odd widths
+  std::vector<cv::Mat> mats;
+  for (auto& size : std::vector<std::array<int, 2>>(
+           {{480, 640}, {720, 1281}, {300, 199}, {640, 640}})) {
+    cv::Mat mat(size[0], size[1], CV_8UC3);
+    cv::randu(mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    mats.push_back(mat);
+  }
+
+  ASSERT_TRUE(batched->SetPreprocessThreads(4));
+  std::vector<vision::FDMat> images = vision::WrapMat(mats);
+  std::vector<FDTensor> outputs;
+  std::vector<std::map<std::string, std::array<float, 2>>> ims_info;
+  ASSERT_TRUE(batched->Run(&images, &outputs, &ims_info));
+  ASSERT_EQ(ims_info.size(), mats.size());
+  check_shape(outputs[0].shape,
+              std::vector<int64_t>({static_cast<int64_t>(mats.size()), 3,
+                                    640, 640}));
+
+  ASSERT_TRUE(single->SetPreprocessThreads(1));
+  int64_t slice_numel = outputs[0].Numel() / mats.size();
+  for (size_t i = 0; i < mats.size(); ++i) {
+    std::vector<vision::FDMat> image =
+        vision::WrapMat(std::vector<cv::Mat>({mats[i]}));
+    std::vector<FDTensor> expected;
+    std::vector<std::map<std::string, std::array<float, 2>>> im_info;
+    ASSERT_TRUE(single->Run(&image, &expected, &im_info));
+    check_shape(expected[0].shape, std::vector<int64_t>({1, 3, 640, 640}));
+    check_data(reinterpret_cast<const float*>(expected[0].Data()),
+               reinterpret_cast<const float*>(outputs[0].Data()) +
+                   i * slice_numel,
+               slice_numel);
+    for (const auto& key : {"input_shape", "output_shape"}) {
+      ASSERT_EQ(im_info[0].at(key)[0], ims_info[i].at(key)[0]);
+      ASSERT_EQ(im_info[0].at(key)[1], ims_info[i].at(key)[1]);
+    }
+  }
+}
+
+TEST(fastdeploy, letter_box_preprocessor_batch) {
+  // Rounds the size while fitting the image
+  vision::detection::YOLOv6Preprocessor yolov6_batched, yolov6_single;
+  CheckLetterBoxBatch(&yolov6_batched, &yolov6_single);
+
+  // Truncates the size while fitting the image
+  vision::detection::ScaledYOLOv4Preprocessor scaledyolov4_batched,
+      scaledyolov4_single;
+  CheckLetterBoxBatch(&scaledyolov4_batched, &scaledyolov4_single);
+
+  // Pads with 0 and normalizes by other alpha and beta
+  vision::facedet::SCRFDPreprocessor scrfd_batched, scrfd_single;
+  CheckLetterBoxBatch(&scrfd_batched, &scrfd_single);
+}
+
+}  // namespace fastdeploy
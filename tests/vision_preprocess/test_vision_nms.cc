@@ -0,0 +1,116 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+static vision::DetectionResult RandomDetectionResult(int num, int num_classes) {
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> coord(0.0f, 1000.0f);
+  std::uniform_real_distribution<float> size(10.0f, 200.0f);
+  std::uniform_real_distribution<float> score(0.0f, 1.0f);
+  std::uniform_int_distribution<int> label(0, num_classes - 1);
+  vision::DetectionResult result;
+  result.Reserve(num);
+  for (int i = 0; i < num; ++i) {
+    float x = coord(rng);
+    float y = coord(rng);
+    result.boxes.emplace_back(
+        std::array<float, 4>{x, y, x + size(rng), y + size(rng)});
+    result.scores.push_back(score(rng));
+    result.label_ids.push_back(label(rng));
+  }
+  return result;
+}
+
+TEST(fastdeploy, vision_nms) {
+  vision::DetectionResult result;
+  result.boxes = {{0, 0, 10, 10}, {1, 1, 11, 11}, {0, 0, 10, 10},
+                  {20, 20, 30, 30}, {21, 21, 31, 31}};
+  // The equal scores are not dropped
+  result.scores = {0.8f, 0.9f, 0.8f, 0.7f, 0.7f};
+  result.label_ids = {0, 0, 1, 2, 2};
+
+  vision::DetectionResult output = result;
+  std::vector<int> index;
+  vision::utils::NMS(&output, 0.5, &index);
+  ASSERT_EQ(index, std::vector<int>({1, 3}));
+  ASSERT_EQ(output.scores, std::vector<float>({0.9f, 0.7f}));
+  ASSERT_EQ(output.label_ids, std::vector<int32_t>({0, 2}));
+
+  // Only the boxes with the same label suppress each other
+  output = result;
+  vision::utils::NMS(&output, 0.5, -1, true, &index);
+  ASSERT_EQ(index, std::vector<int>({1, 2, 3}));
+  ASSERT_EQ(output.boxes.size(), 3);
+  ASSERT_EQ(output.boxes[1], result.boxes[2]);
+
+  // Stop once top_k boxes are kept
+  output = result;
+  vision::utils::NMS(&output, 0.5, 2, true, &index);
+  ASSERT_EQ(index, std::vector<int>({1, 2}));
+  ASSERT_EQ(output.scores.size(), 2);
+
+  vision::FaceDetectionResult face;
+  face.landmarks_per_face = 1;
+  face.boxes = {{0, 0, 10, 10}, {20, 20, 30, 30}, {1, 1, 11, 11}};
+  face.scores = {0.5f, 0.6f, 0.7f};
+  face.landmarks = {{0, 0}, {1, 1}, {2, 2}};
+  vision::utils::NMS(&face, 0.5);
+  ASSERT_EQ(face.scores, std::vector<float>({0.7f, 0.6f}));
+  ASSERT_EQ(face.landmarks[0][0], 2);
+  ASSERT_EQ(face.landmarks[1][0], 1);
+}
+
+TEST(fastdeploy, vision_nms_class_aware) {
+  const int num_classes = 80;
+  for (int num : {1000, 10000}) {
+    vision::DetectionResult result = RandomDetectionResult(num, num_classes);
+    vision::DetectionResult class_aware = result;
+    std::vector<int> index;
+    vision::utils::NMS(&class_aware, 0.45, -1, true, &index);
+
+    // The same as the NMS of each class
+    std::vector<int> expected;
+    for (int label = 0; label < num_classes; ++label) {
+      vision::DetectionResult one_class;
+      std::vector<int> origin;
+      for (int i = 0; i < num; ++i) {
+        if (result.label_ids[i] == label) {
+          one_class.boxes.push_back(result.boxes[i]);
+          one_class.scores.push_back(result.scores[i]);
+          one_class.label_ids.push_back(label);
+          origin.push_back(i);
+        }
+      }
+      std::vector<int> one_class_index;
+      vision::utils::NMS(&one_class, 0.45, &one_class_index);
+      for (int i : one_class_index) {
+        expected.push_back(origin[i]);
+      }
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(index.begin(), index.end());
+    ASSERT_EQ(index, expected);
+  }
+}
+
+}  // namespace fastdeploy
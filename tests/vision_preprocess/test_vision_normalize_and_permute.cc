@@ -21,6 +21,92 @@
 
 namespace fastdeploy {
 
+// The multi-pass implementation before the fused kernel, used as the
+// baseline of results
+void ReferenceNormalizeAndPermute(const cv::Mat& im,
+                                  const std::vector<float>& alpha,
+                                  const std::vector<float>& beta, bool swap_rb,
+                                  cv::Mat* res) {
+  std::vector<cv::Mat> split_im;
+  cv::split(im, split_im);
+  if (swap_rb) std::swap(split_im[0], split_im[2]);
+  for (int c = 0; c < im.channels(); c++) {
+    split_im[c].convertTo(split_im[c], CV_32FC1, alpha[c], beta[c]);
+  }
+  *res = cv::Mat(im.rows, im.cols, CV_32FC(im.channels()));
+  for (int i = 0; i < im.channels(); ++i) {
+    cv::extractChannel(split_im[i],
+                       cv::Mat(im.rows, im.cols, CV_32FC1,
+                               res->ptr() + i * im.rows * im.cols * 4),
+                       0);
+  }
+}
+
+TEST(fastdeploy, opencv_norm_and_perm_fused) {
+  CheckShape check_shape;
+  CheckData check_data;
+
+  std::vector<float> mean({0.485, 0.456, 0.406});
+  std::vector<float> std({0.229, 0.224, 0.225});
+  std::vector<float> alpha;
+  std::vector<float> beta;
+  for (size_t i = 0; i < mean.size(); ++i) {
+    alpha.push_back(1.0 / 255.0 / std[i]);
+    beta.push_back(-mean[i] / std[i]);
+  }
+  for (int size : {224, 640}) {
+    // Odd width to cover the tail of vectorized loop
+    cv::Mat mat(size, size + 3, CV_8UC3);
+    cv::randu(mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::Mat expected;
+    ReferenceNormalizeAndPermute(mat, alpha, beta, true, &expected);
+
+    vision::ConvertAndPermute convert_and_permute(alpha, beta, true);
+    vision::Mat fused_mat(mat);
+    convert_and_permute(&fused_mat, vision::ProcLib::OPENCV);
+    FDTensor fused;
+    fused_mat.ShareWithTensor(&fused);
+    check_shape(fused.shape, std::vector<int64_t>({3, size, size + 3}));
+    check_data(reinterpret_cast<const float*>(expected.ptr()),
+               reinterpret_cast<const float*>(fused.Data()), fused.Numel());
+  }
+
+  // Mat with stride between rows, and gray image
+  cv::Mat big(64, 80, CV_8UC3);
+  cv::randu(big, cv::Scalar::all(0), cv::Scalar::all(255));
+  cv::Mat roi = big(cv::Rect(5, 3, 37, 29));
+  cv::Mat expected;
+  ReferenceNormalizeAndPermute(roi, alpha, beta, false, &expected);
+  vision::Mat roi_mat(roi);
+  vision::ConvertAndPermute::Run(&roi_mat, alpha, beta, false,
+                                 vision::ProcLib::OPENCV);
+  FDTensor result;
+  roi_mat.ShareWithTensor(&result);
+  check_data(reinterpret_cast<const float*>(expected.ptr()),
+             reinterpret_cast<const float*>(result.Data()), result.Numel());
+
+  cv::Mat gray(31, 45, CV_8UC1);
+  cv::randu(gray, cv::Scalar::all(0), cv::Scalar::all(255));
+  ReferenceNormalizeAndPermute(gray, alpha, beta, false, &expected);
+  vision::Mat gray_mat(gray);
+  vision::ConvertAndPermute::Run(&gray_mat, alpha, beta, false,
+                                 vision::ProcLib::OPENCV);
+  gray_mat.ShareWithTensor(&result);
+  check_data(reinterpret_cast<const float*>(expected.ptr()),
+             reinterpret_cast<const float*>(result.Data()), result.Numel());
+
+  // Write into the given buffer, e.g. the input tensor of runtime
+  ReferenceNormalizeAndPermute(roi, alpha, beta, true, &expected);
+  std::vector<float> buffer(3 * roi.rows * roi.cols);
+  vision::Mat buffer_mat(roi);
+  vision::ConvertAndPermute::Run(&buffer_mat, alpha, beta, true,
+                                 vision::ProcLib::OPENCV, buffer.data());
+  buffer_mat.ShareWithTensor(&result);
+  ASSERT_EQ(result.Data(), buffer.data());
+  check_data(reinterpret_cast<const float*>(expected.ptr()), buffer.data(),
+             buffer.size());
+}
+
 #ifdef ENABLE_FLYCV
 TEST(fastdeploy, flycv_norm_and_perm0) {
   CheckShape check_shape;
@@ -0,0 +1,120 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "fastdeploy/vision/ocr/ppocr/utils/ocr_postprocess_op.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+// The mean of pred in the mask filled by cv::fillPoly, which is the score
+// of the polygon computed by the old DB postprocess
+static double FillPolyScore(const cv::Mat& pred,
+                            const std::vector<cv::Point>& polygon) {
+  cv::Mat mask = cv::Mat::zeros(pred.rows, pred.cols, CV_8UC1);
+  const cv::Point* pts[1] = {polygon.data()};
+  int npts[1] = {static_cast<int>(polygon.size())};
+  cv::fillPoly(mask, pts, npts, 1, cv::Scalar(1));
+  return cv::mean(pred, mask)[0];
+}
+
+static void CheckPolygonScores(
+    const cv::Mat& pred, const std::vector<std::vector<cv::Point>>& polygons) {
+  std::vector<double> row_sums(pred.rows * (pred.cols + 1));
+  for (int y = 0; y < pred.rows; ++y) {
+    double* sums = row_sums.data() + y * (pred.cols + 1);
+    sums[0] = 0.0;
+    for (int x = 0; x < pred.cols; ++x) {
+      sums[x + 1] = sums[x] + pred.at<float>(y, x);
+    }
+  }
+  vision::ocr::PostProcessor post_processor;
+  std::vector<cv::Vec3i> spans;
+  std::vector<std::pair<int, int64_t>> crossings;
+  for (const auto& polygon : polygons) {
+    float score = post_processor.PolygonScoreScanline(
+        polygon.data(), static_cast<int>(polygon.size()), row_sums.data(),
+        pred.cols, pred.rows, &spans, &crossings);
+    ASSERT_NEAR(score, FillPolyScore(pred, polygon), 1e-5);
+  }
+}
+
+static cv::Mat RandomPred(int height, int width, int seed) {
+  cv::Mat pred(height, width, CV_32FC1);
+  cv::RNG rng(seed);
+  rng.fill(pred, cv::RNG::UNIFORM, cv::Scalar(0.0), cv::Scalar(1.0));
+  return pred;
+}
+
+TEST(fastdeploy, ocr_polygon_score_convex) {
+  cv::Mat pred = RandomPred(83, 97, 0);
+  std::vector<std::vector<cv::Point>> polygons = {
+      {{10, 10}, {40, 10}, {40, 30}, {10, 30}},
+      {{5, 5}, {60, 20}, {30, 70}},
+      {{0, 0}, {96, 0}, {96, 82}, {0, 82}},
+      {{20, 3}, {21, 3}, {21, 4}},
+      {{7, 40}, {90, 43}, {88, 50}, {5, 47}}};
+  // The rotated boxes of the fast score mode
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dis(0.0f, 1.0f);
+  for (int i = 0; i < 200; ++i) {
+    cv::RotatedRect rect(cv::Point2f(5 + dis(gen) * 87, 5 + dis(gen) * 73),
+                         cv::Size2f(2 + dis(gen) * 58, 2 + dis(gen) * 28),
+                         dis(gen) * 180);
+    cv::Point2f points[4];
+    rect.points(points);
+    std::vector<cv::Point> box(4);
+    for (int k = 0; k < 4; ++k) {
+      box[k].x = std::min(std::max(static_cast<int>(points[k].x), 0), 96);
+      box[k].y = std::min(std::max(static_cast<int>(points[k].y), 0), 82);
+    }
+    polygons.push_back(box);
+  }
+  CheckPolygonScores(pred, polygons);
+}
+
+TEST(fastdeploy, ocr_polygon_score_concave) {
+  cv::Mat pred = RandomPred(83, 97, 1);
+  std::vector<std::vector<cv::Point>> polygons = {
+      {{10, 10}, {50, 10}, {50, 20}, {20, 20}, {20, 60}, {10, 60}},
+      {{48, 2}, {58, 30}, {90, 32}, {64, 50}, {74, 80},
+       {48, 62}, {22, 80}, {32, 50}, {6, 32}, {38, 30}},
+      {{3, 3}, {90, 8}, {40, 20}, {85, 70}, {10, 75}}};
+  // The contours of the slow score mode, found in a bitmap of random
+  // ellipses
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> dis(0, 96);
+  cv::Mat bitmap = cv::Mat::zeros(83, 97, CV_8UC1);
+  for (int i = 0; i < 12; ++i) {
+    cv::ellipse(bitmap, cv::Point(dis(gen), dis(gen) % 83),
+                cv::Size(2 + dis(gen) % 18, 2 + dis(gen) % 10),
+                dis(gen) * 1.8, 0, 360, cv::Scalar(255), -1);
+  }
+  std::vector<std::vector<cv::Point>> contours;
+  cv::findContours(bitmap, contours, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE);
+  for (const auto& contour : contours) {
+    if (contour.size() > 2) {
+      polygons.push_back(contour);
+    }
+  }
+  CheckPolygonScores(pred, polygons);
+}
+
+}  // namespace fastdeploy
@@ -0,0 +1,195 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+// A model without runtime, which outputs the input frames of each window as
+// PP-MSVSR, or the center frame of each window as EDVR
+class RoundTripVSR : public vision::sr::PPMSVSR {
+ public:
+  explicit RoundTripVSR(bool center_frame)
+      : center_frame_output_(center_frame) {
+    mean_ = {0.0f, 0.0f, 0.0f};
+    scale_ = {1.0f, 1.0f, 1.0f};
+    initialized = true;
+  }
+
+  TensorInfo InputInfoOfRuntime(int index) override {
+    TensorInfo info;
+    info.name = "lqs";
+    info.shape = {1, -1, 3, -1, -1};
+    return info;
+  }
+
+  TensorInfo OutputInfoOfRuntime(int index) override {
+    TensorInfo info;
+    info.name = "out";
+    if (center_frame_output_) {
+      info.shape = {1, 3, -1, -1};
+    } else {
+      info.shape = {1, -1, 3, -1, -1};
+    }
+    return info;
+  }
+
+  bool Infer(std::vector<FDTensor>& inputs,
+             std::vector<FDTensor>* outputs) override {
+    const std::vector<int64_t>& shape = inputs[0].shape;
+    int64_t frame_size = shape[2] * shape[3] * shape[4];
+    const float* data = static_cast<const float*>(inputs[0].Data());
+    // The first value of each frame is its index in the stream
+    std::vector<int> window;
+    for (int64_t i = 0; i < shape[1]; ++i) {
+      float first = data[i * frame_size] * 255;
+      window.push_back(static_cast<int>(std::lround(first)));
+    }
+    windows.push_back(window);
+    outputs->resize(1);
+    if (center_frame_output_) {
+      (*outputs)[0].Resize({1, shape[2], shape[3], shape[4]}, FDDataType::FP32);
+      std::memcpy((*outputs)[0].Data(), data + shape[1] / 2 * frame_size,
+                  frame_size * sizeof(float));
+    } else {
+      (*outputs)[0].Resize(shape, FDDataType::FP32);
+      std::memcpy((*outputs)[0].Data(), data, inputs[0].Nbytes());
+    }
+    return true;
+  }
+
+  // The frame indices of the windows fed to Infer
+  std::vector<std::vector<int>> windows;
+
+ private:
+  bool center_frame_output_;
+};
+
+static std::vector<cv::Mat> TestFrames(int num_frames) {
+  std::vector<cv::Mat> frames;
+  for (int i = 0; i < num_frames; ++i) {
+    cv::Mat frame(4, 5, CV_8UC3);
+    uint8_t* data = frame.ptr<uint8_t>(0);
+    for (int k = 0; k < 60; ++k) {
+      data[k] = static_cast<uint8_t>((i * 37 + k * 11) % 256);
+    }
+    // The R value of the first pixel is the index of the frame
+    data[2] = static_cast<uint8_t>(i);
+    frames.push_back(frame);
+  }
+  return frames;
+}
+
+static bool SameFrame(const cv::Mat& a, const cv::Mat& b) {
+  return a.rows == b.rows && a.cols == b.cols && a.type() == b.type() &&
+         std::memcmp(a.ptr<uint8_t>(0), b.ptr<uint8_t>(0),
+                     a.total() * 3) == 0;
+}
+
+// Push the frames, flush the stream, and check every frame is output once in
+// order
+static void CheckStream(RoundTripVSR* model, const std::vector<cv::Mat>& frames,
+                        int window_size, int stride) {
+  ASSERT_TRUE(model->SetStreamWindow(window_size, stride));
+  std::vector<cv::Mat> results;
+  cv::Mat result;
+  for (const auto& frame : frames) {
+    ASSERT_TRUE(model->PushFrame(frame));
+    while (model->PopFrame(&result)) {
+      results.push_back(result);
+    }
+  }
+  ASSERT_TRUE(model->FlushStream());
+  while (model->PopFrame(&result)) {
+    results.push_back(result);
+  }
+  ASSERT_EQ(results.size(), frames.size());
+  for (size_t i = 0; i < frames.size(); ++i) {
+    ASSERT_TRUE(SameFrame(results[i], frames[i]));
+  }
+}
+
+TEST(fastdeploy, ppmsvsr_stream) {
+  for (int num_frames = 1; num_frames <= 12; ++num_frames) {
+    std::vector<cv::Mat> frames = TestFrames(num_frames);
+    for (int window_size = 1; window_size <= 5; ++window_size) {
+      for (int stride = 1; stride <= window_size; ++stride) {
+        RoundTripVSR model(false);
+        CheckStream(&model, frames, window_size, stride);
+        // All the windows are completed windows of the stream, except the
+        // one flushed for a stream shorter than one window
+        for (const auto& window : model.windows) {
+          for (size_t i = 0; i < window.size(); ++i) {
+            ASSERT_EQ(window[i], window[0] + static_cast<int>(i));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(fastdeploy, ppmsvsr_stream_center_frame) {
+  for (int num_frames = 1; num_frames <= 12; ++num_frames) {
+    std::vector<cv::Mat> frames = TestFrames(num_frames);
+    for (int window_size = 1; window_size <= 5; ++window_size) {
+      RoundTripVSR model(true);
+      ASSERT_FALSE(model.SetStreamWindow(window_size, 2));
+      CheckStream(&model, frames, window_size, 1);
+      // One window for each frame, the frames out of the stream are padded
+      // by the first or the last frame
+      ASSERT_EQ(model.windows.size(), frames.size());
+      for (int center = 0; center < num_frames; ++center) {
+        const std::vector<int>& window = model.windows[center];
+        ASSERT_EQ(window.size(), static_cast<size_t>(window_size));
+        for (int i = 0; i < window_size; ++i) {
+          int expected = std::min(std::max(center - window_size / 2 + i, 0),
+                                  num_frames - 1);
+          ASSERT_EQ(window[i], expected);
+        }
+      }
+    }
+  }
+}
+
+TEST(fastdeploy, ppmsvsr_stream_center_frame_latency) {
+  // The frame is output as soon as its window is completed
+  std::vector<cv::Mat> frames = TestFrames(8);
+  RoundTripVSR model(true);
+  ASSERT_TRUE(model.SetStreamWindow(5, 1));
+  cv::Mat result;
+  int num_results = 0;
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_TRUE(model.PushFrame(frames[i]));
+    while (model.PopFrame(&result)) {
+      ASSERT_TRUE(SameFrame(result, frames[num_results]));
+      ++num_results;
+    }
+    ASSERT_EQ(num_results, std::max(i - 1, 0));
+  }
+  ASSERT_TRUE(model.FlushStream());
+  while (model.PopFrame(&result)) {
+    ASSERT_TRUE(SameFrame(result, frames[num_results]));
+    ++num_results;
+  }
+  ASSERT_EQ(num_results, 8);
+}
+
+}  // namespace fastdeploy
@@ -0,0 +1,143 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+static std::string WriteDeployConfig(const std::string& output_op) {
+  std::string path =
+      testing::TempDir() + "test_vision_ppseg_" + output_op + ".yaml";
+  std::ofstream fout(path);
+  fout << "Deploy:\n  output_op: " << output_op << "\n";
+  return path;
+}
+
+// The straightforward postprocess: argmax over channels with the first max
+// class kept on ties, optional softmax, then cv::resize to the input shape
+static void ReferencePostprocess(const float* logits, int channels,
+                                 int height, int width, bool softmax,
+                                 int out_height, int out_width,
+                                 cv::Mat* label_map, cv::Mat* score_map) {
+  cv::Mat label(height, width, CV_8UC1);
+  cv::Mat score(height, width, CV_32FC1);
+  int hw = height * width;
+  for (int i = 0; i < hw; ++i) {
+    int best = 0;
+    for (int c = 1; c < channels; ++c) {
+      if (logits[c * hw + i] > logits[best * hw + i]) {
+        best = c;
+      }
+    }
+    float value = logits[best * hw + i];
+    if (softmax) {
+      double sum = 0.0;
+      for (int c = 0; c < channels; ++c) {
+        sum += std::exp(logits[c * hw + i]);
+      }
+      value = static_cast<float>(std::exp(value) / sum);
+    }
+    label.data[i] = static_cast<uint8_t>(best);
+    reinterpret_cast<float*>(score.data)[i] = value;
+  }
+  cv::resize(label, *label_map, cv::Size(out_width, out_height), 0, 0,
+             cv::INTER_NEAREST);
+  cv::resize(score, *score_map, cv::Size(out_width, out_height), 0, 0,
+             cv::INTER_NEAREST);
+}
+
+TEST(fastdeploy, vision_ppseg_postprocessor) {
+  // Odd width to cover the tail of vectorized argmax, and the small integer
+  // logits have many ties
+  const int batch = 2;
+  const int channels = 5;
+  const int height = 7;
+  const int width = 11;
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> dist(-3, 3);
+  FDTensor logits;
+  logits.Allocate({batch, channels, height, width}, FDDataType::FP32);
+  float* data = reinterpret_cast<float*>(logits.MutableData());
+  for (int i = 0; i < logits.Numel(); ++i) {
+    data[i] = static_cast<float>(dist(rng)) * 0.5f;
+  }
+  // The first image keeps the inference shape, the second one is upsampled
+  std::map<std::string, std::vector<std::array<int, 2>>> imgs_info;
+  imgs_info["shape_info"] = {{height, width}, {16, 25}};
+
+  for (std::string output_op : {"none", "softmax"}) {
+    std::string config = WriteDeployConfig(output_op);
+    vision::segmentation::PaddleSegPostprocessor postprocessor(config);
+    std::remove(config.c_str());
+    postprocessor.SetStoreScoreMap(true);
+    postprocessor.SetApplySoftmax(true);
+    std::vector<vision::SegmentationResult> results;
+    ASSERT_TRUE(postprocessor.Run({logits}, &results, imgs_info));
+    ASSERT_EQ(results.size(), batch);
+    // The softmax is only applied while the model doesn't output it
+    bool softmax = output_op == "none";
+    for (int i = 0; i < batch; ++i) {
+      int out_height = imgs_info["shape_info"][i][0];
+      int out_width = imgs_info["shape_info"][i][1];
+      cv::Mat label_map, score_map;
+      ReferencePostprocess(data + i * channels * height * width, channels,
+                           height, width, softmax, out_height, out_width,
+                           &label_map, &score_map);
+      const auto& result = results[i];
+      ASSERT_EQ(result.shape, std::vector<int64_t>({out_height, out_width}));
+      ASSERT_TRUE(result.contain_score_map);
+      for (int j = 0; j < out_height * out_width; ++j) {
+        ASSERT_EQ(result.label_map[j], label_map.data[j]);
+        ASSERT_NEAR(result.score_map[j],
+                    reinterpret_cast<float*>(score_map.data)[j], 1e-6);
+      }
+    }
+  }
+
+  // The label map exported with argmax
+  std::string config = WriteDeployConfig("argmax");
+  vision::segmentation::PaddleSegPostprocessor postprocessor(config);
+  std::remove(config.c_str());
+  FDTensor labels;
+  labels.Allocate({batch, height, width}, FDDataType::INT64);
+  int64_t* label_data = reinterpret_cast<int64_t*>(labels.MutableData());
+  for (int i = 0; i < labels.Numel(); ++i) {
+    label_data[i] = i % channels;
+  }
+  std::vector<vision::SegmentationResult> results;
+  ASSERT_TRUE(postprocessor.Run({labels}, &results, imgs_info));
+  cv::Mat label(height, width, CV_8UC1);
+  for (int j = 0; j < height * width; ++j) {
+    label.data[j] = static_cast<uint8_t>(label_data[height * width + j]);
+  }
+  cv::Mat label_map;
+  cv::resize(label, label_map, cv::Size(25, 16), 0, 0, cv::INTER_NEAREST);
+  ASSERT_FALSE(results[1].contain_score_map);
+  for (int j = 0; j < 16 * 25; ++j) {
+    ASSERT_EQ(results[1].label_map[j], label_map.data[j]);
+  }
+  // The logits can't be the output of the model exported with argmax
+  ASSERT_FALSE(postprocessor.Run({logits}, &results, imgs_info));
+}
+
+}  // namespace fastdeploy
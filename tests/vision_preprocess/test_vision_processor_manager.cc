@@ -0,0 +1,124 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+class TestProcessorManager : public vision::ProcessorManager {
+ public:
+  explicit TestProcessorManager(bool each_mat = false, bool resize = true)
+      : each_mat_(each_mat) {
+    if (resize) {
+      processors_.push_back(std::make_shared<vision::Resize>(224, 224));
+    }
+    processors_.push_back(std::make_shared<vision::NormalizeAndPermute>(
+        std::vector<float>({0.485f, 0.456f, 0.406f}),
+        std::vector<float>({0.229f, 0.224f, 0.225f})));
+  }
+
+  bool Apply(vision::FDMatBatch* image_batch,
+             std::vector<FDTensor>* outputs) override {
+    if (each_mat_) {
+      if (!ApplyToEachMat(image_batch, processors_)) {
+        return false;
+      }
+    } else {
+      for (size_t i = 0; i < processors_.size(); ++i) {
+        if (!(*(processors_[i].get()))(image_batch)) {
+          return false;
+        }
+      }
+    }
+    outputs->resize(1);
+    FDTensor* tensor = image_batch->Tensor();
+    (*outputs)[0].SetExternalData(tensor->Shape(), tensor->Dtype(),
+                                  tensor->Data(), tensor->device,
+                                  tensor->device_id);
+    return true;
+  }
+
+ private:
+  bool each_mat_;
+  std::vector<std::shared_ptr<vision::Processor>> processors_;
+};
+
+TEST(fastdeploy, processor_manager_preprocess_threads) {
+  CheckShape check_shape;
+  CheckData check_data;
+
+  std::vector<cv::Mat> mats(8);
+  for (size_t i = 0; i < mats.size(); ++i) {
+    mats[i].create(480 + i * 8, 640, CV_8UC3);
+    cv::randu(mats[i], cv::Scalar::all(0), cv::Scalar::all(255));
+  }
+
+  TestProcessorManager serial;
+  ASSERT_FALSE(serial.SetPreprocessThreads(0));
+  std::vector<vision::FDMat> images = vision::WrapMat(mats);
+  std::vector<FDTensor> expected;
+  ASSERT_TRUE(serial.Run(&images, &expected));
+
+  TestProcessorManager parallel;
+  ASSERT_TRUE(parallel.SetPreprocessThreads(4));
+  images = vision::WrapMat(mats);
+  std::vector<FDTensor> outputs;
+  ASSERT_TRUE(parallel.Run(&images, &outputs));
+
+  check_shape(expected[0].shape, outputs[0].shape);
+  check_data(reinterpret_cast<const float*>(expected[0].Data()),
+             reinterpret_cast<const float*>(outputs[0].Data()),
+             expected[0].Numel());
+}
+
+TEST(fastdeploy, processor_manager_apply_to_each_mat) {
+  CheckShape check_shape;
+  CheckData check_data;
+
+  std::vector<cv::Mat> mats(8);
+  for (size_t i = 0; i < mats.size(); ++i) {
+    mats[i].create(480 + i * 8, 640, CV_8UC3);
+    cv::randu(mats[i], cv::Scalar::all(0), cv::Scalar::all(255));
+  }
+
+  TestProcessorManager serial;
+  std::vector<vision::FDMat> images = vision::WrapMat(mats);
+  std::vector<FDTensor> expected;
+  ASSERT_TRUE(serial.Run(&images, &expected));
+
+  for (int threads : {1, 4}) {
+    TestProcessorManager each_mat(true);
+    ASSERT_TRUE(each_mat.SetPreprocessThreads(threads));
+    images = vision::WrapMat(mats);
+    std::vector<FDTensor> outputs;
+    ASSERT_TRUE(each_mat.Run(&images, &outputs));
+    check_shape(expected[0].shape, outputs[0].shape);
+    check_data(reinterpret_cast<const float*>(expected[0].Data()),
+               reinterpret_cast<const float*>(outputs[0].Data()),
+               expected[0].Numel());
+  }
+
+  // The images are not resized to the same shape
+  TestProcessorManager no_resize(true, false);
+  ASSERT_TRUE(no_resize.SetPreprocessThreads(4));
+  images = vision::WrapMat(mats);
+  std::vector<FDTensor> outputs;
+  ASSERT_FALSE(no_resize.Run(&images, &outputs));
+}
+
+}  // namespace fastdeploy
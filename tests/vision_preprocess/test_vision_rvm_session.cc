@@ -0,0 +1,217 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+static const int kHeight = 4;
+static const int kWidth = 5;
+
+// A model without runtime, its outputs are
+//   fgr: the input image
+//   pha: the first channel of the input image plus the first value of r1i
+//   r(k)o: r(k)i broadcasted to [n, k + 1, h, w] plus 1
+// so the number of frames inferred by a session is counted by its states
+class FakeRobustVideoMatting : public vision::matting::RobustVideoMatting {
+ public:
+  FakeRobustVideoMatting() {
+    size = {kWidth, kHeight};
+    video_mode = true;
+    swap_rb = true;
+    initialized = true;
+  }
+
+  int NumInputsOfRuntime() override { return 6; }
+
+  TensorInfo InputInfoOfRuntime(int index) override {
+    TensorInfo info;
+    info.name = "input" + std::to_string(index);
+    return info;
+  }
+
+  bool Infer(std::vector<FDTensor>& inputs,
+             std::vector<FDTensor>* outputs) override {
+    int64_t batch = inputs[0].shape[0];
+    int64_t hw = inputs[0].shape[2] * inputs[0].shape[3];
+    batches.push_back(batch);
+    const float* src = static_cast<const float*>(inputs[0].Data());
+    const FDTensor& r1 = inputs[1];
+    int64_t r1_numel = r1.Numel() / r1.shape[0];
+    if (fail_advanced_sessions && r1_numel > 1) {
+      return false;
+    }
+    outputs->resize(6);
+    (*outputs)[0].Resize(inputs[0].shape, FDDataType::FP32);
+    std::memcpy((*outputs)[0].Data(), src, inputs[0].Nbytes());
+    (*outputs)[1].Resize({batch, 1, inputs[0].shape[2], inputs[0].shape[3]},
+                         FDDataType::FP32);
+    float* pha = static_cast<float*>((*outputs)[1].Data());
+    for (int64_t b = 0; b < batch; ++b) {
+      float state = static_cast<const float*>(r1.Data())[b * r1_numel];
+      for (int64_t i = 0; i < hw; ++i) {
+        pha[b * hw + i] = src[b * 3 * hw + i] + state;
+      }
+    }
+    for (int k = 0; k < 4; ++k) {
+      const FDTensor& state = inputs[k + 1];
+      int64_t state_numel = state.Numel() / state.shape[0];
+      int64_t numel = (k + 1) * hw;
+      FDTensor& output = (*outputs)[k + 2];
+      output.Resize({batch, k + 1, inputs[0].shape[2], inputs[0].shape[3]},
+                    FDDataType::FP32);
+      const float* state_data = static_cast<const float*>(state.Data());
+      float* output_data = static_cast<float*>(output.Data());
+      for (int64_t b = 0; b < batch; ++b) {
+        for (int64_t i = 0; i < numel; ++i) {
+          output_data[b * numel + i] =
+              state_data[b * state_numel + (state_numel == 1 ? 0 : i)] + 1;
+        }
+      }
+    }
+    return true;
+  }
+
+  std::vector<int64_t> batches;
+  bool fail_advanced_sessions = false;
+};
+
+static cv::Mat TestFrame(int index) {
+  cv::Mat frame(kHeight, kWidth, CV_8UC3);
+  uint8_t* data = frame.ptr<uint8_t>(0);
+  for (int i = 0; i < kHeight * kWidth * 3; ++i) {
+    data[i] = static_cast<uint8_t>((index * 37 + i * 11) % 256);
+  }
+  return frame;
+}
+
+// Check the result of the frame which is the num_frames-th frame of its
+// session
+static void CheckResult(const vision::MattingResult& result,
+                        const cv::Mat& frame, int num_frames) {
+  ASSERT_TRUE(result.contain_foreground);
+  ASSERT_EQ(result.shape, std::vector<int64_t>({kHeight, kWidth, 3}));
+  const uint8_t* data = frame.ptr<uint8_t>(0);
+  for (int i = 0; i < kHeight * kWidth; ++i) {
+    // The foreground is HWC in RGB order, while the frame is BGR
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_FLOAT_EQ(result.foreground[i * 3 + c],
+                      data[i * 3 + 2 - c] / 255.0f);
+    }
+    ASSERT_FLOAT_EQ(result.alpha[i], data[i * 3 + 2] / 255.0f + num_frames);
+  }
+}
+
+static void CheckSameResult(const vision::MattingResult& a,
+                            const vision::MattingResult& b) {
+  ASSERT_EQ(a.shape, b.shape);
+  ASSERT_EQ(a.alpha, b.alpha);
+  ASSERT_EQ(a.foreground, b.foreground);
+}
+
+TEST(fastdeploy, rvm_batch_predict) {
+  FakeRobustVideoMatting batched;
+  FakeRobustVideoMatting single;
+  std::vector<int> batched_sessions;
+  std::vector<int> single_sessions;
+  std::vector<int> num_frames;
+  for (int t = 0; t < 4; ++t) {
+    // A new session joins at each step, whose initial states differ from the
+    // others in shape, so the frames are inferred in two batches
+    batched_sessions.push_back(batched.CreateSession());
+    single_sessions.push_back(single.CreateSession());
+    num_frames.push_back(0);
+    std::vector<cv::Mat> frames;
+    for (size_t i = 0; i < batched_sessions.size(); ++i) {
+      frames.push_back(TestFrame(t * 7 + i));
+    }
+    batched.batches.clear();
+    std::vector<vision::MattingResult> results;
+    ASSERT_TRUE(batched.BatchPredict(batched_sessions, frames, &results));
+    ASSERT_EQ(results.size(), frames.size());
+    if (t > 0) {
+      ASSERT_EQ(batched.batches, std::vector<int64_t>({1, t}));
+    }
+    for (size_t i = 0; i < frames.size(); ++i) {
+      vision::MattingResult result;
+      ASSERT_TRUE(single.Predict(single_sessions[i], frames[i], &result));
+      CheckResult(results[i], frames[i], num_frames[i]);
+      CheckSameResult(results[i], result);
+      ++num_frames[i];
+    }
+  }
+}
+
+TEST(fastdeploy, rvm_batch_predict_failure) {
+  FakeRobustVideoMatting model;
+  int advanced = model.CreateSession();
+  vision::MattingResult result;
+  ASSERT_TRUE(model.Predict(advanced, TestFrame(0), &result));
+  int fresh = model.CreateSession();
+
+  // The batch of the advanced session is inferred after the batch of the
+  // fresh session, and fails
+  model.fail_advanced_sessions = true;
+  std::vector<vision::MattingResult> results;
+  std::vector<cv::Mat> frames = {TestFrame(1), TestFrame(2)};
+  ASSERT_FALSE(model.BatchPredict({advanced, fresh}, frames, &results));
+
+  // None of the sessions is advanced by the failed prediction
+  model.fail_advanced_sessions = false;
+  ASSERT_TRUE(model.BatchPredict({advanced, fresh}, frames, &results));
+  CheckResult(results[0], frames[0], 1);
+  CheckResult(results[1], frames[1], 0);
+
+  // Invalid inputs are rejected before any inference
+  model.batches.clear();
+  ASSERT_FALSE(model.BatchPredict({advanced, fresh}, {frames[0], cv::Mat()},
+                                  &results));
+  ASSERT_FALSE(model.BatchPredict({advanced, advanced}, frames, &results));
+  ASSERT_FALSE(model.BatchPredict({advanced, fresh + 1}, frames, &results));
+  ASSERT_TRUE(model.batches.empty());
+  ASSERT_TRUE(model.BatchPredict({advanced, fresh}, frames, &results));
+  CheckResult(results[0], frames[0], 2);
+  CheckResult(results[1], frames[1], 1);
+}
+
+TEST(fastdeploy, rvm_session) {
+  FakeRobustVideoMatting model;
+  int session = model.CreateSession();
+  vision::MattingResult result;
+  cv::Mat frame = TestFrame(0);
+  for (int t = 0; t < 3; ++t) {
+    ASSERT_TRUE(model.Predict(session, frame, &result));
+    CheckResult(result, frame, t);
+  }
+  ASSERT_TRUE(model.ResetSession(session));
+  ASSERT_TRUE(model.Predict(session, frame, &result));
+  CheckResult(result, frame, 0);
+  // The states are not updated without video mode
+  model.video_mode = false;
+  for (int t = 0; t < 2; ++t) {
+    ASSERT_TRUE(model.Predict(session, frame, &result));
+    CheckResult(result, frame, 1);
+  }
+  ASSERT_TRUE(model.ReleaseSession(session));
+  ASSERT_FALSE(model.ReleaseSession(session));
+  ASSERT_FALSE(model.Predict(session, frame, &result));
+}
+
+}  // namespace fastdeploy
@@ -0,0 +1,200 @@
+// Copyright (c) 2022 PaddlePaddle Authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <random>
+#include <vector>
+#include "fastdeploy/vision.h"
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+#include "gtest_utils.h"
+
+namespace fastdeploy {
+
+using vision::DetectionResult;
+using vision::detection::LetterBoxInfo;
+
+static LetterBoxInfo TestLetterBox() {
+  LetterBoxInfo letter_box;
+  letter_box.scale = 0.5f;
+  letter_box.pad_w = 16.0f;
+  letter_box.pad_h = 8.0f;
+  letter_box.ipt_w = 1280.0f;
+  letter_box.ipt_h = 720.0f;
+  return letter_box;
+}
+
+// The scores are multiples of 1/8, so that many classes tie on the max score
+static std::vector<float> RandomScores(int size, int seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dis(0, 8);
+  std::vector<float> data(size);
+  for (auto& v : data) {
+    v = dis(gen) / 8.0f;
+  }
+  return data;
+}
+
+static void ReferenceAddBox(float cx, float cy, float w, float h, float score,
+                            int32_t label, const LetterBoxInfo& letter_box,
+                            DetectionResult* result) {
+  result->boxes.emplace_back(std::array<float, 4>{
+      (cx - w / 2.0f - letter_box.pad_w) / letter_box.scale,
+      (cy - h / 2.0f - letter_box.pad_h) / letter_box.scale,
+      (cx + w / 2.0f - letter_box.pad_w) / letter_box.scale,
+      (cy + h / 2.0f - letter_box.pad_h) / letter_box.scale});
+  result->scores.push_back(score);
+  result->label_ids.push_back(label);
+}
+
+// The straightforward decode of YOLOv5 without the objectness filter, the
+// first max class is kept on ties
+static void ReferenceDecodeYOLOv5(const float* data, int num_rows,
+                                  int row_size, int num_classes,
+                                  float conf_threshold, bool multi_label,
+                                  const LetterBoxInfo& letter_box,
+                                  DetectionResult* result,
+                                  std::vector<int32_t>* rows) {
+  for (int i = 0; i < num_rows; ++i) {
+    const float* s = data + i * row_size;
+    int best = 0;
+    for (int j = 0; j < num_classes; ++j) {
+      float confidence = s[4] * s[5 + j];
+      if (multi_label && confidence > conf_threshold) {
+        ReferenceAddBox(s[0], s[1], s[2], s[3], confidence, j, letter_box,
+                        result);
+        rows->push_back(i);
+      }
+      if (s[5 + j] > s[5 + best]) {
+        best = j;
+      }
+    }
+    float confidence = s[4] * s[5 + best];
+    if (!multi_label && confidence > conf_threshold) {
+      ReferenceAddBox(s[0], s[1], s[2], s[3], confidence, best, letter_box,
+                      result);
+      rows->push_back(i);
+    }
+  }
+}
+
+// The straightforward decode of YOLOv8 on the transposed output
+static void ReferenceDecodeYOLOv8(const float* data, int num_anchors,
+                                  int num_classes, float conf_threshold,
+                                  bool multi_label,
+                                  const LetterBoxInfo& letter_box,
+                                  DetectionResult* result) {
+  for (int i = 0; i < num_anchors; ++i) {
+    float cx = data[i];
+    float cy = data[num_anchors + i];
+    float w = data[2 * num_anchors + i];
+    float h = data[3 * num_anchors + i];
+    const float* s = data + 4 * num_anchors + i;
+    int best = 0;
+    for (int c = 1; c < num_classes; ++c) {
+      if (s[c * num_anchors] > s[best * num_anchors]) {
+        best = c;
+      }
+    }
+    if (s[best * num_anchors] <= conf_threshold) {
+      continue;
+    }
+    if (!multi_label) {
+      ReferenceAddBox(cx, cy, w, h, s[best * num_anchors], best, letter_box,
+                      result);
+      continue;
+    }
+    for (int c = 0; c < num_classes; ++c) {
+      if (s[c * num_anchors] > conf_threshold) {
+        ReferenceAddBox(cx, cy, w, h, s[c * num_anchors], c, letter_box,
+                        result);
+      }
+    }
+  }
+}
+
+static void CheckResultEqual(const DetectionResult& result,
+                             const DetectionResult& expected) {
+  ASSERT_EQ(result.boxes.size(), expected.boxes.size());
+  ASSERT_EQ(result.scores, expected.scores);
+  ASSERT_EQ(result.label_ids, expected.label_ids);
+  for (size_t i = 0; i < result.boxes.size(); ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(result.boxes[i][j], expected.boxes[i][j]);
+    }
+  }
+}
+
+TEST(fastdeploy, yolo_decode_yolov5) {
+  LetterBoxInfo letter_box = TestLetterBox();
+  // The numbers of rows and classes are not multiples of the SIMD width,
+  // and the extra values at the end of rows stand for the mask coefficients
+  // of YOLOv5Seg
+  const int num_rows_list[] = {1, 7, 8, 1003};
+  const int num_classes_list[] = {1, 3, 80};
+  for (int num_rows : num_rows_list) {
+    for (int num_classes : num_classes_list) {
+      for (int extra : {0, 5}) {
+        int row_size = 5 + num_classes + extra;
+        std::vector<float> data =
+            RandomScores(num_rows * row_size, num_rows * 131 + num_classes);
+        for (int i = 0; i < num_rows; ++i) {
+          for (int j = 0; j < 4; ++j) {
+            data[i * row_size + j] *= 640.0f;
+          }
+        }
+        for (bool multi_label : {false, true}) {
+          DetectionResult result, expected;
+          std::vector<int32_t> rows, expected_rows;
+          vision::detection::DecodeYOLOv5Output(
+              data.data(), num_rows, row_size, num_classes, 0.25f,
+              multi_label, letter_box, &result, &rows);
+          ReferenceDecodeYOLOv5(data.data(), num_rows, row_size, num_classes,
+                                0.25f, multi_label, letter_box, &expected,
+                                &expected_rows);
+          CheckResultEqual(result, expected);
+          ASSERT_EQ(rows, expected_rows);
+        }
+      }
+    }
+  }
+}
+
+TEST(fastdeploy, yolo_decode_yolov8) {
+  LetterBoxInfo letter_box = TestLetterBox();
+  // The anchors are split into chunks of 256, and the last anchors of each
+  // chunk are left to the scalar tail of the argmax
+  const int num_anchors_list[] = {1, 3, 8, 13, 256, 300, 8400 + 5};
+  const int num_classes_list[] = {1, 2, 80};
+  for (int num_anchors : num_anchors_list) {
+    for (int num_classes : num_classes_list) {
+      std::vector<float> data = RandomScores(
+          (4 + num_classes) * num_anchors, num_anchors * 131 + num_classes);
+      for (int i = 0; i < 4 * num_anchors; ++i) {
+        data[i] *= 640.0f;
+      }
+      for (bool multi_label : {false, true}) {
+        DetectionResult result, expected;
+        vision::detection::DecodeYOLOv8Output(data.data(), num_anchors,
+                                              num_classes, 0.25f, multi_label,
+                                              letter_box, &result);
+        ReferenceDecodeYOLOv8(data.data(), num_anchors, num_classes, 0.25f,
+                              multi_label, letter_box, &expected);
+        CheckResultEqual(result, expected);
+      }
+    }
+  }
+}
+
+}  // namespace fastdeploy